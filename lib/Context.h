@@ -6,6 +6,9 @@
 #include "meta/Notification.h"
 #include "meta/Meta.h"
 
+#include <mutex>
+#include <shared_mutex>
+
 namespace sairedis
 {
     class Context
@@ -42,5 +45,15 @@ namespace sairedis
             std::shared_ptr<RedisRemoteSaiInterface> m_redisSai;
 
             std::function<sai_switch_notifications_t(std::shared_ptr<Notification>, Context*)> m_notificationCallback;
+
+            /**
+             * @brief Context mutex.
+             *
+             * Api calls which modify metadata and notifications take this
+             * mutex exclusively, read only queries (stats and capabilities)
+             * take it shared and can execute concurrently with each other.
+             * Calls on different contexts can execute concurrently.
+             */
+            std::shared_timed_mutex m_mutex;
     };
 }
@@ -714,6 +714,77 @@ void Recorder::recordGenericClearStatsResponse(
     recordLine("Q|clear_stats|" + sai_serialize_status(status));
 }
 
+void Recorder::recordBulkGenericGetStats(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& arguments)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_recordStats)
+        return;
+
+    recordLine("q|bulk_get_stats|" + key + "|" + Globals::joinFieldValues(arguments));
+}
+
+void Recorder::recordBulkGenericGetStatsResponse(
+        _In_ sai_status_t status,
+        _In_ uint32_t objectCount,
+        _In_ const sai_status_t *objectStatuses,
+        _In_ uint32_t numberOfCounters,
+        _In_ const uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_recordStats)
+        return;
+
+    std::string joined;
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        joined += "|" + sai_serialize_status(objectStatuses[idx]) + "=";
+
+        if (objectStatuses[idx] == SAI_STATUS_SUCCESS)
+        {
+            joined += sai_serialize_counter_list(numberOfCounters, counters + (size_t)idx * numberOfCounters);
+        }
+    }
+
+    recordLine("Q|bulk_get_stats|" + sai_serialize_status(status) + joined);
+}
+
+void Recorder::recordBulkGenericClearStats(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& arguments)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_recordStats)
+        return;
+
+    recordLine("q|bulk_clear_stats|" + key + "|" + Globals::joinFieldValues(arguments));
+}
+
+void Recorder::recordBulkGenericClearStatsResponse(
+        _In_ sai_status_t status,
+        _In_ uint32_t objectCount,
+        _In_ const sai_status_t *objectStatuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_recordStats)
+        return;
+
+    std::string joined;
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        joined += "|" + sai_serialize_status(objectStatuses[idx]);
+    }
+
+    recordLine("Q|bulk_clear_stats|" + sai_serialize_status(status) + joined);
+}
+
 void Recorder::recordNotification(
         _In_ const std::string &name,
         _In_ const std::string &serializedNotification,
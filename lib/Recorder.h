@@ -240,6 +240,26 @@ namespace sairedis
             void recordGenericClearStatsResponse(
                     _In_ sai_status_t status);
 
+            void recordBulkGenericGetStats(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments);
+
+            void recordBulkGenericGetStatsResponse(
+                    _In_ sai_status_t status,
+                    _In_ uint32_t objectCount,
+                    _In_ const sai_status_t *objectStatuses,
+                    _In_ uint32_t numberOfCounters,
+                    _In_ const uint64_t *counters);
+
+            void recordBulkGenericClearStats(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments);
+
+            void recordBulkGenericClearStatsResponse(
+                    _In_ sai_status_t status,
+                    _In_ uint32_t objectCount,
+                    _In_ const sai_status_t *objectStatuses);
+
         public: // SAI bulk API
 
             void recordBulkGenericCreate(
@@ -5,6 +5,7 @@
 #include "SkipRecordAttrContainer.h"
 #include "SwitchContainer.h"
 #include "ZeroMQChannel.h"
+#include "RedisScanner.h"
 
 #include "sairediscommon.h"
 
@@ -16,6 +17,8 @@
 
 #include <inttypes.h>
 
+#define TABLE_DUMP_SCAN_COUNT 1000
+
 using namespace sairedis;
 using namespace saimeta;
 using namespace sairediscommon;
@@ -860,6 +863,8 @@ sai_status_t RedisRemoteSaiInterface::objectTypeGetAvailability(
 
     // Syncd will pop this argument off before trying to deserialize the attribute list
 
+    std::lock_guard<std::mutex> lock(m_channelMutex);
+
     m_recorder->recordObjectTypeGetAvailability(switchId, objectType, attrCount, attrList);
     // recordObjectTypeGetAvailability(strSwitchId, entry);
 
@@ -939,6 +944,8 @@ sai_status_t RedisRemoteSaiInterface::queryAttributeCapability(
     // This query will not put any data into the ASIC view, just into the
     // message queue
 
+    std::lock_guard<std::mutex> lock(m_channelMutex);
+
     m_recorder->recordQueryAttributeCapability(switchId, objectType, attrId, capability);
 
     m_communicationChannel->set(switchIdStr, entry, REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY);
@@ -1028,6 +1035,8 @@ sai_status_t RedisRemoteSaiInterface::queryAattributeEnumValuesCapability(
     // This query will not put any data into the ASIC view, just into the
     // message queue
 
+    std::lock_guard<std::mutex> lock(m_channelMutex);
+
     m_recorder->recordQueryAattributeEnumValuesCapability(switchId, objectType, attrId, enumValuesCapability);
 
     m_communicationChannel->set(switch_id_str, entry, REDIS_ASIC_STATE_COMMAND_ATTR_ENUM_VALUES_CAPABILITY_QUERY);
@@ -1120,6 +1129,8 @@ sai_status_t RedisRemoteSaiInterface::getStats(
 
     // get_stats will not put data to asic view, only to message queue
 
+    std::lock_guard<std::mutex> lock(m_channelMutex);
+
     m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET_STATS);
 
     return waitForGetStatsResponse(number_of_counters, counters);
@@ -1224,9 +1235,25 @@ sai_status_t RedisRemoteSaiInterface::bulkGetStats(
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_ERROR("not implemented");
+    auto key = sai_serialize_object_type(object_type) + ":" + sai_serialize_object_id(switchId);
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    auto entries = serializeBulkStats(object_count, object_key, number_of_counters, counter_ids, mode);
+
+    SWSS_LOG_DEBUG("bulk get stats key: %s, objects: %u", key.c_str(), object_count);
+
+    // bulk_get_stats will not put data to asic view, only to message queue
+
+    std::lock_guard<std::mutex> lock(m_channelMutex);
+
+    m_recorder->recordBulkGenericGetStats(key, entries);
+
+    m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_GET_STATS);
+
+    auto status = waitForBulkStatsResponse(object_count, number_of_counters, object_statuses, counters);
+
+    m_recorder->recordBulkGenericGetStatsResponse(status, object_count, object_statuses, number_of_counters, counters);
+
+    return status;
 }
 
 sai_status_t RedisRemoteSaiInterface::bulkClearStats(
@@ -1241,9 +1268,95 @@ sai_status_t RedisRemoteSaiInterface::bulkClearStats(
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_ERROR("not implemented");
+    auto key = sai_serialize_object_type(object_type) + ":" + sai_serialize_object_id(switchId);
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    auto entries = serializeBulkStats(object_count, object_key, number_of_counters, counter_ids, mode);
+
+    SWSS_LOG_DEBUG("bulk clear stats key: %s, objects: %u", key.c_str(), object_count);
+
+    m_recorder->recordBulkGenericClearStats(key, entries);
+
+    m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_CLEAR_STATS);
+
+    auto status = waitForBulkStatsResponse(object_count, 0, object_statuses, nullptr);
+
+    m_recorder->recordBulkGenericClearStatsResponse(status, object_count, object_statuses);
+
+    return status;
+}
+
+std::vector<swss::FieldValueTuple> RedisRemoteSaiInterface::serializeBulkStats(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode)
+{
+    SWSS_LOG_ENTER();
+
+    // counter ids are sent as numbers, so syncd don't need to look up enum
+    // names for every object
+
+    std::vector<uint64_t> ids(counter_ids, counter_ids + number_of_counters);
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    entries.reserve(object_count + 1);
+
+    entries.emplace_back(
+            sai_serialize_enum(mode, &sai_metadata_enum_sai_stats_mode_t),
+            sai_serialize_counter_list(number_of_counters, ids.data()));
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        entries.emplace_back(sai_serialize_object_id(object_key[idx].key.object_id), "");
+    }
+
+    return entries;
+}
+
+sai_status_t RedisRemoteSaiInterface::waitForBulkStatsResponse(
+        _In_ uint32_t object_count,
+        _In_ uint32_t number_of_counters,
+        _Out_ sai_status_t *object_statuses,
+        _Out_ uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+
+    auto &values = kfvFieldsValues(kco);
+
+    if (values.size() != object_count)
+    {
+        if (status == SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_THROW("wrong number of statuses, got %zu, expected %u", values.size(), object_count);
+        }
+
+        // request was rejected as a whole
+
+        for (uint32_t idx = 0; idx < object_count; idx++)
+        {
+            object_statuses[idx] = status;
+        }
+
+        return status;
+    }
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        sai_deserialize_status(fvField(values[idx]), object_statuses[idx]);
+
+        if (counters && object_statuses[idx] == SAI_STATUS_SUCCESS)
+        {
+            sai_deserialize_counter_list(fvValue(values[idx]), number_of_counters, counters + (size_t)idx * number_of_counters);
+        }
+    }
+
+    return status;
 }
 
 sai_status_t RedisRemoteSaiInterface::waitForClearStatsResponse()
@@ -2209,25 +2322,57 @@ void RedisRemoteSaiInterface::refreshTableDump()
 
     SWSS_LOG_TIMER("get asic view from %s", ASIC_STATE_TABLE);
 
-    swss::Table table(m_db.get(), ASIC_STATE_TABLE);
+    auto& map = m_tableDump;
 
-    swss::TableDump dump;
+    map.clear();
 
-    table.dump(dump);
+    /*
+     * Table dump is executed by single lua script, which blocks redis and
+     * builds whole reply in memory, which takes long time on large ASIC view.
+     * Instead keys are scanned in chunks and their hashes are fetched by
+     * pipeline, keys removed between chunks return empty hash and are
+     * skipped.
+     *
+     * Unlike lua dump, this is not atomic snapshot. Connecting with
+     * init=false expects view which is not modified during connect, like
+     * after syncd applied view and before orchagent starts; when other
+     * client modifies view at the same time, dump can contain only part of
+     * its changes and local metadata will not match ASIC view.
+     */
 
-    auto& map = m_tableDump;
+    const std::string prefix = ASIC_STATE_TABLE ":";
 
-    map.clear();
+    std::vector<std::pair<std::string, std::unordered_map<std::string, std::string>>> entries;
+
+    std::string cursor = "0";
 
-    for (auto& key: dump)
+    do
     {
-        sai_object_meta_key_t mk;
-        sai_deserialize_object_meta_key(key.first, mk);
+        cursor = RedisScanner::scanHashes(m_db.get(), cursor, prefix + "*", TABLE_DUMP_SCAN_COUNT, entries);
+
+        for (auto& entry: entries)
+        {
+            if (entry.second.empty())
+            {
+                continue;
+            }
 
-        auto switchVID = switchIdQuery(mk.objectkey.key.object_id);
+            std::string key = entry.first.substr(prefix.size());
 
-        map[switchVID][key.first] = key.second;
+            sai_object_meta_key_t mk;
+            sai_deserialize_object_meta_key(key, mk);
+
+            auto switchVID = switchIdQuery(mk.objectkey.key.object_id);
+
+            auto& fields = map[switchVID][key];
+
+            for (auto& fv: entry.second)
+            {
+                fields[fv.first] = std::move(fv.second);
+            }
+        }
     }
+    while (cursor != "0");
 
     SWSS_LOG_NOTICE("%s switch count: %zu:", ASIC_STATE_TABLE, map.size());
 
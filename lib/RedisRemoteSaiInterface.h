@@ -20,6 +20,7 @@
 #include <memory>
 #include <functional>
 #include <map>
+#include <mutex>
 
 namespace sairedis
 {
@@ -310,6 +311,19 @@ namespace sairedis
 
             sai_status_t waitForClearStatsResponse();
 
+            sai_status_t waitForBulkStatsResponse(
+                    _In_ uint32_t object_count,
+                    _In_ uint32_t number_of_counters,
+                    _Out_ sai_status_t *object_statuses,
+                    _Out_ uint64_t *counters);
+
+            static std::vector<swss::FieldValueTuple> serializeBulkStats(
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t *counter_ids,
+                    _In_ sai_stats_mode_t mode);
+
         private: // non QUAD API response
 
             sai_status_t waitForFlushFdbEntriesResponse();
@@ -386,6 +400,15 @@ namespace sairedis
 
             std::shared_ptr<Channel> m_communicationChannel;
 
+            /**
+             * @brief Communication channel mutex.
+             *
+             * Channel is single request/response pipe, so read only queries
+             * executed concurrently under shared context lock must still send
+             * request and wait for response one at a time.
+             */
+            std::mutex m_channelMutex;
+
             uint64_t m_responseTimeoutMs;
 
             std::function<sai_switch_notifications_t(std::shared_ptr<Notification>)> m_notificationCallback;
@@ -0,0 +1,140 @@
+#include "RedisScanner.h"
+
+#include "swss/logger.h"
+#include "swss/redisreply.h"
+
+#include <algorithm>
+
+using namespace sairedis;
+
+std::string RedisScanner::scan(
+        _In_ swss::DBConnector* db,
+        _In_ const std::string& cursor,
+        _In_ const std::string& pattern,
+        _In_ uint32_t count,
+        _Out_ std::vector<std::string>& keys)
+{
+    SWSS_LOG_ENTER();
+
+    keys.clear();
+
+    swss::RedisCommand scan;
+
+    scan.format(std::vector<std::string>{ "SCAN", cursor, "MATCH", pattern, "COUNT", std::to_string(count) });
+
+    swss::RedisReply r(db, scan, REDIS_REPLY_ARRAY);
+
+    redisReply* reply = r.getContext();
+
+    if (reply->elements != 2)
+    {
+        SWSS_LOG_THROW("unexpected SCAN reply elements count: %zu", reply->elements);
+    }
+
+    redisReply* chunk = reply->element[1];
+
+    for (size_t idx = 0; idx < chunk->elements; idx++)
+    {
+        keys.emplace_back(chunk->element[idx]->str, chunk->element[idx]->len);
+    }
+
+    return reply->element[0]->str;
+}
+
+std::vector<std::string> RedisScanner::keys(
+        _In_ swss::DBConnector* db,
+        _In_ const std::string& pattern,
+        _In_ uint32_t count)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> keys;
+
+    std::vector<std::string> chunk;
+
+    std::string cursor = "0";
+
+    do
+    {
+        cursor = scan(db, cursor, pattern, count, chunk);
+
+        keys.insert(keys.end(), chunk.begin(), chunk.end());
+    }
+    while (cursor != "0");
+
+    // SCAN can return the same key more than once
+
+    std::sort(keys.begin(), keys.end());
+
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    return keys;
+}
+
+std::string RedisScanner::scanHashes(
+        _In_ swss::DBConnector* db,
+        _In_ const std::string& cursor,
+        _In_ const std::string& pattern,
+        _In_ uint32_t count,
+        _Out_ std::vector<std::pair<std::string, std::unordered_map<std::string, std::string>>>& hashes)
+{
+    SWSS_LOG_ENTER();
+
+    hashes.clear();
+
+    std::vector<std::string> keys;
+
+    auto next = scan(db, cursor, pattern, count, keys);
+
+    redisContext* ctx = db->getContext();
+
+    for (auto& key: keys)
+    {
+        swss::RedisCommand hgetall;
+
+        hgetall.format(std::vector<std::string>{ "HGETALL", key });
+
+        if (redisAppendFormattedCommand(ctx, hgetall.c_str(), hgetall.length()) != REDIS_OK)
+        {
+            SWSS_LOG_THROW("failed to append HGETALL command: %s", ctx->errstr);
+        }
+
+        hashes.emplace_back(key, std::unordered_map<std::string, std::string>());
+    }
+
+    // all replies are read even when one fails, so connection stays usable
+
+    std::string error;
+
+    for (auto& hash: hashes)
+    {
+        redisReply* reply = nullptr;
+
+        if (redisGetReply(ctx, (void**)&reply) != REDIS_OK || reply == nullptr)
+        {
+            SWSS_LOG_THROW("failed to get HGETALL reply: %s", ctx->errstr);
+        }
+
+        swss::RedisReply r(reply);
+
+        if (reply->type != REDIS_REPLY_ARRAY)
+        {
+            error = "unexpected HGETALL reply type for key " + hash.first;
+            continue;
+        }
+
+        for (size_t idx = 0; idx + 1 < reply->elements; idx += 2)
+        {
+            hash.second.emplace(
+                    std::string(reply->element[idx]->str, reply->element[idx]->len),
+                    std::string(reply->element[idx + 1]->str, reply->element[idx + 1]->len));
+        }
+    }
+
+    if (error.size())
+    {
+        SWSS_LOG_THROW("%s", error.c_str());
+    }
+
+    return next;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "swss/dbconnector.h"
+#include "swss/sal.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sairedis
+{
+    /**
+     * @brief Iterate redis keys using SCAN.
+     *
+     * Unlike KEYS, SCAN returns keys in small chunks, so redis is not blocked
+     * for the whole key space and other clients are served between chunks.
+     * Keys created or removed during iteration may or may not be returned.
+     */
+    class RedisScanner
+    {
+        private:
+
+            RedisScanner() = delete;
+            ~RedisScanner() = delete;
+
+        public:
+
+            /**
+             * @brief Scan next chunk of keys matching pattern.
+             *
+             * Scan starts and ends with cursor "0", count is only a hint for
+             * redis how many keys to return. Single key can be returned in
+             * more than one chunk.
+             *
+             * @return Cursor to be passed to next call.
+             */
+            static std::string scan(
+                    _In_ swss::DBConnector* db,
+                    _In_ const std::string& cursor,
+                    _In_ const std::string& pattern,
+                    _In_ uint32_t count,
+                    _Out_ std::vector<std::string>& keys);
+
+            /**
+             * @brief Get all keys matching pattern, chunk by chunk.
+             *
+             * Returned keys are sorted and unique.
+             */
+            static std::vector<std::string> keys(
+                    _In_ swss::DBConnector* db,
+                    _In_ const std::string& pattern,
+                    _In_ uint32_t count);
+
+            /**
+             * @brief Scan next chunk of keys matching pattern and get their
+             * hashes.
+             *
+             * Hashes are fetched by single pipeline per chunk. Key removed
+             * between SCAN and HGETALL is returned with empty hash.
+             *
+             * Chunks are read at different times, so all chunks together are
+             * not atomic snapshot: when keys are modified during iteration,
+             * result can contain object created after its referencing object
+             * was skipped, or miss object which existed whole time only in
+             * its old state. Caller must not rely on consistency between
+             * chunks unless writers are stopped.
+             *
+             * @return Cursor to be passed to next call.
+             */
+            static std::string scanHashes(
+                    _In_ swss::DBConnector* db,
+                    _In_ const std::string& cursor,
+                    _In_ const std::string& pattern,
+                    _In_ uint32_t count,
+                    _Out_ std::vector<std::pair<std::string, std::unordered_map<std::string, std::string>>>& hashes);
+    };
+}
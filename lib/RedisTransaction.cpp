@@ -0,0 +1,237 @@
+#include "RedisTransaction.h"
+
+#include "swss/logger.h"
+#include "swss/rediscommand.h"
+#include "swss/redisreply.h"
+
+#include <cstring>
+
+using namespace sairedis;
+
+RedisTransaction::RedisTransaction(
+        _In_ const swss::DBConnector* db,
+        _In_ size_t bufferSize):
+    m_db(db->newConnector(0)),
+    m_bufferSize(bufferSize),
+    m_pending(0),
+    m_commands(0),
+    m_multi(false)
+{
+    SWSS_LOG_ENTER();
+
+    if (bufferSize == 0)
+    {
+        SWSS_LOG_THROW("buffer size must be greater than zero");
+    }
+}
+
+RedisTransaction::~RedisTransaction()
+{
+    SWSS_LOG_ENTER();
+
+    // not executed transaction is discarded by redis when connection is
+    // closed, nothing is written
+}
+
+void RedisTransaction::push(
+        _In_ const std::vector<std::string>& args)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_multi)
+    {
+        append({ "MULTI" });
+
+        m_pending++;
+
+        m_multi = true;
+    }
+
+    append(args);
+
+    m_pending++;
+
+    m_commands++;
+
+    if (m_pending < m_bufferSize)
+    {
+        return;
+    }
+
+    auto error = readQueuedReplies();
+
+    if (error.empty())
+    {
+        return;
+    }
+
+    // redis will refuse EXEC of this transaction anyway
+
+    discard();
+
+    SWSS_LOG_THROW("failed to queue command in transaction: %s", error.c_str());
+}
+
+void RedisTransaction::exec()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_multi)
+    {
+        return;
+    }
+
+    append({ "EXEC" });
+
+    auto error = readQueuedReplies();
+
+    redisContext* ctx = m_db->getContext();
+
+    redisReply* reply = nullptr;
+
+    // state is reset before reading reply, since transaction is finished by
+    // EXEC even when it fails
+
+    reset();
+
+    if (redisGetReply(ctx, (void**)&reply) != REDIS_OK || reply == nullptr)
+    {
+        SWSS_LOG_THROW("failed to get EXEC reply: %s", ctx->errstr);
+    }
+
+    swss::RedisReply r(reply);
+
+    if (error.size())
+    {
+        // EXEC reply is EXECABORT error, nothing was applied
+
+        SWSS_LOG_THROW("failed to queue command in transaction: %s", error.c_str());
+    }
+
+    if (reply->type == REDIS_REPLY_ERROR)
+    {
+        SWSS_LOG_THROW("EXEC failed: %s", reply->str);
+    }
+
+    if (reply->type != REDIS_REPLY_ARRAY)
+    {
+        SWSS_LOG_THROW("unexpected EXEC reply type: %d", reply->type);
+    }
+
+    for (size_t idx = 0; idx < reply->elements; idx++)
+    {
+        if (reply->element[idx]->type == REDIS_REPLY_ERROR)
+        {
+            SWSS_LOG_THROW("command %zu in transaction failed: %s", idx, reply->element[idx]->str);
+        }
+    }
+}
+
+void RedisTransaction::discard()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_multi)
+    {
+        return;
+    }
+
+    append({ "DISCARD" });
+
+    // errors of queued commands don't matter, since they are discarded
+
+    readQueuedReplies();
+
+    redisContext* ctx = m_db->getContext();
+
+    redisReply* reply = nullptr;
+
+    reset();
+
+    if (redisGetReply(ctx, (void**)&reply) != REDIS_OK || reply == nullptr)
+    {
+        SWSS_LOG_THROW("failed to get DISCARD reply: %s", ctx->errstr);
+    }
+
+    swss::RedisReply r(reply);
+
+    if (reply->type != REDIS_REPLY_STATUS || strcmp(reply->str, "OK") != 0)
+    {
+        SWSS_LOG_THROW("DISCARD failed: %s", reply->str ? reply->str : "unexpected reply");
+    }
+}
+
+size_t RedisTransaction::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_commands;
+}
+
+void RedisTransaction::append(
+        _In_ const std::vector<std::string>& args)
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisCommand command;
+
+    command.format(args);
+
+    redisContext* ctx = m_db->getContext();
+
+    if (redisAppendFormattedCommand(ctx, command.c_str(), command.length()) != REDIS_OK)
+    {
+        SWSS_LOG_THROW("failed to append %s command: %s", args.at(0).c_str(), ctx->errstr);
+    }
+}
+
+std::string RedisTransaction::readQueuedReplies()
+{
+    SWSS_LOG_ENTER();
+
+    redisContext* ctx = m_db->getContext();
+
+    // all replies are read even when one fails, so connection stays usable
+
+    std::string error;
+
+    for (; m_pending > 0; m_pending--)
+    {
+        redisReply* reply = nullptr;
+
+        if (redisGetReply(ctx, (void**)&reply) != REDIS_OK || reply == nullptr)
+        {
+            SWSS_LOG_THROW("failed to get reply: %s", ctx->errstr);
+        }
+
+        swss::RedisReply r(reply);
+
+        if (error.size())
+        {
+            continue;
+        }
+
+        // MULTI replies OK, all other commands QUEUED
+
+        if (reply->type == REDIS_REPLY_ERROR)
+        {
+            error = reply->str;
+        }
+        else if (reply->type != REDIS_REPLY_STATUS ||
+                (strcmp(reply->str, "QUEUED") != 0 && strcmp(reply->str, "OK") != 0))
+        {
+            error = "unexpected reply type " + std::to_string(reply->type);
+        }
+    }
+
+    return error;
+}
+
+void RedisTransaction::reset()
+{
+    SWSS_LOG_ENTER();
+
+    m_multi = false;
+
+    m_commands = 0;
+}
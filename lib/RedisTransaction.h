@@ -0,0 +1,100 @@
+#pragma once
+
+#include "swss/dbconnector.h"
+#include "swss/sal.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sairedis
+{
+    /**
+     * @brief Pipelined redis MULTI/EXEC transaction.
+     *
+     * Commands are appended to connection output buffer and their replies
+     * are read only when buffer is full or on exec/discard, so the whole
+     * transaction takes just few round trips.
+     *
+     * Inside MULTI redis replies "+QUEUED" to every command instead of the
+     * command result, and results are returned by EXEC as array. Those
+     * replies are checked here, since swss::RedisPipeline expects "+OK" for
+     * every status reply.
+     *
+     * Transaction uses its own connection, so other commands executed on
+     * the source connector are not part of transaction.
+     */
+    class RedisTransaction
+    {
+        public:
+
+            RedisTransaction(
+                    _In_ const swss::DBConnector* db,
+                    _In_ size_t bufferSize);
+
+            virtual ~RedisTransaction();
+
+        public:
+
+            /**
+             * @brief Queue command in transaction.
+             *
+             * MULTI is sent before first command. When queuing of any command
+             * fails, transaction is discarded and exception is thrown.
+             */
+            void push(
+                    _In_ const std::vector<std::string>& args);
+
+            /**
+             * @brief Execute queued commands.
+             *
+             * Redis doesn't roll back transaction, so when single command
+             * fails, all other commands are still applied and exception is
+             * thrown. Does nothing if no command was queued.
+             */
+            void exec();
+
+            /**
+             * @brief Discard queued commands.
+             *
+             * Does nothing if no command was queued.
+             */
+            void discard();
+
+            /**
+             * @brief Number of commands queued in current transaction.
+             */
+            size_t size() const;
+
+        private:
+
+            void append(
+                    _In_ const std::vector<std::string>& args);
+
+            /**
+             * @brief Read replies of all appended commands.
+             *
+             * @return Error of first failed command, empty string if all
+             * commands were queued.
+             */
+            std::string readQueuedReplies();
+
+            void reset();
+
+        private:
+
+            std::unique_ptr<swss::DBConnector> m_db;
+
+            size_t m_bufferSize;
+
+            /**
+             * @brief Appended commands (including MULTI) which replies were
+             * not read yet.
+             */
+            size_t m_pending;
+
+            size_t m_commands;
+
+            bool m_multi;
+    };
+}
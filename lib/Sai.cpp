@@ -16,7 +16,7 @@ using namespace std::placeholders;
         SWSS_LOG_ERROR("%s: api not initialized", __PRETTY_FUNCTION__);     \
         return SAI_STATUS_FAILURE; }
 
-#define REDIS_CHECK_CONTEXT(oid)                                            \
+#define REDIS_GET_CONTEXT(oid)                                              \
     auto _globalContext = VirtualObjectIdManager::getGlobalContext(oid);    \
     auto context = getContext(_globalContext);                              \
     if (context == nullptr) {                                               \
@@ -25,6 +25,17 @@ using namespace std::placeholders;
                 sai_serialize_object_id(oid).c_str());                      \
         return SAI_STATUS_FAILURE; }
 
+#define REDIS_CHECK_CONTEXT(oid)                                            \
+    REDIS_GET_CONTEXT(oid)                                                  \
+    CONTEXT_MUTEX(context);
+
+// read only queries which don't modify metadata, get is not one of them since
+// post get validation inserts switch internal objects into metadata
+
+#define REDIS_CHECK_CONTEXT_SHARED(oid)                                     \
+    REDIS_GET_CONTEXT(oid)                                                  \
+    CONTEXT_SHARED_MUTEX(context);
+
 #define REDIS_CHECK_POINTER(pointer)                                        \
     if ((pointer) == nullptr) {                                             \
         SWSS_LOG_ERROR("entry pointer " # pointer " is null");              \
@@ -87,13 +98,17 @@ sai_status_t Sai::initialize(
 
     auto ccc = ContextConfigContainer::loadFromFile(contextConfig);
 
+    auto contextMap = std::make_shared<std::map<uint32_t, std::shared_ptr<Context>>>();
+
     for (auto&cc: ccc->getAllContextConfigs())
     {
         auto context = std::make_shared<Context>(cc, m_recorder, std::bind(&Sai::handle_notification, this, _1, _2));
 
-        m_contextMap[cc->m_guid] = context;
+        (*contextMap)[cc->m_guid] = context;
     }
 
+    std::atomic_store(&m_contextMap, std::shared_ptr<const std::map<uint32_t, std::shared_ptr<Context>>>(contextMap));
+
     m_apiInitialized = true;
 
     return SAI_STATUS_SUCCESS;
@@ -101,12 +116,24 @@ sai_status_t Sai::initialize(
 
 sai_status_t Sai::uninitialize(void)
 {
+    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
     SWSS_LOG_NOTICE("begin");
 
-    m_contextMap.clear();
+    auto contextMap = getContextMap();
+
+    std::atomic_store(&m_contextMap, std::shared_ptr<const std::map<uint32_t, std::shared_ptr<Context>>>());
+
+    // new api calls will not find any context, wait for api calls which are
+    // in progress, contexts still referenced by them will be destroyed when
+    // those calls will finish
+
+    for (auto& kvp: *contextMap)
+    {
+        CONTEXT_MUTEX(kvp.second);
+    }
 
     m_recorder = nullptr;
 
@@ -126,15 +153,17 @@ sai_status_t Sai::create(
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
-    REDIS_CHECK_CONTEXT(switchId);
+    // context must be selected before acquiring context mutex, since switch
+    // create can explicitly request different context
+
+    uint32_t globalContext = VirtualObjectIdManager::getGlobalContext(switchId);
 
     if (objectType == SAI_OBJECT_TYPE_SWITCH && attr_count > 0 && attr_list)
     {
-        uint32_t globalContext = 0; // default
+        globalContext = 0; // default
 
         if (attr_list[attr_count - 1].id == SAI_REDIS_SWITCH_ATTR_CONTEXT)
         {
@@ -142,17 +171,19 @@ sai_status_t Sai::create(
         }
 
         SWSS_LOG_NOTICE("request switch create with context %u", globalContext);
+    }
 
-        context = getContext(globalContext);
+    auto context = getContext(globalContext);
 
-        if (context == nullptr)
-        {
-            SWSS_LOG_ERROR("no global context defined at index %u", globalContext);
+    if (context == nullptr)
+    {
+        SWSS_LOG_ERROR("no global context defined at index %u", globalContext);
 
-            return SAI_STATUS_FAILURE;
-        }
+        return SAI_STATUS_FAILURE;
     }
 
+    CONTEXT_MUTEX(context);
+
     auto status = context->m_meta->create(
             objectType,
             objectId,
@@ -184,7 +215,6 @@ sai_status_t Sai::remove(
         _In_ sai_object_type_t objectType,
         _In_ sai_object_id_t objectId)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(objectId);
@@ -197,30 +227,26 @@ sai_status_t Sai::set(
         _In_ sai_object_id_t objectId,
         _In_ const sai_attribute_t *attr)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
     if (RedisRemoteSaiInterface::isRedisAttribute(objectType, attr))
     {
-        if (attr->id == SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE)
-        {
-            // Since communication mode destroys current channel and creates
-            // new one, it may happen, that during this SET api execution when
-            // api mutex is acquired, channel destructor will be blocking on
-            // thread->join() and channel thread will start processing
-            // incoming notification. That notification will be synchronized
-            // with api mutex and will cause deadlock, so to mitigate this
-            // scenario we will unlock api mutex here.
-            //
-            // This is not the perfect, but assuming that communication mode is
-            // changed in single thread and before switch create then we should
-            // not hit race condition.
-
-            SWSS_LOG_NOTICE("unlocking api mutex for communication mode");
-
-            MUTEX_UNLOCK();
-        }
+        MUTEX();
+
+        // Since communication mode destroys current channel and creates new
+        // one, it may happen, that during this SET api execution when context
+        // mutex is acquired, channel destructor will be blocking on
+        // thread->join() and channel thread will start processing incoming
+        // notification. That notification will be synchronized with context
+        // mutex and will cause deadlock, so to mitigate this scenario we will
+        // not acquire context mutex for communication mode.
+        //
+        // This is not the perfect, but assuming that communication mode is
+        // changed in single thread and before switch create then we should
+        // not hit race condition.
+
+        bool lockContext = (attr->id != SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE);
 
         // skip metadata if attribute is redis extension attribute
 
@@ -229,8 +255,15 @@ sai_status_t Sai::set(
 
         bool success = true;
 
-        for (auto& kvp: m_contextMap)
+        for (auto& kvp: *getContextMap())
         {
+            std::unique_lock<std::shared_timed_mutex> lock(kvp.second->m_mutex, std::defer_lock);
+
+            if (lockContext)
+            {
+                lock.lock();
+            }
+
             sai_status_t status = kvp.second->m_redisSai->set(objectType, objectId, attr);
 
             success &= (status == SAI_STATUS_SUCCESS);
@@ -254,7 +287,6 @@ sai_status_t Sai::get(
         _In_ uint32_t attr_count,
         _Inout_ sai_attribute_t *attr_list)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(objectId);
@@ -274,7 +306,6 @@ sai_status_t Sai::create(                                           \
         _In_ uint32_t attr_count,                                   \
         _In_ const sai_attribute_t *attr_list)                      \
 {                                                                   \
-    MUTEX();                                                        \
     SWSS_LOG_ENTER();                                               \
     REDIS_CHECK_API_INITIALIZED();                                  \
     REDIS_CHECK_POINTER(entry)                                      \
@@ -288,7 +319,6 @@ SAIREDIS_DECLARE_EVERY_ENTRY(DECLARE_CREATE_ENTRY);
 sai_status_t Sai::remove(                                   \
         _In_ const sai_ ## ot ## _t* entry)                 \
 {                                                           \
-    MUTEX();                                                \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entry)                              \
@@ -303,7 +333,6 @@ sai_status_t Sai::set(                                      \
         _In_ const sai_ ## ot ## _t* entry,                 \
         _In_ const sai_attribute_t *attr)                   \
 {                                                           \
-    MUTEX();                                                \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entry)                              \
@@ -319,7 +348,6 @@ sai_status_t Sai::get(                                          \
         _In_ uint32_t attr_count,                               \
         _Inout_ sai_attribute_t *attr_list)                     \
 {                                                               \
-    MUTEX();                                                    \
     SWSS_LOG_ENTER();                                           \
     REDIS_CHECK_API_INITIALIZED();                              \
     REDIS_CHECK_POINTER(entry)                                  \
@@ -338,10 +366,9 @@ sai_status_t Sai::getStats(
         _In_ const sai_stat_id_t *counter_ids,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
-    REDIS_CHECK_CONTEXT(object_id);
+    REDIS_CHECK_CONTEXT_SHARED(object_id);
 
     return context->m_meta->getStats(
             object_type,
@@ -369,10 +396,9 @@ sai_status_t Sai::getStatsExt(
         _In_ sai_stats_mode_t mode,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
-    REDIS_CHECK_CONTEXT(object_id);
+    REDIS_CHECK_CONTEXT_SHARED(object_id);
 
     return context->m_meta->getStatsExt(
             object_type,
@@ -389,7 +415,6 @@ sai_status_t Sai::clearStats(
         _In_ uint32_t number_of_counters,
         _In_ const sai_stat_id_t *counter_ids)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
@@ -413,8 +438,19 @@ sai_status_t Sai::bulkGetStats(
         _Out_ uint64_t *counters)
 {
     SWSS_LOG_ENTER();
+    REDIS_CHECK_API_INITIALIZED();
+    REDIS_CHECK_CONTEXT_SHARED(switchId);
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return context->m_meta->bulkGetStats(
+            switchId,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses,
+            counters);
 }
 
 sai_status_t Sai::bulkClearStats(
@@ -428,8 +464,18 @@ sai_status_t Sai::bulkClearStats(
         _Inout_ sai_status_t *object_statuses)
 {
     SWSS_LOG_ENTER();
+    REDIS_CHECK_API_INITIALIZED();
+    REDIS_CHECK_CONTEXT(switchId);
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return context->m_meta->bulkClearStats(
+            switchId,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses);
 }
 
 // BULK QUAD OID
@@ -444,7 +490,6 @@ sai_status_t Sai::bulkCreate(
         _Out_ sai_object_id_t *object_id,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switch_id);
@@ -467,7 +512,6 @@ sai_status_t Sai::bulkRemove(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_POINTER(object_id);
@@ -489,7 +533,6 @@ sai_status_t Sai::bulkSet(
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(*object_id);
@@ -514,7 +557,6 @@ sai_status_t Sai::bulkCreate(                               \
         _In_ sai_bulk_op_error_mode_t mode,                 \
         _Out_ sai_status_t *object_statuses)                \
 {                                                           \
-    MUTEX();                                                \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entries)                            \
@@ -539,7 +581,6 @@ sai_status_t Sai::bulkRemove(                               \
         _In_ sai_bulk_op_error_mode_t mode,                 \
         _Out_ sai_status_t *object_statuses)                \
 {                                                           \
-    MUTEX();                                                \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entries)                            \
@@ -563,7 +604,6 @@ sai_status_t Sai::bulkSet(                                  \
         _In_ sai_bulk_op_error_mode_t mode,                 \
         _Out_ sai_status_t *object_statuses)                \
 {                                                           \
-    MUTEX();                                                \
     SWSS_LOG_ENTER();                                       \
     REDIS_CHECK_API_INITIALIZED();                          \
     REDIS_CHECK_POINTER(entries)                            \
@@ -585,7 +625,6 @@ sai_status_t Sai::flushFdbEntries(
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(switch_id);
@@ -605,10 +644,9 @@ sai_status_t Sai::objectTypeGetAvailability(
         _In_ const sai_attribute_t *attrList,
         _Out_ uint64_t *count)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
-    REDIS_CHECK_CONTEXT(switchId);
+    REDIS_CHECK_CONTEXT_SHARED(switchId);
 
     return context->m_meta->objectTypeGetAvailability(
             switchId,
@@ -624,10 +662,9 @@ sai_status_t Sai::queryAttributeCapability(
         _In_ sai_attr_id_t attr_id,
         _Out_ sai_attr_capability_t *capability)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
-    REDIS_CHECK_CONTEXT(switch_id);
+    REDIS_CHECK_CONTEXT_SHARED(switch_id);
 
     return context->m_meta->queryAttributeCapability(
             switch_id,
@@ -642,10 +679,9 @@ sai_status_t Sai::queryAattributeEnumValuesCapability(
         _In_ sai_attr_id_t attr_id,
         _Inout_ sai_s32_list_t *enum_values_capability)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
-    REDIS_CHECK_CONTEXT(switch_id);
+    REDIS_CHECK_CONTEXT_SHARED(switch_id);
 
     return context->m_meta->queryAattributeEnumValuesCapability(
             switch_id,
@@ -692,8 +728,10 @@ sai_status_t Sai::logSet(
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
-    for (auto&kvp: m_contextMap)
+    for (auto&kvp: *getContextMap())
     {
+        CONTEXT_MUTEX(kvp.second);
+
         kvp.second->m_meta->logSet(api, log_level);
     }
 
@@ -719,7 +757,7 @@ sai_switch_notifications_t Sai::handle_notification(
         _In_ std::shared_ptr<Notification> notification,
         _In_ Context* context)
 {
-    MUTEX();
+    CONTEXT_MUTEX(context);
     SWSS_LOG_ENTER();
 
     if (!m_apiInitialized)
@@ -737,14 +775,32 @@ std::shared_ptr<Context> Sai::getContext(
 {
     SWSS_LOG_ENTER();
 
-    auto it = m_contextMap.find(globalContext);
+    auto contextMap = getContextMap();
 
-    if (it == m_contextMap.end())
+    auto it = contextMap->find(globalContext);
+
+    if (it == contextMap->end())
         return nullptr;
 
     return it->second;
 }
 
+std::shared_ptr<const std::map<uint32_t, std::shared_ptr<Context>>> Sai::getContextMap()
+{
+    SWSS_LOG_ENTER();
+
+    auto contextMap = std::atomic_load(&m_contextMap);
+
+    if (contextMap == nullptr)
+    {
+        // api was uninitialized in the meantime
+
+        return std::make_shared<const std::map<uint32_t, std::shared_ptr<Context>>>();
+    }
+
+    return contextMap;
+}
+
 std::vector<swss::FieldValueTuple> serialize_counter_id_list(
         _In_ const sai_enum_metadata_t *stats_enum,
         _In_ uint32_t count,
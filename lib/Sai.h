@@ -13,6 +13,7 @@
 #include <memory>
 #include <mutex>
 #include <map>
+#include <atomic>
 
 namespace sairedis
 {
@@ -185,13 +186,28 @@ namespace sairedis
             std::shared_ptr<Context> getContext(
                     _In_ uint32_t globalContext);
 
+            std::shared_ptr<const std::map<uint32_t, std::shared_ptr<Context>>> getContextMap();
+
         private:
 
-            bool m_apiInitialized;
+            std::atomic<bool> m_apiInitialized;
 
+            /**
+             * @brief Api mutex.
+             *
+             * Guards only initialize/uninitialize and operations which apply
+             * to all contexts, api calls on specific context are guarded by
+             * context mutex.
+             */
             std::recursive_mutex m_apimutex;
 
-            std::map<uint32_t, std::shared_ptr<Context>> m_contextMap;
+            /**
+             * @brief Context map.
+             *
+             * Map is immutable after initialize and it's swapped atomically,
+             * so context lookup don't need any lock.
+             */
+            std::shared_ptr<const std::map<uint32_t, std::shared_ptr<Context>>> m_contextMap;
 
             sai_service_method_table_t m_service_method_table;
 
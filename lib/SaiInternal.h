@@ -2,3 +2,6 @@
 
 #define MUTEX() std::lock_guard<std::recursive_mutex> _lock(m_apimutex)
 #define MUTEX_UNLOCK() m_apimutex.unlock()
+
+#define CONTEXT_MUTEX(context) std::lock_guard<std::shared_timed_mutex> _ctxlock((context)->m_mutex)
+#define CONTEXT_SHARED_MUTEX(context) std::shared_lock<std::shared_timed_mutex> _ctxlock((context)->m_mutex)
@@ -37,6 +37,19 @@
 #define REDIS_ASIC_STATE_COMMAND_GET_STATS          "get_stats"
 #define REDIS_ASIC_STATE_COMMAND_CLEAR_STATS        "clear_stats"
 
+/*
+ * Bulk stats request:
+ *
+ * key:         object_type:switch_id
+ * field[0]:    stats mode, value: comma separated numeric counter ids
+ * field[1..]:  object_id, value: empty
+ *
+ * Response has object status as field and comma separated counter values as
+ * value (empty on bulk clear) for each object.
+ */
+#define REDIS_ASIC_STATE_COMMAND_BULK_GET_STATS     "bulk_get_stats"
+#define REDIS_ASIC_STATE_COMMAND_BULK_CLEAR_STATS   "bulk_clear_stats"
+
 #define REDIS_ASIC_STATE_COMMAND_GETRESPONSE        "getresponse"
 
 #define REDIS_ASIC_STATE_COMMAND_FLUSH              "flush"
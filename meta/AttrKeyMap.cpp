@@ -4,10 +4,29 @@
 
 using namespace saimeta;
 
+std::size_t AttrKeyPtrHash::operator()(
+        _In_ const std::string* key) const
+{
+    SWSS_LOG_ENTER();
+
+    return std::hash<std::string>()(*key);
+}
+
+bool AttrKeyPtrHash::operator()(
+        _In_ const std::string* a,
+        _In_ const std::string* b) const
+{
+    SWSS_LOG_ENTER();
+
+    return *a == *b;
+}
+
 void AttrKeyMap::clear()
 {
     SWSS_LOG_ENTER();
 
+    m_attrKeyIndex.clear();
+
     m_map.clear();
 }
 
@@ -17,39 +36,109 @@ void AttrKeyMap::insert(
 {
     SWSS_LOG_ENTER();
 
-    m_map[metaKey] = attrKey;
+    eraseMetaKey(metaKey);
+
+    auto& key = m_map[getSwitchId(attrKey)][metaKey];
+
+    key = attrKey;
+
+    // map nodes are not moved on rehash, so pointer stays valid until erase
+
+    m_attrKeyIndex.insert(&key);
 }
 
+void AttrKeyMap::eraseFromIndex(
+        _In_ const std::string& attrKey)
+{
+    SWSS_LOG_ENTER();
+
+    // the same key may be present under different meta keys, so erase
+    // entry pointing to this particular string
+
+    auto range = m_attrKeyIndex.equal_range(&attrKey);
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (*it == &attrKey)
+        {
+            m_attrKeyIndex.erase(it);
+
+            return;
+        }
+    }
+}
 
 void AttrKeyMap::eraseMetaKey(
         _In_ const std::string& metaKey)
 {
     SWSS_LOG_ENTER();
 
-    auto it = m_map.find(metaKey);
+    // there are only few switches, so check each partition
 
-    if (it != m_map.end())
+    for (auto& partition: m_map)
     {
+        auto it = partition.second.find(metaKey);
+
+        if (it == partition.second.end())
+        {
+            continue;
+        }
+
         SWSS_LOG_DEBUG("erasing attributes key %s", it->second.c_str());
 
-        m_map.erase(it);
+        eraseFromIndex(it->second);
+
+        partition.second.erase(it);
+
+        return;
     }
 }
 
+void AttrKeyMap::eraseSwitch(
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_map.find(switchId);
+
+    if (it == m_map.end())
+    {
+        return;
+    }
+
+    for (auto& kvp: it->second)
+    {
+        eraseFromIndex(kvp.second);
+    }
+
+    m_map.erase(it);
+}
+
 bool AttrKeyMap::attrKeyExists(
         _In_ const std::string& attrKey) const
 {
     SWSS_LOG_ENTER();
 
-    for (auto& it: m_map)
+    return m_attrKeyIndex.find(&attrKey) != m_attrKeyIndex.end();
+}
+
+sai_object_id_t AttrKeyMap::getSwitchId(
+        _In_ const std::string& attrKey)
+{
+    SWSS_LOG_ENTER();
+
+    auto pos = attrKey.find(';');
+
+    if (pos == std::string::npos || attrKey.compare(0, 4, "oid:") != 0)
     {
-        if (it.second == attrKey)
-        {
-            return true;
-        }
+        return SAI_NULL_OBJECT_ID;
     }
 
-    return false;
+    sai_object_id_t switchId;
+
+    sai_deserialize_object_id(attrKey.substr(0, pos), switchId);
+
+    return switchId;
 }
 
 std::string AttrKeyMap::constructKey(
@@ -160,9 +249,12 @@ std::vector<std::string> AttrKeyMap::getAllKeys() const
 
     std::vector<std::string> vec;
 
-    for (auto& it: m_map)
+    for (auto& partition: m_map)
     {
-        vec.push_back(it.first);
+        for (auto& it: partition.second)
+        {
+            vec.push_back(it.first);
+        }
     }
 
     return vec;
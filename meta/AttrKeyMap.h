@@ -7,9 +7,20 @@ extern "C" {
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace saimeta
 {
+    struct AttrKeyPtrHash
+    {
+        std::size_t operator()(
+                _In_ const std::string* key) const;
+
+        bool operator()(
+                _In_ const std::string* a,
+                _In_ const std::string* b) const;
+    };
+
     class AttrKeyMap
     {
         public:
@@ -18,6 +29,11 @@ namespace saimeta
 
             virtual ~AttrKeyMap() = default;
 
+        private:
+
+            AttrKeyMap(const AttrKeyMap&) = delete;
+            AttrKeyMap& operator=(const AttrKeyMap&) = delete;
+
         public:
 
             void clear();
@@ -43,10 +59,29 @@ namespace saimeta
 
             std::vector<std::string> getAllKeys() const;
 
+            /**
+             * @brief Erase all keys of given switch.
+             */
+            void eraseSwitch(
+                    _In_ sai_object_id_t switchId);
+
         private:
 
+            void eraseFromIndex(
+                    _In_ const std::string& attrKey);
+
             /**
-             * @brief map holding attribute keys.
+             * @brief Get switch id from attribute key.
+             *
+             * Constructed attribute key starts with switch id.
+             */
+            static sai_object_id_t getSwitchId(
+                    _In_ const std::string& attrKey);
+
+        private:
+
+            /**
+             * @brief map holding attribute keys per switch.
              *
              * Key is serialized meta key.
              *
@@ -56,6 +91,15 @@ namespace saimeta
              * object, we only have meta Key, and we can't construct attr Key (we
              * could since we have local db, but this way is safer).
              */
-            std::unordered_map<std::string, std::string> m_map;
+            std::unordered_map<sai_object_id_t, std::unordered_map<std::string, std::string>> m_map;
+
+            /**
+             * @brief Index of all attribute keys present in map.
+             *
+             * Contains pointers to attribute keys stored in map, so keys are
+             * not duplicated. Allows to check whether attribute key exists
+             * without iterating over entire map.
+             */
+            std::unordered_multiset<const std::string*, AttrKeyPtrHash, AttrKeyPtrHash> m_attrKeyIndex;
     };
 }
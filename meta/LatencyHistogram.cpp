@@ -0,0 +1,286 @@
+#include "LatencyHistogram.h"
+
+#include "swss/logger.h"
+
+#include <limits>
+#include <cmath>
+#include <algorithm>
+
+using namespace sairediscommon;
+
+std::mutex LatencyHistogramRegistry::m_mutex;
+
+std::atomic<bool> LatencyHistogramRegistry::m_enabled(true);
+
+std::map<std::string, std::unique_ptr<LatencyHistogram>> LatencyHistogramRegistry::m_histograms;
+
+LatencyHistogram::Snapshot::Snapshot():
+    m_count(0),
+    m_sum(0),
+    m_min(0),
+    m_max(0)
+{
+    SWSS_LOG_ENTER();
+
+    m_buckets.fill(0);
+}
+
+uint64_t LatencyHistogram::Snapshot::getValueAtPercentile(
+        _In_ double p) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_count == 0)
+    {
+        return 0;
+    }
+
+    p = std::min(std::max(p, 0.0), 100.0);
+
+    uint64_t target = (uint64_t)std::ceil(p / 100.0 * (double)m_count);
+
+    target = std::max(target, (uint64_t)1);
+
+    uint64_t total = 0;
+
+    for (size_t idx = 0; idx < BUCKET_COUNT; idx++)
+    {
+        total += m_buckets[idx];
+
+        if (total >= target)
+        {
+            return std::min(getBucketUpperBound(idx), m_max);
+        }
+    }
+
+    return m_max;
+}
+
+uint64_t LatencyHistogram::Snapshot::getMean() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count ? m_sum / m_count : 0;
+}
+
+void LatencyHistogram::Snapshot::merge(
+        _In_ const Snapshot& other)
+{
+    SWSS_LOG_ENTER();
+
+    if (other.m_count == 0)
+    {
+        return;
+    }
+
+    m_min = m_count ? std::min(m_min, other.m_min) : other.m_min;
+    m_max = std::max(m_max, other.m_max);
+
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+
+    for (size_t idx = 0; idx < BUCKET_COUNT; idx++)
+    {
+        m_buckets[idx] += other.m_buckets[idx];
+    }
+}
+
+LatencyHistogram::LatencyHistogram()
+{
+    SWSS_LOG_ENTER();
+
+    reset();
+}
+
+size_t LatencyHistogram::getBucketIndex(
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    if (value < 2 * SUB_BUCKET_COUNT)
+    {
+        return (size_t)value;
+    }
+
+    uint32_t msb = 63 - (uint32_t)__builtin_clzll(value);
+
+    uint32_t shift = msb - SUB_BUCKET_BITS;
+
+    // value >> shift is in range [SUB_BUCKET_COUNT, 2 * SUB_BUCKET_COUNT)
+
+    return (size_t)(((uint64_t)shift << SUB_BUCKET_BITS) + (value >> shift));
+}
+
+uint64_t LatencyHistogram::getBucketUpperBound(
+        _In_ size_t index)
+{
+    SWSS_LOG_ENTER();
+
+    if (index < 2 * SUB_BUCKET_COUNT)
+    {
+        return (uint64_t)index;
+    }
+
+    uint64_t shift = (index >> SUB_BUCKET_BITS) - 1;
+
+    uint64_t mantissa = index - (shift << SUB_BUCKET_BITS);
+
+    // for last bucket this wraps around to max 64 bit value
+
+    return ((mantissa + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    if (!LatencyHistogramRegistry::isEnabled())
+    {
+        return;
+    }
+
+    m_buckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+
+    m_count.fetch_add(1, std::memory_order_relaxed);
+
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t current = m_max.load(std::memory_order_relaxed);
+
+    while (value > current && !m_max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+        // current is updated by failed exchange
+    }
+
+    current = m_min.load(std::memory_order_relaxed);
+
+    while (value < current && !m_min.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+        // current is updated by failed exchange
+    }
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const
+{
+    SWSS_LOG_ENTER();
+
+    // snapshot taken while other threads are recording may be off by those
+    // few values, which is acceptable for statistics
+
+    Snapshot s;
+
+    for (size_t idx = 0; idx < BUCKET_COUNT; idx++)
+    {
+        s.m_buckets[idx] = m_buckets[idx].load(std::memory_order_relaxed);
+    }
+
+    s.m_count = m_count.load(std::memory_order_relaxed);
+    s.m_sum = m_sum.load(std::memory_order_relaxed);
+    s.m_max = m_max.load(std::memory_order_relaxed);
+    s.m_min = s.m_count ? m_min.load(std::memory_order_relaxed) : 0;
+
+    return s;
+}
+
+void LatencyHistogram::reset()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& bucket: m_buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+
+    m_count.store(0, std::memory_order_relaxed);
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+LatencyHistogram& LatencyHistogramRegistry::getHistogram(
+        _In_ const std::string& name)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto& histogram = m_histograms[name];
+
+    if (histogram == nullptr)
+    {
+        histogram = std::make_unique<LatencyHistogram>();
+    }
+
+    return *histogram;
+}
+
+std::map<std::string, LatencyHistogram::Snapshot> LatencyHistogramRegistry::snapshot()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::map<std::string, LatencyHistogram::Snapshot> snapshots;
+
+    for (auto& kvp: m_histograms)
+    {
+        snapshots[kvp.first] = kvp.second->snapshot();
+    }
+
+    return snapshots;
+}
+
+void LatencyHistogramRegistry::reset()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto& kvp: m_histograms)
+    {
+        kvp.second->reset();
+    }
+}
+
+void LatencyHistogramRegistry::setEnabled(
+        _In_ bool enabled)
+{
+    SWSS_LOG_ENTER();
+
+    m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool LatencyHistogramRegistry::isEnabled()
+{
+    SWSS_LOG_ENTER();
+
+    return m_enabled.load(std::memory_order_relaxed);
+}
+
+LatencyHistogramScope::LatencyHistogramScope(
+        _In_ LatencyHistogram& histogram):
+    m_histogram(histogram),
+    m_enabled(LatencyHistogramRegistry::isEnabled())
+{
+    SWSS_LOG_ENTER();
+
+    if (m_enabled)
+    {
+        m_start = std::chrono::steady_clock::now();
+    }
+}
+
+LatencyHistogramScope::~LatencyHistogramScope()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    auto duration = std::chrono::steady_clock::now() - m_start;
+
+    m_histogram.record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace sairediscommon
+{
+    /**
+     * @brief Latency histogram with logarithmic buckets.
+     *
+     * Each power of two range is split into SUB_BUCKET_COUNT linear sub
+     * buckets, so recorded value precision is 1/SUB_BUCKET_COUNT of the value
+     * across whole 64 bit range, like in HDR histogram. Buckets are relaxed
+     * atomic counters, so multiple threads can record without any lock.
+     */
+    class LatencyHistogram
+    {
+        public:
+
+            static constexpr uint32_t SUB_BUCKET_BITS = 3;
+
+            static constexpr uint64_t SUB_BUCKET_COUNT = (1 << SUB_BUCKET_BITS);
+
+            static constexpr size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+        public:
+
+            /**
+             * @brief Point in time copy of histogram.
+             */
+            class Snapshot
+            {
+                public:
+
+                    Snapshot();
+
+                public:
+
+                    /**
+                     * @brief Get value at given percentile, p is in range [0, 100].
+                     *
+                     * Value is upper bound of the bucket containing percentile.
+                     */
+                    uint64_t getValueAtPercentile(
+                            _In_ double p) const;
+
+                    uint64_t getMean() const;
+
+                    /**
+                     * @brief Add values of other snapshot, for example
+                     * histogram of other thread.
+                     */
+                    void merge(
+                            _In_ const Snapshot& other);
+
+                public:
+
+                    uint64_t m_count;
+
+                    uint64_t m_sum;
+
+                    uint64_t m_min;
+
+                    uint64_t m_max;
+
+                    std::array<uint64_t, BUCKET_COUNT> m_buckets;
+            };
+
+        public:
+
+            LatencyHistogram();
+
+            ~LatencyHistogram() = default; // non virtual
+
+        private:
+
+            LatencyHistogram(const LatencyHistogram&) = delete;
+            LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+        public:
+
+            /**
+             * @brief Record single value, usually in nanoseconds.
+             *
+             * Value is dropped when histograms are disabled in registry.
+             */
+            void record(
+                    _In_ uint64_t value);
+
+            Snapshot snapshot() const;
+
+            void reset();
+
+        public:
+
+            static size_t getBucketIndex(
+                    _In_ uint64_t value);
+
+            /**
+             * @brief Get highest value which falls into bucket.
+             */
+            static uint64_t getBucketUpperBound(
+                    _In_ size_t index);
+
+        private:
+
+            std::array<std::atomic<uint64_t>, BUCKET_COUNT> m_buckets;
+
+            std::atomic<uint64_t> m_count;
+
+            std::atomic<uint64_t> m_sum;
+
+            std::atomic<uint64_t> m_min;
+
+            std::atomic<uint64_t> m_max;
+    };
+
+    /**
+     * @brief Named latency histograms of the process.
+     *
+     * Histograms are never removed, so returned reference can be cached in
+     * static variable by the caller and registry lock is taken only once.
+     */
+    class LatencyHistogramRegistry
+    {
+        private:
+
+            LatencyHistogramRegistry() = delete;
+
+        public:
+
+            static LatencyHistogram& getHistogram(
+                    _In_ const std::string& name);
+
+            static std::map<std::string, LatencyHistogram::Snapshot> snapshot();
+
+            static void reset();
+
+            /**
+             * @brief Enable or disable recording of all histograms.
+             *
+             * Enabled by default. When disabled, scopes don't read the clock,
+             * so histogram overhead can be measured by comparing both modes.
+             */
+            static void setEnabled(
+                    _In_ bool enabled);
+
+            static bool isEnabled();
+
+        private:
+
+            static std::mutex m_mutex;
+
+            static std::atomic<bool> m_enabled;
+
+            static std::map<std::string, std::unique_ptr<LatencyHistogram>> m_histograms;
+    };
+
+    /**
+     * @brief Record scope duration in nanoseconds in latency histogram.
+     */
+    class LatencyHistogramScope
+    {
+        public:
+
+            LatencyHistogramScope(
+                    _In_ LatencyHistogram& histogram);
+
+            ~LatencyHistogramScope(); // non virtual
+
+        private:
+
+            LatencyHistogram& m_histogram;
+
+            bool m_enabled;
+
+            std::chrono::time_point<std::chrono::steady_clock> m_start;
+    };
+}
@@ -9,6 +9,9 @@
 #include <inttypes.h>
 
 #include <set>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 // TODO add validation for all oids belong to the same switch
 
@@ -16,6 +19,15 @@
 
 #define CHECK_STATUS_SUCCESS(s) { if ((s) != SAI_STATUS_SUCCESS) return (s); }
 
+#define WORKER_POOL_MAX_THREADS 8
+
+#define BULK_VALIDATION_MIN_CHUNK_SIZE 256
+
+#define POPULATE_MIN_CHUNK_SIZE 2048
+
+// number of dump entries parsed before they are committed to metadata
+#define POPULATE_WINDOW_SIZE (64 * 1024)
+
 #define VALIDATION_LIST(md,vlist)                                               \
 {                                                                               \
     auto _status = meta_genetic_validation_list(md,vlist.count,vlist.list);     \
@@ -48,6 +60,28 @@ Meta::Meta(
 
     m_unittestsEnabled = false;
 
+    // partition metadata by switch, so removing switch will just drop its
+    // partition instead of scanning all objects
+
+    SwitchIdQuery query = [this](sai_object_id_t oid) -> sai_object_id_t
+    {
+        try
+        {
+            return switchIdQuery(oid);
+        }
+        catch (const std::exception&)
+        {
+            // invalid oid, it will not be found in any partition and it
+            // will be reported by validation
+
+            return SAI_NULL_OBJECT_ID;
+        }
+    };
+
+    m_portRelatedSet.setSwitchIdQuery(query);
+    m_oids.setSwitchIdQuery(query);
+    m_saiObjectCollection.setSwitchIdQuery(query);
+
     // TODO if metadata supports multiple switches
     // then warm boot must be per each switch
 
@@ -86,11 +120,9 @@ void Meta::meta_init_db()
     SWSS_LOG_NOTICE("begin");
 
     /*
-     * This DB will contain objects from all switches.
-     *
-     * TODO: later on we will have separate bases for each switch.  This way
-     * should be easier to manage, on remove switch we will just clear that db,
-     * instead of checking all objects.
+     * This DB will contain objects from all switches, partitioned by switch
+     * id, so on remove switch we will just clear that partition, instead of
+     * checking all objects.
      */
 
     m_oids.clear();
@@ -136,6 +168,22 @@ void Meta::dump() const
     {
         SWSS_LOG_NOTICE("objcollection: %s", sai_serialize_object_meta_key(mk).c_str());
     }
+
+    for (auto &mu: m_saiObjectCollection.getMemoryUsage())
+    {
+        SWSS_LOG_NOTICE("memory: %s: objects: %zu, attributes: %zu, bytes: %zu",
+                sai_serialize_object_type(mu.first).c_str(),
+                mu.second.objects,
+                mu.second.attributes,
+                mu.second.bytes);
+    }
+
+    auto pool = m_saiObjectCollection.getAttrPoolMemoryUsage();
+
+    SWSS_LOG_NOTICE("memory: attribute pool: entries: %zu, used: %zu, bytes: %zu",
+            pool.objects,
+            pool.attributes,
+            pool.bytes);
 }
 
 sai_status_t Meta::remove(
@@ -1863,7 +1911,17 @@ sai_status_t Meta::bulkGetStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    PARAMETER_CHECK_IF_NOT_NULL(counters);
+
+    auto status = meta_validate_bulk_stats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkGetStats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses, counters);
+
+    // no post validation required
+
+    return status;
 }
 
 sai_status_t Meta::bulkClearStats(
@@ -1878,7 +1936,181 @@ sai_status_t Meta::bulkClearStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    auto status = meta_validate_bulk_stats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkClearStats(switchId, object_type, object_count, object_key, number_of_counters, counter_ids, mode, object_statuses);
+
+    // no post validation required
+
+    return status;
+}
+
+sai_status_t Meta::meta_validate_bulk_stats(
+        _In_ sai_object_id_t switch_id,
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _In_ const sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    PARAMETER_CHECK_OID_OBJECT_TYPE(switch_id, SAI_OBJECT_TYPE_SWITCH);
+    PARAMETER_CHECK_OID_EXISTS(switch_id, SAI_OBJECT_TYPE_SWITCH);
+    PARAMETER_CHECK_POSITIVE(object_count);
+    PARAMETER_CHECK_IF_NOT_NULL(object_key);
+    PARAMETER_CHECK_IF_NOT_NULL(object_statuses);
+
+    uint64_t counters;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        sai_object_id_t object_id = object_key[idx].key.object_id;
+
+        // validates object type, counter ids and mode
+
+        auto status = meta_validate_stats(object_type, object_id, number_of_counters, counter_ids, &counters, mode);
+
+        CHECK_STATUS_SUCCESS(status);
+
+        if (switchIdQuery(object_id) != switch_id)
+        {
+            SWSS_LOG_ERROR("object %s is not on switch %s",
+                    sai_serialize_object_id(object_id).c_str(),
+                    sai_serialize_object_id(switch_id).c_str());
+
+            return SAI_STATUS_INVALID_PARAMETER;
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t Meta::bulkValidate(
+        _In_ sai_common_api_t api,
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t object_count,
+        _In_ const std::function<sai_status_t(uint32_t)>& validate)
+{
+    SWSS_LOG_ENTER();
+
+    auto key = sai_serialize_common_api(api) + ":" + sai_serialize_object_type(objectType);
+
+    auto& timer = m_bulkValidationTimers[key];
+
+    if (timer == nullptr)
+    {
+        key = "Meta::bulkValidate(" + key + ")";
+
+        timer = std::make_shared<sairediscommon::PerformanceIntervalTimer>(key.c_str());
+    }
+
+    timer->start();
+
+    /*
+     * Validation is read only on metadata database, so entries can be
+     * validated in parallel. Each chunk stops on first failure, and the
+     * failure with lowest index is reported, so returned status (or thrown
+     * exception) is the same as if entries were validated serially.
+     */
+
+    std::mutex failedMutex;
+
+    std::atomic<uint32_t> failedIndex(object_count);
+
+    sai_status_t failedStatus = SAI_STATUS_SUCCESS;
+
+    std::exception_ptr failedException;
+
+    auto validateRange = [&](size_t begin, size_t end) {
+
+        for (size_t idx = begin; idx < end && idx < failedIndex; idx++)
+        {
+            sai_status_t status;
+
+            std::exception_ptr exception;
+
+            try
+            {
+                status = validate((uint32_t)idx);
+            }
+            catch (...)
+            {
+                status = SAI_STATUS_FAILURE;
+
+                exception = std::current_exception();
+            }
+
+            if (status == SAI_STATUS_SUCCESS)
+            {
+                continue;
+            }
+
+            std::lock_guard<std::mutex> lock(failedMutex);
+
+            if (idx < failedIndex)
+            {
+                failedIndex = (uint32_t)idx;
+                failedStatus = status;
+                failedException = exception;
+            }
+
+            return;
+        }
+    };
+
+    if (m_unittestsEnabled)
+    {
+        // unittests readonly flag is erased during set validation, so
+        // validate serially in that case
+
+        validateRange(0, object_count);
+    }
+    else
+    {
+        parallelFor(object_count, BULK_VALIDATION_MIN_CHUNK_SIZE, validateRange);
+    }
+
+    timer->stop();
+    timer->inc(failedIndex < object_count ? failedIndex + 1 : object_count);
+
+    if (failedException)
+    {
+        std::rethrow_exception(failedException);
+    }
+
+    return failedStatus;
+}
+
+void Meta::parallelFor(
+        _In_ size_t count,
+        _In_ size_t minChunkSize,
+        _In_ const std::function<void(size_t begin, size_t end)>& fn)
+{
+    SWSS_LOG_ENTER();
+
+    std::shared_ptr<WorkerPool> pool;
+
+    {
+        std::lock_guard<std::mutex> lock(m_workerPoolMutex);
+
+        if (m_workerPool == nullptr)
+        {
+            size_t threads = std::min<size_t>(std::thread::hardware_concurrency(), WORKER_POOL_MAX_THREADS);
+
+            // calling thread also executes one chunk
+
+            m_workerPool = std::make_shared<WorkerPool>(threads > 1 ? threads - 1 : 0);
+        }
+
+        pool = m_workerPool;
+    }
+
+    pool->parallelFor(count, minChunkSize, fn);
 }
 
 // for bulk operations actually we could make copy of current db and actually
@@ -1914,9 +2146,9 @@ sai_status_t Meta::bulkRemove(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_oid(object_type, &object_id[idx], SAI_NULL_OBJECT_ID, false);
 
@@ -1924,14 +2156,20 @@ sai_status_t Meta::bulkRemove(
 
         sai_object_meta_key_t meta_key = { .objecttype = object_type, .objectkey = { .key = { .object_id  = object_id[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_remove(meta_key);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkRemove(object_type, object_count, object_id, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_REMOVE, object_type, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkRemove(object_type, object_count, object_id, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -1972,9 +2210,9 @@ sai_status_t Meta::bulkRemove(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_route_entry(&route_entry[idx], false);
 
@@ -1982,14 +2220,20 @@ sai_status_t Meta::bulkRemove(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY, .objectkey = { .key = { .route_entry = route_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_remove(meta_key);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkRemove(object_count, route_entry, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_REMOVE, SAI_OBJECT_TYPE_ROUTE_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkRemove(object_count, route_entry, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2030,9 +2274,9 @@ sai_status_t Meta::bulkRemove(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_nat_entry(&nat_entry[idx], false);
 
@@ -2040,14 +2284,20 @@ sai_status_t Meta::bulkRemove(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_NAT_ENTRY, .objectkey = { .key = { .nat_entry = nat_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_remove(meta_key);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkRemove(object_count, nat_entry, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_REMOVE, SAI_OBJECT_TYPE_NAT_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkRemove(object_count, nat_entry, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2089,9 +2339,9 @@ sai_status_t Meta::bulkRemove(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_my_sid_entry(&my_sid_entry[idx], false);
 
@@ -2099,14 +2349,20 @@ sai_status_t Meta::bulkRemove(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_MY_SID_ENTRY, .objectkey = { .key = { .my_sid_entry = my_sid_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_remove(meta_key);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkRemove(object_count, my_sid_entry, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_REMOVE, SAI_OBJECT_TYPE_MY_SID_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkRemove(object_count, my_sid_entry, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2148,9 +2404,9 @@ sai_status_t Meta::bulkRemove(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_neighbor_entry(&neighbor_entry[idx], false);
 
@@ -2158,14 +2414,20 @@ sai_status_t Meta::bulkRemove(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, .objectkey = { .key = { .neighbor_entry = neighbor_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_remove(meta_key);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkRemove(object_count, neighbor_entry, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_REMOVE, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkRemove(object_count, neighbor_entry, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2206,9 +2468,9 @@ sai_status_t Meta::bulkRemove(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_fdb_entry(&fdb_entry[idx], false);
 
@@ -2216,14 +2478,20 @@ sai_status_t Meta::bulkRemove(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_FDB_ENTRY, .objectkey = { .key = { .fdb_entry = fdb_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_remove(meta_key);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkRemove(object_count, fdb_entry, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_REMOVE, SAI_OBJECT_TYPE_FDB_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkRemove(object_count, fdb_entry, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2264,9 +2532,9 @@ sai_status_t Meta::bulkRemove(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_inseg_entry(&inseg_entry[idx], false);
 
@@ -2274,14 +2542,20 @@ sai_status_t Meta::bulkRemove(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_INSEG_ENTRY, .objectkey = { .key = { .inseg_entry = inseg_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_remove(meta_key);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkRemove(object_count, inseg_entry, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_REMOVE, SAI_OBJECT_TYPE_INSEG_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkRemove(object_count, inseg_entry, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2326,9 +2600,9 @@ sai_status_t Meta::bulkSet(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_oid(object_type, &object_id[idx], SAI_NULL_OBJECT_ID, false);
 
@@ -2336,14 +2610,20 @@ sai_status_t Meta::bulkSet(
 
         sai_object_meta_key_t meta_key = { .objecttype = object_type, .objectkey = { .key = { .object_id  = object_id[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_set(meta_key, &attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkSet(object_type, object_count, object_id, attr_list, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_SET, object_type, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkSet(object_type, object_count, object_id, attr_list, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2383,9 +2663,9 @@ sai_status_t Meta::bulkSet(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_route_entry(&route_entry[idx], false);
 
@@ -2393,14 +2673,20 @@ sai_status_t Meta::bulkSet(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY, .objectkey = { .key = { .route_entry = route_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_set(meta_key, &attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkSet(object_count, route_entry, attr_list, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_SET, SAI_OBJECT_TYPE_ROUTE_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkSet(object_count, route_entry, attr_list, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2440,9 +2726,9 @@ sai_status_t Meta::bulkSet(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_nat_entry(&nat_entry[idx], false);
 
@@ -2450,14 +2736,20 @@ sai_status_t Meta::bulkSet(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_NAT_ENTRY, .objectkey = { .key = { .nat_entry = nat_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_set(meta_key, &attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkSet(object_count, nat_entry, attr_list, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_SET, SAI_OBJECT_TYPE_NAT_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkSet(object_count, nat_entry, attr_list, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2498,9 +2790,9 @@ sai_status_t Meta::bulkSet(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_my_sid_entry(&my_sid_entry[idx], false);
 
@@ -2508,14 +2800,20 @@ sai_status_t Meta::bulkSet(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_MY_SID_ENTRY, .objectkey = { .key = { .my_sid_entry = my_sid_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_set(meta_key, &attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkSet(object_count, my_sid_entry, attr_list, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_SET, SAI_OBJECT_TYPE_MY_SID_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkSet(object_count, my_sid_entry, attr_list, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2556,9 +2854,9 @@ sai_status_t Meta::bulkSet(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_neighbor_entry(&neighbor_entry[idx], false);
 
@@ -2566,14 +2864,20 @@ sai_status_t Meta::bulkSet(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, .objectkey = { .key = { .neighbor_entry = neighbor_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_set(meta_key, &attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkSet(object_count, neighbor_entry, attr_list, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_SET, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkSet(object_count, neighbor_entry, attr_list, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2613,9 +2917,9 @@ sai_status_t Meta::bulkSet(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_fdb_entry(&fdb_entry[idx], false);
 
@@ -2623,14 +2927,20 @@ sai_status_t Meta::bulkSet(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_FDB_ENTRY, .objectkey = { .key = { .fdb_entry = fdb_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_set(meta_key, &attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkSet(object_count, fdb_entry, attr_list, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_SET, SAI_OBJECT_TYPE_FDB_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkSet(object_count, fdb_entry, attr_list, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2670,9 +2980,9 @@ sai_status_t Meta::bulkSet(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_inseg_entry(&inseg_entry[idx], false);
 
@@ -2680,14 +2990,20 @@ sai_status_t Meta::bulkSet(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_INSEG_ENTRY, .objectkey = { .key = { .inseg_entry = inseg_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_set(meta_key, &attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkSet(object_count, inseg_entry, attr_list, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_SET, SAI_OBJECT_TYPE_INSEG_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkSet(object_count, inseg_entry, attr_list, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2752,9 +3068,9 @@ sai_status_t Meta::bulkCreate(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_oid(object_type, &object_id[idx], switchId, true);
 
@@ -2764,14 +3080,20 @@ sai_status_t Meta::bulkCreate(
 
         sai_object_meta_key_t meta_key = { .objecttype = object_type, .objectkey = { .key = { .object_id  = SAI_NULL_OBJECT_ID } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_create(meta_key, switchId, attr_count[idx], attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkCreate(object_type, switchId, object_count, attr_count, attr_list, mode, object_id, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_CREATE, object_type, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkCreate(object_type, switchId, object_count, attr_count, attr_list, mode, object_id, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2815,11 +3137,11 @@ sai_status_t Meta::bulkCreate(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
     // TODO handle case when two 2 identical routes are created - it will throw, should return fail
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_route_entry(&route_entry[idx], true);
 
@@ -2827,14 +3149,20 @@ sai_status_t Meta::bulkCreate(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_ROUTE_ENTRY, .objectkey = { .key = { .route_entry = route_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_create(meta_key, route_entry[idx].switch_id, attr_count[idx], attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkCreate(object_count, route_entry, attr_count, attr_list, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_CREATE, SAI_OBJECT_TYPE_ROUTE_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkCreate(object_count, route_entry, attr_count, attr_list, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2876,9 +3204,9 @@ sai_status_t Meta::bulkCreate(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_fdb_entry(&fdb_entry[idx], true);
 
@@ -2886,14 +3214,20 @@ sai_status_t Meta::bulkCreate(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_FDB_ENTRY, .objectkey = { .key = { .fdb_entry = fdb_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_create(meta_key, fdb_entry[idx].switch_id, attr_count[idx], attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkCreate(object_count, fdb_entry, attr_count, attr_list, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_CREATE, SAI_OBJECT_TYPE_FDB_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkCreate(object_count, fdb_entry, attr_count, attr_list, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2935,9 +3269,9 @@ sai_status_t Meta::bulkCreate(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_inseg_entry(&inseg_entry[idx], true);
 
@@ -2945,14 +3279,20 @@ sai_status_t Meta::bulkCreate(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_INSEG_ENTRY, .objectkey = { .key = { .inseg_entry = inseg_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_create(meta_key, inseg_entry[idx].switch_id, attr_count[idx], attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkCreate(object_count, inseg_entry, attr_count, attr_list, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_CREATE, SAI_OBJECT_TYPE_INSEG_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkCreate(object_count, inseg_entry, attr_count, attr_list, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -2994,9 +3334,9 @@ sai_status_t Meta::bulkCreate(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_nat_entry(&nat_entry[idx], true);
 
@@ -3004,14 +3344,20 @@ sai_status_t Meta::bulkCreate(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_NAT_ENTRY, .objectkey = { .key = { .nat_entry = nat_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_create(meta_key, nat_entry[idx].switch_id, attr_count[idx], attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkCreate(object_count, nat_entry, attr_count, attr_list, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_CREATE, SAI_OBJECT_TYPE_NAT_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkCreate(object_count, nat_entry, attr_count, attr_list, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -3054,9 +3400,9 @@ sai_status_t Meta::bulkCreate(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_my_sid_entry(&my_sid_entry[idx], true);
 
@@ -3064,14 +3410,20 @@ sai_status_t Meta::bulkCreate(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_MY_SID_ENTRY, .objectkey = { .key = { .my_sid_entry = my_sid_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_create(meta_key, my_sid_entry[idx].switch_id, attr_count[idx], attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkCreate(object_count, my_sid_entry, attr_count, attr_list, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_CREATE, SAI_OBJECT_TYPE_MY_SID_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkCreate(object_count, my_sid_entry, attr_count, attr_list, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -3114,9 +3466,9 @@ sai_status_t Meta::bulkCreate(
         return SAI_STATUS_INVALID_PARAMETER;
     }
 
-    std::vector<sai_object_meta_key_t> vmk;
+    std::vector<sai_object_meta_key_t> vmk(object_count);
 
-    for (uint32_t idx = 0; idx < object_count; idx++)
+    auto validate = [&](uint32_t idx) -> sai_status_t
     {
         sai_status_t status = meta_sai_validate_neighbor_entry(&neighbor_entry[idx], true);
 
@@ -3124,14 +3476,20 @@ sai_status_t Meta::bulkCreate(
 
         sai_object_meta_key_t meta_key = { .objecttype = SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, .objectkey = { .key = { .neighbor_entry = neighbor_entry[idx] } } };
 
-        vmk.push_back(meta_key);
+        vmk[idx] = meta_key;
 
         status = meta_generic_validation_create(meta_key, neighbor_entry[idx].switch_id, attr_count[idx], attr_list[idx]);
 
         CHECK_STATUS_SUCCESS(status);
-    }
 
-    auto status = m_implementation->bulkCreate(object_count, neighbor_entry, attr_count, attr_list, mode, object_statuses);
+        return SAI_STATUS_SUCCESS;
+    };
+
+    auto status = bulkValidate(SAI_COMMON_API_BULK_CREATE, SAI_OBJECT_TYPE_NEIGHBOR_ENTRY, object_count, validate);
+
+    CHECK_STATUS_SUCCESS(status);
+
+    status = m_implementation->bulkCreate(object_count, neighbor_entry, attr_count, attr_list, mode, object_statuses);
 
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
@@ -3197,52 +3555,16 @@ void Meta::clean_after_switch_remove(
                 sai_serialize_object_id(switchId).c_str());
     }
 
-    // clear port related objects
+    // all metadata containers are partitioned by switch id, so we just
+    // need to drop partition of removed switch
 
-    for (auto port: m_portRelatedSet.getAllPorts())
-    {
-        if (switchIdQuery(port) == switchId)
-        {
-            m_portRelatedSet.removePort(port);
-        }
-    }
+    m_portRelatedSet.removeSwitch(switchId);
 
-    // clear oid references
+    m_oids.removeSwitch(switchId);
 
-    for (auto oid: m_oids.getAllOids())
-    {
-        if (switchIdQuery(oid) == switchId)
-        {
-            m_oids.objectReferenceClear(oid);
-        }
-    }
-
-    // clear attr keys
-
-    for (auto& key: m_attrKeys.getAllKeys())
-    {
-        sai_object_meta_key_t mk;
-        sai_deserialize_object_meta_key(key, mk);
+    m_attrKeys.eraseSwitch(switchId);
 
-        // we guarantee that switch_id is first in the key structure so we can
-        // use that as object_id as well
-
-        if (switchIdQuery(mk.objectkey.key.object_id) == switchId)
-        {
-            m_attrKeys.eraseMetaKey(key);
-        }
-    }
-
-    for (auto& mk: m_saiObjectCollection.getAllKeys())
-    {
-        // we guarantee that switch_id is first in the key structure so we can
-        // use that as object_id as well
-
-        if (switchIdQuery(mk.objectkey.key.object_id) == switchId)
-        {
-            m_saiObjectCollection.removeObject(mk);
-        }
-    }
+    m_saiObjectCollection.removeSwitch(switchId);
 
     SWSS_LOG_NOTICE("removed all objects related to switch %s",
             sai_serialize_object_id(switchId).c_str());
@@ -8097,154 +8419,196 @@ void Meta::populate(
     // table dump contains only 1 switch the one that user wanted to connect
     // using init=false
 
-    for (const auto &key: dump)
-    {
-        sai_object_meta_key_t mk;
-        sai_deserialize_object_meta_key(key.first, mk);
+    size_t windowSize = std::min(dump.size(), (size_t)POPULATE_WINDOW_SIZE);
 
-        std::unordered_map<std::string, std::string> hash;
+    std::vector<const swss::TableDump::value_type*> entries;
+    std::vector<sai_object_meta_key_t> metaKeys(windowSize);
+    std::vector<std::unique_ptr<SaiAttributeList>> lists(windowSize);
 
-        for (const auto &field: key.second)
-        {
-            hash[field.first] = field.second;
-        }
+    entries.reserve(windowSize);
 
-        SaiAttributeList alist(mk.objecttype, hash, false);
+    auto parse = [&](size_t idx) {
 
-        auto attr_count = alist.get_attr_count();
-        auto attr_list = alist.get_attr_list();
+        sai_deserialize_object_meta_key(entries[idx]->first, metaKeys[idx]);
 
-        // make references and objects from object id
+        std::vector<swss::FieldValueTuple> values(entries[idx]->second.begin(), entries[idx]->second.end());
 
-        if (!m_saiObjectCollection.objectExists(mk))
-            m_saiObjectCollection.createObject(mk);
+        lists[idx] = std::make_unique<SaiAttributeList>(metaKeys[idx].objecttype, values, false);
+    };
 
-        auto info = sai_metadata_get_object_type_info(mk.objecttype);
+    /*
+     * Deserializing entries takes most of populate time and it doesn't touch
+     * metadata database, so entries are parsed in parallel, each chunk parses
+     * continuous range of entries. Objects and references are then committed
+     * by single thread in dump order. Dump is processed in windows, so only
+     * single window of parsed attribute lists is kept in memory.
+     */
 
-        if (info->isnonobjectid)
-        {
-            /*
-             * Increase object reference count for all object ids in non object id
-             * members.
-             */
+    auto it = dump.begin();
 
-            for (size_t j = 0; j < info->structmemberscount; ++j)
-            {
-                const sai_struct_member_info_t *m = info->structmembers[j];
+    while (it != dump.end())
+    {
+        entries.clear();
 
-                if (m->membervaluetype != SAI_ATTR_VALUE_TYPE_OBJECT_ID)
-                {
-                    continue;
-                }
+        for (; it != dump.end() && entries.size() < windowSize; ++it)
+        {
+            entries.push_back(&*it);
+        }
 
-                if (!m_oids.objectReferenceExists(m->getoid(&mk)))
-                    m_oids.objectReferenceInsert(m->getoid(&mk));
+        parallelFor(entries.size(), POPULATE_MIN_CHUNK_SIZE, [&](size_t begin, size_t end) {
 
-                m_oids.objectReferenceIncrement(m->getoid(&mk));
+            for (size_t idx = begin; idx < end; idx++)
+            {
+                parse(idx);
             }
-        }
-        else
+        });
+
+        for (size_t idx = 0; idx < entries.size(); idx++)
         {
-            if (!m_oids.objectReferenceExists(mk.objectkey.key.object_id))
-                m_oids.objectReferenceInsert(mk.objectkey.key.object_id);
+            populateObject(metaKeys[idx], lists[idx]->get_attr_count(), lists[idx]->get_attr_list());
+
+            lists[idx].reset();
         }
+    }
+}
 
-        bool haskeys = false;
+void Meta::populateObject(
+        _In_ const sai_object_meta_key_t& mk,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t* attr_list)
+{
+    SWSS_LOG_ENTER();
 
-        for (uint32_t idx = 0; idx < attr_count; ++idx)
-        {
-            const sai_attribute_t* attr = &attr_list[idx];
+    // make references and objects from object id
 
-            auto mdp = sai_metadata_get_attr_metadata(mk.objecttype, attr->id);
+    if (!m_saiObjectCollection.objectExists(mk))
+        m_saiObjectCollection.createObject(mk);
 
-            const sai_attribute_value_t& value = attr->value;
+    auto info = sai_metadata_get_object_type_info(mk.objecttype);
 
-            const sai_attr_metadata_t& md = *mdp;
+    if (info->isnonobjectid)
+    {
+        /*
+         * Increase object reference count for all object ids in non object id
+         * members.
+         */
 
-            if (SAI_HAS_FLAG_KEY(md.flags))
+        for (size_t j = 0; j < info->structmemberscount; ++j)
+        {
+            const sai_struct_member_info_t *m = info->structmembers[j];
+
+            if (m->membervaluetype != SAI_ATTR_VALUE_TYPE_OBJECT_ID)
             {
-                haskeys = true;
-                META_LOG_DEBUG(md, "attr is key");
+                continue;
             }
 
-            // increase reference on object id types
+            if (!m_oids.objectReferenceExists(m->getoid(&mk)))
+                m_oids.objectReferenceInsert(m->getoid(&mk));
 
-            uint32_t count = 0;
-            const sai_object_id_t *list;
+            m_oids.objectReferenceIncrement(m->getoid(&mk));
+        }
+    }
+    else
+    {
+        if (!m_oids.objectReferenceExists(mk.objectkey.key.object_id))
+            m_oids.objectReferenceInsert(mk.objectkey.key.object_id);
+    }
 
-            switch (md.attrvaluetype)
-            {
-                case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
-                    count = 1;
-                    list = &value.oid;
-                    break;
+    bool haskeys = false;
 
-                case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-                    count = value.objlist.count;
-                    list = value.objlist.list;
-                    break;
+    for (uint32_t idx = 0; idx < attr_count; ++idx)
+    {
+        const sai_attribute_t* attr = &attr_list[idx];
 
-                case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
-                    if (value.aclfield.enable)
-                    {
-                        count = 1;
-                        list = &value.aclfield.data.oid;
-                    }
-                    break;
+        auto mdp = sai_metadata_get_attr_metadata(mk.objecttype, attr->id);
 
-                case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
-                    if (value.aclfield.enable)
-                    {
-                        count = value.aclfield.data.objlist.count;
-                        list = value.aclfield.data.objlist.list;
-                    }
-                    break;
+        const sai_attribute_value_t& value = attr->value;
 
-                case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
-                    if (value.aclaction.enable)
-                    {
-                        count = 1;
-                        list = &value.aclaction.parameter.oid;
-                    }
-                    break;
+        const sai_attr_metadata_t& md = *mdp;
 
-                case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
-                    if (value.aclaction.enable)
-                    {
-                        count = value.aclaction.parameter.objlist.count;
-                        list = value.aclaction.parameter.objlist.list;
-                    }
-                    break;
+        if (SAI_HAS_FLAG_KEY(md.flags))
+        {
+            haskeys = true;
+            META_LOG_DEBUG(md, "attr is key");
+        }
 
-                default:
+        // increase reference on object id types
 
-                    if (md.isoidattribute)
-                    {
-                        META_LOG_THROW(md, "missing process of oid attribute, FIXME");
-                    }
-                    break;
-            }
+        uint32_t count = 0;
+        const sai_object_id_t *list;
 
-            for (uint32_t index = 0; index < count; index++)
-            {
-                if (!m_oids.objectReferenceExists(list[index]))
-                    m_oids.objectReferenceInsert(list[index]);
+        switch (md.attrvaluetype)
+        {
+            case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+                count = 1;
+                list = &value.oid;
+                break;
 
-                m_oids.objectReferenceIncrement(list[index]);
-            }
+            case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+                count = value.objlist.count;
+                list = value.objlist.list;
+                break;
 
-            m_saiObjectCollection.setObjectAttr(mk, md, attr);
+            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
+                if (value.aclfield.enable)
+                {
+                    count = 1;
+                    list = &value.aclfield.data.oid;
+                }
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
+                if (value.aclfield.enable)
+                {
+                    count = value.aclfield.data.objlist.count;
+                    list = value.aclfield.data.objlist.list;
+                }
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
+                if (value.aclaction.enable)
+                {
+                    count = 1;
+                    list = &value.aclaction.parameter.oid;
+                }
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
+                if (value.aclaction.enable)
+                {
+                    count = value.aclaction.parameter.objlist.count;
+                    list = value.aclaction.parameter.objlist.list;
+                }
+                break;
+
+            default:
+
+                if (md.isoidattribute)
+                {
+                    META_LOG_THROW(md, "missing process of oid attribute, FIXME");
+                }
+                break;
         }
 
-        if (haskeys)
+        for (uint32_t index = 0; index < count; index++)
         {
-            auto mKey = sai_serialize_object_meta_key(mk);
+            if (!m_oids.objectReferenceExists(list[index]))
+                m_oids.objectReferenceInsert(list[index]);
 
-            auto switchId = switchIdQuery(mk.objectkey.key.object_id);
+            m_oids.objectReferenceIncrement(list[index]);
+        }
 
-            auto attrKey = AttrKeyMap::constructKey(switchId, mk, attr_count, attr_list);
+        m_saiObjectCollection.setObjectAttr(mk, md, attr);
+    }
 
-            m_attrKeys.insert(mKey, attrKey);
-        }
+    if (haskeys)
+    {
+        auto mKey = sai_serialize_object_meta_key(mk);
+
+        auto switchId = switchIdQuery(mk.objectkey.key.object_id);
+
+        auto attrKey = AttrKeyMap::constructKey(switchId, mk, attr_count, attr_list);
+
+        m_attrKeys.insert(mKey, attrKey);
     }
 }
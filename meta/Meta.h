@@ -7,12 +7,17 @@
 #include "PortRelatedSet.h"
 #include "AttrKeyMap.h"
 #include "OidRefCounter.h"
+#include "PerformanceIntervalTimer.h"
+#include "WorkerPool.h"
 
 #include "swss/table.h"
 
 #include <vector>
 #include <memory>
 #include <set>
+#include <map>
+#include <functional>
+#include <mutex>
 
 #define DEFAULT_VLAN_NUMBER 1
 #define MINIMUM_VLAN_NUMBER 1
@@ -243,6 +248,42 @@ namespace saimeta
             void meta_sai_on_bfd_session_state_change_single(
                     _In_ const sai_bfd_session_state_notification_t& data);
 
+        private: // bulk validation
+
+            /**
+             * @brief Validate bulk entries.
+             *
+             * Validation doesn't modify metadata database, so for large bulk
+             * requests entries are validated in parallel. Returned status is
+             * the status of the first failed entry, the same as in serial
+             * validation. Validation time is reported by performance timer.
+             *
+             * @param api Bulk API.
+             * @param objectType Object type of entries.
+             * @param object_count Number of entries.
+             * @param validate Function validating single entry at given index.
+             *
+             * @return Status of first failed entry or SAI_STATUS_SUCCESS.
+             */
+            sai_status_t bulkValidate(
+                    _In_ sai_common_api_t api,
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint32_t object_count,
+                    _In_ const std::function<sai_status_t(uint32_t)>& validate);
+
+            /**
+             * @brief Execute function on range [0, count) on worker pool.
+             *
+             * Worker pool is created on first use and shared by all parallel
+             * operations of this instance. Range is split into chunks of at
+             * least minChunkSize entries, so small ranges are executed by
+             * calling thread only.
+             */
+            void parallelFor(
+                    _In_ size_t count,
+                    _In_ size_t minChunkSize,
+                    _In_ const std::function<void(size_t begin, size_t end)>& fn);
+
         private: // validation helpers
 
             sai_status_t meta_generic_validation_objlist(
@@ -431,6 +472,16 @@ namespace saimeta
                     _In_ sai_object_type_t object_type,
                     _In_ sai_object_id_t object_id);
 
+            sai_status_t meta_validate_bulk_stats(
+                    _In_ sai_object_id_t switch_id,
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t *counter_ids,
+                    _In_ sai_stats_mode_t mode,
+                    _In_ const sai_status_t *object_statuses);
+
         private: // validate OID
 
             sai_status_t meta_sai_validate_oid(
@@ -488,9 +539,23 @@ namespace saimeta
 
             void meta_warm_boot_notify();
 
+            /**
+             * @brief Populate metadata from ASIC state dump.
+             *
+             * Dump entries are deserialized in parallel when dump is large,
+             * objects and references are then created in dump order. Large
+             * dump is parsed and committed in bounded windows of entries.
+             */
             void populate(
                     _In_ const swss::TableDump& dump);
 
+        private:
+
+            void populateObject(
+                    _In_ const sai_object_meta_key_t& mk,
+                    _In_ uint32_t attr_count,
+                    _In_ const sai_attribute_t* attr_list);
+
         private:
 
             void clean_after_switch_remove(
@@ -534,5 +599,15 @@ namespace saimeta
         private: // warm boot
 
             bool m_warmBoot;
+
+        private: // bulk validation
+
+            std::map<std::string, std::shared_ptr<sairediscommon::PerformanceIntervalTimer>> m_bulkValidationTimers;
+
+        private: // parallel operations
+
+            std::mutex m_workerPoolMutex;
+
+            std::shared_ptr<WorkerPool> m_workerPool;
     };
 }
@@ -13,12 +13,79 @@ void OidRefCounter::clear()
     m_hash.clear();
 }
 
+void OidRefCounter::setSwitchIdQuery(
+        _In_ const SwitchIdQuery& switchIdQuery)
+{
+    SWSS_LOG_ENTER();
+
+    m_switchIdQuery = switchIdQuery;
+}
+
+void OidRefCounter::removeSwitch(
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    m_hash.erase(switchId);
+}
+
+sai_object_id_t OidRefCounter::getSwitchId(
+        _In_ sai_object_id_t oid) const
+{
+    SWSS_LOG_ENTER();
+
+    if (oid == SAI_NULL_OBJECT_ID || !m_switchIdQuery)
+    {
+        return SAI_NULL_OBJECT_ID;
+    }
+
+    return m_switchIdQuery(oid);
+}
+
+OidRefCounter::ReferenceHash* OidRefCounter::findPartition(
+        _In_ sai_object_id_t oid)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * There are only few switches, so check each partition instead of
+     * querying switch id, since oid may be invalid, and switch id query
+     * would report error for it.
+     */
+
+    for (auto& partition: m_hash)
+    {
+        if (partition.second.find(oid) != partition.second.end())
+        {
+            return &partition.second;
+        }
+    }
+
+    return nullptr;
+}
+
+const OidRefCounter::ReferenceHash* OidRefCounter::findPartition(
+        _In_ sai_object_id_t oid) const
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& partition: m_hash)
+    {
+        if (partition.second.find(oid) != partition.second.end())
+        {
+            return &partition.second;
+        }
+    }
+
+    return nullptr;
+}
+
 bool OidRefCounter::objectReferenceExists(
         _In_ sai_object_id_t oid) const
 {
     SWSS_LOG_ENTER();
 
-    bool exists = m_hash.find(oid) != m_hash.end();
+    bool exists = findPartition(oid) != nullptr;
 
     SWSS_LOG_DEBUG("object 0x%" PRIx64 " reference: %s", oid, exists ? "exists" : "missing");
 
@@ -36,14 +103,18 @@ void OidRefCounter::objectReferenceIncrement(
         return;
     }
 
-    if (!objectReferenceExists(oid))
+    auto partition = findPartition(oid);
+
+    if (partition == nullptr)
     {
         SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " not in reference map", oid);
     }
 
-    m_hash[oid]++;
+    auto& count = partition->at(oid);
 
-    SWSS_LOG_DEBUG("increased reference on oid 0x%" PRIx64 " to %d", oid, m_hash[oid]);
+    count++;
+
+    SWSS_LOG_DEBUG("increased reference on oid 0x%" PRIx64 " to %d", oid, count);
 }
 
 void OidRefCounter::objectReferenceIncrement(
@@ -68,19 +139,23 @@ void OidRefCounter::objectReferenceDecrement(
         return;
     }
 
-    if (!objectReferenceExists(oid))
+    auto partition = findPartition(oid);
+
+    if (partition == nullptr)
     {
         SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " not in reference map", oid);
     }
 
-    m_hash[oid]--;
+    auto& count = partition->at(oid);
 
-    if (m_hash[oid] < 0)
+    count--;
+
+    if (count < 0)
     {
         SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " reference count is negative!", oid);
     }
 
-    SWSS_LOG_DEBUG("decreased reference on oid 0x%" PRIx64 " to %d", oid, m_hash[oid]);
+    SWSS_LOG_DEBUG("decreased reference on oid 0x%" PRIx64 " to %d", oid, count);
 }
 
 void OidRefCounter::objectReferenceDecrement(
@@ -104,7 +179,7 @@ void OidRefCounter::objectReferenceInsert(
         SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " already in reference map", oid);
     }
 
-    m_hash[oid] = 0;
+    m_hash[getSwitchId(oid)][oid] = 0;
 
     SWSS_LOG_DEBUG("inserted reference on 0x%" PRIx64 "", oid);
 }
@@ -130,7 +205,7 @@ void OidRefCounter::objectReferenceRemove(
 
     SWSS_LOG_DEBUG("removing object oid 0x%" PRIx64 " reference", oid);
 
-    m_hash.erase(oid);
+    findPartition(oid)->erase(oid);
 }
 
 int32_t OidRefCounter::getObjectReferenceCount(
@@ -140,7 +215,7 @@ int32_t OidRefCounter::getObjectReferenceCount(
 
     if (objectReferenceExists(oid))
     {
-        int32_t count = m_hash.at(oid);
+        int32_t count = findPartition(oid)->at(oid);
 
         SWSS_LOG_DEBUG("reference count on oid 0x%" PRIx64 " is %d", oid, count);
 
@@ -162,7 +237,14 @@ std::unordered_map<sai_object_id_t, int32_t> OidRefCounter::getAllReferences() c
 {
     SWSS_LOG_ENTER();
 
-    return m_hash; // copy
+    std::unordered_map<sai_object_id_t, int32_t> hash;
+
+    for (auto& partition: m_hash)
+    {
+        hash.insert(partition.second.begin(), partition.second.end());
+    }
+
+    return hash;
 }
 
 std::vector<sai_object_id_t> OidRefCounter::getAllOids() const
@@ -171,9 +253,12 @@ std::vector<sai_object_id_t> OidRefCounter::getAllOids() const
 
     std::vector<sai_object_id_t> vec;
 
-    for (auto& it: m_hash)
+    for (auto& partition: m_hash)
     {
-        vec.push_back(it.first);
+        for (auto& it: partition.second)
+        {
+            vec.push_back(it.first);
+        }
     }
 
     return vec;
@@ -184,11 +269,13 @@ void OidRefCounter::objectReferenceClear(
 {
     SWSS_LOG_ENTER();
 
-    if (objectReferenceExists(oid))
+    auto partition = findPartition(oid);
+
+    if (partition)
     {
         SWSS_LOG_DEBUG("removing object oid 0x%" PRIx64 " reference", oid);
 
-        m_hash.erase(oid);
+        partition->erase(oid);
     }
     else
     {
@@ -4,6 +4,8 @@ extern "C" {
 #include "sai.h"
 }
 
+#include "SwitchIdQuery.h"
+
 #include <unordered_map>
 #include <vector>
 
@@ -24,6 +26,20 @@ namespace saimeta
              */
             void clear();
 
+            /**
+             * @brief Set function used to partition objects by switch.
+             *
+             * When not set, all objects are in single partition.
+             */
+            void setSwitchIdQuery(
+                    _In_ const SwitchIdQuery& switchIdQuery);
+
+            /**
+             * @brief Remove references of all objects on given switch.
+             */
+            void removeSwitch(
+                    _In_ sai_object_id_t switchId);
+
             /**
              * @brief Check if object reference exists.
              *
@@ -105,12 +121,32 @@ namespace saimeta
 
         private:
 
+            typedef std::unordered_map<sai_object_id_t, int32_t> ReferenceHash;
+
+            sai_object_id_t getSwitchId(
+                    _In_ sai_object_id_t oid) const;
+
             /**
-             * @brief Object id to reference count hash.
+             * @brief Find partition containing given object.
+             *
+             * Returns nullptr if object reference don't exist.
+             */
+            ReferenceHash* findPartition(
+                    _In_ sai_object_id_t oid);
+
+            const ReferenceHash* findPartition(
+                    _In_ sai_object_id_t oid) const;
+
+        private:
+
+            /**
+             * @brief Object id to reference count hash per switch.
              *
              * Object may exist in the hash, and have reference count 0, which
              * means is not not used anywhere and can be safely removed.
              */
-            std::unordered_map<sai_object_id_t, int32_t> m_hash;
+            std::unordered_map<sai_object_id_t, ReferenceHash> m_hash;
+
+            SwitchIdQuery m_switchIdQuery;
     };
 }
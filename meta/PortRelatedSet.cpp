@@ -20,7 +20,7 @@ void PortRelatedSet::insert(
         SWSS_LOG_THROW("portId is NULL");
     }
 
-    m_mapset[portId].insert(relatedObjectId);
+    m_mapset[getSwitchId(portId)][portId].insert(relatedObjectId);
 }
 
 const std::set<sai_object_id_t> PortRelatedSet::getPortRelatedObjects(
@@ -28,11 +28,16 @@ const std::set<sai_object_id_t> PortRelatedSet::getPortRelatedObjects(
 {
     SWSS_LOG_ENTER();
 
-    auto it = m_mapset.find(portId);
+    // port id may be invalid, so check each switch instead of query
 
-    if (it != m_mapset.end())
+    for (auto& sit: m_mapset)
     {
-        return it->second;
+        auto it = sit.second.find(portId);
+
+        if (it != sit.second.end())
+        {
+            return it->second;
+        }
     }
 
     return { };
@@ -50,11 +55,9 @@ void PortRelatedSet::removePort(
 {
     SWSS_LOG_ENTER();
 
-    auto it = m_mapset.find(portId);
-
-    if (it != m_mapset.end())
+    for (auto& sit: m_mapset)
     {
-        m_mapset.erase(it);
+        sit.second.erase(portId);
     }
 }
 
@@ -64,10 +67,42 @@ std::vector<sai_object_id_t> PortRelatedSet::getAllPorts() const
 
     std::vector<sai_object_id_t> vec;
 
-    for (auto& it: m_mapset)
+    for (auto& sit: m_mapset)
     {
-        vec.push_back(it.first);
+        for (auto& it: sit.second)
+        {
+            vec.push_back(it.first);
+        }
     }
 
     return vec;
 }
+
+void PortRelatedSet::setSwitchIdQuery(
+        _In_ const SwitchIdQuery& switchIdQuery)
+{
+    SWSS_LOG_ENTER();
+
+    m_switchIdQuery = switchIdQuery;
+}
+
+void PortRelatedSet::removeSwitch(
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    m_mapset.erase(switchId);
+}
+
+sai_object_id_t PortRelatedSet::getSwitchId(
+        _In_ sai_object_id_t portId) const
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_switchIdQuery)
+    {
+        return SAI_NULL_OBJECT_ID;
+    }
+
+    return m_switchIdQuery(portId);
+}
@@ -4,6 +4,8 @@ extern "C" {
 #include "sai.h"
 }
 
+#include "SwitchIdQuery.h"
+
 #include <map>
 #include <set>
 #include <vector>
@@ -34,8 +36,32 @@ namespace saimeta
 
             std::vector<sai_object_id_t> getAllPorts() const;
 
+            /**
+             * @brief Set function used to partition ports by switch.
+             *
+             * When not set, all ports are in single partition.
+             */
+            void setSwitchIdQuery(
+                    _In_ const SwitchIdQuery& switchIdQuery);
+
+            /**
+             * @brief Remove all ports of given switch.
+             */
+            void removeSwitch(
+                    _In_ sai_object_id_t switchId);
+
+        private:
+
+            sai_object_id_t getSwitchId(
+                    _In_ sai_object_id_t portId) const;
+
         private:
 
-            std::map<sai_object_id_t, std::set<sai_object_id_t>> m_mapset;
+            /**
+             * @brief Port related objects per switch.
+             */
+            std::map<sai_object_id_t, std::map<sai_object_id_t, std::set<sai_object_id_t>>> m_mapset;
+
+            SwitchIdQuery m_switchIdQuery;
     };
 }
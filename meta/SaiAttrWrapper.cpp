@@ -67,3 +67,42 @@ sai_attr_id_t SaiAttrWrapper::getAttrId() const
 
     return m_attr.id;
 }
+
+size_t SaiAttrWrapper::getMemoryUsage() const
+{
+    SWSS_LOG_ENTER();
+
+    size_t size = sizeof(SaiAttrWrapper);
+
+    const auto& value = m_attr.value;
+
+    switch (m_meta->attrvaluetype)
+    {
+        case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+            return size + value.objlist.count * sizeof(sai_object_id_t);
+
+        case SAI_ATTR_VALUE_TYPE_UINT8_LIST:
+            return size + value.u8list.count * sizeof(uint8_t);
+
+        case SAI_ATTR_VALUE_TYPE_INT8_LIST:
+            return size + value.s8list.count * sizeof(int8_t);
+
+        case SAI_ATTR_VALUE_TYPE_UINT32_LIST:
+            return size + value.u32list.count * sizeof(uint32_t);
+
+        case SAI_ATTR_VALUE_TYPE_INT32_LIST:
+            return size + value.s32list.count * sizeof(int32_t);
+
+        case SAI_ATTR_VALUE_TYPE_VLAN_LIST:
+            return size + value.vlanlist.count * sizeof(sai_vlan_id_t);
+
+        case SAI_ATTR_VALUE_TYPE_QOS_MAP_LIST:
+            return size + value.qosmap.count * sizeof(sai_qos_map_t);
+
+        default:
+
+            // other lists are rare, count only attribute itself
+
+            return size;
+    }
+}
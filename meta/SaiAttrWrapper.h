@@ -26,6 +26,12 @@ namespace saimeta
 
             sai_attr_id_t getAttrId() const;
 
+            /**
+             * @brief Get approximate memory used by attribute including
+             * allocated list.
+             */
+            size_t getMemoryUsage() const;
+
         private:
 
             SaiAttrWrapper(const SaiAttrWrapper&) = delete;
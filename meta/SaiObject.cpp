@@ -4,6 +4,8 @@
 
 #include "sai_serialize.h"
 
+#include <algorithm>
+
 using namespace saimeta;
 
 SaiObject::SaiObject(
@@ -30,7 +32,7 @@ bool SaiObject::hasAttr(
 {
     SWSS_LOG_ENTER();
 
-    return m_attrs.find(id) != m_attrs.end();
+    return findAttr(id) != m_attrs.end();
 }
 
 const sai_object_meta_key_t& SaiObject::getMetaKey() const
@@ -40,13 +42,27 @@ const sai_object_meta_key_t& SaiObject::getMetaKey() const
     return m_metaKey;
 }
 
+std::vector<std::shared_ptr<SaiAttrWrapper>>::const_iterator SaiObject::findAttr(
+        _In_ sai_attr_id_t id) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = std::lower_bound(m_attrs.begin(), m_attrs.end(), id,
+            [](const std::shared_ptr<SaiAttrWrapper>& attr, sai_attr_id_t attrId) { return attr->getAttrId() < attrId; });
+
+    if (it != m_attrs.end() && (*it)->getAttrId() == id)
+        return it;
+
+    return m_attrs.end();
+}
+
 void SaiObject::setAttr(
         _In_ const sai_attr_metadata_t* md,
         _In_ const sai_attribute_t *attr)
 {
     SWSS_LOG_ENTER();
 
-    m_attrs[attr->id] = std::make_shared<SaiAttrWrapper>(md, *attr);
+    setAttr(std::make_shared<SaiAttrWrapper>(md, *attr));
 }
 
 void SaiObject::setAttr(
@@ -54,7 +70,18 @@ void SaiObject::setAttr(
 {
     SWSS_LOG_ENTER();
 
-    m_attrs[attr->getAttrId()] = attr;
+    sai_attr_id_t id = attr->getAttrId();
+
+    auto it = std::lower_bound(m_attrs.begin(), m_attrs.end(), id,
+            [](const std::shared_ptr<SaiAttrWrapper>& a, sai_attr_id_t attrId) { return a->getAttrId() < attrId; });
+
+    if (it != m_attrs.end() && (*it)->getAttrId() == id)
+    {
+        *it = attr;
+        return;
+    }
+
+    m_attrs.insert(it, attr);
 }
 
 std::shared_ptr<SaiAttrWrapper> SaiObject::getAttr(
@@ -62,10 +89,10 @@ std::shared_ptr<SaiAttrWrapper> SaiObject::getAttr(
 {
     SWSS_LOG_ENTER();
 
-    auto it = m_attrs.find(id);
+    auto it = findAttr(id);
 
     if (it != m_attrs.end())
-        return it->second;
+        return *it;
 
     return nullptr;
 }
@@ -74,10 +101,19 @@ std::vector<std::shared_ptr<SaiAttrWrapper>> SaiObject::getAttributes() const
 {
     SWSS_LOG_ENTER();
 
-    std::vector<std::shared_ptr<SaiAttrWrapper>> values;
+    return m_attrs;
+}
+
+size_t SaiObject::getMemoryUsage() const
+{
+    SWSS_LOG_ENTER();
+
+    size_t size = sizeof(SaiObject) + m_attrs.capacity() * sizeof(std::shared_ptr<SaiAttrWrapper>);
 
-    for (auto&kvp: m_attrs)
-        values.push_back(kvp.second);
+    for (auto& attr: m_attrs)
+    {
+        size += attr->getMemoryUsage() / (size_t)std::max<long>(1, attr.use_count());
+    }
 
-    return values;
+    return size;
 }
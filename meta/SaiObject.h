@@ -43,10 +43,29 @@ namespace saimeta
 
             std::vector<std::shared_ptr<SaiAttrWrapper>> getAttributes() const;
 
+            /**
+             * @brief Get approximate memory used by object and its attributes.
+             *
+             * Memory of attributes shared with other objects is divided
+             * between all users.
+             */
+            size_t getMemoryUsage() const;
+
+        private:
+
+            std::vector<std::shared_ptr<SaiAttrWrapper>>::const_iterator findAttr(
+                    _In_ sai_attr_id_t id) const;
+
         private:
 
             sai_object_meta_key_t m_metaKey;
 
-            std::unordered_map<sai_attr_id_t, std::shared_ptr<SaiAttrWrapper>> m_attrs;
+            /**
+             * @brief Object attributes sorted by attribute id.
+             *
+             * Objects have usually only few attributes, so sorted vector
+             * is much more compact than hash map and lookup is as fast.
+             */
+            std::vector<std::shared_ptr<SaiAttrWrapper>> m_attrs;
     };
 }
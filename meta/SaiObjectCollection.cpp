@@ -2,13 +2,102 @@
 
 #include "sai_serialize.h"
 
+#include <algorithm>
+
+#define ATTR_POOL_MAX_LIST_COUNT 16
+#define ATTR_POOL_MIN_PURGE_SIZE 1024
+
 using namespace saimeta;
 
+SaiObjectCollection::SaiObjectCollection():
+    m_attrPoolPurgeSize(ATTR_POOL_MIN_PURGE_SIZE)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
 void SaiObjectCollection::clear()
 {
     SWSS_LOG_ENTER();
 
     m_objects.clear();
+
+    m_attrPool.clear();
+
+    m_attrPoolPurgeSize = ATTR_POOL_MIN_PURGE_SIZE;
+}
+
+void SaiObjectCollection::setSwitchIdQuery(
+        _In_ const SwitchIdQuery& switchIdQuery)
+{
+    SWSS_LOG_ENTER();
+
+    m_switchIdQuery = switchIdQuery;
+}
+
+void SaiObjectCollection::removeSwitch(
+        _In_ sai_object_id_t switchId)
+{
+    SWSS_LOG_ENTER();
+
+    m_objects.erase(switchId);
+}
+
+sai_object_id_t SaiObjectCollection::getSwitchId(
+        _In_ const sai_object_meta_key_t& metaKey) const
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_switchIdQuery)
+    {
+        return SAI_NULL_OBJECT_ID;
+    }
+
+    // we guarantee that switch_id is first in the key structure so we can
+    // use that as object_id as well
+
+    return m_switchIdQuery(metaKey.objectkey.key.object_id);
+}
+
+SaiObjectCollection::ObjectHash* SaiObjectCollection::findPartition(
+        _In_ const sai_object_meta_key_t& metaKey)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * There are only few switches, so check each partition instead of
+     * querying switch id, since key may contain invalid object id, and
+     * switch id query would report error for it.
+     */
+
+    for (auto& sit: m_objects)
+    {
+        if (sit.second.find(metaKey) != sit.second.end())
+        {
+            return &sit.second;
+        }
+    }
+
+    return nullptr;
+}
+
+std::shared_ptr<SaiObject> SaiObjectCollection::findObject(
+        _In_ const sai_object_meta_key_t& metaKey) const
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& sit: m_objects)
+    {
+        auto it = sit.second.find(metaKey);
+
+        if (it != sit.second.end())
+        {
+            return it->second;
+        }
+    }
+
+    return nullptr;
 }
 
 bool SaiObjectCollection::objectExists(
@@ -16,7 +105,7 @@ bool SaiObjectCollection::objectExists(
 {
     SWSS_LOG_ENTER();
 
-    bool exists = m_objects.find(metaKey) != m_objects.end();
+    bool exists = findObject(metaKey) != nullptr;
 
     return exists;
 }
@@ -34,7 +123,7 @@ void SaiObjectCollection::createObject(
                 sai_serialize_object_meta_key(metaKey).c_str());
     }
 
-    m_objects[metaKey] = obj;
+    m_objects[getSwitchId(metaKey)][metaKey] = obj;
 }
 
 void SaiObjectCollection::removeObject(
@@ -42,13 +131,15 @@ void SaiObjectCollection::removeObject(
 {
     SWSS_LOG_ENTER();
 
-    if (!objectExists(metaKey))
+    auto partition = findPartition(metaKey);
+
+    if (partition == nullptr)
     {
         SWSS_LOG_THROW("FATAL: object %s doesn't exist",
                 sai_serialize_object_meta_key(metaKey).c_str());
     }
 
-    m_objects.erase(metaKey);
+    partition->erase(metaKey);
 }
 
 void SaiObjectCollection::setObjectAttr(
@@ -58,13 +149,170 @@ void SaiObjectCollection::setObjectAttr(
 {
     SWSS_LOG_ENTER();
 
-    if (!objectExists(metaKey))
+    auto obj = findObject(metaKey);
+
+    if (obj == nullptr)
     {
         SWSS_LOG_THROW("FATAL: object %s doesn't exist",
                 sai_serialize_object_meta_key(metaKey).c_str());
     }
 
-    m_objects[metaKey]->setAttr(&md, attr);
+    obj->setAttr(getInternedAttr(md, *attr));
+}
+
+static void appendBytes(
+        _Inout_ std::string& key,
+        _In_ const void* data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    key.append(static_cast<const char*>(data), size);
+}
+
+template <typename T>
+static bool appendList(
+        _Inout_ std::string& key,
+        _In_ const T& list)
+{
+    SWSS_LOG_ENTER();
+
+    if (list.count > ATTR_POOL_MAX_LIST_COUNT || (list.count && list.list == nullptr))
+        return false;
+
+    appendBytes(key, &list.count, sizeof(list.count));
+    appendBytes(key, list.list, list.count * sizeof(*list.list));
+
+    return true;
+}
+
+/**
+ * @brief Construct attribute pool key.
+ *
+ * Key contains only bytes of actual value, so the same values will have the
+ * same key. Only value types which are commonly repeated between objects,
+ * like enums, flags and object ids, are shared. Addresses, names and 64 bit
+ * values are usually unique per object, and keeping them in pool would
+ * only add pool entry to each attribute.
+ *
+ * @return True if attribute can be shared, false otherwise.
+ */
+static bool getAttrPoolKey(
+        _In_ const sai_attr_metadata_t& md,
+        _In_ const sai_attribute_t& attr,
+        _Out_ std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    const sai_attr_metadata_t* pmd = &md;
+
+    key.clear();
+
+    appendBytes(key, &pmd, sizeof(pmd));
+
+    const auto& value = attr.value;
+
+    switch (md.attrvaluetype)
+    {
+        case SAI_ATTR_VALUE_TYPE_BOOL:
+            appendBytes(key, &value.booldata, sizeof(value.booldata));
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_UINT8:
+        case SAI_ATTR_VALUE_TYPE_INT8:
+            appendBytes(key, &value.u8, sizeof(value.u8));
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_UINT16:
+        case SAI_ATTR_VALUE_TYPE_INT16:
+            appendBytes(key, &value.u16, sizeof(value.u16));
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_UINT32:
+        case SAI_ATTR_VALUE_TYPE_INT32:
+            appendBytes(key, &value.u32, sizeof(value.u32));
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+            appendBytes(key, &value.oid, sizeof(value.oid));
+            return true;
+
+        case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+            return appendList(key, value.objlist);
+
+        case SAI_ATTR_VALUE_TYPE_INT32_LIST:
+            return appendList(key, value.s32list);
+
+        default:
+            return false;
+    }
+}
+
+std::shared_ptr<SaiAttrWrapper> SaiObjectCollection::getInternedAttr(
+        _In_ const sai_attr_metadata_t& md,
+        _In_ const sai_attribute_t& attr)
+{
+    SWSS_LOG_ENTER();
+
+    std::string key;
+
+    if (!getAttrPoolKey(md, attr, key))
+    {
+        return std::make_shared<SaiAttrWrapper>(&md, attr);
+    }
+
+    /*
+     * Pool is keyed only by hash of value, on hash collision key of pooled
+     * attribute is constructed again and compared, so pool don't need to
+     * keep copy of the key.
+     */
+
+    size_t hash = std::hash<std::string>()(key);
+
+    auto range = m_attrPool.equal_range(hash);
+
+    std::string pooledKey;
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        auto wrapper = it->second.lock();
+
+        if (wrapper == nullptr)
+        {
+            continue;
+        }
+
+        getAttrPoolKey(*wrapper->getSaiAttrMetadata(), *wrapper->getSaiAttr(), pooledKey);
+
+        if (pooledKey == key)
+        {
+            return wrapper;
+        }
+    }
+
+    /*
+     * Wrapper is not allocated with make_shared, so expired pool entry keeps
+     * only control block until it's purged, and not entire wrapper.
+     */
+
+    auto wrapper = std::shared_ptr<SaiAttrWrapper>(new SaiAttrWrapper(&md, attr));
+
+    m_attrPool.emplace(hash, wrapper);
+
+    if (m_attrPool.size() >= m_attrPoolPurgeSize)
+    {
+        for (auto it = m_attrPool.begin(); it != m_attrPool.end(); )
+        {
+            if (it->second.expired())
+                it = m_attrPool.erase(it);
+            else
+                ++it;
+        }
+
+        m_attrPoolPurgeSize = std::max<size_t>(ATTR_POOL_MIN_PURGE_SIZE, 2 * m_attrPool.size());
+    }
+
+    return wrapper;
 }
 
 std::shared_ptr<SaiAttrWrapper> SaiObjectCollection::getObjectAttr(
@@ -79,9 +327,9 @@ std::shared_ptr<SaiAttrWrapper> SaiObjectCollection::getObjectAttr(
      * should make exists check before.
      */
 
-    auto it = m_objects.find(metaKey);
+    auto obj = findObject(metaKey);
 
-    if (it == m_objects.end())
+    if (obj == nullptr)
     {
         SWSS_LOG_ERROR("object key %s not found",
                 sai_serialize_object_meta_key(metaKey).c_str());
@@ -89,7 +337,7 @@ std::shared_ptr<SaiAttrWrapper> SaiObjectCollection::getObjectAttr(
         return nullptr;
     }
 
-    return it->second->getAttr(id);
+    return obj->getAttr(id);
 }
 
 std::vector<std::shared_ptr<SaiObject>> SaiObjectCollection::getObjectsByObjectType(
@@ -99,10 +347,13 @@ std::vector<std::shared_ptr<SaiObject>> SaiObjectCollection::getObjectsByObjectT
 
     std::vector<std::shared_ptr<SaiObject>> vec;
 
-    for (auto& kvp: m_objects)
+    for (auto& sit: m_objects)
     {
-        if (kvp.second->getObjectType() == objectType)
-            vec.push_back(kvp.second);
+        for (auto& kvp: sit.second)
+        {
+            if (kvp.second->getObjectType() == objectType)
+                vec.push_back(kvp.second);
+        }
     }
 
     return vec;
@@ -113,13 +364,59 @@ std::shared_ptr<SaiObject> SaiObjectCollection::getObject(
 {
     SWSS_LOG_ENTER();
 
-    if (!objectExists(metaKey))
+    auto obj = findObject(metaKey);
+
+    if (obj == nullptr)
     {
         SWSS_LOG_THROW("FATAL: object %s doesn't exist",
                 sai_serialize_object_meta_key(metaKey).c_str());
     }
 
-    return m_objects.at(metaKey);
+    return obj;
+}
+
+std::map<sai_object_type_t, SaiObjectCollection::MemoryUsage> SaiObjectCollection::getMemoryUsage() const
+{
+    SWSS_LOG_ENTER();
+
+    std::map<sai_object_type_t, MemoryUsage> usage;
+
+    for (auto& sit: m_objects)
+    {
+        for (auto& kvp: sit.second)
+        {
+            auto& mu = usage[kvp.first.objecttype];
+
+            mu.objects++;
+            mu.attributes += kvp.second->getAttributes().size();
+            mu.bytes += kvp.second->getMemoryUsage();
+        }
+    }
+
+    return usage;
+}
+
+SaiObjectCollection::MemoryUsage SaiObjectCollection::getAttrPoolMemoryUsage() const
+{
+    SWSS_LOG_ENTER();
+
+    MemoryUsage mu = { 0, 0, 0 };
+
+    for (auto& kvp: m_attrPool)
+    {
+        if (!kvp.second.expired())
+        {
+            mu.attributes++;
+        }
+    }
+
+    // pool entry is node with hash and weak pointer, and bucket pointer
+
+    mu.objects = m_attrPool.size();
+    mu.bytes = m_attrPool.size() * (sizeof(void*) + sizeof(size_t) + sizeof(std::weak_ptr<SaiAttrWrapper>))
+        + m_attrPool.bucket_count() * sizeof(void*);
+
+    return mu;
 }
 
 std::vector<sai_object_meta_key_t> SaiObjectCollection::getAllKeys() const
@@ -128,9 +425,12 @@ std::vector<sai_object_meta_key_t> SaiObjectCollection::getAllKeys() const
 
     std::vector<sai_object_meta_key_t> vec;
 
-    for (auto& it: m_objects)
+    for (auto& sit: m_objects)
     {
-        vec.push_back(it.first);
+        for (auto& it: sit.second)
+        {
+            vec.push_back(it.first);
+        }
     }
 
     return vec;
@@ -3,9 +3,11 @@
 #include "SaiAttrWrapper.h"
 #include "SaiObject.h"
 #include "MetaKeyHasher.h"
+#include "SwitchIdQuery.h"
 
 #include <string>
 #include <unordered_map>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -15,7 +17,19 @@ namespace saimeta
     {
         public:
 
-            SaiObjectCollection() = default;
+            typedef struct _MemoryUsage
+            {
+                size_t objects;
+
+                size_t attributes;
+
+                size_t bytes;
+
+            } MemoryUsage;
+
+        public:
+
+            SaiObjectCollection();
             virtual ~SaiObjectCollection() = default;
 
         private:
@@ -56,9 +70,81 @@ namespace saimeta
 
             std::vector<sai_object_meta_key_t> getAllKeys() const;
 
+            /**
+             * @brief Get approximate memory usage per object type.
+             */
+            std::map<sai_object_type_t, MemoryUsage> getMemoryUsage() const;
+
+            /**
+             * @brief Get approximate memory used by shared attributes pool.
+             *
+             * Objects is number of pool entries, attributes is number of
+             * entries still used by objects.
+             */
+            MemoryUsage getAttrPoolMemoryUsage() const;
+
+            /**
+             * @brief Set function used to partition objects by switch.
+             *
+             * When not set, all objects are in single partition.
+             */
+            void setSwitchIdQuery(
+                    _In_ const SwitchIdQuery& switchIdQuery);
+
+            /**
+             * @brief Remove all objects of given switch.
+             */
+            void removeSwitch(
+                    _In_ sai_object_id_t switchId);
+
         private:
 
-            std::unordered_map<sai_object_meta_key_t, std::shared_ptr<SaiObject>, MetaKeyHasher, MetaKeyHasher> m_objects;
+            typedef std::unordered_map<sai_object_meta_key_t, std::shared_ptr<SaiObject>, MetaKeyHasher, MetaKeyHasher> ObjectHash;
+
+            sai_object_id_t getSwitchId(
+                    _In_ const sai_object_meta_key_t& metaKey) const;
+
+            /**
+             * @brief Find partition containing given object.
+             *
+             * Returns nullptr if object don't exist.
+             */
+            ObjectHash* findPartition(
+                    _In_ const sai_object_meta_key_t& metaKey);
+
+            std::shared_ptr<SaiObject> findObject(
+                    _In_ const sai_object_meta_key_t& metaKey) const;
+
+            /**
+             * @brief Get attribute wrapper for given value.
+             *
+             * Attributes with the same value, like next hop OID on thousands
+             * of routes, share single wrapper, since wrappers are never
+             * modified. Only attributes without lists or with short lists
+             * are shared.
+             */
+            std::shared_ptr<SaiAttrWrapper> getInternedAttr(
+                    _In_ const sai_attr_metadata_t& md,
+                    _In_ const sai_attribute_t& attr);
+
+        private:
+
+            /**
+             * @brief Objects per switch.
+             */
+            std::unordered_map<sai_object_id_t, ObjectHash> m_objects;
+
+            SwitchIdQuery m_switchIdQuery;
+
+            /**
+             * @brief Pool of shared attributes.
+             *
+             * Key is hash of attribute metadata and value bytes. Expired
+             * entries are removed when pool size reaches purge size.
+             */
+            std::unordered_multimap<size_t, std::weak_ptr<SaiAttrWrapper>> m_attrPool;
+
+            size_t m_attrPoolPurgeSize;
 
     };
 }
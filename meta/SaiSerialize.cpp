@@ -722,6 +722,28 @@ std::string sai_serialize_number(
     return sai_serialize_number<uint32_t>(number, hex);
 }
 
+std::string sai_serialize_counter_list(
+        _In_ uint32_t count,
+        _In_ const uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    std::string s;
+
+    s.reserve(count * 8);
+
+    char buf[32];
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        int len = snprintf(buf, sizeof(buf), idx ? ",%" PRIu64 : "%" PRIu64, counters[idx]);
+
+        s.append(buf, (size_t)len);
+    }
+
+    return s;
+}
+
 std::string sai_serialize_attr_id(
         _In_ const sai_attr_metadata_t& meta)
 {
@@ -2500,6 +2522,47 @@ void sai_deserialize_number(
     sai_deserialize_number<uint32_t>(s, number, hex);
 }
 
+void sai_deserialize_counter_list(
+        _In_ const std::string& s,
+        _In_ uint32_t count,
+        _Out_ uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    const char* ptr = s.c_str();
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        if (idx)
+        {
+            if (*ptr != ',')
+            {
+                SWSS_LOG_THROW("expected %u counters in '%s'", count, s.c_str());
+            }
+
+            ptr++;
+        }
+
+        char *endptr = NULL;
+
+        errno = 0;
+
+        counters[idx] = strtoull(ptr, &endptr, 10);
+
+        if (errno != 0 || endptr == ptr)
+        {
+            SWSS_LOG_THROW("invalid counter at index %u in '%s'", idx, s.c_str());
+        }
+
+        ptr = endptr;
+    }
+
+    if (*ptr != 0)
+    {
+        SWSS_LOG_THROW("expected %u counters in '%s'", count, s.c_str());
+    }
+}
+
 void sai_deserialize_enum(
         _In_ const std::string& s,
         _In_ const sai_enum_metadata_t *meta,
@@ -0,0 +1,18 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+}
+
+#include <functional>
+
+namespace saimeta
+{
+    /**
+     * @brief Function returning switch id of given object id.
+     *
+     * Used by metadata containers to keep objects partitioned by switch, so
+     * all objects of removed switch can be erased at once.
+     */
+    typedef std::function<sai_object_id_t(sai_object_id_t)> SwitchIdQuery;
+}
@@ -0,0 +1,163 @@
+#include "WorkerPool.h"
+
+#include "swss/logger.h"
+
+#include <exception>
+#include <algorithm>
+
+using namespace saimeta;
+
+WorkerPool::WorkerPool(
+        _In_ size_t threadCount):
+    m_stop(false)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t idx = 0; idx < threadCount; idx++)
+    {
+        m_threads.emplace_back(&WorkerPool::workerThreadProc, this);
+    }
+
+    SWSS_LOG_NOTICE("started %zu worker threads", threadCount);
+}
+
+WorkerPool::~WorkerPool()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stop = true;
+    }
+
+    m_cv.notify_all();
+
+    for (auto& thread: m_threads)
+    {
+        thread.join();
+    }
+}
+
+size_t WorkerPool::getThreadCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_threads.size();
+}
+
+void WorkerPool::workerThreadProc()
+{
+    SWSS_LOG_ENTER();
+
+    while (true)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_cv.wait(lock, [&]{ return m_stop || !m_tasks.empty(); });
+
+            if (m_tasks.empty())
+            {
+                // stop requested and all tasks are executed
+
+                return;
+            }
+
+            task = std::move(m_tasks.front());
+
+            m_tasks.pop_front();
+        }
+
+        task();
+    }
+}
+
+void WorkerPool::parallelFor(
+        _In_ size_t count,
+        _In_ size_t minChunkSize,
+        _In_ const std::function<void(size_t begin, size_t end)>& fn)
+{
+    SWSS_LOG_ENTER();
+
+    minChunkSize = std::max(minChunkSize, (size_t)1);
+
+    size_t chunks = std::min(m_threads.size() + 1, (count + minChunkSize - 1) / minChunkSize);
+
+    if (chunks <= 1)
+    {
+        if (count)
+        {
+            fn(0, count);
+        }
+
+        return;
+    }
+
+    size_t chunkSize = (count + chunks - 1) / chunks;
+
+    std::vector<std::exception_ptr> errors(chunks);
+
+    std::mutex doneMutex;
+
+    std::condition_variable doneCv;
+
+    size_t pending = chunks - 1;
+
+    auto runChunk = [&](size_t chunk) {
+
+        size_t begin = chunk * chunkSize;
+        size_t end = std::min(begin + chunkSize, count);
+
+        try
+        {
+            if (begin < end)
+            {
+                fn(begin, end);
+            }
+        }
+        catch (...)
+        {
+            errors[chunk] = std::current_exception();
+        }
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for (size_t chunk = 1; chunk < chunks; chunk++)
+        {
+            m_tasks.push_back([&, chunk]{
+
+                runChunk(chunk);
+
+                std::lock_guard<std::mutex> doneLock(doneMutex);
+
+                if (--pending == 0)
+                {
+                    doneCv.notify_one();
+                }
+            });
+        }
+    }
+
+    m_cv.notify_all();
+
+    runChunk(0);
+
+    {
+        std::unique_lock<std::mutex> lock(doneMutex);
+
+        doneCv.wait(lock, [&]{ return pending == 0; });
+    }
+
+    for (auto& error: errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
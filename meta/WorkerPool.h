@@ -0,0 +1,69 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+
+namespace saimeta
+{
+    /**
+     * @brief Fixed size pool of worker threads.
+     *
+     * Used to split data parallel work, like validation of bulk entries in
+     * metadata or deserialize and translate of bulk entries in syncd, into
+     * chunks. Calling thread also executes one of the
+     * chunks, so pool with N threads runs N + 1 chunks at the same time.
+     */
+    class WorkerPool
+    {
+        public:
+
+            WorkerPool(
+                    _In_ size_t threadCount);
+
+            virtual ~WorkerPool();
+
+        private:
+
+            WorkerPool(const WorkerPool&) = delete;
+            WorkerPool& operator=(const WorkerPool&) = delete;
+
+        public:
+
+            /**
+             * @brief Execute function on range [0, count) split into chunks.
+             *
+             * Chunks are at least minChunkSize long, and function returns when
+             * all chunks are executed. When chunks throw, exception from the
+             * chunk with lowest index is thrown again, so the result is the same
+             * as when range is executed serially by single thread.
+             */
+            void parallelFor(
+                    _In_ size_t count,
+                    _In_ size_t minChunkSize,
+                    _In_ const std::function<void(size_t begin, size_t end)>& fn);
+
+            size_t getThreadCount() const;
+
+        private:
+
+            void workerThreadProc();
+
+        private:
+
+            std::vector<std::thread> m_threads;
+
+            std::mutex m_mutex;
+
+            std::condition_variable m_cv;
+
+            std::deque<std::function<void()>> m_tasks;
+
+            bool m_stop;
+    };
+}
@@ -199,6 +199,13 @@ std::string sai_serialize_number(
         _In_ uint32_t number,
         _In_ bool hex = false);
 
+/**
+ * @brief Serialize counters as comma separated decimal numbers.
+ */
+std::string sai_serialize_counter_list(
+        _In_ uint32_t count,
+        _In_ const uint64_t *counters);
+
 std::string sai_serialize_attr_id(
         _In_ const sai_attr_metadata_t& meta);
 
@@ -271,6 +278,14 @@ void sai_deserialize_number(
         _Out_ uint32_t& number,
         _In_ bool hex = false);
 
+/**
+ * @brief Deserialize exactly count comma separated counters.
+ */
+void sai_deserialize_counter_list(
+        _In_ const std::string& s,
+        _In_ uint32_t count,
+        _Out_ uint64_t *counters);
+
 void sai_deserialize_status(
         _In_ const std::string& s,
         _Out_ sai_status_t& status);
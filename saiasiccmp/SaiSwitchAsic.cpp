@@ -279,6 +279,14 @@ void SaiSwitchAsic::onPostPortCreate(
     SWSS_LOG_THROW("not implemented");
 }
 
+void SaiSwitchAsic::onPostPortsCreate(
+        _In_ const std::vector<sai_object_id_t>& portRids)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_THROW("not implemented");
+}
+
 void SaiSwitchAsic::postPortRemove(
         _In_ sai_object_id_t portRid)
 {
@@ -287,6 +295,14 @@ void SaiSwitchAsic::postPortRemove(
     SWSS_LOG_THROW("not implemented");
 }
 
+void SaiSwitchAsic::postPortsRemove(
+        _In_ const std::vector<sai_object_id_t>& portRids)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_THROW("not implemented");
+}
+
 void SaiSwitchAsic::collectPortRelatedObjects(
         _In_ sai_object_id_t portRid)
 {
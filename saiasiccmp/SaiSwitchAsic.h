@@ -68,9 +68,15 @@ namespace saiasiccmp
                     _In_ sai_object_id_t port_rid,
                     _In_ sai_object_id_t port_vid) override;
 
+            virtual void onPostPortsCreate(
+                    _In_ const std::vector<sai_object_id_t>& portRids) override;
+
             virtual void postPortRemove(
                     _In_ sai_object_id_t portRid) override;
 
+            virtual void postPortsRemove(
+                    _In_ const std::vector<sai_object_id_t>& portRids) override;
+
             virtual void collectPortRelatedObjects(
                     _In_ sai_object_id_t portRid) override;
 
@@ -0,0 +1,830 @@
+#include "SaiDump.h"
+
+#include "swss/json.hpp"
+#include "meta/sai_serialize.h"
+#include "sairediscommon.h"
+#include "VirtualObjectIdManager.h"
+
+#include <inttypes.h>
+#include <set>
+#include <sstream>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+
+#include <getopt.h>
+#include <fnmatch.h>
+#include <sys/resource.h>
+
+using namespace swss;
+
+#define DEFAULT_SCAN_BATCH_SIZE 1000
+
+CmdOptions g_cmdOptions;
+
+void printUsage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << "Usage: saidump [-t] [-g] [-s] [-b batch] [-o objectType] [-k keyPattern] [-j] [-h]" << std::endl;
+    std::cout << "    -t --tempView:" << std::endl;
+    std::cout << "        Dump temp view" << std::endl;
+    std::cout << "    -g --dumpGraph:" << std::endl;
+    std::cout << "        Dump current graph" << std::endl;
+    std::cout << "    -s --stream:" << std::endl;
+    std::cout << "        Stream objects using SCAN in bounded batches instead of loading whole table," << std::endl;
+    std::cout << "        objects are not sorted and may repeat if table is modified during dump" << std::endl;
+    std::cout << "    -b --batchSize:" << std::endl;
+    std::cout << "        Number of keys fetched in single batch in stream mode (default " << DEFAULT_SCAN_BATCH_SIZE << ")" << std::endl;
+    std::cout << "    -o --objectType:" << std::endl;
+    std::cout << "        Dump only objects of given type, e.g. SAI_OBJECT_TYPE_ROUTE_ENTRY" << std::endl;
+    std::cout << "    -k --keyPattern:" << std::endl;
+    std::cout << "        Dump only objects which key (without object type) matches glob pattern" << std::endl;
+    std::cout << "    -j --json:" << std::endl;
+    std::cout << "        Print each object as single line JSON" << std::endl;
+    std::cout << "    -h --help:" << std::endl;
+    std::cout << "        Print out this message" << std::endl;
+}
+
+CmdOptions handleCmdLine(int argc, char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    CmdOptions options;
+
+    options.skipAttributes = false;
+    options.dumpTempView = false;
+    options.dumpGraph = false;
+    options.stream = false;
+    options.json = false;
+    options.batchSize = DEFAULT_SCAN_BATCH_SIZE;
+
+    const char* const optstring = "gtsb:o:k:jh";
+
+    while (true)
+    {
+        static struct option long_options[] =
+        {
+            { "dumpGraph",      no_argument,       0, 'g' },
+            { "tempView",       no_argument,       0, 't' },
+            { "stream",         no_argument,       0, 's' },
+            { "batchSize",      required_argument, 0, 'b' },
+            { "objectType",     required_argument, 0, 'o' },
+            { "keyPattern",     required_argument, 0, 'k' },
+            { "json",           no_argument,       0, 'j' },
+            { "help",           no_argument,       0, 'h' },
+            { 0,                0,                 0,  0  }
+        };
+
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+
+        if (c == -1)
+        {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'g':
+                SWSS_LOG_NOTICE("Dumping graph");
+                options.dumpGraph = true;
+                break;
+
+            case 't':
+                SWSS_LOG_NOTICE("Dumping temp view");
+                options.dumpTempView = true;
+                break;
+
+            case 's':
+                SWSS_LOG_NOTICE("Streaming dump");
+                options.stream = true;
+                break;
+
+            case 'b':
+                {
+                    int batchSize = 0;
+
+                    try
+                    {
+                        size_t pos = 0;
+
+                        batchSize = std::stoi(optarg, &pos);
+
+                        if (pos != strlen(optarg))
+                        {
+                            batchSize = 0;
+                        }
+                    }
+                    catch (const std::exception&)
+                    {
+                        // not a number or out of range, handled below
+                    }
+
+                    if (batchSize <= 0)
+                    {
+                        SWSS_LOG_ERROR("batch size must be positive number: %s", optarg);
+                        std::cerr << "batch size must be positive number: " << optarg << std::endl;
+                        printUsage();
+                        exit(EXIT_FAILURE);
+                    }
+
+                    options.batchSize = (uint32_t)batchSize;
+                }
+                break;
+
+            case 'o':
+                {
+                    std::string objectType = optarg;
+
+                    if (objectType.find("SAI_OBJECT_TYPE_") != 0)
+                    {
+                        objectType = "SAI_OBJECT_TYPE_" + objectType;
+                    }
+
+                    try
+                    {
+                        sai_object_type_t ot;
+                        sai_deserialize_object_type(objectType, ot);
+                    }
+                    catch (const std::exception&)
+                    {
+                        SWSS_LOG_ERROR("invalid object type: %s", optarg);
+                        std::cerr << "invalid object type: " << optarg << std::endl;
+                        printUsage();
+                        exit(EXIT_FAILURE);
+                    }
+
+                    options.objectType = objectType;
+                }
+                break;
+
+            case 'k':
+                options.keyPattern = optarg;
+                break;
+
+            case 'j':
+                options.json = true;
+                break;
+
+            case 'h':
+                printUsage();
+                exit(EXIT_SUCCESS);
+
+            case '?':
+                SWSS_LOG_WARN("unknown option %c", optopt);
+                printUsage();
+                exit(EXIT_FAILURE);
+
+            default:
+                SWSS_LOG_ERROR("getopt_long failure");
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    return options;
+}
+
+size_t get_max_attr_len(const TableMap& map)
+{
+    SWSS_LOG_ENTER();
+
+    size_t max = 0;
+
+    for (const auto&field: map)
+    {
+        max = std::max(max, field.first.length());
+    }
+
+    return max;
+}
+
+std::string pad_string(std::string s, size_t pad)
+{
+    SWSS_LOG_ENTER();
+
+    size_t len = s.length();
+
+    if (len < pad)
+    {
+        s.insert(len, pad - len, ' ');
+    }
+
+    return s;
+}
+
+void print_attributes(size_t indent, const TableMap& map)
+{
+    SWSS_LOG_ENTER();
+
+    size_t max_len = get_max_attr_len(map);
+
+    std::string str_indent = pad_string("", indent);
+
+    for (const auto&field: map)
+    {
+        const sai_attr_metadata_t *meta;
+        sai_deserialize_attr_id(field.first, &meta);
+
+        std::stringstream ss;
+
+        ss << str_indent << pad_string(field.first, max_len) << " : ";
+
+        ss << field.second;
+
+        std::cout << ss.str() << std::endl;
+    }
+}
+
+void print_json(const std::string& key, const TableMap& map)
+{
+    SWSS_LOG_ENTER();
+
+    auto start = key.find_first_of(":");
+
+    nlohmann::json attrs = nlohmann::json::object();
+
+    for (const auto&field: map)
+    {
+        attrs[field.first] = field.second;
+    }
+
+    nlohmann::json j;
+
+    j["type"] = key.substr(0, start);
+    j["id"] = key.substr(start + 1);
+    j["attributes"] = attrs;
+
+    std::cout << j.dump() << "\n";
+}
+
+void print_object(const std::string& key, const TableMap& map)
+{
+    SWSS_LOG_ENTER();
+
+    if (g_cmdOptions.json)
+    {
+        print_json(key, map);
+        return;
+    }
+
+    auto start = key.find_first_of(":");
+    auto str_object_type = key.substr(0, start);
+    auto str_object_id  = key.substr(start + 1);
+
+    std::cout << str_object_type << " " << str_object_id << " " << std::endl;
+
+    size_t indent = 4;
+
+    print_attributes(indent, map);
+
+    std::cout << std::endl;
+}
+
+bool match_filters(const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto start = key.find_first_of(":");
+
+    if (g_cmdOptions.objectType.size() && key.substr(0, start) != g_cmdOptions.objectType)
+    {
+        return false;
+    }
+
+    if (g_cmdOptions.keyPattern.size() &&
+            fnmatch(g_cmdOptions.keyPattern.c_str(), key.substr(start + 1).c_str(), 0) != 0)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+std::string get_scan_pattern(const std::string& table)
+{
+    SWSS_LOG_ENTER();
+
+    std::string pattern = table + ":";
+
+    pattern += g_cmdOptions.objectType.size() ? g_cmdOptions.objectType : "*";
+
+    pattern += ":";
+
+    pattern += g_cmdOptions.keyPattern.size() ? g_cmdOptions.keyPattern : "*";
+
+    return pattern;
+}
+
+// colors are in HSV
+#define GV_ARROW_COLOR  "0.650 0.700 0.700"
+#define GV_ROOT_COLOR   "0.650 0.200 1.000"
+#define GV_NODE_COLOR   "0.650 0.500 1.000"
+
+#define SAI_OBJECT_TYPE_PREFIX_LEN (sizeof("SAI_OBJECT_TYPE_") - 1)
+
+/**
+ * @brief Graph built incrementally one object at a time.
+ *
+ * Only links and object types are kept, so memory is bounded by number of
+ * object types, not by number of objects.
+ */
+struct GraphState
+{
+    std::map<sai_object_type_t,const sai_object_type_info_t*> typemap;
+
+    std::set<std::string> definedlinks;
+
+    std::set<sai_object_type_t> ref;
+    std::set<sai_object_type_t> attrref;
+
+    /**
+     * @brief Get object type info of oid, nullptr when not known.
+     */
+    std::function<const sai_object_type_info_t*(sai_object_id_t)> getOidInfo;
+};
+
+void dumpGraphHeader()
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << "digraph \"SAI Object Dependency Graph\" {" << std::endl;
+    std::cout << "size = \"30,12\"; ratio = fill;" << std::endl;
+    std::cout << "node [ style = filled ];" << std::endl;
+}
+
+void dumpGraphObject(GraphState& gs, const std::string& key, const TableMap& map)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_meta_key_t meta_key;
+    sai_deserialize_object_meta_key(key, meta_key);
+
+    auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
+
+    gs.typemap[info->objecttype] = info;
+
+    // process non object id objects if any
+    for (size_t j = 0; j < info->structmemberscount; ++j)
+    {
+        const sai_struct_member_info_t *m = info->structmembers[j];
+
+        if (m->membervaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
+        {
+            sai_object_id_t member_oid = m->getoid(&meta_key);
+
+            auto member_info = gs.getOidInfo(member_oid);
+
+            if (member_info == nullptr)
+            {
+                // link can't be drawn, error is logged by getOidInfo
+                continue;
+            }
+
+            if (member_info->objecttype == SAI_OBJECT_TYPE_SWITCH)
+            {
+                // skip link of SWITCH to non object id object types, since
+                // all of them contain switch_id
+                continue;
+            }
+
+            std::stringstream ss;
+
+            ss << std::string(member_info->objecttypename + SAI_OBJECT_TYPE_PREFIX_LEN) << " -> "
+            << std::string(info->objecttypename + SAI_OBJECT_TYPE_PREFIX_LEN)
+            << "[ color=\"" << GV_ARROW_COLOR << "\", style = dashed, penwidth = 2 ]";
+
+            std::string link = ss.str();
+
+            if (gs.definedlinks.find(link) != gs.definedlinks.end())
+                continue;
+
+            gs.definedlinks.insert(link);
+
+            std::cout << link << std::endl;
+        }
+    }
+
+    // process attributes for this object
+
+    for (const auto&field: map)
+    {
+        const sai_attr_metadata_t *meta;
+        sai_deserialize_attr_id(field.first, &meta);
+
+        if (!meta->isoidattribute || meta->isreadonly)
+        {
+            // skip non oid attributes and read only attributes
+            continue;
+        }
+
+        sai_attribute_t attr;
+
+        sai_deserialize_attr_value(field.second, *meta, attr, false);
+
+        sai_object_list_t list = { 0, NULL };
+
+        switch (meta->attrvaluetype)
+        {
+            case SAI_ATTR_VALUE_TYPE_OBJECT_ID:
+                list.count = 1;
+                list.list = &attr.value.oid;
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_ID:
+                if (attr.value.aclfield.enable)
+                {
+                    list.count = 1;
+                    list.list = &attr.value.aclfield.data.oid;
+                }
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID:
+                if (attr.value.aclaction.enable)
+                {
+                    list.count = 1;
+                    list.list = &attr.value.aclaction.parameter.oid;
+                }
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+                list = attr.value.objlist;
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_FIELD_DATA_OBJECT_LIST:
+                if (attr.value.aclfield.enable)
+                    list = attr.value.aclfield.data.objlist;
+                break;
+
+            case SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_LIST:
+                if (attr.value.aclaction.enable)
+                    list = attr.value.aclaction.parameter.objlist;
+                break;
+
+            default:
+                SWSS_LOG_THROW("attr value type: %d is not supported, FIXME", meta->attrvaluetype);
+        }
+
+        for (uint32_t i = 0; i < list.count; ++i)
+        {
+            sai_object_id_t oid = list.list[i];
+
+            if (oid == SAI_NULL_OBJECT_ID)
+                continue;
+
+            // this object type is not root, can be in the middle or leaf
+            gs.ref.insert(info->objecttype);
+
+            auto attr_oid_info = gs.getOidInfo(oid);
+
+            if (attr_oid_info == nullptr)
+            {
+                // link can't be drawn, error is logged by getOidInfo
+                continue;
+            }
+
+            std::stringstream ss;
+
+            gs.attrref.insert(attr_oid_info->objecttype);
+
+            ss << std::string(attr_oid_info->objecttypename + SAI_OBJECT_TYPE_PREFIX_LEN) << " -> "
+            << std::string(info->objecttypename + SAI_OBJECT_TYPE_PREFIX_LEN)
+            << "[ color = \"" << GV_ARROW_COLOR << "\" ]";
+
+            std::string link = ss.str();
+
+            if (gs.definedlinks.find(link) != gs.definedlinks.end())
+                continue;
+
+            gs.definedlinks.insert(link);
+
+            std::cout << link << std::endl;
+        }
+
+        sai_deserialize_free_attribute_value(meta->attrvaluetype, attr);
+    }
+}
+
+void dumpGraphFooter(const GraphState& gs)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto t: gs.typemap)
+    {
+        auto ot = t.first;
+        auto info = t.second;
+
+        auto name = std::string(info->objecttypename + SAI_OBJECT_TYPE_PREFIX_LEN);
+
+        if (info->isnonobjectid)
+        {
+            /* non object id leafs */
+
+            std::cout << name << " [ color = plum, shape = rect ];\n";
+            continue;
+        }
+
+        if (gs.ref.find(ot) != gs.ref.end() && gs.attrref.find(ot) != gs.attrref.end())
+        {
+            /* middle nodes */
+
+            std::cout << name << " [ color =\"" << GV_NODE_COLOR << "\" ];\n";
+            continue;
+        }
+
+        if (gs.ref.find(ot) != gs.ref.end() && gs.attrref.find(ot) == gs.attrref.end())
+        {
+            /* leafs */
+
+            std::cout << name << " [ color = palegreen, shape = rect ];\n";
+            continue;
+        }
+
+        if (gs.ref.find(ot) == gs.ref.end() && gs.attrref.find(ot) != gs.attrref.end())
+        {
+            /* roots */
+
+            std::cout << name << " [ color = \"" << GV_ROOT_COLOR << "\" ];\n";
+            continue;
+        }
+
+        /* objects which are there but not referenced nowhere for example STP */
+
+        std::cout << name << " [ color = \"" << GV_ROOT_COLOR << "\", shape = rect ];\n";
+    }
+
+    std::cout << "SWITCH -> PORT [ dir = none, color = red, peripheries = 2, penwidth = 2, style = dashed ];" << std::endl;
+    std::cout << "SWITCH [ color = orange, fillcolor = orange, shape = parallelogram, peripheries = 2 ];" << std::endl;
+    std::cout << "PORT [ color = gold, shape = diamond, peripheries = 2 ];" << std::endl;
+    std::cout << "}" << std::endl;
+}
+
+void dumpGraph(const TableDump& td)
+{
+    SWSS_LOG_ENTER();
+
+    std::map<sai_object_id_t, const sai_object_type_info_t*> oidtypemap;
+
+    // build object type map first
+
+    for (const auto& key: td)
+    {
+        sai_object_meta_key_t meta_key;
+        sai_deserialize_object_meta_key(key.first, meta_key);
+
+        auto info = sai_metadata_get_object_type_info(meta_key.objecttype);
+
+        if (!info->isnonobjectid)
+            oidtypemap[meta_key.objectkey.key.object_id] = info;
+    }
+
+    GraphState gs;
+
+    gs.getOidInfo = [&](sai_object_id_t oid) -> const sai_object_type_info_t* {
+
+        auto it = oidtypemap.find(oid);
+
+        if (it == oidtypemap.end())
+        {
+            // referenced object is missing in ASIC DB, don't abort whole dump
+
+            SWSS_LOG_ERROR("unable to find oid %s in object type map",
+                    sai_serialize_object_id(oid).c_str());
+
+            return nullptr;
+        }
+
+        return it->second;
+    };
+
+    dumpGraphHeader();
+
+    for (const auto& key: td)
+    {
+        // filters select objects which are drawn, same as in stream mode,
+        // referenced objects are still resolved from whole table
+
+        if (!match_filters(key.first))
+            continue;
+
+        dumpGraphObject(gs, key.first, key.second);
+    }
+
+    dumpGraphFooter(gs);
+}
+
+/**
+ * @brief Statistics of streaming dump.
+ */
+struct StreamStats
+{
+    size_t keys;
+
+    size_t batches;
+
+    // total and max time spent waiting on redis for single batch
+    uint64_t redisUs;
+
+    uint64_t maxBatchUs;
+};
+
+/**
+ * @brief Iterate table with SCAN and fetch objects in bounded batches.
+ *
+ * Each SCAN and each pipelined HGETALL batch are separate short redis
+ * commands, so redis is never blocked for whole table and only single batch
+ * is held in memory at a time.
+ */
+void streamTable(
+        DBConnector& db,
+        const std::string& table,
+        std::function<void(const std::string&, const TableMap&)> callback,
+        StreamStats& stats)
+{
+    SWSS_LOG_ENTER();
+
+    // filters are also applied on redis side to reduce number of returned keys
+
+    std::string pattern = get_scan_pattern(table);
+
+    std::string cursor = "0";
+
+    redisContext* ctx = db.getContext();
+
+    do
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        RedisCommand scan;
+
+        scan.format("SCAN %s MATCH %s COUNT %u", cursor.c_str(), pattern.c_str(), g_cmdOptions.batchSize);
+
+        RedisReply r(&db, scan, REDIS_REPLY_ARRAY);
+
+        redisReply* reply = r.getContext();
+
+        cursor = reply->element[0]->str;
+
+        redisReply* keys = reply->element[1];
+
+        std::vector<std::string> batch;
+
+        for (size_t i = 0; i < keys->elements; i++)
+        {
+            std::string key = keys->element[i]->str;
+
+            // skip table name and ':'
+            key = key.substr(table.size() + 1);
+
+            // wildcard in object type part may consume key pattern
+            if (!match_filters(key))
+                continue;
+
+            batch.push_back(key);
+
+            RedisCommand hgetall;
+
+            hgetall.format("HGETALL %s:%s", table.c_str(), key.c_str());
+
+            if (redisAppendFormattedCommand(ctx, hgetall.c_str(), hgetall.length()) != REDIS_OK)
+            {
+                SWSS_LOG_THROW("failed to append HGETALL command: %s", ctx->errstr);
+            }
+        }
+
+        std::vector<TableMap> values(batch.size());
+
+        for (size_t i = 0; i < batch.size(); i++)
+        {
+            redisReply* hreply = nullptr;
+
+            if (redisGetReply(ctx, (void**)&hreply) != REDIS_OK)
+            {
+                SWSS_LOG_THROW("failed to get HGETALL reply: %s", ctx->errstr);
+            }
+
+            RedisReply hr(hreply);
+
+            hr.checkReplyType(REDIS_REPLY_ARRAY);
+
+            for (size_t j = 0; j + 1 < hreply->elements; j += 2)
+            {
+                values[i][hreply->element[j]->str] = hreply->element[j + 1]->str;
+            }
+        }
+
+        auto end = std::chrono::steady_clock::now();
+
+        uint64_t us = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        stats.redisUs += us;
+        stats.maxBatchUs = std::max(stats.maxBatchUs, us);
+        stats.batches++;
+        stats.keys += batch.size();
+
+        for (size_t i = 0; i < batch.size(); i++)
+        {
+            // key could be removed between SCAN and HGETALL
+            if (values[i].size())
+            {
+                callback(batch[i], values[i]);
+            }
+        }
+    }
+    while (cursor != "0");
+}
+
+int streamDump(
+        DBConnector& db,
+        const std::string& table)
+{
+    SWSS_LOG_ENTER();
+
+    StreamStats stats = {};
+
+    if (g_cmdOptions.dumpGraph)
+    {
+        // object type is encoded in VID, so no index over all objects is needed
+
+        GraphState gs;
+
+        gs.getOidInfo = [](sai_object_id_t oid) {
+
+            auto ot = sairedis::VirtualObjectIdManager::objectTypeQuery(oid);
+
+            auto info = sai_metadata_get_object_type_info(ot);
+
+            if (info == nullptr)
+            {
+                SWSS_LOG_ERROR("unable to get object type of oid %s",
+                        sai_serialize_object_id(oid).c_str());
+            }
+
+            return info;
+        };
+
+        dumpGraphHeader();
+
+        streamTable(db, table, [&](const std::string& key, const TableMap& map) { dumpGraphObject(gs, key, map); }, stats);
+
+        dumpGraphFooter(gs);
+    }
+    else
+    {
+        streamTable(db, table, print_object, stats);
+    }
+
+    std::cout << std::flush;
+
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    std::cerr
+        << "objects: " << stats.keys
+        << ", batches: " << stats.batches
+        << ", redis time: " << stats.redisUs << " us"
+        << ", max batch time: " << stats.maxBatchUs << " us"
+        << ", peak RSS: " << usage.ru_maxrss << " kB" << std::endl;
+
+    SWSS_LOG_NOTICE("streamed %zu objects in %zu batches, redis time %" PRIu64 " us, max batch %" PRIu64 " us, peak RSS %ld kB",
+            stats.keys,
+            stats.batches,
+            stats.redisUs,
+            stats.maxBatchUs,
+            usage.ru_maxrss);
+
+    return EXIT_SUCCESS;
+}
+
+int dumpTable(
+        DBConnector& db,
+        const std::string& table)
+{
+    SWSS_LOG_ENTER();
+
+    swss::Table t(&db, table);
+
+    TableDump dump;
+
+    t.dump(dump);
+
+    if (g_cmdOptions.dumpGraph)
+    {
+        dumpGraph(dump);
+
+        return EXIT_SUCCESS;
+    }
+
+    for (const auto&key: dump)
+    {
+        if (!match_filters(key.first))
+            continue;
+
+        print_object(key.first, key.second);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+extern "C" {
+#include <sai.h>
+}
+
+#include "swss/table.h"
+
+#include <string>
+
+struct CmdOptions
+{
+    bool skipAttributes;
+    bool dumpTempView;
+    bool dumpGraph;
+    bool stream;
+    bool json;
+    uint32_t batchSize;
+    std::string objectType;
+    std::string keyPattern;
+};
+
+extern CmdOptions g_cmdOptions;
+
+void printUsage();
+
+/**
+ * @brief Parse command line, on invalid option usage is printed and process
+ * exits with failure.
+ */
+CmdOptions handleCmdLine(int argc, char **argv);
+
+/**
+ * @brief Match key against object type and key pattern filters.
+ *
+ * Key is without table prefix.
+ */
+bool match_filters(const std::string& key);
+
+/**
+ * @brief Get SCAN pattern of stream mode, which applies filters on redis side.
+ */
+std::string get_scan_pattern(const std::string& table);
+
+/**
+ * @brief Dump table using SCAN in bounded batches.
+ */
+int streamDump(
+        swss::DBConnector& db,
+        const std::string& table);
+
+/**
+ * @brief Dump whole table loaded at once.
+ */
+int dumpTable(
+        swss::DBConnector& db,
+        const std::string& table);
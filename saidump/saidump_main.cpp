@@ -0,0 +1,34 @@
+#include "SaiDump.h"
+
+#include "sairediscommon.h"
+
+#include "swss/logger.h"
+
+int main(int argc, char ** argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_DEBUG);
+
+    SWSS_LOG_ENTER();
+
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_INFO);
+
+    g_cmdOptions = handleCmdLine(argc, argv);
+
+    swss::DBConnector db("ASIC_DB", 0);
+
+    std::string table = ASIC_STATE_TABLE;
+
+    if (g_cmdOptions.dumpTempView)
+    {
+        table = TEMP_PREFIX + table;
+    }
+
+    if (g_cmdOptions.stream)
+    {
+        return streamDump(db, table);
+    }
+
+    return dumpTable(db, table);
+}
@@ -0,0 +1,290 @@
+#include "BulkCoalescer.h"
+
+#include "syncd/SaiAttr.h"
+#include "VirtualObjectIdManager.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+using namespace saiplayer;
+using namespace saimeta;
+
+BulkCoalescer::BulkCoalescer(
+        _In_ size_t maxBulkSize):
+    m_maxBulkSize(maxBulkSize),
+    m_objectType(SAI_OBJECT_TYPE_NULL),
+    m_api(SAI_COMMON_API_MAX),
+    m_switchId(SAI_NULL_OBJECT_ID)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_maxBulkSize == 0)
+    {
+        SWSS_LOG_THROW("max bulk size must be positive");
+    }
+}
+
+bool BulkCoalescer::isEligible(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_common_api_t api,
+        _In_ size_t attrCount)
+{
+    SWSS_LOG_ENTER();
+
+    switch (api)
+    {
+        case SAI_COMMON_API_CREATE:
+        case SAI_COMMON_API_REMOVE:
+            break;
+
+        case SAI_COMMON_API_SET:
+
+            if (attrCount != 1)
+            {
+                return false;
+            }
+
+            break;
+
+        default:
+            return false;
+    }
+
+    switch (objectType)
+    {
+        case SAI_OBJECT_TYPE_ROUTE_ENTRY:
+        case SAI_OBJECT_TYPE_FDB_ENTRY:
+        case SAI_OBJECT_TYPE_NAT_ENTRY:
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+            return true;
+
+        case SAI_OBJECT_TYPE_SWITCH:
+            return false;
+
+        default:
+            break;
+    }
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info == NULL || !info->isobjectid)
+    {
+        return false;
+    }
+
+    if (api == SAI_COMMON_API_REMOVE && isSelfReferencing(objectType))
+    {
+        // removed object can be referenced by other object in the same
+        // batch, bulk remove validates all reference counts before removing
+        // any object, so it would fail while removing one by one succeeds
+
+        return false;
+    }
+
+    return true;
+}
+
+bool BulkCoalescer::isSelfReferencing(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info == NULL)
+    {
+        return false;
+    }
+
+    for (size_t idx = 0; info->attrmetadata[idx] != NULL; idx++)
+    {
+        auto md = info->attrmetadata[idx];
+
+        for (size_t i = 0; i < md->allowedobjecttypeslength; i++)
+        {
+            if (md->allowedobjecttypes[i] == objectType)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+sai_common_api_t BulkCoalescer::toBulkApi(
+        _In_ sai_common_api_t api)
+{
+    SWSS_LOG_ENTER();
+
+    switch (api)
+    {
+        case SAI_COMMON_API_CREATE:
+            return SAI_COMMON_API_BULK_CREATE;
+
+        case SAI_COMMON_API_REMOVE:
+            return SAI_COMMON_API_BULK_REMOVE;
+
+        case SAI_COMMON_API_SET:
+            return SAI_COMMON_API_BULK_SET;
+
+        default:
+            SWSS_LOG_THROW("api %s has no bulk equivalent", sai_serialize_common_api(api).c_str());
+    }
+}
+
+bool BulkCoalescer::canAppend(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_common_api_t api,
+        _In_ const std::string& strObjectId,
+        _In_ const std::vector<swss::FieldValueTuple>& values) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_objectIds.empty())
+    {
+        return true;
+    }
+
+    if (full() || objectType != m_objectType || toBulkApi(api) != m_api)
+    {
+        return false;
+    }
+
+    if (m_keys.find(strObjectId) != m_keys.end())
+    {
+        return false;
+    }
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info->isnonobjectid)
+    {
+        // entries don't create object ids, so there is nothing to reference
+
+        return true;
+    }
+
+    sai_object_id_t localId;
+    sai_deserialize_object_id(strObjectId, localId);
+
+    if (sairedis::VirtualObjectIdManager::switchIdQuery(localId) != m_switchId)
+    {
+        return false;
+    }
+
+    if (m_created.empty())
+    {
+        return true;
+    }
+
+    for (auto& fv: values)
+    {
+        syncd::SaiAttr attr(fvField(fv), fvValue(fv));
+
+        for (auto oid: attr.getOidListFromAttribute())
+        {
+            if (m_created.find(oid) != m_created.end())
+            {
+                SWSS_LOG_DEBUG("%s references %s created by current batch",
+                        strObjectId.c_str(),
+                        sai_serialize_object_id(oid).c_str());
+
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void BulkCoalescer::append(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_common_api_t api,
+        _In_ const std::string& strObjectId,
+        _In_ std::shared_ptr<SaiAttributeList> attributes)
+{
+    SWSS_LOG_ENTER();
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (m_objectIds.empty())
+    {
+        m_objectType = objectType;
+        m_api = toBulkApi(api);
+        m_switchId = SAI_NULL_OBJECT_ID;
+    }
+
+    if (info->isobjectid)
+    {
+        sai_object_id_t localId;
+        sai_deserialize_object_id(strObjectId, localId);
+
+        if (m_objectIds.empty())
+        {
+            m_switchId = sairedis::VirtualObjectIdManager::switchIdQuery(localId);
+        }
+
+        if (api == SAI_COMMON_API_CREATE)
+        {
+            m_created.insert(localId);
+        }
+    }
+
+    m_objectIds.push_back(strObjectId);
+    m_attributes.push_back(attributes);
+    m_keys.insert(strObjectId);
+}
+
+bool BulkCoalescer::empty() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_objectIds.empty();
+}
+
+bool BulkCoalescer::full() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_objectIds.size() >= m_maxBulkSize;
+}
+
+sai_object_type_t BulkCoalescer::getObjectType() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_objectType;
+}
+
+sai_common_api_t BulkCoalescer::getBulkApi() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_api;
+}
+
+const std::vector<std::string>& BulkCoalescer::getObjectIds() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_objectIds;
+}
+
+const std::vector<std::shared_ptr<SaiAttributeList>>& BulkCoalescer::getAttributes() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_attributes;
+}
+
+void BulkCoalescer::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_objectIds.clear();
+    m_attributes.clear();
+    m_keys.clear();
+    m_created.clear();
+}
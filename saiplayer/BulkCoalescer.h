@@ -0,0 +1,145 @@
+#pragma once
+
+#include "meta/SaiAttributeList.h"
+
+#include "swss/sal.h"
+#include "swss/table.h"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace saiplayer
+{
+    /**
+     * @brief Collects consecutive single create, remove or set operations
+     * which can be executed as single bulk call.
+     *
+     * Operations are collected only when they are independent, so executing
+     * them in bulk gives the same result as executing them one by one:
+     * all operations in batch have the same object type and API, each object
+     * is in batch at most once, object ids belong to the same switch and no
+     * operation references object which is created by the same batch, since
+     * its redis id is known only after bulk is executed, and no removed
+     * object is referenced by other object removed by the same batch.
+     */
+    class BulkCoalescer
+    {
+        private:
+
+            BulkCoalescer(const BulkCoalescer&) = delete;
+            BulkCoalescer& operator=(const BulkCoalescer&) = delete;
+
+        public:
+
+            BulkCoalescer(
+                    _In_ size_t maxBulkSize);
+
+            virtual ~BulkCoalescer() = default;
+
+        public:
+
+            /**
+             * @brief Check whether operation can be executed by bulk API.
+             *
+             * Switch operations are always executed one by one since they
+             * require notification pointers and context. Bulk set supports
+             * only single attribute per object. Remove of object type which
+             * can reference object of the same type is executed one by one,
+             * since recorded remove doesn't carry attributes and dependencies
+             * inside batch can't be checked.
+             */
+            static bool isEligible(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_common_api_t api,
+                    _In_ size_t attrCount);
+
+            /**
+             * @brief Check whether object type has attribute which can
+             * reference object of the same type, like scheduler group parent
+             * node.
+             */
+            static bool isSelfReferencing(
+                    _In_ sai_object_type_t objectType);
+
+            /**
+             * @brief Convert single API to bulk API.
+             */
+            static sai_common_api_t toBulkApi(
+                    _In_ sai_common_api_t api);
+
+        public:
+
+            /**
+             * @brief Check whether operation can be appended to current batch.
+             *
+             * Values are attributes in recorded form, before local object ids
+             * are translated to redis object ids.
+             *
+             * @return True if operation can be appended, false if batch must
+             * be executed first.
+             */
+            bool canAppend(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_common_api_t api,
+                    _In_ const std::string& strObjectId,
+                    _In_ const std::vector<swss::FieldValueTuple>& values) const;
+
+            /**
+             * @brief Append operation to current batch.
+             *
+             * Attributes must already have object ids translated to redis
+             * object ids.
+             */
+            void append(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_common_api_t api,
+                    _In_ const std::string& strObjectId,
+                    _In_ std::shared_ptr<saimeta::SaiAttributeList> attributes);
+
+            bool empty() const;
+
+            bool full() const;
+
+            sai_object_type_t getObjectType() const;
+
+            /**
+             * @brief Get bulk API of current batch.
+             */
+            sai_common_api_t getBulkApi() const;
+
+            const std::vector<std::string>& getObjectIds() const;
+
+            const std::vector<std::shared_ptr<saimeta::SaiAttributeList>>& getAttributes() const;
+
+            /**
+             * @brief Start new empty batch.
+             */
+            void clear();
+
+        private:
+
+            size_t m_maxBulkSize;
+
+            sai_object_type_t m_objectType;
+
+            sai_common_api_t m_api;
+
+            sai_object_id_t m_switchId;
+
+            std::vector<std::string> m_objectIds;
+
+            std::vector<std::shared_ptr<saimeta::SaiAttributeList>> m_attributes;
+
+            /**
+             * @brief Object ids in current batch.
+             */
+            std::set<std::string> m_keys;
+
+            /**
+             * @brief Local object ids created by current batch.
+             */
+            std::set<sai_object_id_t> m_created;
+    };
+}
@@ -26,6 +26,14 @@ CommandLineOptions::CommandLineOptions()
 
     m_profileMapFile = "";
     m_contextConfig = "";
+
+    m_timing = REPLAY_TIMING_MAX;
+
+    m_speed = 1.0;
+
+    m_reportFile = "";
+
+    m_bulkCoalesce = 0;
 }
 
 std::string CommandLineOptions::getCommandLineString() const
@@ -44,6 +52,47 @@ std::string CommandLineOptions::getCommandLineString() const
     ss << " EnableRecording=" << (m_enableRecording ? "YES" : "NO");
     ss << " ProfileMapFile=" << m_profileMapFile;
     ss << " ContextConfig=" << m_contextConfig;
+    ss << " Timing=" << timingToString(m_timing);
+    ss << " Speed=" << m_speed;
+    ss << " ReportFile=" << m_reportFile;
+    ss << " BulkCoalesce=" << m_bulkCoalesce;
 
     return ss.str();
 }
+
+replay_timing_t CommandLineOptions::timingStringToTiming(
+        _In_ const std::string& timing)
+{
+    SWSS_LOG_ENTER();
+
+    if (timing == STRING_REPLAY_TIMING_MAX)
+        return REPLAY_TIMING_MAX;
+
+    if (timing == STRING_REPLAY_TIMING_RECORDED)
+        return REPLAY_TIMING_RECORDED;
+
+    SWSS_LOG_WARN("unknown replay timing: '%s'", timing.c_str());
+
+    return REPLAY_TIMING_UNKNOWN;
+}
+
+std::string CommandLineOptions::timingToString(
+        _In_ replay_timing_t timing)
+{
+    SWSS_LOG_ENTER();
+
+    switch (timing)
+    {
+        case REPLAY_TIMING_MAX:
+            return STRING_REPLAY_TIMING_MAX;
+
+        case REPLAY_TIMING_RECORDED:
+            return STRING_REPLAY_TIMING_RECORDED;
+
+        default:
+
+            SWSS_LOG_WARN("unknown replay timing: %d", timing);
+
+            return STRING_REPLAY_TIMING_UNKNOWN;
+    }
+}
@@ -7,8 +7,31 @@
 #include <string>
 #include <vector>
 
+#define STRING_REPLAY_TIMING_MAX        "max"
+#define STRING_REPLAY_TIMING_RECORDED   "recorded"
+#define STRING_REPLAY_TIMING_UNKNOWN    "unknown"
+
 namespace saiplayer
 {
+    typedef enum _replay_timing_t
+    {
+        /**
+         * Each line is executed as soon as previous one finished.
+         */
+        REPLAY_TIMING_MAX = 0,
+
+        /**
+         * Lines are executed at recorded timestamps divided by speed.
+         */
+        REPLAY_TIMING_RECORDED = 1,
+
+        /**
+         * Set at last, just for error purpose.
+         */
+        REPLAY_TIMING_UNKNOWN
+
+    } replay_timing_t;
+
     class CommandLineOptions
     {
         public:
@@ -21,6 +44,14 @@ namespace saiplayer
 
             virtual std::string getCommandLineString() const;
 
+        public:
+
+            static replay_timing_t timingStringToTiming(
+                    _In_ const std::string& timing);
+
+            static std::string timingToString(
+                    _In_ replay_timing_t timing);
+
         public:
 
             bool m_useTempView;
@@ -43,6 +74,25 @@ namespace saiplayer
 
             std::string m_contextConfig;
 
+            replay_timing_t m_timing;
+
+            /**
+             * @brief Replay speed multiplier used with recorded timing.
+             */
+            double m_speed;
+
+            /**
+             * @brief File to which JSON replay report is written, "-" is
+             * standard output, empty means no report.
+             */
+            std::string m_reportFile;
+
+            /**
+             * @brief Maximum number of consecutive single operations
+             * coalesced into one bulk call, zero disables coalescing.
+             */
+            uint32_t m_bulkCoalesce;
+
             std::vector<std::string> m_files;
     };
 }
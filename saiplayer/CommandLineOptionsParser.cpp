@@ -18,7 +18,7 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
 
     auto options = std::make_shared<CommandLineOptions>();
 
-    const char* const optstring = "uiCdsmz:rp:x:h";
+    const char* const optstring = "uiCdsmz:rp:x:T:X:R:B:h";
 
     while (true)
     {
@@ -34,6 +34,10 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
             { "enableRecording",        no_argument,       0, 'r' },
             { "profile",                required_argument, 0, 'p' },
             { "contextContig",          required_argument, 0, 'x' },
+            { "timing",                 required_argument, 0, 'T' },
+            { "speed",                  required_argument, 0, 'X' },
+            { "reportFile",             required_argument, 0, 'R' },
+            { "bulkCoalesce",           required_argument, 0, 'B' },
             { "help",                   no_argument,       0, 'h' },
         };
 
@@ -85,6 +89,36 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
                 options->m_contextConfig = std::string(optarg);
                 break;
 
+            case 'T':
+                options->m_timing = CommandLineOptions::timingStringToTiming(optarg);
+
+                if (options->m_timing == REPLAY_TIMING_UNKNOWN)
+                {
+                    SWSS_LOG_ERROR("unknown replay timing '%s'", optarg);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+
+            case 'X':
+                options->m_speed = std::stod(optarg);
+
+                if (!(options->m_speed > 0))
+                {
+                    SWSS_LOG_ERROR("replay speed must be positive: '%s'", optarg);
+                    exit(EXIT_FAILURE);
+                }
+
+                options->m_timing = REPLAY_TIMING_RECORDED;
+                break;
+
+            case 'R':
+                options->m_reportFile = std::string(optarg);
+                break;
+
+            case 'B':
+                options->m_bulkCoalesce = (uint32_t)std::stoul(optarg);
+                break;
+
             case 'h':
                 printUsage();
                 exit(EXIT_SUCCESS);
@@ -123,7 +157,7 @@ void CommandLineOptionsParser::printUsage()
 {
     SWSS_LOG_ENTER();
 
-    std::cout << "Usage: saiplayer [-u] [-i] [-C] [-d] [-s] [-m] [-z mode] [-r] [-p profile] [-x contextConfig] [-h] recordfile" << std::endl << std::endl;
+    std::cout << "Usage: saiplayer [-u] [-i] [-C] [-d] [-s] [-m] [-z mode] [-r] [-p profile] [-x contextConfig] [-T timing] [-X speed] [-R reportFile] [-B size] [-h] recordfile" << std::endl << std::endl;
 
     std::cout << "    -u --useTempView:" << std::endl;
     std::cout << "        Enable temporary view between init and apply" << std::endl << std::endl;
@@ -145,6 +179,17 @@ void CommandLineOptionsParser::printUsage()
     std::cout << "        Provide profile map file" << std::endl << std::endl;
     std::cout << "    -x --contextConfig" << std::endl;
     std::cout << "        Context configuration file" << std::endl << std::endl;
+    std::cout << "    -T --timing timing" << std::endl;
+    std::cout << "        Replay timing (max|recorded), default: max" << std::endl;
+    std::cout << "        max executes lines as fast as possible, recorded keeps recorded time gaps" << std::endl << std::endl;
+    std::cout << "    -X --speed speed" << std::endl;
+    std::cout << "        Speed multiplier of recorded timing, implies -T recorded, default: 1.0" << std::endl << std::endl;
+    std::cout << "    -R --reportFile file" << std::endl;
+    std::cout << "        Write JSON report of latency per object type and API, - is standard output" << std::endl;
+    std::cout << "        In async communication mode latency does not include syncd processing" << std::endl << std::endl;
+    std::cout << "    -B --bulkCoalesce size" << std::endl;
+    std::cout << "        Coalesce up to size consecutive independent create/remove/set operations" << std::endl;
+    std::cout << "        of same object type into single bulk call, default: 0 (disabled)" << std::endl << std::endl;
     std::cout << "    -h --help:" << std::endl;
     std::cout << "        Print out this message" << std::endl << std::endl;
 }
@@ -0,0 +1,141 @@
+#include "ReplayPacer.h"
+
+#include "swss/logger.h"
+
+#include <thread>
+#include <algorithm>
+
+#include <stdio.h>
+#include <time.h>
+
+using namespace saiplayer;
+
+ReplayPacer::ReplayPacer(
+        _In_ replay_timing_t timing,
+        _In_ double speed):
+    m_timing(timing),
+    m_speed(speed),
+    m_started(false),
+    m_firstTimestamp(0),
+    m_maxLag(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (!(m_speed > 0))
+    {
+        SWSS_LOG_THROW("replay speed must be positive: %f", m_speed);
+    }
+}
+
+void ReplayPacer::wait(
+        _In_ const std::string& timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_timing == REPLAY_TIMING_MAX)
+    {
+        return;
+    }
+
+    int64_t recorded;
+
+    if (!parseTimestamp(timestamp, recorded))
+    {
+        SWSS_LOG_WARN("invalid timestamp '%s', executing immediately", timestamp.c_str());
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    if (!m_started)
+    {
+        m_started = true;
+        m_firstTimestamp = recorded;
+        m_start = now;
+        return;
+    }
+
+    // recorded time can go back when system clock was changed
+
+    int64_t offset = std::max(recorded - m_firstTimestamp, (int64_t)0);
+
+    auto due = m_start + std::chrono::microseconds((int64_t)((double)offset / m_speed));
+
+    if (due > now)
+    {
+        std::this_thread::sleep_until(due);
+        return;
+    }
+
+    uint64_t lag = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(now - due).count();
+
+    m_maxLag = std::max(m_maxLag, lag);
+}
+
+bool ReplayPacer::isDue(
+        _In_ const std::string& timestamp) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_timing == REPLAY_TIMING_MAX || !m_started)
+    {
+        return true;
+    }
+
+    int64_t recorded;
+
+    if (!parseTimestamp(timestamp, recorded))
+    {
+        return true;
+    }
+
+    int64_t offset = std::max(recorded - m_firstTimestamp, (int64_t)0);
+
+    auto due = m_start + std::chrono::microseconds((int64_t)((double)offset / m_speed));
+
+    return due <= std::chrono::steady_clock::now();
+}
+
+uint64_t ReplayPacer::getMaxLag() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_maxLag;
+}
+
+bool ReplayPacer::parseTimestamp(
+        _In_ const std::string& timestamp,
+        _Out_ int64_t& microseconds)
+{
+    SWSS_LOG_ENTER();
+
+    struct tm tm = {};
+
+    long usec = 0;
+
+    int consumed = 0;
+
+    int n = sscanf(timestamp.c_str(), "%d-%d-%d.%d:%d:%d.%6ld%n",
+            &tm.tm_year, &tm.tm_mon, &tm.tm_mday,
+            &tm.tm_hour, &tm.tm_min, &tm.tm_sec,
+            &usec, &consumed);
+
+    if (n != 7 || (size_t)consumed != timestamp.size())
+    {
+        return false;
+    }
+
+    tm.tm_year -= 1900;
+    tm.tm_mon -= 1;
+
+    time_t seconds = timegm(&tm);
+
+    if (seconds == (time_t)-1)
+    {
+        return false;
+    }
+
+    microseconds = (int64_t)seconds * 1000000 + usec;
+
+    return true;
+}
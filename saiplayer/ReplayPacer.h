@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CommandLineOptions.h"
+
+#include "swss/sal.h"
+
+#include <chrono>
+#include <string>
+
+namespace saiplayer
+{
+    /**
+     * @brief Delays replayed lines according to recorded timestamps.
+     *
+     * First replayed line is executed immediately and each next line is
+     * executed when its recorded distance from first line, divided by speed,
+     * elapsed. When replay can't keep up, lines are executed immediately and
+     * the delay is reported as lag.
+     */
+    class ReplayPacer
+    {
+        public:
+
+            ReplayPacer(
+                    _In_ replay_timing_t timing,
+                    _In_ double speed);
+
+            virtual ~ReplayPacer() = default;
+
+        public:
+
+            /**
+             * @brief Wait until line with given recorded timestamp is due.
+             */
+            void wait(
+                    _In_ const std::string& timestamp);
+
+            /**
+             * @brief Check whether line with given recorded timestamp can be
+             * executed without waiting.
+             */
+            bool isDue(
+                    _In_ const std::string& timestamp) const;
+
+            /**
+             * @brief Get maximum lag behind recorded timing in microseconds.
+             */
+            uint64_t getMaxLag() const;
+
+        public:
+
+            /**
+             * @brief Parse timestamp written by recorder to microseconds.
+             *
+             * Recorded local time is converted as if it was universal time,
+             * since only differences between timestamps are used.
+             *
+             * @return True on success.
+             */
+            static bool parseTimestamp(
+                    _In_ const std::string& timestamp,
+                    _Out_ int64_t& microseconds);
+
+        private:
+
+            replay_timing_t m_timing;
+
+            double m_speed;
+
+            bool m_started;
+
+            int64_t m_firstTimestamp;
+
+            std::chrono::steady_clock::time_point m_start;
+
+            uint64_t m_maxLag;
+    };
+}
@@ -0,0 +1,119 @@
+#include "ReplayReport.h"
+
+#include "swss/logger.h"
+#include "swss/json.hpp"
+
+using namespace saiplayer;
+using namespace sairediscommon;
+
+ReplayReport::Entry::Entry():
+    m_objects(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+ReplayReport::ReplayReport():
+    m_start(std::chrono::steady_clock::now())
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void ReplayReport::record(
+        _In_ const std::string& objectType,
+        _In_ const std::string& api,
+        _In_ size_t objectCount,
+        _In_ std::chrono::steady_clock::time_point start)
+{
+    SWSS_LOG_ENTER();
+
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    auto& entry = m_entries[std::make_pair(objectType, api)];
+
+    if (entry == nullptr)
+    {
+        entry = std::make_unique<Entry>();
+    }
+
+    entry->m_histogram.record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+
+    entry->m_objects += objectCount;
+}
+
+std::string ReplayReport::toJson(
+        _In_ const std::string& timing,
+        _In_ double speed,
+        _In_ uint64_t maxLag) const
+{
+    SWSS_LOG_ENTER();
+
+    auto wall = std::chrono::steady_clock::now() - m_start;
+
+    double wallSeconds = std::chrono::duration<double>(wall).count();
+
+    uint64_t totalOps = 0;
+
+    nlohmann::json entries = nlohmann::json::array();
+
+    for (auto& kvp: m_entries)
+    {
+        auto snapshot = kvp.second->m_histogram.snapshot();
+
+        double busySeconds = (double)snapshot.m_sum / 1e9;
+
+        nlohmann::json j;
+
+        j["object_type"] = kvp.first.first;
+        j["api"] = kvp.first.second;
+        j["ops"] = snapshot.m_count;
+        j["objects"] = kvp.second->m_objects;
+        j["ops_per_sec"] = busySeconds > 0 ? (double)snapshot.m_count / busySeconds : 0.0;
+        j["objects_per_sec"] = busySeconds > 0 ? (double)kvp.second->m_objects / busySeconds : 0.0;
+        j["min_ns"] = snapshot.m_min;
+        j["mean_ns"] = snapshot.getMean();
+        j["p50_ns"] = snapshot.getValueAtPercentile(50);
+        j["p90_ns"] = snapshot.getValueAtPercentile(90);
+        j["p99_ns"] = snapshot.getValueAtPercentile(99);
+        j["p999_ns"] = snapshot.getValueAtPercentile(99.9);
+        j["max_ns"] = snapshot.m_max;
+
+        entries.push_back(j);
+
+        totalOps += snapshot.m_count;
+    }
+
+    nlohmann::json report;
+
+    report["timing"] = timing;
+    report["speed"] = speed;
+    report["wall_time_ms"] = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(wall).count();
+    report["ops"] = totalOps;
+    report["ops_per_sec"] = wallSeconds > 0 ? (double)totalOps / wallSeconds : 0.0;
+    report["max_lag_us"] = maxLag;
+    report["entries"] = entries;
+
+    return report.dump(4);
+}
+
+void ReplayReport::log() const
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& kvp: m_entries)
+    {
+        auto snapshot = kvp.second->m_histogram.snapshot();
+
+        SWSS_LOG_NOTICE("%s %s: ops %lu, objects %lu, mean %lu ns, p99 %lu ns, max %lu ns",
+                kvp.first.first.c_str(),
+                kvp.first.second.c_str(),
+                snapshot.m_count,
+                kvp.second->m_objects,
+                snapshot.getMean(),
+                snapshot.getValueAtPercentile(99),
+                snapshot.m_max);
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "meta/LatencyHistogram.h"
+
+#include "swss/sal.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace saiplayer
+{
+    /**
+     * @brief Latency and throughput of replayed operations.
+     *
+     * Operations are grouped by object type and API, for each group
+     * latency histogram and number of objects (bulk operations count all
+     * objects in bulk) are kept.
+     */
+    class ReplayReport
+    {
+        public:
+
+            ReplayReport();
+
+            virtual ~ReplayReport() = default;
+
+        public:
+
+            /**
+             * @brief Record operation which started at given time and ended now.
+             */
+            void record(
+                    _In_ const std::string& objectType,
+                    _In_ const std::string& api,
+                    _In_ size_t objectCount,
+                    _In_ std::chrono::steady_clock::time_point start);
+
+            /**
+             * @brief Serialize report to JSON.
+             *
+             * Replay throughput is calculated from wall time, throughput of
+             * each group is calculated from time spent in its operations.
+             */
+            std::string toJson(
+                    _In_ const std::string& timing,
+                    _In_ double speed,
+                    _In_ uint64_t maxLag) const;
+
+            /**
+             * @brief Log single line summary of each group.
+             */
+            void log() const;
+
+        private:
+
+            class Entry
+            {
+                public:
+
+                    Entry();
+
+                public:
+
+                    sairediscommon::LatencyHistogram m_histogram;
+
+                    uint64_t m_objects;
+            };
+
+            std::chrono::steady_clock::time_point m_start;
+
+            std::map<std::pair<std::string, std::string>, std::unique_ptr<Entry>> m_entries;
+    };
+}
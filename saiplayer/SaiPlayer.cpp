@@ -17,6 +17,7 @@
 #include <string.h>
 
 #include <iostream>
+#include <fstream>
 #include <stdexcept>
 #include <sstream>
 #include <string>
@@ -1481,6 +1482,24 @@ sai_status_t SaiPlayer::handle_bulk_entry(
             }
             break;
 
+            case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+            {
+
+                std::vector<sai_neighbor_entry_t> entries(object_count);
+
+                for (size_t it = 0; it < object_count; it++)
+                {
+                    sai_deserialize_neighbor_entry(object_ids[it], entries[it]);
+
+                    entries[it].switch_id = translate_local_to_redis(entries[it].switch_id);
+                    entries[it].rif_id = translate_local_to_redis(entries[it].rif_id);
+                }
+
+                CALL_BULK_CREATE_API_WITH_TIMER("neighbor_entry");
+
+            }
+            break;
+
             default:
                 SWSS_LOG_THROW("api %s is not supported in bulk", sai_serialize_common_api(api).c_str());
         }
@@ -1543,6 +1562,24 @@ sai_status_t SaiPlayer::handle_bulk_entry(
             }
             break;
 
+            case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+            {
+
+                std::vector<sai_neighbor_entry_t> entries(object_count);
+
+                for (size_t it = 0; it < object_count; it++)
+                {
+                    sai_deserialize_neighbor_entry(object_ids[it], entries[it]);
+
+                    entries[it].switch_id = translate_local_to_redis(entries[it].switch_id);
+                    entries[it].rif_id = translate_local_to_redis(entries[it].rif_id);
+                }
+
+                CALL_BULK_REMOVE_API_WITH_TIMER("neighbor_entry");
+
+            }
+            break;
+
             default:
                 SWSS_LOG_THROW("api %s is not supported in bulk", sai_serialize_common_api(api).c_str());
 
@@ -1612,6 +1649,24 @@ sai_status_t SaiPlayer::handle_bulk_entry(
             }
             break;
 
+            case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
+            {
+
+                std::vector<sai_neighbor_entry_t> entries(object_count);
+
+                for (size_t it = 0; it < object_count; it++)
+                {
+                    sai_deserialize_neighbor_entry(object_ids[it], entries[it]);
+
+                    entries[it].switch_id = translate_local_to_redis(entries[it].switch_id);
+                    entries[it].rif_id = translate_local_to_redis(entries[it].rif_id);
+                }
+
+                CALL_BULK_SET_API_WITH_TIMER("neighbor_entry");
+
+            }
+            break;
+
             default:
                 SWSS_LOG_THROW("api %s is not supported in bulk", sai_serialize_common_api(api).c_str());
         }
@@ -1696,16 +1751,22 @@ sai_status_t SaiPlayer::handle_bulk_object(
                                             ids.data(),
                                             statuses.data());
 
-            if (status == SAI_STATUS_SUCCESS)
+            // with ignore error mode objects with success status are created
+            // even when overall status is failure, and coalesced creates can
+            // be referenced later by recording
+
+            for (uint32_t it = 0; it < object_count; it++)
             {
-                for (uint32_t it = 0; it < object_count; it++)
+                if (statuses[it] != SAI_STATUS_SUCCESS)
                 {
-                    match_redis_with_rec(ids[it], local_ids[it]);
-
-                    SWSS_LOG_INFO("saved VID %s to RID %s",
-                            sai_serialize_object_id(local_ids[it]).c_str(),
-                            sai_serialize_object_id(ids[it]).c_str());
+                    continue;
                 }
+
+                match_redis_with_rec(ids[it], local_ids[it]);
+
+                SWSS_LOG_INFO("saved VID %s to RID %s",
+                        sai_serialize_object_id(local_ids[it]).c_str(),
+                        sai_serialize_object_id(ids[it]).c_str());
             }
 
             return status;
@@ -1790,12 +1851,6 @@ void SaiPlayer::processBulk(
 
     std::vector<std::shared_ptr<SaiAttributeList>> attributes;
 
-    std::vector<sai_status_t> statuses(fields.size());
-
-    // TODO currently we expect all bulk API will always succeed in sync mode
-    // we will need to update that, needs to be obtained from recording file
-    std::vector<sai_status_t> expectedStatuses(fields.size(), SAI_STATUS_SUCCESS);
-
     for (size_t idx = 1; idx < fields.size(); ++idx)
     {
         // object_id|attr=value|...
@@ -1844,15 +1899,35 @@ void SaiPlayer::processBulk(
         attributes.push_back(list);
     }
 
+    executeBulk(object_type, api, object_ids, attributes);
+}
+
+void SaiPlayer::executeBulk(
+        _In_ sai_object_type_t object_type,
+        _In_ sai_common_api_t api,
+        _In_ const std::vector<std::string> &object_ids,
+        _In_ const std::vector<std::shared_ptr<SaiAttributeList>> &attributes)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_status_t> statuses(object_ids.size());
+
+    // TODO currently we expect all bulk API will always succeed in sync mode
+    // we will need to update that, needs to be obtained from recording file
+    std::vector<sai_status_t> expectedStatuses(object_ids.size(), SAI_STATUS_SUCCESS);
+
     sai_status_t status = SAI_STATUS_SUCCESS;
 
     auto info = sai_metadata_get_object_type_info(object_type);
 
+    auto start = std::chrono::steady_clock::now();
+
     switch (object_type)
     {
         case SAI_OBJECT_TYPE_ROUTE_ENTRY:
         case SAI_OBJECT_TYPE_FDB_ENTRY:
         case SAI_OBJECT_TYPE_NAT_ENTRY:
+        case SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:
             status = handle_bulk_entry(object_ids, object_type, api, attributes, statuses);
             break;
 
@@ -1868,6 +1943,8 @@ void SaiPlayer::processBulk(
             break;
     }
 
+    m_report->record(sai_serialize_object_type(object_type), sai_serialize_common_api(api), object_ids.size(), start);
+
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("handle bulk executed with failure, status = %s", sai_serialize_status(status).c_str());
@@ -1891,6 +1968,29 @@ void SaiPlayer::processBulk(
     }
 }
 
+void SaiPlayer::flushCoalesced()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_coalescer == nullptr || m_coalescer->empty())
+    {
+        return;
+    }
+
+    SWSS_LOG_INFO("executing %zu coalesced %s operations on %s",
+            m_coalescer->getObjectIds().size(),
+            sai_serialize_common_api(m_coalescer->getBulkApi()).c_str(),
+            sai_serialize_object_type(m_coalescer->getObjectType()).c_str());
+
+    executeBulk(
+            m_coalescer->getObjectType(),
+            m_coalescer->getBulkApi(),
+            m_coalescer->getObjectIds(),
+            m_coalescer->getAttributes());
+
+    m_coalescer->clear();
+}
+
 int SaiPlayer::replay()
 {
     //swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_DEBUG);
@@ -1916,6 +2016,17 @@ int SaiPlayer::replay()
         return -1;
     }
 
+    m_pacer = std::make_shared<ReplayPacer>(m_commandLineOptions->m_timing, m_commandLineOptions->m_speed);
+
+    m_report = std::make_shared<ReplayReport>();
+
+    m_coalescer = nullptr;
+
+    if (m_commandLineOptions->m_bulkCoalesce)
+    {
+        m_coalescer = std::make_shared<BulkCoalescer>(m_commandLineOptions->m_bulkCoalesce);
+    }
+
     std::string line;
 
     while (std::getline(infile, line))
@@ -1928,6 +2039,39 @@ int SaiPlayer::replay()
 
         char op = line[p+1];
 
+        auto timestamp = line.substr(0, p);
+
+        switch (op)
+        {
+            case 'c':
+            case 'r':
+            case 's':
+            case 'q':
+            case 'Q':
+            case '#':
+            case 'n':
+
+                // coalesced operations are executed before replay is paused
+
+                if (!m_pacer->isDue(timestamp))
+                {
+                    flushCoalesced();
+                }
+
+                break;
+
+            default:
+
+                // all other operations must observe effects of preceding operations
+
+                flushCoalesced();
+                break;
+        }
+
+        m_pacer->wait(timestamp);
+
+        std::chrono::steady_clock::time_point opStart;
+
         switch (op)
         {
             case 'a':
@@ -1944,7 +2088,11 @@ int SaiPlayer::replay()
                     }
                     while (response[response.find_first_of("|") + 1] == 'n');
 
+                    opStart = std::chrono::steady_clock::now();
+
                     performNotifySyncd(line, response);
+
+                    m_report->record(sai_serialize_object_type(SAI_OBJECT_TYPE_SWITCH), "notify_syncd", 1, opStart);
                 }
                 continue;
 
@@ -1962,7 +2110,11 @@ int SaiPlayer::replay()
                     }
                     while (response[response.find_first_of("|") + 1] == 'n');
 
+                    opStart = std::chrono::steady_clock::now();
+
                     performFdbFlush(line, response);
+
+                    m_report->record(sai_serialize_object_type(SAI_OBJECT_TYPE_FDB_ENTRY), "flush", 1, opStart);
                 }
                 continue;
 
@@ -2017,6 +2169,31 @@ int SaiPlayer::replay()
 
         auto values = get_values(fields);
 
+        if (m_coalescer && BulkCoalescer::isEligible(object_type, api, values.size()))
+        {
+            if (!m_coalescer->canAppend(object_type, api, str_object_id, values))
+            {
+                flushCoalesced();
+            }
+
+            // translate after flush, since attributes may reference objects created by flushed batch
+
+            auto bulkList = std::make_shared<SaiAttributeList>(object_type, values, false);
+
+            translate_local_to_redis(object_type, bulkList->get_attr_count(), bulkList->get_attr_list());
+
+            m_coalescer->append(object_type, api, str_object_id, bulkList);
+
+            if (m_coalescer->full())
+            {
+                flushCoalesced();
+            }
+
+            continue;
+        }
+
+        flushCoalesced();
+
         SaiAttributeList list(object_type, values, false);
 
         sai_attribute_t *attr_list = list.get_attr_list();
@@ -2034,6 +2211,8 @@ int SaiPlayer::replay()
 
         auto info = sai_metadata_get_object_type_info(object_type);
 
+        opStart = std::chrono::steady_clock::now();
+
         switch (object_type)
         {
             case SAI_OBJECT_TYPE_FDB_ENTRY:
@@ -2065,6 +2244,8 @@ int SaiPlayer::replay()
                 break;
         }
 
+        m_report->record(str_object_type, sai_serialize_common_api(api), 1, opStart);
+
         if (status != SAI_STATUS_SUCCESS)
         {
             if (api == SAI_COMMON_API_GET)
@@ -2127,8 +2308,12 @@ int SaiPlayer::replay()
         }
     }
 
+    flushCoalesced();
+
     infile.close();
 
+    writeReport();
+
     SWSS_LOG_NOTICE("finished replaying %s with SUCCESS", filename.c_str());
 
     if (m_commandLineOptions->m_sleep)
@@ -2203,6 +2388,43 @@ int SaiPlayer::profileGetNextValue(
     return 0;
 }
 
+void SaiPlayer::writeReport()
+{
+    SWSS_LOG_ENTER();
+
+    m_report->log();
+
+    auto& file = m_commandLineOptions->m_reportFile;
+
+    if (file.empty())
+    {
+        return;
+    }
+
+    auto json = m_report->toJson(
+            CommandLineOptions::timingToString(m_commandLineOptions->m_timing),
+            m_commandLineOptions->m_speed,
+            m_pacer->getMaxLag());
+
+    if (file == "-")
+    {
+        std::cout << json << std::endl;
+        return;
+    }
+
+    std::ofstream ofs(file);
+
+    if (!ofs.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open report file %s", file.c_str());
+        return;
+    }
+
+    ofs << json << std::endl;
+
+    SWSS_LOG_NOTICE("replay report written to %s", file.c_str());
+}
+
 int SaiPlayer::run()
 {
     SWSS_LOG_ENTER();
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "CommandLineOptions.h"
+#include "BulkCoalescer.h"
+#include "ReplayPacer.h"
+#include "ReplayReport.h"
 
 #include "meta/SaiInterface.h"
 #include "meta/SaiAttributeList.h"
@@ -39,6 +42,20 @@ namespace saiplayer
                     _In_ sai_common_api_t api,
                     _In_ const std::string &line);
 
+            /**
+             * @brief Execute bulk and check that all statuses are success.
+             */
+            void executeBulk(
+                    _In_ sai_object_type_t object_type,
+                    _In_ sai_common_api_t api,
+                    _In_ const std::vector<std::string> &object_ids,
+                    _In_ const std::vector<std::shared_ptr<saimeta::SaiAttributeList>> &attributes);
+
+            /**
+             * @brief Execute collected single operations as one bulk call.
+             */
+            void flushCoalesced();
+
             sai_status_t handle_bulk_route(
                     _In_ const std::vector<std::string> &object_ids,
                     _In_ sai_common_api_t api,
@@ -173,6 +190,8 @@ namespace saiplayer
 
             void loadProfileMap();
 
+            void writeReport();
+
         private: // notification handlers
 
             void onFdbEvent(
@@ -218,5 +237,14 @@ namespace saiplayer
             std::map<std::string, std::string> m_profileMap;
 
             std::map<std::string, std::string>::iterator m_profileIter;
+
+            std::shared_ptr<ReplayPacer> m_pacer;
+
+            std::shared_ptr<ReplayReport> m_report;
+
+            /**
+             * @brief Collects single operations into bulk calls, null when disabled.
+             */
+            std::shared_ptr<BulkCoalescer> m_coalescer;
     };
 }
@@ -0,0 +1,50 @@
+#include "CommandLineOptions.h"
+
+#include "swss/logger.h"
+
+#include <sstream>
+
+using namespace sairecanalyzer;
+
+CommandLineOptions::CommandLineOptions()
+{
+    SWSS_LOG_ENTER();
+
+    // default values for command line options
+
+    m_enableLogLevelInfo = false;
+
+    m_threads = 0;
+
+    m_windowSeconds = 1;
+
+    m_maxWindows = 10000;
+
+    m_chunkSize = 64 << 20;
+
+    m_slowest = 20;
+
+    m_outputFile = "-";
+}
+
+std::string CommandLineOptions::getCommandLineString() const
+{
+    SWSS_LOG_ENTER();
+
+    std::stringstream ss;
+
+    ss << " EnableLogLevelInfo=" << (m_enableLogLevelInfo ? "YES" : "NO");
+    ss << " Threads=" << m_threads;
+    ss << " WindowSeconds=" << m_windowSeconds;
+    ss << " MaxWindows=" << m_maxWindows;
+    ss << " ChunkSize=" << m_chunkSize;
+    ss << " Slowest=" << m_slowest;
+    ss << " OutputFile=" << m_outputFile;
+
+    for (auto &file: m_files)
+    {
+        ss << " " << file;
+    }
+
+    return ss.str();
+}
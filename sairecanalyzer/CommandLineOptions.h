@@ -0,0 +1,60 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <vector>
+
+namespace sairecanalyzer
+{
+    class CommandLineOptions
+    {
+        public:
+
+            CommandLineOptions();
+
+            virtual ~CommandLineOptions() = default;
+
+        public:
+
+            virtual std::string getCommandLineString() const;
+
+        public:
+
+            bool m_enableLogLevelInfo;
+
+            /**
+             * @brief Number of worker threads, zero means number of CPUs.
+             */
+            uint32_t m_threads;
+
+            /**
+             * @brief Length of throughput window in seconds.
+             */
+            uint32_t m_windowSeconds;
+
+            /**
+             * @brief Maximum number of throughput windows in report, window
+             * length is doubled until recording fits.
+             */
+            uint32_t m_maxWindows;
+
+            /**
+             * @brief Size of chunk of plain file processed by single thread.
+             */
+            uint64_t m_chunkSize;
+
+            /**
+             * @brief Number of slowest operations in report.
+             */
+            uint32_t m_slowest;
+
+            /**
+             * @brief File to which JSON report is written, "-" is standard
+             * output.
+             */
+            std::string m_outputFile;
+
+            std::vector<std::string> m_files;
+    };
+}
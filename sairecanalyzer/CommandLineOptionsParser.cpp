@@ -0,0 +1,143 @@
+#include "CommandLineOptionsParser.h"
+
+#include "swss/logger.h"
+
+#include <getopt.h>
+
+#include <iostream>
+
+using namespace sairecanalyzer;
+
+std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
+        _In_ int argc,
+        _In_ char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    auto options = std::make_shared<CommandLineOptions>();
+
+    const char* const optstring = "ij:w:m:c:n:o:h";
+
+    while (true)
+    {
+        static struct option long_options[] =
+        {
+            { "enableLogLevelInfo",      no_argument,       0, 'i' },
+            { "threads",                 required_argument, 0, 'j' },
+            { "window",                  required_argument, 0, 'w' },
+            { "maxWindows",              required_argument, 0, 'm' },
+            { "chunkSize",               required_argument, 0, 'c' },
+            { "slowest",                 required_argument, 0, 'n' },
+            { "output",                  required_argument, 0, 'o' },
+            { "help",                    no_argument,       0, 'h' },
+            { 0,                         0,                 0,  0  }
+        };
+
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+
+        if (c == -1)
+        {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'i':
+                options->m_enableLogLevelInfo = true;
+                break;
+
+            case 'j':
+                options->m_threads = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'w':
+                options->m_windowSeconds = (uint32_t)std::stoul(optarg);
+
+                if (options->m_windowSeconds == 0)
+                {
+                    SWSS_LOG_ERROR("window must be at least 1 second");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+
+            case 'm':
+                options->m_maxWindows = (uint32_t)std::stoul(optarg);
+
+                if (options->m_maxWindows == 0)
+                {
+                    SWSS_LOG_ERROR("max windows must be at least 1");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+
+            case 'c':
+                options->m_chunkSize = (uint64_t)std::stoull(optarg);
+
+                if (options->m_chunkSize == 0)
+                {
+                    SWSS_LOG_ERROR("chunk size must be at least 1 byte");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+
+            case 'n':
+                options->m_slowest = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'o':
+                options->m_outputFile = std::string(optarg);
+                break;
+
+            case 'h':
+                printUsage();
+                exit(EXIT_SUCCESS);
+
+            case '?':
+                SWSS_LOG_WARN("unknown option %c", optopt);
+                printUsage();
+                exit(EXIT_FAILURE);
+
+            default:
+                SWSS_LOG_ERROR("getopt_long failure");
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    for (int index = optind; index < argc; index++)
+    {
+        options->m_files.push_back(argv[index]);
+    }
+
+    return options;
+}
+
+void CommandLineOptionsParser::printUsage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << "Usage: sairecanalyzer [-i] [-j threads] [-w seconds] [-m count] [-c bytes] [-n count] [-o file] [-h] recordfile [recordfile...]" << std::endl << std::endl;
+
+    std::cout << "    Analyze sairedis recordings and write JSON performance report" << std::endl;
+    std::cout << "    Recordings can be rotated and compressed by gzip, for example:" << std::endl;
+    std::cout << "    sairecanalyzer /var/log/swss/sairedis.rec*" << std::endl << std::endl;
+
+    std::cout << "    -i --enableLogLevelInfo" << std::endl;
+    std::cout << "        Enable LogLevel INFO" << std::endl;
+    std::cout << "    -j --threads threads" << std::endl;
+    std::cout << "        Number of worker threads, default: number of CPUs" << std::endl;
+    std::cout << "    -w --window seconds" << std::endl;
+    std::cout << "        Length of throughput window, default: 1" << std::endl;
+    std::cout << "    -m --maxWindows count" << std::endl;
+    std::cout << "        Maximum number of throughput windows, window length is doubled" << std::endl;
+    std::cout << "        until recording fits, default: 10000" << std::endl;
+    std::cout << "    -c --chunkSize bytes" << std::endl;
+    std::cout << "        Size of plain file chunk processed by single thread, default: 67108864" << std::endl;
+    std::cout << "    -n --slowest count" << std::endl;
+    std::cout << "        Number of slowest operations in report, default: 20" << std::endl;
+    std::cout << "    -o --output file" << std::endl;
+    std::cout << "        Write report to file instead of standard output" << std::endl;
+    std::cout << "    -h --help" << std::endl;
+    std::cout << "        Print out this message" << std::endl;
+}
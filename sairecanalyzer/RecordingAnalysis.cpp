@@ -0,0 +1,795 @@
+#include "RecordingAnalysis.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+using namespace sairecanalyzer;
+using namespace sairediscommon;
+
+/**
+ * @brief Length of recorded timestamp up to seconds.
+ */
+#define TIMESTAMP_SECONDS_LENGTH 19
+
+/**
+ * @brief Length of recorded timestamp including microseconds.
+ */
+#define TIMESTAMP_LENGTH 26
+
+#define MAX_LINE_PREFIX 256
+
+RecordingAnalysis::Request::Request():
+    m_valid(false),
+    m_timestamp(0),
+    m_objects(0),
+    m_bulk(false)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+RecordingAnalysis::Group::Group():
+    m_ops(0),
+    m_objects(0),
+    m_errors(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+RecordingAnalysis::Window::Window():
+    m_ops(0),
+    m_objects(0),
+    m_errors(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+bool RecordingAnalysis::SlowOperation::operator>(
+        _In_ const SlowOperation& other) const
+{
+    SWSS_LOG_ENTER();
+
+    // earlier operation wins tie, so result doesn't depend on chunks
+
+    if (m_duration != other.m_duration)
+    {
+        return m_duration > other.m_duration;
+    }
+
+    return m_timestamp < other.m_timestamp;
+}
+
+RecordingAnalysis::RecordingAnalysis(
+        _In_ uint32_t windowSeconds,
+        _In_ size_t maxWindows,
+        _In_ size_t slowestCount):
+    m_windowSeconds(windowSeconds),
+    m_maxWindows(maxWindows),
+    m_slowestCount(slowestCount),
+    m_lines(0),
+    m_invalidLines(0),
+    m_firstTimestamp(std::numeric_limits<int64_t>::max()),
+    m_lastTimestamp(std::numeric_limits<int64_t>::min()),
+    m_cachedSeconds(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_windowSeconds == 0)
+    {
+        SWSS_LOG_THROW("window must be at least 1 second");
+    }
+
+    if (m_maxWindows == 0)
+    {
+        SWSS_LOG_THROW("max windows must be at least 1");
+    }
+}
+
+bool RecordingAnalysis::parseTimestamp(
+        _In_ const std::string& line,
+        _In_ size_t length,
+        _Out_ int64_t& microseconds)
+{
+    SWSS_LOG_ENTER();
+
+    // format is year-month-day.hour:minute:second.microseconds
+
+    if (length != TIMESTAMP_LENGTH || line[TIMESTAMP_SECONDS_LENGTH] != '.')
+    {
+        return false;
+    }
+
+    int64_t usec = 0;
+
+    for (size_t idx = TIMESTAMP_SECONDS_LENGTH + 1; idx < TIMESTAMP_LENGTH; idx++)
+    {
+        if (line[idx] < '0' || line[idx] > '9')
+        {
+            return false;
+        }
+
+        usec = usec * 10 + (line[idx] - '0');
+    }
+
+    if (m_cachedSecondsText.empty() ||
+            line.compare(0, TIMESTAMP_SECONDS_LENGTH, m_cachedSecondsText) != 0)
+    {
+        struct tm tm = {};
+
+        int consumed = 0;
+
+        auto text = line.substr(0, TIMESTAMP_SECONDS_LENGTH);
+
+        int n = sscanf(text.c_str(), "%d-%d-%d.%d:%d:%d%n",
+                &tm.tm_year, &tm.tm_mon, &tm.tm_mday,
+                &tm.tm_hour, &tm.tm_min, &tm.tm_sec,
+                &consumed);
+
+        if (n != 6 || consumed != TIMESTAMP_SECONDS_LENGTH)
+        {
+            return false;
+        }
+
+        tm.tm_year -= 1900;
+        tm.tm_mon -= 1;
+
+        time_t seconds = timegm(&tm);
+
+        if (seconds == (time_t)-1)
+        {
+            return false;
+        }
+
+        m_cachedSecondsText = text;
+        m_cachedSeconds = (int64_t)seconds;
+    }
+
+    microseconds = m_cachedSeconds * 1000000 + usec;
+
+    return true;
+}
+
+std::string RecordingAnalysis::formatTimestamp(
+        _In_ int64_t microseconds)
+{
+    SWSS_LOG_ENTER();
+
+    time_t seconds = (time_t)(microseconds / 1000000);
+
+    struct tm tm;
+
+    gmtime_r(&seconds, &tm);
+
+    char buffer[64];
+
+    size_t size = strftime(buffer, 32, "%Y-%m-%d.%T.", &tm);
+
+    snprintf(buffer + size, 32, "%06ld", (long)(microseconds % 1000000));
+
+    return buffer;
+}
+
+RecordingAnalysis::line_kind_t RecordingAnalysis::parseLine(
+        _In_ const std::string& line,
+        _Out_ int64_t& timestamp,
+        _Out_ char& op,
+        _Out_ Request& request)
+{
+    SWSS_LOG_ENTER();
+
+    // timestamp|action|data
+
+    size_t p = line.find('|');
+
+    if (p == std::string::npos || p + 1 >= line.size())
+    {
+        return LINE_KIND_INVALID;
+    }
+
+    if (!parseTimestamp(line, p, timestamp))
+    {
+        return LINE_KIND_INVALID;
+    }
+
+    op = line[p + 1];
+
+    size_t start = std::min(p + 3, line.size());
+
+    // first field after action, like object type and object id
+
+    size_t end = line.find('|', start);
+
+    std::string field = line.substr(start, end == std::string::npos ? std::string::npos : end - start);
+
+    request.m_valid = true;
+    request.m_timestamp = timestamp;
+    request.m_objects = 1;
+    request.m_bulk = false;
+
+    switch (op)
+    {
+        case 'c':
+            request.m_api = "create";
+            break;
+
+        case 'r':
+            request.m_api = "remove";
+            break;
+
+        case 's':
+            request.m_api = "set";
+            break;
+
+        case 'g':
+            request.m_api = "get";
+            break;
+
+        case 'f':
+            request.m_api = "flush_fdb";
+            break;
+
+        case 'a':
+            request.m_api = "notify_syncd";
+            request.m_objectType = field;
+            break;
+
+        case 'C':
+            request.m_api = "bulk_create";
+            request.m_bulk = true;
+            break;
+
+        case 'R':
+            request.m_api = "bulk_remove";
+            request.m_bulk = true;
+            break;
+
+        case 'S':
+            request.m_api = "bulk_set";
+            request.m_bulk = true;
+            break;
+
+        case 'q':
+
+            {
+                // q|query|object_type:object_id|...
+
+                request.m_api = field;
+
+                size_t keyStart = (end == std::string::npos) ? line.size() : end + 1;
+
+                size_t keyEnd = line.find_first_of(":|", keyStart);
+
+                request.m_objectType = line.substr(keyStart, keyEnd == std::string::npos ? std::string::npos : keyEnd - keyStart);
+            }
+
+            break;
+
+        case 'G':
+        case 'A':
+        case 'F':
+        case 'E':
+
+            request.m_valid = false;
+            request.m_api = field; // status
+
+            return LINE_KIND_RESPONSE;
+
+        case 'Q':
+
+            {
+                // Q|query|status|...
+
+                size_t statusStart = (end == std::string::npos) ? line.size() : end + 1;
+
+                size_t statusEnd = line.find('|', statusStart);
+
+                request.m_valid = false;
+                request.m_api = line.substr(statusStart, statusEnd == std::string::npos ? std::string::npos : statusEnd - statusStart);
+            }
+
+            return LINE_KIND_RESPONSE;
+
+        case 'n':
+
+            request.m_valid = false;
+            request.m_api = field; // notification name
+
+            return LINE_KIND_OTHER;
+
+        case '#':
+        case '@':
+
+            request.m_valid = false;
+
+            return LINE_KIND_OTHER;
+
+        default:
+
+            request.m_valid = false;
+
+            return LINE_KIND_INVALID;
+    }
+
+    switch (op)
+    {
+        case 'c':
+        case 'r':
+        case 's':
+        case 'g':
+        case 'f':
+
+            // object_type:object_id
+
+            request.m_objectType = field.substr(0, field.find(':'));
+            break;
+
+        case 'C':
+        case 'R':
+        case 'S':
+
+            {
+                // object_type||object_id|attr=value|...||object_id|...
+
+                request.m_objectType = field;
+                request.m_objects = 0;
+
+                for (size_t pos = line.find("||", start); pos != std::string::npos; pos = line.find("||", pos + 2))
+                {
+                    request.m_objects++;
+                }
+            }
+
+            break;
+
+        default:
+            break;
+    }
+
+    request.m_line = line.substr(0, MAX_LINE_PREFIX);
+
+    return LINE_KIND_REQUEST;
+}
+
+void RecordingAnalysis::processLine(
+        _In_ const std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    m_lines++;
+
+    int64_t timestamp;
+    char op;
+    Request request;
+
+    auto kind = parseLine(line, timestamp, op, request);
+
+    if (kind == LINE_KIND_INVALID)
+    {
+        m_invalidLines++;
+        return;
+    }
+
+    m_firstTimestamp = std::min(m_firstTimestamp, timestamp);
+    m_lastTimestamp = std::max(m_lastTimestamp, timestamp);
+
+    switch (kind)
+    {
+        case LINE_KIND_REQUEST:
+
+            completePending(timestamp, false, false);
+
+            m_pending = std::move(request);
+
+            break;
+
+        case LINE_KIND_RESPONSE:
+
+            // response without request belongs to request in previous chunk
+
+            completePending(timestamp, true, op == 'E' || request.m_api != "SAI_STATUS_SUCCESS");
+
+            break;
+
+        default:
+
+            if (op == 'n')
+            {
+                m_notifications[request.m_api]++;
+            }
+
+            break;
+    }
+}
+
+bool RecordingAnalysis::processLookaheadLine(
+        _In_ const std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_pending.m_valid)
+    {
+        return true;
+    }
+
+    int64_t timestamp;
+    char op;
+    Request request;
+
+    switch (parseLine(line, timestamp, op, request))
+    {
+        case LINE_KIND_REQUEST:
+
+            completePending(timestamp, false, false);
+
+            return true;
+
+        case LINE_KIND_RESPONSE:
+
+            completePending(timestamp, true, op == 'E' || request.m_api != "SAI_STATUS_SUCCESS");
+
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+void RecordingAnalysis::finishChunk()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pending.m_valid)
+    {
+        record(m_pending, false, 0, false, false);
+
+        m_pending.m_valid = false;
+    }
+}
+
+void RecordingAnalysis::completePending(
+        _In_ int64_t timestamp,
+        _In_ bool paired,
+        _In_ bool error)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_pending.m_valid)
+    {
+        return;
+    }
+
+    // recorded time can go back when system clock was changed
+
+    uint64_t duration = (uint64_t)std::max(timestamp - m_pending.m_timestamp, (int64_t)0);
+
+    record(m_pending, true, duration, paired, error);
+
+    m_pending.m_valid = false;
+}
+
+void RecordingAnalysis::recordValue(
+        _Inout_ LatencyHistogram::Snapshot& snapshot,
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    snapshot.m_buckets[LatencyHistogram::getBucketIndex(value)]++;
+
+    snapshot.m_min = snapshot.m_count ? std::min(snapshot.m_min, value) : value;
+    snapshot.m_max = std::max(snapshot.m_max, value);
+
+    snapshot.m_count++;
+    snapshot.m_sum += value;
+}
+
+void RecordingAnalysis::record(
+        _In_ const Request& request,
+        _In_ bool hasDuration,
+        _In_ uint64_t duration,
+        _In_ bool paired,
+        _In_ bool error)
+{
+    SWSS_LOG_ENTER();
+
+    auto& group = m_groups[std::make_pair(request.m_api, request.m_objectType)];
+
+    group.m_ops++;
+    group.m_objects += request.m_objects;
+    group.m_errors += error;
+
+    if (request.m_bulk)
+    {
+        uint64_t size = 1;
+
+        while (size < request.m_objects)
+        {
+            size <<= 1;
+        }
+
+        group.m_bulkSizes[size]++;
+    }
+
+    auto& window = m_windows[request.m_timestamp / 1000000 / m_windowSeconds];
+
+    window.m_ops++;
+    window.m_objects += request.m_objects;
+    window.m_errors += error;
+
+    while (m_windows.size() > m_maxWindows)
+    {
+        joinWindows();
+    }
+
+    if (!hasDuration)
+    {
+        return;
+    }
+
+    recordValue(paired ? group.m_latency : group.m_gap, duration);
+
+    if (m_slowestCount == 0 ||
+            (m_slowest.size() == m_slowestCount && duration < m_slowest.front().m_duration))
+    {
+        return;
+    }
+
+    SlowOperation slow;
+
+    slow.m_duration = duration;
+    slow.m_paired = paired;
+    slow.m_timestamp = request.m_timestamp;
+    slow.m_api = request.m_api;
+    slow.m_objectType = request.m_objectType;
+    slow.m_objects = request.m_objects;
+    slow.m_line = request.m_line;
+
+    addSlowOperation(slow);
+}
+
+void RecordingAnalysis::joinWindows()
+{
+    SWSS_LOG_ENTER();
+
+    std::map<int64_t, Window> windows;
+
+    for (auto& kvp: m_windows)
+    {
+        auto& window = windows[kvp.first / 2];
+
+        window.m_ops += kvp.second.m_ops;
+        window.m_objects += kvp.second.m_objects;
+        window.m_errors += kvp.second.m_errors;
+    }
+
+    m_windows.swap(windows);
+
+    m_windowSeconds *= 2;
+
+    SWSS_LOG_INFO("window length increased to %u seconds", m_windowSeconds);
+}
+
+void RecordingAnalysis::addSlowOperation(
+        _In_ const SlowOperation& slow)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_slowest.size() == m_slowestCount)
+    {
+        if (!(slow > m_slowest.front()))
+        {
+            return;
+        }
+
+        std::pop_heap(m_slowest.begin(), m_slowest.end(), std::greater<SlowOperation>());
+
+        m_slowest.back() = slow;
+    }
+    else
+    {
+        m_slowest.push_back(slow);
+    }
+
+    std::push_heap(m_slowest.begin(), m_slowest.end(), std::greater<SlowOperation>());
+}
+
+void RecordingAnalysis::merge(
+        _In_ const RecordingAnalysis& other)
+{
+    SWSS_LOG_ENTER();
+
+    m_lines += other.m_lines;
+    m_invalidLines += other.m_invalidLines;
+
+    m_firstTimestamp = std::min(m_firstTimestamp, other.m_firstTimestamp);
+    m_lastTimestamp = std::max(m_lastTimestamp, other.m_lastTimestamp);
+
+    for (auto& kvp: other.m_groups)
+    {
+        auto& group = m_groups[kvp.first];
+
+        group.m_ops += kvp.second.m_ops;
+        group.m_objects += kvp.second.m_objects;
+        group.m_errors += kvp.second.m_errors;
+
+        group.m_latency.merge(kvp.second.m_latency);
+        group.m_gap.merge(kvp.second.m_gap);
+
+        for (auto& size: kvp.second.m_bulkSizes)
+        {
+            group.m_bulkSizes[size.first] += size.second;
+        }
+    }
+
+    // both window lengths are initial length multiplied by power of two
+
+    while (m_windowSeconds < other.m_windowSeconds)
+    {
+        joinWindows();
+    }
+
+    int64_t ratio = m_windowSeconds / other.m_windowSeconds;
+
+    for (auto& kvp: other.m_windows)
+    {
+        auto& window = m_windows[kvp.first / ratio];
+
+        window.m_ops += kvp.second.m_ops;
+        window.m_objects += kvp.second.m_objects;
+        window.m_errors += kvp.second.m_errors;
+    }
+
+    while (m_windows.size() > m_maxWindows)
+    {
+        joinWindows();
+    }
+
+    for (auto& kvp: other.m_notifications)
+    {
+        m_notifications[kvp.first] += kvp.second;
+    }
+
+    if (m_slowestCount)
+    {
+        for (auto& slow: other.m_slowest)
+        {
+            addSlowOperation(slow);
+        }
+    }
+}
+
+nlohmann::json RecordingAnalysis::toJson(
+        _In_ const LatencyHistogram::Snapshot& snapshot)
+{
+    SWSS_LOG_ENTER();
+
+    nlohmann::json j;
+
+    j["count"] = snapshot.m_count;
+    j["min"] = snapshot.m_min;
+    j["mean"] = snapshot.getMean();
+    j["p50"] = snapshot.getValueAtPercentile(50);
+    j["p90"] = snapshot.getValueAtPercentile(90);
+    j["p99"] = snapshot.getValueAtPercentile(99);
+    j["p999"] = snapshot.getValueAtPercentile(99.9);
+    j["max"] = snapshot.m_max;
+
+    return j;
+}
+
+nlohmann::json RecordingAnalysis::toJson() const
+{
+    SWSS_LOG_ENTER();
+
+    nlohmann::json report;
+
+    report["lines"] = m_lines;
+    report["invalid_lines"] = m_invalidLines;
+
+    uint64_t ops = 0;
+
+    if (m_firstTimestamp <= m_lastTimestamp)
+    {
+        report["first_timestamp"] = formatTimestamp(m_firstTimestamp);
+        report["last_timestamp"] = formatTimestamp(m_lastTimestamp);
+    }
+
+    nlohmann::json operations = nlohmann::json::array();
+
+    for (auto& kvp: m_groups)
+    {
+        auto& group = kvp.second;
+
+        nlohmann::json j;
+
+        j["api"] = kvp.first.first;
+        j["object_type"] = kvp.first.second;
+        j["ops"] = group.m_ops;
+        j["objects"] = group.m_objects;
+        j["errors"] = group.m_errors;
+        j["latency_us"] = toJson(group.m_latency);
+        j["gap_us"] = toJson(group.m_gap);
+
+        if (group.m_bulkSizes.size())
+        {
+            nlohmann::json sizes = nlohmann::json::array();
+
+            for (auto& size: group.m_bulkSizes)
+            {
+                sizes.push_back({ { "max_size", size.first }, { "count", size.second } });
+            }
+
+            j["bulk_sizes"] = sizes;
+        }
+
+        operations.push_back(j);
+
+        ops += group.m_ops;
+    }
+
+    report["ops"] = ops;
+    report["operations"] = operations;
+
+    nlohmann::json windows = nlohmann::json::array();
+
+    for (auto& kvp: m_windows)
+    {
+        nlohmann::json j;
+
+        j["start"] = formatTimestamp(kvp.first * m_windowSeconds * 1000000);
+        j["ops"] = kvp.second.m_ops;
+        j["objects"] = kvp.second.m_objects;
+        j["errors"] = kvp.second.m_errors;
+        j["objects_per_sec"] = (double)kvp.second.m_objects / m_windowSeconds;
+
+        windows.push_back(j);
+    }
+
+    report["window_seconds"] = m_windowSeconds;
+    report["windows"] = windows;
+
+    auto slowest = m_slowest;
+
+    std::sort(slowest.begin(), slowest.end(), std::greater<SlowOperation>());
+
+    nlohmann::json slow = nlohmann::json::array();
+
+    for (auto& s: slowest)
+    {
+        nlohmann::json j;
+
+        j["timestamp"] = formatTimestamp(s.m_timestamp);
+        j["api"] = s.m_api;
+        j["object_type"] = s.m_objectType;
+        j["objects"] = s.m_objects;
+        j["duration_us"] = s.m_duration;
+        j["kind"] = s.m_paired ? "latency" : "gap";
+        j["line"] = s.m_line;
+
+        slow.push_back(j);
+    }
+
+    report["slowest"] = slow;
+
+    nlohmann::json notifications = nlohmann::json::object();
+
+    for (auto& kvp: m_notifications)
+    {
+        notifications[kvp.first] = kvp.second;
+    }
+
+    report["notifications"] = notifications;
+
+    return report;
+}
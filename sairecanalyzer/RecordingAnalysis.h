@@ -0,0 +1,279 @@
+#pragma once
+
+#include "meta/LatencyHistogram.h"
+
+#include "swss/sal.h"
+#include "swss/json.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sairecanalyzer
+{
+    /**
+     * @brief Statistics of recorded operations.
+     *
+     * Each request line is paired with following response line (G, A, F, Q
+     * or E) and time between them is operation latency. Create, remove and
+     * set responses are recorded only on failure, so for successful
+     * operations time until next request is recorded as gap, which is upper
+     * bound of latency in synchronous mode. Notification and comment lines
+     * between request and response are skipped.
+     *
+     * Memory usage doesn't depend on recording size. Number of throughput
+     * windows depends on recorded time span, so when it exceeds the limit,
+     * window length is doubled and neighbour windows are joined. Each thread
+     * uses its own instance, instances are merged at the end.
+     */
+    class RecordingAnalysis
+    {
+        private:
+
+            RecordingAnalysis(const RecordingAnalysis&) = delete;
+            RecordingAnalysis& operator=(const RecordingAnalysis&) = delete;
+
+        public:
+
+            RecordingAnalysis(
+                    _In_ uint32_t windowSeconds,
+                    _In_ size_t maxWindows,
+                    _In_ size_t slowestCount);
+
+            virtual ~RecordingAnalysis() = default;
+
+        public:
+
+            /**
+             * @brief Process line of recording.
+             */
+            void processLine(
+                    _In_ const std::string& line);
+
+            /**
+             * @brief Process line after end of chunk, only to complete
+             * pending request of this chunk.
+             *
+             * @return True when more lines are not needed.
+             */
+            bool processLookaheadLine(
+                    _In_ const std::string& line);
+
+            /**
+             * @brief Finish chunk, pending request is counted without
+             * latency.
+             */
+            void finishChunk();
+
+            void merge(
+                    _In_ const RecordingAnalysis& other);
+
+            nlohmann::json toJson() const;
+
+        public:
+
+            /**
+             * @brief Parse recorded timestamp to microseconds.
+             *
+             * Recorded local time is converted as if it was universal time,
+             * so it's printed back unchanged.
+             *
+             * @return True on success.
+             */
+            bool parseTimestamp(
+                    _In_ const std::string& line,
+                    _In_ size_t length,
+                    _Out_ int64_t& microseconds);
+
+            static std::string formatTimestamp(
+                    _In_ int64_t microseconds);
+
+        private:
+
+            class Request
+            {
+                public:
+
+                    Request();
+
+                public:
+
+                    bool m_valid;
+
+                    int64_t m_timestamp;
+
+                    std::string m_api;
+
+                    std::string m_objectType;
+
+                    uint64_t m_objects;
+
+                    bool m_bulk;
+
+                    /**
+                     * @brief Beginning of request line, bulk lines can be
+                     * very long.
+                     */
+                    std::string m_line;
+            };
+
+            class Group
+            {
+                public:
+
+                    Group();
+
+                public:
+
+                    uint64_t m_ops;
+
+                    uint64_t m_objects;
+
+                    uint64_t m_errors;
+
+                    sairediscommon::LatencyHistogram::Snapshot m_latency;
+
+                    sairediscommon::LatencyHistogram::Snapshot m_gap;
+
+                    /**
+                     * @brief Number of bulk operations by size rounded up to
+                     * power of two.
+                     */
+                    std::map<uint64_t, uint64_t> m_bulkSizes;
+            };
+
+            class Window
+            {
+                public:
+
+                    Window();
+
+                public:
+
+                    uint64_t m_ops;
+
+                    uint64_t m_objects;
+
+                    uint64_t m_errors;
+            };
+
+            class SlowOperation
+            {
+                public:
+
+                    uint64_t m_duration;
+
+                    bool m_paired;
+
+                    int64_t m_timestamp;
+
+                    std::string m_api;
+
+                    std::string m_objectType;
+
+                    uint64_t m_objects;
+
+                    std::string m_line;
+
+                public:
+
+                    bool operator>(
+                            _In_ const SlowOperation& other) const;
+            };
+
+            typedef enum _line_kind_t
+            {
+                LINE_KIND_REQUEST,
+
+                LINE_KIND_RESPONSE,
+
+                LINE_KIND_OTHER,
+
+                LINE_KIND_INVALID,
+
+            } line_kind_t;
+
+        private:
+
+            line_kind_t parseLine(
+                    _In_ const std::string& line,
+                    _Out_ int64_t& timestamp,
+                    _Out_ char& op,
+                    _Out_ Request& request);
+
+            /**
+             * @brief Complete pending request by response or by next request.
+             */
+            void completePending(
+                    _In_ int64_t timestamp,
+                    _In_ bool paired,
+                    _In_ bool error);
+
+            void record(
+                    _In_ const Request& request,
+                    _In_ bool hasDuration,
+                    _In_ uint64_t duration,
+                    _In_ bool paired,
+                    _In_ bool error);
+
+            /**
+             * @brief Double window length and join neighbour windows.
+             *
+             * Window boundaries stay aligned to multiples of window length,
+             * so instances with different window length can be merged.
+             */
+            void joinWindows();
+
+            /**
+             * @brief Keep operation if it's one of slowest operations.
+             */
+            void addSlowOperation(
+                    _In_ const SlowOperation& slow);
+
+            static void recordValue(
+                    _Inout_ sairediscommon::LatencyHistogram::Snapshot& snapshot,
+                    _In_ uint64_t value);
+
+            static nlohmann::json toJson(
+                    _In_ const sairediscommon::LatencyHistogram::Snapshot& snapshot);
+
+        private:
+
+            uint32_t m_windowSeconds;
+
+            size_t m_maxWindows;
+
+            size_t m_slowestCount;
+
+            uint64_t m_lines;
+
+            uint64_t m_invalidLines;
+
+            int64_t m_firstTimestamp;
+
+            int64_t m_lastTimestamp;
+
+            Request m_pending;
+
+            std::map<std::pair<std::string, std::string>, Group> m_groups;
+
+            std::map<int64_t, Window> m_windows;
+
+            std::map<std::string, uint64_t> m_notifications;
+
+            /**
+             * @brief Min heap of slowest operations.
+             */
+            std::vector<SlowOperation> m_slowest;
+
+            /**
+             * @brief Last parsed timestamp seconds, to skip calendar
+             * conversion for lines recorded in the same second.
+             */
+            std::string m_cachedSecondsText;
+
+            int64_t m_cachedSeconds;
+    };
+}
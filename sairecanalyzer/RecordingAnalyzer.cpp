@@ -0,0 +1,209 @@
+#include "RecordingAnalyzer.h"
+#include "RecordingReader.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+using namespace sairecanalyzer;
+
+RecordingAnalyzer::RecordingAnalyzer(
+        _In_ std::shared_ptr<CommandLineOptions> options):
+    m_options(options)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+std::vector<RecordingAnalyzer::Chunk> RecordingAnalyzer::getChunks() const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<Chunk> chunks;
+
+    for (auto& fileName: m_options->m_files)
+    {
+        uint64_t size = RecordingReader::getFileSize(fileName);
+
+        uint64_t chunkSize = m_options->m_chunkSize;
+
+        RecordingReader reader(fileName);
+
+        if (reader.isCompressed() || size <= chunkSize)
+        {
+            chunks.push_back({ fileName, 0, 0 });
+            continue;
+        }
+
+        for (uint64_t start = 0; start < size; start += chunkSize)
+        {
+            uint64_t end = start + chunkSize;
+
+            chunks.push_back({ fileName, start, end < size ? end : 0 });
+        }
+    }
+
+    return chunks;
+}
+
+void RecordingAnalyzer::analyzeChunk(
+        _In_ const Chunk& chunk,
+        _Inout_ RecordingAnalysis& analysis) const
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_INFO("analyzing %s from %lu to %lu", chunk.m_fileName.c_str(), chunk.m_start, chunk.m_end);
+
+    RecordingReader reader(chunk.m_fileName);
+
+    reader.seek(chunk.m_start);
+
+    std::string line;
+
+    while (chunk.m_end == 0 || reader.tell() < chunk.m_end)
+    {
+        if (!reader.getline(line))
+        {
+            break;
+        }
+
+        analysis.processLine(line);
+    }
+
+    // lines of next chunk are read only to complete last request
+
+    while (chunk.m_end && reader.getline(line))
+    {
+        if (analysis.processLookaheadLine(line))
+        {
+            break;
+        }
+    }
+
+    analysis.finishChunk();
+}
+
+std::unique_ptr<RecordingAnalysis> RecordingAnalyzer::analyze()
+{
+    SWSS_LOG_ENTER();
+
+    auto chunks = getChunks();
+
+    size_t threadCount = m_options->m_threads ? m_options->m_threads : std::thread::hardware_concurrency();
+
+    threadCount = std::max(std::min(threadCount, chunks.size()), (size_t)1);
+
+    SWSS_LOG_NOTICE("analyzing %zu chunks using %zu threads", chunks.size(), threadCount);
+
+    std::vector<std::unique_ptr<RecordingAnalysis>> analyses;
+
+    for (size_t idx = 0; idx < threadCount; idx++)
+    {
+        analyses.push_back(std::make_unique<RecordingAnalysis>(
+                    m_options->m_windowSeconds,
+                    m_options->m_maxWindows,
+                    m_options->m_slowest));
+    }
+
+    std::atomic<size_t> nextChunk(0);
+
+    std::vector<std::exception_ptr> errors(threadCount);
+
+    std::vector<std::thread> threads;
+
+    for (size_t idx = 0; idx < threadCount; idx++)
+    {
+        threads.emplace_back([&, idx]() {
+
+                try
+                {
+                    for (size_t c = nextChunk++; c < chunks.size(); c = nextChunk++)
+                    {
+                        analyzeChunk(chunks[c], *analyses[idx]);
+                    }
+                }
+                catch (...)
+                {
+                    errors[idx] = std::current_exception();
+
+                    // stop other threads
+
+                    nextChunk = chunks.size();
+                }
+        });
+    }
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    for (auto& error: errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    for (size_t idx = 1; idx < analyses.size(); idx++)
+    {
+        analyses[0]->merge(*analyses[idx]);
+    }
+
+    return std::move(analyses[0]);
+}
+
+bool RecordingAnalyzer::run()
+{
+    SWSS_LOG_ENTER();
+
+    try
+    {
+        auto analysis = analyze();
+
+        writeReport(*analysis);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void RecordingAnalyzer::writeReport(
+        _In_ const RecordingAnalysis& analysis) const
+{
+    SWSS_LOG_ENTER();
+
+    auto report = analysis.toJson();
+
+    report["files"] = m_options->m_files;
+
+    auto& file = m_options->m_outputFile;
+
+    if (file == "-")
+    {
+        std::cout << report.dump(4) << std::endl;
+        return;
+    }
+
+    std::ofstream ofs(file);
+
+    if (!ofs.is_open())
+    {
+        SWSS_LOG_THROW("failed to open report file %s", file.c_str());
+    }
+
+    ofs << report.dump(4) << std::endl;
+
+    SWSS_LOG_NOTICE("report written to %s", file.c_str());
+}
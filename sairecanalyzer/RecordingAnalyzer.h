@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CommandLineOptions.h"
+#include "RecordingAnalysis.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sairecanalyzer
+{
+    /**
+     * @brief Analyzes recordings using multiple threads.
+     *
+     * Each file is processed as separate chunk, large plain files are split
+     * into multiple chunks. Chunk processes lines which start in its range
+     * and reads following lines only to complete its last request. Each
+     * thread takes next chunk until all chunks are processed.
+     */
+    class RecordingAnalyzer
+    {
+        private:
+
+            RecordingAnalyzer(const RecordingAnalyzer&) = delete;
+            RecordingAnalyzer& operator=(const RecordingAnalyzer&) = delete;
+
+        public:
+
+            RecordingAnalyzer(
+                    _In_ std::shared_ptr<CommandLineOptions> options);
+
+            virtual ~RecordingAnalyzer() = default;
+
+        public:
+
+            /**
+             * @brief Analyze all recordings and write report.
+             *
+             * @return True on success.
+             */
+            bool run();
+
+            /**
+             * @brief Analyze all recordings.
+             *
+             * Result doesn't depend on chunk size and number of threads.
+             *
+             * @return Merged analysis, throws on error.
+             */
+            std::unique_ptr<RecordingAnalysis> analyze();
+
+        private:
+
+            class Chunk
+            {
+                public:
+
+                    std::string m_fileName;
+
+                    uint64_t m_start;
+
+                    /**
+                     * @brief End offset, zero means end of file.
+                     */
+                    uint64_t m_end;
+            };
+
+            std::vector<Chunk> getChunks() const;
+
+            void analyzeChunk(
+                    _In_ const Chunk& chunk,
+                    _Inout_ RecordingAnalysis& analysis) const;
+
+            void writeReport(
+                    _In_ const RecordingAnalysis& analysis) const;
+
+        private:
+
+            std::shared_ptr<CommandLineOptions> m_options;
+    };
+}
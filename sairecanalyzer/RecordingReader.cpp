@@ -0,0 +1,127 @@
+#include "RecordingReader.h"
+
+#include "swss/logger.h"
+
+#include <sys/stat.h>
+
+#include <string.h>
+
+using namespace sairecanalyzer;
+
+#define READ_BUFFER_SIZE (1 << 20)
+
+RecordingReader::RecordingReader(
+        _In_ const std::string& fileName):
+    m_fileName(fileName),
+    m_buffer(READ_BUFFER_SIZE)
+{
+    SWSS_LOG_ENTER();
+
+    m_file = gzopen(fileName.c_str(), "rb");
+
+    if (m_file == NULL)
+    {
+        SWSS_LOG_THROW("failed to open %s: %s", fileName.c_str(), strerror(errno));
+    }
+
+    gzbuffer(m_file, READ_BUFFER_SIZE);
+}
+
+RecordingReader::~RecordingReader()
+{
+    SWSS_LOG_ENTER();
+
+    gzclose(m_file);
+}
+
+bool RecordingReader::isCompressed() const
+{
+    SWSS_LOG_ENTER();
+
+    // when called before first read, header is read to decide
+
+    return gzdirect(m_file) == 0;
+}
+
+void RecordingReader::seek(
+        _In_ uint64_t offset)
+{
+    SWSS_LOG_ENTER();
+
+    if (offset == 0)
+    {
+        return;
+    }
+
+    if (isCompressed())
+    {
+        SWSS_LOG_THROW("can't seek in compressed file %s", m_fileName.c_str());
+    }
+
+    // line starting exactly at offset is preceded by new line character
+
+    if (gzseek(m_file, (z_off_t)(offset - 1), SEEK_SET) < 0)
+    {
+        SWSS_LOG_THROW("failed to seek %s to %lu", m_fileName.c_str(), offset);
+    }
+
+    std::string partial;
+
+    getline(partial);
+}
+
+uint64_t RecordingReader::tell() const
+{
+    SWSS_LOG_ENTER();
+
+    return (uint64_t)gztell(m_file);
+}
+
+bool RecordingReader::getline(
+        _Out_ std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    line.clear();
+
+    while (gzgets(m_file, m_buffer.data(), (int)m_buffer.size()) != NULL)
+    {
+        size_t len = strlen(m_buffer.data());
+
+        if (len && m_buffer[len - 1] == '\n')
+        {
+            line.append(m_buffer.data(), len - 1);
+            return true;
+        }
+
+        // line is longer than buffer or file has no new line at the end
+
+        line.append(m_buffer.data(), len);
+    }
+
+    int error;
+
+    const char* message = gzerror(m_file, &error);
+
+    if (error != Z_OK && error != Z_BUF_ERROR)
+    {
+        SWSS_LOG_THROW("failed to read %s: %s", m_fileName.c_str(), message);
+    }
+
+    return !line.empty();
+}
+
+uint64_t RecordingReader::getFileSize(
+        _In_ const std::string& fileName)
+{
+    SWSS_LOG_ENTER();
+
+    struct stat st;
+
+    if (stat(fileName.c_str(), &st) != 0)
+    {
+        SWSS_LOG_THROW("failed to stat %s: %s", fileName.c_str(), strerror(errno));
+    }
+
+    return (uint64_t)st.st_size;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <zlib.h>
+
+#include <string>
+#include <vector>
+
+namespace sairecanalyzer
+{
+    /**
+     * @brief Reads lines of plain or gzip compressed recording.
+     *
+     * Plain recordings can be positioned at any offset, so large file can
+     * be split into chunks read by multiple threads. Compressed recordings
+     * can only be read from the beginning.
+     */
+    class RecordingReader
+    {
+        private:
+
+            RecordingReader(const RecordingReader&) = delete;
+            RecordingReader& operator=(const RecordingReader&) = delete;
+
+        public:
+
+            RecordingReader(
+                    _In_ const std::string& fileName);
+
+            virtual ~RecordingReader();
+
+        public:
+
+            bool isCompressed() const;
+
+            /**
+             * @brief Position reader at first line which starts at or after
+             * given offset.
+             */
+            void seek(
+                    _In_ uint64_t offset);
+
+            /**
+             * @brief Get offset of next line.
+             */
+            uint64_t tell() const;
+
+            /**
+             * @brief Read next line without new line character.
+             *
+             * @return False on end of file.
+             */
+            bool getline(
+                    _Out_ std::string& line);
+
+        public:
+
+            static uint64_t getFileSize(
+                    _In_ const std::string& fileName);
+
+        private:
+
+            std::string m_fileName;
+
+            gzFile m_file;
+
+            std::vector<char> m_buffer;
+    };
+}
@@ -0,0 +1,36 @@
+#include "CommandLineOptionsParser.h"
+#include "RecordingAnalyzer.h"
+
+#include "swss/logger.h"
+
+#include <iostream>
+
+using namespace sairecanalyzer;
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_DEBUG);
+
+    SWSS_LOG_ENTER();
+
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    auto commandLineOptions = CommandLineOptionsParser::parseCommandLine(argc, argv);
+
+    SWSS_LOG_NOTICE("command line: %s",  commandLineOptions->getCommandLineString().c_str());
+
+    if (commandLineOptions->m_enableLogLevelInfo)
+    {
+        swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_INFO);
+    }
+
+    if (commandLineOptions->m_files.empty())
+    {
+        std::cerr << "ERROR: expected at least 1 input file" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    RecordingAnalyzer analyzer(commandLineOptions);
+
+    return analyzer.run() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
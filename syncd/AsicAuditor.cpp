@@ -0,0 +1,403 @@
+#include "AsicAuditor.h"
+
+#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+#include "meta/SaiAttributeList.h"
+
+#include "swss/logger.h"
+
+#include <cstring>
+#include <limits>
+#include <algorithm>
+
+using namespace syncd;
+using namespace saimeta;
+
+// number of keys requested from redis by single SCAN
+#define ASIC_AUDIT_SCAN_COUNT           256
+
+#define ASIC_AUDIT_DEFAULT_MAX_OBJECTS  256
+#define ASIC_AUDIT_DEFAULT_MAX_DURATION 5000
+
+AsicAuditor::AsicAuditor(
+        _In_ std::shared_ptr<RedisClient> client,
+        _In_ std::shared_ptr<VirtualOidTranslator> translator,
+        _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
+        _In_ std::shared_ptr<swss::DBConnector> dbState):
+    m_client(client),
+    m_translator(translator),
+    m_vendorSai(vendorSai),
+    m_maxObjects(ASIC_AUDIT_DEFAULT_MAX_OBJECTS),
+    m_maxDuration(ASIC_AUDIT_DEFAULT_MAX_DURATION),
+    m_passActive(false),
+    m_batchIndex(0),
+    m_passCount(0),
+    m_passObjects(0),
+    m_passMismatches(0),
+    m_lastPassObjects(0),
+    m_lastPassMismatches(0),
+    m_lastPassDurationMs(0),
+    m_objects(0),
+    m_mismatches(0),
+    m_errors(0)
+{
+    SWSS_LOG_ENTER();
+
+    m_auditTable = std::make_shared<swss::Table>(dbState.get(), SYNCD_ASIC_AUDIT_TABLE);
+
+    m_statsTable = std::make_shared<swss::Table>(dbState.get(), SYNCD_ASIC_AUDIT_STATS_TABLE);
+
+    // entries left by previous syncd run are not tracked by this auditor, so
+    // they would never be removed
+
+    std::vector<std::string> keys;
+
+    m_auditTable->getKeys(keys);
+
+    for (auto& key: keys)
+    {
+        m_auditTable->del(key);
+    }
+
+    SWSS_LOG_NOTICE("removed %zu audit entries of previous run", keys.size());
+}
+
+AsicAuditor::~AsicAuditor()
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void AsicAuditor::setBudget(
+        _In_ size_t maxObjects,
+        _In_ std::chrono::microseconds maxDuration)
+{
+    SWSS_LOG_ENTER();
+
+    m_maxObjects = std::max(maxObjects, (size_t)1);
+
+    m_maxDuration = maxDuration;
+
+    SWSS_LOG_NOTICE("slice budget: %zu objects, %ld us", m_maxObjects, (long)m_maxDuration.count());
+}
+
+bool AsicAuditor::runSlice()
+{
+    SWSS_LOG_ENTER();
+
+    return runSlice(m_maxObjects, m_maxDuration);
+}
+
+void AsicAuditor::runPass()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("asic audit pass");
+
+    m_passActive = false;
+
+    while (!runSlice(std::numeric_limits<size_t>::max(), std::chrono::microseconds::max()))
+    {
+        // pass is finished when cursor returns to the beginning
+    }
+}
+
+bool AsicAuditor::runSlice(
+        _In_ size_t maxObjects,
+        _In_ std::chrono::microseconds maxDuration)
+{
+    SWSS_LOG_ENTER();
+
+    auto start = std::chrono::steady_clock::now();
+
+    size_t objects = 0;
+
+    bool finished = false;
+
+    do
+    {
+        if (!m_passActive)
+        {
+            startPass();
+            continue;
+        }
+
+        if (m_batchIndex == m_batch.size())
+        {
+            if (m_cursor == "0")
+            {
+                finishPass();
+
+                finished = true;
+                break;
+            }
+
+            scanNextBatch();
+            continue;
+        }
+
+        auto& entry = m_batch[m_batchIndex++];
+
+        try
+        {
+            auditObject(entry.first, entry.second);
+        }
+        catch (const std::exception& e)
+        {
+            // object could be removed or changed while pass is in progress
+
+            SWSS_LOG_WARN("failed to audit %s: %s", entry.first.c_str(), e.what());
+
+            m_errors++;
+        }
+
+        objects++;
+    }
+    while (objects < maxObjects &&
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start) < maxDuration);
+
+    writeStats();
+
+    return finished;
+}
+
+void AsicAuditor::startPass()
+{
+    SWSS_LOG_ENTER();
+
+    // keys of interrupted pass are still present in audit table
+
+    m_previousMismatches.insert(m_currentMismatches.begin(), m_currentMismatches.end());
+
+    m_currentMismatches.clear();
+
+    m_passActive = true;
+
+    m_passStart = std::chrono::steady_clock::now();
+
+    m_passObjects = 0;
+    m_passMismatches = 0;
+
+    m_cursor = "0";
+
+    scanNextBatch();
+}
+
+void AsicAuditor::finishPass()
+{
+    SWSS_LOG_ENTER();
+
+    // objects were removed from ASIC DB or were not visited by SCAN
+
+    for (auto& key: m_previousMismatches)
+    {
+        m_auditTable->del(key);
+    }
+
+    m_previousMismatches = std::move(m_currentMismatches);
+
+    m_currentMismatches.clear();
+
+    m_passActive = false;
+
+    m_passCount++;
+
+    m_lastPassObjects = m_passObjects;
+    m_lastPassMismatches = m_passMismatches;
+
+    auto duration = std::chrono::steady_clock::now() - m_passStart;
+
+    m_lastPassDurationMs = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+
+    SWSS_LOG_NOTICE("pass %lu finished in %lu ms: %lu objects, %lu mismatched",
+            m_passCount,
+            m_lastPassDurationMs,
+            m_lastPassObjects,
+            m_lastPassMismatches);
+}
+
+void AsicAuditor::scanNextBatch()
+{
+    SWSS_LOG_ENTER();
+
+    m_cursor = m_client->scanAsicState(m_cursor, ASIC_AUDIT_SCAN_COUNT, m_batch);
+
+    m_batchIndex = 0;
+}
+
+void AsicAuditor::auditObject(
+        _In_ const std::string& key,
+        _In_ const std::unordered_map<std::string, std::string>& hash)
+{
+    SWSS_LOG_ENTER();
+
+    m_passObjects++;
+    m_objects++;
+
+    if (hash.empty())
+    {
+        // removed between SCAN and HGETALL
+        return;
+    }
+
+    // ASIC_STATE:objecttype:objectid (object id may contain ':')
+
+    auto mk = key.substr(strlen(ASIC_STATE_TABLE) + 1);
+
+    sai_object_meta_key_t metaKey;
+    sai_deserialize_object_meta_key(mk, metaKey);
+
+    SaiAttributeList expected(metaKey.objecttype, hash, false);
+
+    uint32_t attr_count = expected.get_attr_count();
+
+    if (attr_count == 0)
+    {
+        // TODO: how to check ASIC on ASIC DB key with NULL:NULL hash
+        // just ignore for now
+        return;
+    }
+
+    if (!m_translator->tryTranslateVidToRid(metaKey))
+    {
+        SWSS_LOG_INFO("object %s was removed, skipping", mk.c_str());
+        return;
+    }
+
+    // values read from ASIC contain RIDs, so expected values are translated
+    // as well, buffers for lists are allocated based on ASIC DB values
+
+    m_translator->translateVidToRid(metaKey.objecttype, attr_count, expected.get_attr_list());
+
+    SaiAttributeList actual(metaKey.objecttype, hash, false);
+
+    sai_status_t status = m_vendorSai->get(metaKey, attr_count, actual.get_attr_list());
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("failed to execute get api on %s: %s",
+                mk.c_str(),
+                sai_serialize_status(status).c_str());
+
+        m_errors++;
+        return;
+    }
+
+    std::vector<swss::FieldValueTuple> mismatches;
+
+    for (uint32_t index = 0; index < attr_count; ++index)
+    {
+        const sai_attribute_t& attr = actual.get_attr_list()[index];
+
+        auto meta = sai_metadata_get_attr_metadata(metaKey.objecttype, attr.id);
+
+        if (meta == NULL)
+        {
+            SWSS_LOG_THROW("failed to find metadata for object type %s and attr id %d",
+                    sai_serialize_object_type(metaKey.objecttype).c_str(),
+                    attr.id);
+        }
+
+        std::string strExpected = sai_serialize_attr_value(*meta, expected.get_attr_list()[index], false);
+
+        std::string strActual = sai_serialize_attr_value(*meta, attr, false);
+
+        if (strExpected == strActual)
+            continue;
+
+        SWSS_LOG_ERROR("failed to match %s REDIS attr '%s' with ASIC attr '%s' for %s",
+                meta->attridname,
+                strExpected.c_str(),
+                strActual.c_str(),
+                mk.c_str());
+
+        mismatches.emplace_back(meta->attridname, strActual);
+    }
+
+    bool recorded = m_previousMismatches.erase(mk) || m_currentMismatches.count(mk);
+
+    if (recorded)
+    {
+        // previous entry may contain other attributes
+
+        m_auditTable->del(mk);
+
+        m_currentMismatches.erase(mk);
+    }
+
+    if (mismatches.empty())
+    {
+        return;
+    }
+
+    m_auditTable->set(mk, mismatches);
+
+    m_currentMismatches.insert(mk);
+
+    m_passMismatches++;
+    m_mismatches++;
+}
+
+void AsicAuditor::writeStats()
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("pass_count", std::to_string(m_passCount));
+    values.emplace_back("pass_in_progress", m_passActive ? "true" : "false");
+    values.emplace_back("pass_objects", std::to_string(m_passObjects));
+    values.emplace_back("pass_mismatches", std::to_string(m_passMismatches));
+    values.emplace_back("last_pass_objects", std::to_string(m_lastPassObjects));
+    values.emplace_back("last_pass_mismatches", std::to_string(m_lastPassMismatches));
+    values.emplace_back("last_pass_duration_ms", std::to_string(m_lastPassDurationMs));
+    values.emplace_back("objects", std::to_string(m_objects));
+    values.emplace_back("mismatches", std::to_string(m_mismatches));
+    values.emplace_back("errors", std::to_string(m_errors));
+
+    m_statsTable->set(SYNCD_ASIC_AUDIT_STATS_KEY, values);
+}
+
+uint64_t AsicAuditor::getPassCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_passCount;
+}
+
+uint64_t AsicAuditor::getPassObjectCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_passObjects;
+}
+
+uint64_t AsicAuditor::getPassMismatchCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_passMismatches;
+}
+
+uint64_t AsicAuditor::getObjectCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_objects;
+}
+
+uint64_t AsicAuditor::getMismatchCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_mismatches;
+}
+
+uint64_t AsicAuditor::getErrorCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_errors;
+}
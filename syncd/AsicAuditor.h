@@ -0,0 +1,178 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "RedisClient.h"
+#include "VirtualOidTranslator.h"
+
+#include "meta/SaiInterface.h"
+
+#include "swss/dbconnector.h"
+#include "swss/table.h"
+
+#include <chrono>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Mismatched attributes found by ASIC auditor in STATE DB.
+ *
+ * Key is ASIC DB key without ASIC_STATE prefix, fields are mismatched
+ * attributes and values are attribute values read from ASIC.
+ */
+#define SYNCD_ASIC_AUDIT_TABLE          "SYNCD_ASIC_AUDIT"
+
+/**
+ * @brief ASIC auditor progress and mismatch counters in STATE DB.
+ */
+#define SYNCD_ASIC_AUDIT_STATS_TABLE    "SYNCD_ASIC_AUDIT_STATS"
+
+#define SYNCD_ASIC_AUDIT_STATS_KEY      "global"
+
+namespace syncd
+{
+    /**
+     * @brief Background consistency check of ASIC DB against ASIC.
+     *
+     * ASIC DB is walked by SCAN cursor in slices. Each slice audits objects
+     * until objects or time budget is used and next slice resumes from the
+     * same cursor, so main loop is never blocked for long. Each object is
+     * read from ASIC by single get of all attributes present in ASIC DB.
+     *
+     * Objects with mismatched attributes are written to audit table, entries
+     * of objects which no longer mismatch or were removed are deleted during
+     * next pass. Audit table is cleared when auditor is created.
+     */
+    class AsicAuditor
+    {
+        public:
+
+            AsicAuditor(
+                    _In_ std::shared_ptr<RedisClient> client,
+                    _In_ std::shared_ptr<VirtualOidTranslator> translator,
+                    _In_ std::shared_ptr<sairedis::SaiInterface> vendorSai,
+                    _In_ std::shared_ptr<swss::DBConnector> dbState);
+
+            virtual ~AsicAuditor();
+
+        private:
+
+            AsicAuditor(const AsicAuditor&) = delete;
+            AsicAuditor& operator=(const AsicAuditor&) = delete;
+
+        public:
+
+            /**
+             * @brief Set budget of single slice.
+             *
+             * Slice ends when given number of objects was audited or when
+             * given time elapsed, whichever comes first.
+             */
+            void setBudget(
+                    _In_ size_t maxObjects,
+                    _In_ std::chrono::microseconds maxDuration);
+
+            /**
+             * @brief Audit next chunk of ASIC DB within slice budget.
+             *
+             * @return True if current pass was finished in this slice.
+             */
+            bool runSlice();
+
+            /**
+             * @brief Restart current pass and audit whole ASIC DB at once.
+             */
+            void runPass();
+
+        public:
+
+            uint64_t getPassCount() const;
+
+            uint64_t getPassObjectCount() const;
+
+            uint64_t getPassMismatchCount() const;
+
+            uint64_t getObjectCount() const;
+
+            uint64_t getMismatchCount() const;
+
+            uint64_t getErrorCount() const;
+
+        private:
+
+            bool runSlice(
+                    _In_ size_t maxObjects,
+                    _In_ std::chrono::microseconds maxDuration);
+
+            void startPass();
+
+            void finishPass();
+
+            void scanNextBatch();
+
+            void auditObject(
+                    _In_ const std::string& key,
+                    _In_ const std::unordered_map<std::string, std::string>& hash);
+
+            void writeStats();
+
+        private:
+
+            std::shared_ptr<RedisClient> m_client;
+
+            std::shared_ptr<VirtualOidTranslator> m_translator;
+
+            std::shared_ptr<sairedis::SaiInterface> m_vendorSai;
+
+            std::shared_ptr<swss::Table> m_auditTable;
+
+            std::shared_ptr<swss::Table> m_statsTable;
+
+            size_t m_maxObjects;
+
+            std::chrono::microseconds m_maxDuration;
+
+            bool m_passActive;
+
+            std::string m_cursor;
+
+            std::vector<std::pair<std::string, std::unordered_map<std::string, std::string>>> m_batch;
+
+            size_t m_batchIndex;
+
+            std::chrono::steady_clock::time_point m_passStart;
+
+            /**
+             * @brief Audit table keys written in previous pass.
+             */
+            std::set<std::string> m_previousMismatches;
+
+            /**
+             * @brief Audit table keys written in current pass.
+             */
+            std::set<std::string> m_currentMismatches;
+
+            uint64_t m_passCount;
+
+            uint64_t m_passObjects;
+
+            uint64_t m_passMismatches;
+
+            uint64_t m_lastPassObjects;
+
+            uint64_t m_lastPassMismatches;
+
+            uint64_t m_lastPassDurationMs;
+
+            uint64_t m_objects;
+
+            uint64_t m_mismatches;
+
+            uint64_t m_errors;
+    };
+}
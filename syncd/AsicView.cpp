@@ -58,6 +58,15 @@ void AsicView::fromDump(
 
     int switchesCount = 0;
 
+    /*
+     * Many objects have attributes with the same value, like thousands of
+     * routes pointing to the same next hop, so only single copy of each value
+     * is kept. Pool is only needed while view is constructed, values are kept
+     * alive by attributes using them.
+     */
+
+    SaiAttrValuePool valuePool;
+
     for (const auto &key: dump)
     {
         auto start = key.first.find_first_of(":");
@@ -158,7 +167,7 @@ void AsicView::fromDump(
             m_vidReference[o->m_meta_key.objectkey.key.object_id] += 0;
         }
 
-        populateAttributes(o, key.second);
+        populateAttributes(o, key.second, valuePool);
     }
 
     if (switchesCount != 1)
@@ -1175,13 +1184,14 @@ void AsicView::dumpVidToAsicOperatioId() const
 
 void AsicView::populateAttributes(
         _In_ std::shared_ptr<SaiObj> &obj,
-        _In_ const swss::TableMap &map)
+        _In_ const swss::TableMap &map,
+        _Inout_ SaiAttrValuePool& valuePool)
 {
     SWSS_LOG_ENTER();
 
     for (const auto& field: map)
     {
-        std::shared_ptr<SaiAttr> attr = std::make_shared<SaiAttr>(field.first, field.second);
+        std::shared_ptr<SaiAttr> attr = std::make_shared<SaiAttr>(field.first, field.second, valuePool);
 
         if (obj->getObjectType() == SAI_OBJECT_TYPE_ACL_COUNTER)
         {
@@ -22,6 +22,26 @@ namespace syncd
             typedef std::unordered_map<sai_object_id_t, sai_object_id_t> ObjectIdMap;
             typedef std::map<std::string, std::shared_ptr<SaiObj>> StrObjectIdToSaiObjectHash;
             typedef std::map<sai_object_id_t, std::shared_ptr<SaiObj>> ObjectIdToSaiObjectHash;
+            typedef std::unordered_map<size_t, std::vector<std::shared_ptr<SaiObj>>> SignatureToSaiObjectList;
+
+            typedef struct _SignatureIndex
+            {
+                SignatureToSaiObjectList objects;
+
+                /*
+                 * True if signature was computed for all not processed
+                 * objects when index was built.
+                 */
+
+                bool complete;
+
+                /*
+                 * Greatest number of attributes on indexed object type.
+                 */
+
+                size_t maxAttrCount;
+
+            } SignatureIndex;
 
         private:
 
@@ -253,7 +273,8 @@ namespace syncd
 
             void populateAttributes(
                     _In_ std::shared_ptr<SaiObj> &obj,
-                    _In_ const swss::TableMap &map);
+                    _In_ const swss::TableMap &map,
+                    _Inout_ SaiAttrValuePool& valuePool);
 
             /**
              * @brief Update non object id VID reference count by specified value.
@@ -287,6 +308,16 @@ namespace syncd
 
             std::unordered_map<sai_object_id_t, sai_object_id_t> m_preMatchMap;
 
+            /**
+             * @brief Objects indexed by attributes signature.
+             *
+             * Index for given object type is populated on first lookup by
+             * BestCandidateFinder and contains objects which were not
+             * processed at that time, so object status must be checked when
+             * using it.
+             */
+            mutable std::map<sai_object_type_t, SignatureIndex> m_signatureIndex;
+
             /*
              * On temp view this needs to be used for actual NEW rids created and
              * then reused with rid mapping to create new rid/vid map.
@@ -8,9 +8,20 @@
 #include <inttypes.h>
 
 #include <algorithm>
+#include <random>
 
 using namespace syncd;
 
+static thread_local std::mt19937 g_randomGenerator;
+
+void BestCandidateFinder::seedRandom(
+        _In_ unsigned int seed)
+{
+    SWSS_LOG_ENTER();
+
+    g_randomGenerator.seed(seed);
+}
+
 BestCandidateFinder::BestCandidateFinder(
         _In_ const AsicView& currentView,
         _In_ const AsicView& temporaryView,
@@ -1683,209 +1694,49 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObjec
     }
 
     /*
-     * Get not processed objects of temporary object type, and all attributes
-     * that are set on that object. This function should be used only on oid
-     * object ids, since for non object id finding best match is based on
-     * struct entry of object id.
+     * Most of the time objects don't change between views, so first try to
+     * find object with all attributes equal using signature index. This is
+     * only a shortcut, object is returned only when it's the same object
+     * which full compare below would select, otherwise full compare is
+     * performed.
+     */
+
+    auto signatureCandidate = findCurrentBestMatchForGenericObjectUsingSignature(temporaryObj);
+
+    if (signatureCandidate != nullptr)
+        return signatureCandidate;
+
+    /*
+     * Get not processed objects of temporary object type. This function
+     * should be used only on oid object ids, since for non object id finding
+     * best match is based on struct entry of object id.
      */
 
     sai_object_type_t object_type = temporaryObj->getObjectType();
 
     const auto notProcessedObjects = m_currentView.getNotProcessedObjectsByObjectType(object_type);
 
-    const auto attrs = temporaryObj->getAllAttributes();
-
     /*
      * Complexity here is O((n^2)*m) since we iterate via all not processed
      * objects, then we iterate through all present attributes.  N is squared
-     * since for given object type we iterate via entire list for each object,
-     * this can be optimized a little bit inside AsicView class.
+     * since for given object type we iterate via entire list for each object.
      */
 
     SWSS_LOG_INFO("not processed objects for %s: %zu, attrs: %zu",
             temporaryObj->m_str_object_type.c_str(),
             notProcessedObjects.size(),
-            attrs.size());
+            temporaryObj->getAllAttributes().size());
 
     std::vector<sai_object_compare_info_t> candidateObjects;
 
     for (const auto &currentObj: notProcessedObjects)
     {
-        SWSS_LOG_INFO("* examing current obj: %s", currentObj->m_str_object_id.c_str());
-
-        sai_object_compare_info_t soci = { 0, currentObj };
-
-        bool has_different_create_only_attr = false;
-
-        /*
-         * NOTE: we only iterate by attributes that are present in temporary
-         * view. It may happen that current view has some additional attributes
-         * set that are create only and value can't be updated then, so in that
-         * case such object must be disqualified from being candidate.
-         */
-
-        for (const auto &attr: attrs)
-        {
-            sai_attr_id_t attrId = attr.first;
-
-            /*
-             * Function hasEqualAttribute check if attribute exists on both objects.
-             */
-
-            if (hasEqualAttribute(m_currentView, m_temporaryView, currentObj, temporaryObj, attrId))
-            {
-                soci.equal_attributes++;
-
-                SWSS_LOG_INFO("ob equal %s %s, %s: %s",
-                        temporaryObj->m_str_object_id.c_str(),
-                        currentObj->m_str_object_id.c_str(),
-                        attr.second->getStrAttrId().c_str(),
-                        attr.second->getStrAttrValue().c_str());
-            }
-            else
-            {
-                SWSS_LOG_INFO("ob not equal %s %s, %s: %s",
-                        temporaryObj->m_str_object_id.c_str(),
-                        currentObj->m_str_object_id.c_str(),
-                        attr.second->getStrAttrId().c_str(),
-                        attr.second->getStrAttrValue().c_str());
-
-                /*
-                 * Function hasEqualAttribute returns true only when both
-                 * attributes are existing and both are equal, so here it
-                 * returned false, so it may mean 2 things:
-                 *
-                 * - attribute doesn't exist in current view, or
-                 * - attributes are different
-                 *
-                 * If we check if attribute also exists in current view and has
-                 * CREATE_ONLY flag then attributes are different and we
-                 * disqualify this object since new temporary object needs to
-                 * pass new different attribute with CREATE_ONLY flag.
-                 *
-                 * Case when attribute doesn't exist is much more complicated
-                 * since it maybe conditional and have default value, we will
-                 * do that check when we select best match.
-                 */
-
-                /*
-                 * Get attribute metadata to see if contains CREATE_ONLY flag.
-                 */
-
-                const sai_attr_metadata_t* meta = attr.second->getAttrMetadata();
-
-                if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && currentObj->hasAttr(attrId))
-                {
-                    has_different_create_only_attr = true;
-
-                    SWSS_LOG_INFO("obj has not equal create only attributes %s",
-                            temporaryObj->m_str_object_id.c_str());
-
-                    /*
-                     * In this case there is no need to compare other
-                     * attributes since we won't be able to update them anyway.
-                     */
-
-                    break;
-                }
-
-                if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && !currentObj->hasAttr(attrId))
-                {
-                    /*
-                     * This attribute exists only on temporary view and it's
-                     * create only.  If it has default value, check if it's the
-                     * same as current.
-                     */
-
-                    auto curDefault = getSaiAttrFromDefaultValue(m_currentView, m_switch, *meta);
-
-                    if (curDefault != nullptr)
-                    {
-                        if (curDefault->getStrAttrValue() != attr.second->getStrAttrValue())
-                        {
-                            has_different_create_only_attr = true;
-
-                            SWSS_LOG_INFO("obj has not equal create only attributes %s (default): %s",
-                                    temporaryObj->m_str_object_id.c_str(),
-                                    meta->attridname);
-                            break;
-                        }
-                        else
-                        {
-                            SWSS_LOG_INFO("obj has equal create only value %s (default): %s",
-                                    temporaryObj->m_str_object_id.c_str(),
-                                    meta->attridname);
-                        }
-                    }
-                }
-            }
-        }
-
-        /*
-         * Before we add this object as candidate, see if there are some create
-         * only attributes which are not present in temporary object but
-         * present in current, and if there is default value that is the same.
-         */
-
-        const auto curAttrs = currentObj->getAllAttributes();
-
-        for (auto curAttr: curAttrs)
-        {
-            if (attrs.find(curAttr.first) != attrs.end())
-            {
-                // attr exists in both objects.
-                continue;
-            }
-
-            const sai_attr_metadata_t* meta = curAttr.second->getAttrMetadata();
-
-            if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && !temporaryObj->hasAttr(curAttr.first))
-            {
-                /*
-                 * This attribute exists only on current view and it's
-                 * create only.  If it has default value, check if it's the
-                 * same as current.
-                 */
-
-                auto tmpDefault = getSaiAttrFromDefaultValue(m_temporaryView, m_switch, *meta);
-
-                if (tmpDefault != nullptr)
-                {
-                    if (tmpDefault->getStrAttrValue() != curAttr.second->getStrAttrValue())
-                    {
-                        has_different_create_only_attr = true;
-
-                        SWSS_LOG_INFO("obj has not equal create only attributes %s (default): %s",
-                                currentObj->m_str_object_id.c_str(),
-                                meta->attridname);
-                        break;
-                    }
-                    else
-                    {
-                        SWSS_LOG_INFO("obj has equal create only value %s (default): %s",
-                                temporaryObj->m_str_object_id.c_str(),
-                                meta->attridname);
-                    }
-                }
-            }
-        }
+        sai_object_compare_info_t soci;
 
-        if (has_different_create_only_attr)
+        if (isGenericObjectCandidate(temporaryObj, currentObj, soci))
         {
-            /*
-             * Those objects differs with attribute which is marked as
-             * CREATE_ONLY so we will not be able to update current if
-             * necessary using SET operations.
-             */
-
-            continue;
+            candidateObjects.push_back(soci);
         }
-
-        SWSS_LOG_INFO("* current obj: %s has equal %lu attributes",
-                currentObj->m_str_object_id.c_str(),
-                soci.equal_attributes);
-
-        candidateObjects.push_back(soci);
     }
 
     SWSS_LOG_INFO("number candidate objects for %s is %zu",
@@ -1999,6 +1850,460 @@ std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObjec
     return findCurrentBestMatchForGenericObjectUsingHeuristic(temporaryObj, candidateObjects);
 }
 
+bool BestCandidateFinder::isGenericObjectCandidate(
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj,
+        _In_ const std::shared_ptr<SaiObj> &currentObj,
+        _Out_ sai_object_compare_info_t &soci)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_INFO("* examing current obj: %s", currentObj->m_str_object_id.c_str());
+
+    soci = { 0, currentObj };
+
+    const auto &attrs = temporaryObj->getAllAttributes();
+
+    bool has_different_create_only_attr = false;
+
+    /*
+     * NOTE: we only iterate by attributes that are present in temporary
+     * view. It may happen that current view has some additional attributes
+     * set that are create only and value can't be updated then, so in that
+     * case such object must be disqualified from being candidate.
+     */
+
+    for (const auto &attr: attrs)
+    {
+        sai_attr_id_t attrId = attr.first;
+
+        /*
+         * Function hasEqualAttribute check if attribute exists on both objects.
+         */
+
+        if (hasEqualAttribute(m_currentView, m_temporaryView, currentObj, temporaryObj, attrId))
+        {
+            soci.equal_attributes++;
+
+            SWSS_LOG_INFO("ob equal %s %s, %s: %s",
+                    temporaryObj->m_str_object_id.c_str(),
+                    currentObj->m_str_object_id.c_str(),
+                    attr.second->getStrAttrId().c_str(),
+                    attr.second->getStrAttrValue().c_str());
+        }
+        else
+        {
+            SWSS_LOG_INFO("ob not equal %s %s, %s: %s",
+                    temporaryObj->m_str_object_id.c_str(),
+                    currentObj->m_str_object_id.c_str(),
+                    attr.second->getStrAttrId().c_str(),
+                    attr.second->getStrAttrValue().c_str());
+
+            /*
+             * Function hasEqualAttribute returns true only when both
+             * attributes are existing and both are equal, so here it
+             * returned false, so it may mean 2 things:
+             *
+             * - attribute doesn't exist in current view, or
+             * - attributes are different
+             *
+             * If we check if attribute also exists in current view and has
+             * CREATE_ONLY flag then attributes are different and we
+             * disqualify this object since new temporary object needs to
+             * pass new different attribute with CREATE_ONLY flag.
+             *
+             * Case when attribute doesn't exist is much more complicated
+             * since it maybe conditional and have default value, we will
+             * do that check when we select best match.
+             */
+
+            /*
+             * Get attribute metadata to see if contains CREATE_ONLY flag.
+             */
+
+            const sai_attr_metadata_t* meta = attr.second->getAttrMetadata();
+
+            if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && currentObj->hasAttr(attrId))
+            {
+                has_different_create_only_attr = true;
+
+                SWSS_LOG_INFO("obj has not equal create only attributes %s",
+                        temporaryObj->m_str_object_id.c_str());
+
+                /*
+                 * In this case there is no need to compare other
+                 * attributes since we won't be able to update them anyway.
+                 */
+
+                break;
+            }
+
+            if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && !currentObj->hasAttr(attrId))
+            {
+                /*
+                 * This attribute exists only on temporary view and it's
+                 * create only.  If it has default value, check if it's the
+                 * same as current.
+                 */
+
+                auto curDefault = getSaiAttrFromDefaultValue(m_currentView, m_switch, *meta);
+
+                if (curDefault != nullptr)
+                {
+                    if (curDefault->getStrAttrValue() != attr.second->getStrAttrValue())
+                    {
+                        has_different_create_only_attr = true;
+
+                        SWSS_LOG_INFO("obj has not equal create only attributes %s (default): %s",
+                                temporaryObj->m_str_object_id.c_str(),
+                                meta->attridname);
+                        break;
+                    }
+                    else
+                    {
+                        SWSS_LOG_INFO("obj has equal create only value %s (default): %s",
+                                temporaryObj->m_str_object_id.c_str(),
+                                meta->attridname);
+                    }
+                }
+            }
+        }
+    }
+
+    /*
+     * Before we add this object as candidate, see if there are some create
+     * only attributes which are not present in temporary object but
+     * present in current, and if there is default value that is the same.
+     */
+
+    const auto curAttrs = currentObj->getAllAttributes();
+
+    for (auto curAttr: curAttrs)
+    {
+        if (attrs.find(curAttr.first) != attrs.end())
+        {
+            // attr exists in both objects.
+            continue;
+        }
+
+        const sai_attr_metadata_t* meta = curAttr.second->getAttrMetadata();
+
+        if (SAI_HAS_FLAG_CREATE_ONLY(meta->flags) && !temporaryObj->hasAttr(curAttr.first))
+        {
+            /*
+             * This attribute exists only on current view and it's
+             * create only.  If it has default value, check if it's the
+             * same as current.
+             */
+
+            auto tmpDefault = getSaiAttrFromDefaultValue(m_temporaryView, m_switch, *meta);
+
+            if (tmpDefault != nullptr)
+            {
+                if (tmpDefault->getStrAttrValue() != curAttr.second->getStrAttrValue())
+                {
+                    has_different_create_only_attr = true;
+
+                    SWSS_LOG_INFO("obj has not equal create only attributes %s (default): %s",
+                            currentObj->m_str_object_id.c_str(),
+                            meta->attridname);
+                    break;
+                }
+                else
+                {
+                    SWSS_LOG_INFO("obj has equal create only value %s (default): %s",
+                            temporaryObj->m_str_object_id.c_str(),
+                            meta->attridname);
+                }
+            }
+        }
+    }
+
+    if (has_different_create_only_attr)
+    {
+        /*
+         * Those objects differs with attribute which is marked as
+         * CREATE_ONLY so we will not be able to update current if
+         * necessary using SET operations.
+         */
+
+        return false;
+    }
+
+    SWSS_LOG_INFO("* current obj: %s has equal %lu attributes",
+            currentObj->m_str_object_id.c_str(),
+            soci.equal_attributes);
+
+    return true;
+}
+
+bool BestCandidateFinder::getAttributesSignature(
+        _In_ const AsicView &view,
+        _In_ const std::shared_ptr<const SaiObj> &obj,
+        _Out_ size_t &signature)
+{
+    SWSS_LOG_ENTER();
+
+    signature = 0;
+
+    std::hash<std::string> strHash;
+
+    for (const auto &attr: obj->getAllAttributes())
+    {
+        const auto meta = attr.second->getAttrMetadata();
+
+        size_t hash = std::hash<sai_attr_id_t>()(attr.first);
+
+        if (meta->attrvaluetype == SAI_ATTR_VALUE_TYPE_QOS_MAP_LIST)
+        {
+            /*
+             * Qos map list is compared regardless of entries order.
+             */
+
+            return false;
+        }
+
+        if (meta->attrvaluetype == SAI_ATTR_VALUE_TYPE_POINTER)
+        {
+            /*
+             * Pointers are equal when both are null or both are not null.
+             */
+
+            hash ^= (attr.second->getSaiAttr()->value.ptr == nullptr) ? 0 : 1;
+        }
+        else if (attr.second->isObjectIdAttr())
+        {
+            /*
+             * VIDs are different between views, but RIDs are the same for
+             * matched objects.
+             */
+
+            for (auto vid: attr.second->getOidListFromAttribute())
+            {
+                sai_object_id_t rid = SAI_NULL_OBJECT_ID;
+
+                if (vid != SAI_NULL_OBJECT_ID)
+                {
+                    auto it = view.m_vidToRid.find(vid);
+
+                    if (it == view.m_vidToRid.end())
+                    {
+                        return false;
+                    }
+
+                    rid = it->second;
+                }
+
+                hash = hash * 31 + std::hash<sai_object_id_t>()(rid);
+            }
+        }
+        else
+        {
+            hash = hash * 31 + strHash(attr.second->getStrAttrValue());
+        }
+
+        /*
+         * Attributes are not ordered, so combine them in order independent
+         * way.
+         */
+
+        signature += hash * 0x9e3779b97f4a7c15ULL;
+    }
+
+    return true;
+}
+
+bool BestCandidateFinder::hasObjectTypeSpecificMatch(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    /*
+     * Object types which are matched by label or by graph in
+     * findCurrentBestMatchForGenericObjectUsingLabel and
+     * findCurrentBestMatchForGenericObjectUsingGraph, this list must be
+     * updated when new type is added there.
+     */
+
+    switch (objectType)
+    {
+        case SAI_OBJECT_TYPE_LAG:
+        case SAI_OBJECT_TYPE_VIRTUAL_ROUTER:
+        case SAI_OBJECT_TYPE_NEXT_HOP_GROUP:
+        case SAI_OBJECT_TYPE_ACL_TABLE_GROUP:
+        case SAI_OBJECT_TYPE_ACL_COUNTER:
+        case SAI_OBJECT_TYPE_ROUTER_INTERFACE:
+        case SAI_OBJECT_TYPE_POLICER:
+        case SAI_OBJECT_TYPE_HOSTIF_TRAP_GROUP:
+        case SAI_OBJECT_TYPE_ACL_TABLE:
+        case SAI_OBJECT_TYPE_BUFFER_POOL:
+        case SAI_OBJECT_TYPE_WRED:
+        case SAI_OBJECT_TYPE_BUFFER_PROFILE:
+        case SAI_OBJECT_TYPE_TUNNEL_MAP:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+const AsicView::SignatureIndex& BestCandidateFinder::getSignatureIndex(
+        _In_ sai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_currentView.m_signatureIndex.find(objectType);
+
+    if (it != m_currentView.m_signatureIndex.end())
+    {
+        return it->second;
+    }
+
+    /*
+     * Build index once per object type. Objects processed later are not
+     * removed from index, so their status must be checked on lookup.
+     */
+
+    auto &index = m_currentView.m_signatureIndex[objectType];
+
+    index.complete = true;
+    index.maxAttrCount = 0;
+
+    for (const auto &currentObj: m_currentView.getNotProcessedObjectsByObjectType(objectType))
+    {
+        index.maxAttrCount = std::max(index.maxAttrCount, currentObj->getAllAttributes().size());
+
+        size_t signature;
+
+        if (getAttributesSignature(m_currentView, currentObj, signature))
+        {
+            index.objects[signature].push_back(currentObj);
+        }
+        else
+        {
+            index.complete = false;
+        }
+    }
+
+    SWSS_LOG_INFO("signature index for %s has %zu entries, complete: %s, max attributes: %zu",
+            sai_serialize_object_type(objectType).c_str(),
+            index.objects.size(),
+            (index.complete ? "true" : "false"),
+            index.maxAttrCount);
+
+    return index;
+}
+
+/**
+ * @brief Find current best match for generic object using attributes signature.
+ *
+ * Returns object only when full compare in
+ * findCurrentBestMatchForGenericObject is guaranteed to select the same
+ * object, that is when:
+ *
+ * - object type is not matched by label, graph or pre match map, since those
+ *   can prefer object which don't have all attributes equal,
+ * - signature was computed for temporary object and for all not processed
+ *   current objects of that type,
+ * - no current object has more attributes than temporary object, so any
+ *   object with all temporary attributes equal has the same signature,
+ * - exactly one current object has all attributes equal, so it's the only
+ *   one with the greatest number of equal attributes.
+ *
+ * Otherwise nullptr is returned and caller must compare all not processed
+ * objects.
+ *
+ * @param temporaryObj Temporary object.
+ *
+ * @return Current object with all attributes equal or nullptr.
+ */
+std::shared_ptr<SaiObj> BestCandidateFinder::findCurrentBestMatchForGenericObjectUsingSignature(
+        _In_ const std::shared_ptr<const SaiObj> &temporaryObj)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_type_t objectType = temporaryObj->getObjectType();
+
+    if (hasObjectTypeSpecificMatch(objectType))
+    {
+        return nullptr;
+    }
+
+    if (m_temporaryView.m_preMatchMap.find(temporaryObj->getVid()) != m_temporaryView.m_preMatchMap.end())
+    {
+        return nullptr;
+    }
+
+    size_t signature;
+
+    if (!getAttributesSignature(m_temporaryView, temporaryObj, signature))
+    {
+        return nullptr;
+    }
+
+    const auto &index = getSignatureIndex(objectType);
+
+    const auto &attrs = temporaryObj->getAllAttributes();
+
+    if (!index.complete || index.maxAttrCount > attrs.size())
+    {
+        return nullptr;
+    }
+
+    auto it = index.objects.find(signature);
+
+    if (it == index.objects.end())
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<SaiObj> candidate;
+
+    for (const auto &currentObj: it->second)
+    {
+        if (currentObj->getObjectStatus() != SAI_OBJECT_STATUS_NOT_PROCESSED)
+        {
+            continue;
+        }
+
+        sai_object_compare_info_t soci;
+
+        if (!isGenericObjectCandidate(temporaryObj, currentObj, soci))
+        {
+            continue;
+        }
+
+        if (soci.equal_attributes != attrs.size())
+        {
+            /*
+             * Signature collision.
+             */
+
+            continue;
+        }
+
+        if (candidate != nullptr)
+        {
+            /*
+             * Multiple objects with all attributes equal, selection between
+             * them is left to full compare.
+             */
+
+            return nullptr;
+        }
+
+        candidate = currentObj;
+    }
+
+    if (candidate != nullptr)
+    {
+        SWSS_LOG_INFO("found candidate %s with equal signature for %s",
+                candidate->m_str_object_id.c_str(),
+                temporaryObj->m_str_object_id.c_str());
+    }
+
+    return candidate;
+}
+
 bool BestCandidateFinder::compareByEqualAttributes(
         _In_ const sai_object_compare_info_t &a,
         _In_ const sai_object_compare_info_t &b)
@@ -2030,7 +2335,7 @@ std::shared_ptr<SaiObj> BestCandidateFinder::selectRandomCandidate(
 
     SWSS_LOG_INFO("selecting random candidate from %zu objects", candidateCount);
 
-    size_t index = std::rand() % candidateCount;
+    size_t index = g_randomGenerator() % candidateCount;
 
     return candidateObjects.at(index).obj;
 }
@@ -32,6 +32,16 @@ namespace syncd
 
         public:
 
+            /**
+             * @brief Seed random candidate selection for current thread.
+             *
+             * Each thread uses its own random generator, so views of
+             * different switches can be compared concurrently and selection
+             * stays deterministic for given seed.
+             */
+            static void seedRandom(
+                    _In_ unsigned int seed);
+
             std::shared_ptr<SaiObj> findCurrentBestMatch(
                     _In_ const std::shared_ptr<const SaiObj> &temporaryObj);
 
@@ -43,6 +53,17 @@ namespace syncd
             std::shared_ptr<SaiObj> findCurrentBestMatchForGenericObject(
                     _In_ const std::shared_ptr<const SaiObj> &temporaryObj);
 
+            bool isGenericObjectCandidate(
+                    _In_ const std::shared_ptr<const SaiObj> &temporaryObj,
+                    _In_ const std::shared_ptr<SaiObj> &currentObj,
+                    _Out_ sai_object_compare_info_t &soci);
+
+            std::shared_ptr<SaiObj> findCurrentBestMatchForGenericObjectUsingSignature(
+                    _In_ const std::shared_ptr<const SaiObj> &temporaryObj);
+
+            const AsicView::SignatureIndex& getSignatureIndex(
+                    _In_ sai_object_type_t objectType);
+
             std::shared_ptr<SaiObj> findCurrentBestMatchForLag(
                     _In_ const std::shared_ptr<const SaiObj> &temporaryObj,
                     _In_ const std::vector<sai_object_compare_info_t> &candidateObjects);
@@ -146,6 +167,28 @@ namespace syncd
             static std::shared_ptr<SaiObj> selectRandomCandidate(
                     _In_ const std::vector<sai_object_compare_info_t> &candidateObjects);
 
+            /**
+             * @brief Get object attributes signature.
+             *
+             * Signature is computed in a way that objects with all attributes
+             * equal according to hasEqualAttribute will have the same
+             * signature. Object id attributes are translated to RID, so
+             * signature can't be computed when some VID don't have RID yet.
+             *
+             * @param view View in which object exists.
+             * @param obj Object to compute signature for.
+             * @param signature Computed signature.
+             *
+             * @return True if signature was computed, false otherwise.
+             */
+            static bool hasObjectTypeSpecificMatch(
+                    _In_ sai_object_type_t objectType);
+
+            static bool getAttributesSignature(
+                    _In_ const AsicView &view,
+                    _In_ const std::shared_ptr<const SaiObj> &obj,
+                    _Out_ size_t &signature);
+
             static int findAllChildsInDependencyTreeCount(
                     _In_ const AsicView &view,
                     _In_ const std::shared_ptr<const SaiObj> &obj);
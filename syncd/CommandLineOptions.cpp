@@ -22,6 +22,21 @@ CommandLineOptions::CommandLineOptions()
     m_enableSyncMode = false;
     m_enableSaiBulkSupport = false;
 
+    m_bulkPrepareThreads = 0;
+
+    m_disableParallelApplyView = false;
+
+    m_disableLatencyHistograms = false;
+
+    m_asicAuditInterval = 0;
+
+    m_asicAuditBudget = 5000;
+
+    // not set, so profile value can be used when policy is not given on
+    // command line
+
+    m_vendorLockPolicy = VENDOR_SAI_LOCK_POLICY_UNKNOWN;
+
     m_redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
 
     m_startType = SAI_START_TYPE_COLD_BOOT;
@@ -58,6 +73,12 @@ std::string CommandLineOptions::getCommandLineString() const
     ss << " EnableSyncMode=" << (m_enableSyncMode ? "YES" : "NO");
     ss << " RedisCommunicationMode=" << sai_serialize_redis_communication_mode(m_redisCommunicationMode);
     ss << " EnableSaiBulkSuport=" << (m_enableSaiBulkSupport ? "YES" : "NO");
+    ss << " BulkPrepareThreads=" << m_bulkPrepareThreads;
+    ss << " DisableParallelApplyView=" << (m_disableParallelApplyView ? "YES" : "NO");
+    ss << " DisableLatencyHistograms=" << (m_disableLatencyHistograms ? "YES" : "NO");
+    ss << " AsicAuditInterval=" << m_asicAuditInterval;
+    ss << " AsicAuditBudget=" << m_asicAuditBudget;
+    ss << " VendorLockPolicy=" << lockPolicyToString(m_vendorLockPolicy);
     ss << " StartType=" << startTypeToString(m_startType);
     ss << " ProfileMapFile=" << m_profileMapFile;
     ss << " GlobalContext=" << m_globalContext;
@@ -128,3 +149,49 @@ std::string CommandLineOptions::startTypeToString(
             return STRING_SAI_START_TYPE_UNKNOWN;
     }
 }
+
+vendor_sai_lock_policy_t CommandLineOptions::lockPolicyStringToLockPolicy(
+        _In_ const std::string& lockPolicy)
+{
+    SWSS_LOG_ENTER();
+
+    if (lockPolicy == STRING_VENDOR_SAI_LOCK_POLICY_GLOBAL)
+        return VENDOR_SAI_LOCK_POLICY_GLOBAL;
+
+    if (lockPolicy == STRING_VENDOR_SAI_LOCK_POLICY_LANES)
+        return VENDOR_SAI_LOCK_POLICY_LANES;
+
+    if (lockPolicy == STRING_VENDOR_SAI_LOCK_POLICY_CONCURRENT)
+        return VENDOR_SAI_LOCK_POLICY_CONCURRENT;
+
+    SWSS_LOG_WARN("unknown lockPolicy: '%s'", lockPolicy.c_str());
+
+    return VENDOR_SAI_LOCK_POLICY_UNKNOWN;
+}
+
+std::string CommandLineOptions::lockPolicyToString(
+        _In_ vendor_sai_lock_policy_t lockPolicy)
+{
+    SWSS_LOG_ENTER();
+
+    switch (lockPolicy)
+    {
+        case VENDOR_SAI_LOCK_POLICY_GLOBAL:
+            return STRING_VENDOR_SAI_LOCK_POLICY_GLOBAL;
+
+        case VENDOR_SAI_LOCK_POLICY_LANES:
+            return STRING_VENDOR_SAI_LOCK_POLICY_LANES;
+
+        case VENDOR_SAI_LOCK_POLICY_CONCURRENT:
+            return STRING_VENDOR_SAI_LOCK_POLICY_CONCURRENT;
+
+        case VENDOR_SAI_LOCK_POLICY_UNKNOWN:
+            return STRING_VENDOR_SAI_LOCK_POLICY_UNKNOWN;
+
+        default:
+
+            SWSS_LOG_WARN("unknown lockPolicy '%d'", lockPolicy);
+
+            return STRING_VENDOR_SAI_LOCK_POLICY_UNKNOWN;
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "sairedis.h"
+#include "VendorSaiLockPolicy.h"
 
 #include "swss/sal.h"
 
@@ -55,6 +56,12 @@ namespace syncd
             static std::string startTypeToString(
                     _In_ sai_start_type_t startType);
 
+            static vendor_sai_lock_policy_t lockPolicyStringToLockPolicy(
+                    _In_ const std::string& lockPolicy);
+
+            static std::string lockPolicyToString(
+                    _In_ vendor_sai_lock_policy_t lockPolicy);
+
         public:
 
             bool m_enableDiagShell;
@@ -72,6 +79,42 @@ namespace syncd
 
             bool m_enableSaiBulkSupport;
 
+            /**
+             * @brief Number of worker threads used to deserialize and
+             * translate bulk entries, 0 means bulk is prepared serially.
+             */
+            uint32_t m_bulkPrepareThreads;
+
+            /**
+             * @brief When set to true, apply view builds and compares views
+             * of multiple switches one by one instead of on separate threads.
+             */
+            bool m_disableParallelApplyView;
+
+            /**
+             * @brief When set to true, hot path latency histograms are not
+             * recorded.
+             */
+            bool m_disableLatencyHistograms;
+
+            /**
+             * @brief Interval in milliseconds between background ASIC audit
+             * slices, 0 means background audit is disabled.
+             */
+            uint32_t m_asicAuditInterval;
+
+            /**
+             * @brief Time budget in microseconds of single ASIC audit slice.
+             */
+            uint32_t m_asicAuditBudget;
+
+            /**
+             * @brief Vendor SAI lock policy.
+             *
+             * VENDOR_SAI_LOCK_POLICY_UNKNOWN when not given on command line.
+             */
+            vendor_sai_lock_policy_t m_vendorLockPolicy;
+
             sai_redis_communication_mode_t m_redisCommunicationMode;
 
             sai_start_type_t m_startType;
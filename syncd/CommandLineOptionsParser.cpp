@@ -19,9 +19,9 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
     auto options = std::make_shared<CommandLineOptions>();
 
 #ifdef SAITHRIFT
-    const char* const optstring = "dp:t:g:x:b:uSUCsz:lrm:h";
+    const char* const optstring = "dp:t:g:x:b:uSUCsz:lw:VHL:A:a:rm:h";
 #else
-    const char* const optstring = "dp:t:g:x:b:uSUCsz:lh";
+    const char* const optstring = "dp:t:g:x:b:uSUCsz:lw:VHL:A:a:h";
 #endif // SAITHRIFT
 
     while (true)
@@ -38,6 +38,12 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
             { "syncMode",                no_argument,       0, 's' },
             { "redisCommunicationMode",  required_argument, 0, 'z' },
             { "enableSaiBulkSupport",    no_argument,       0, 'l' },
+            { "bulkPrepareThreads",      required_argument, 0, 'w' },
+            { "disableParallelApplyView",no_argument,       0, 'V' },
+            { "disableLatencyHistograms",no_argument,       0, 'H' },
+            { "vendorLockPolicy",        required_argument, 0, 'L' },
+            { "asicAuditInterval",       required_argument, 0, 'A' },
+            { "asicAuditBudget",         required_argument, 0, 'a' },
             { "globalContext",           required_argument, 0, 'g' },
             { "contextContig",           required_argument, 0, 'x' },
             { "breakConfig",             required_argument, 0, 'b' },
@@ -107,6 +113,36 @@ std::shared_ptr<CommandLineOptions> CommandLineOptionsParser::parseCommandLine(
                 options->m_enableSaiBulkSupport = true;
                 break;
 
+            case 'w':
+                options->m_bulkPrepareThreads = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'V':
+                options->m_disableParallelApplyView = true;
+                break;
+
+            case 'H':
+                options->m_disableLatencyHistograms = true;
+                break;
+
+            case 'L':
+                options->m_vendorLockPolicy = CommandLineOptions::lockPolicyStringToLockPolicy(optarg);
+
+                if (options->m_vendorLockPolicy == VENDOR_SAI_LOCK_POLICY_UNKNOWN)
+                {
+                    SWSS_LOG_ERROR("unknown vendor lock policy '%s'", optarg);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+
+            case 'A':
+                options->m_asicAuditInterval = (uint32_t)std::stoul(optarg);
+                break;
+
+            case 'a':
+                options->m_asicAuditBudget = (uint32_t)std::stoul(optarg);
+                break;
+
             case 'g':
                 options->m_globalContext = (uint32_t)std::stoul(optarg);
                 break;
@@ -151,9 +187,9 @@ void CommandLineOptionsParser::printUsage()
     SWSS_LOG_ENTER();
 
 #ifdef SAITHRIFT
-    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-r] [-m portmap] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-w threads] [-V] [-L policy] [-A interval] [-a budget] [-g idx] [-x contextConfig] [-b breakConfig] [-r] [-m portmap] [-h]" << std::endl;
 #else
-    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-g idx] [-x contextConfig] [-b breakConfig] [-h]" << std::endl;
+    std::cout << "Usage: syncd [-d] [-p profile] [-t type] [-u] [-S] [-U] [-C] [-s] [-z mode] [-l] [-w threads] [-V] [-L policy] [-A interval] [-a budget] [-g idx] [-x contextConfig] [-b breakConfig] [-h]" << std::endl;
 #endif // SAITHRIFT
 
     std::cout << "    -d --diag" << std::endl;
@@ -176,6 +212,19 @@ void CommandLineOptionsParser::printUsage()
     std::cout << "        Redis communication mode (redis_async|redis_sync|zmq_sync), default: redis_async" << std::endl;
     std::cout << "    -l --enableBulk" << std::endl;
     std::cout << "        Enable SAI Bulk support" << std::endl;
+    std::cout << "    -w --bulkPrepareThreads threads" << std::endl;
+    std::cout << "        Number of threads used to deserialize and translate bulk entries, default: 0 (serial)" << std::endl;
+    std::cout << "    -V --disableParallelApplyView" << std::endl;
+    std::cout << "        Build and compare views of multiple switches one by one during apply view" << std::endl;
+    std::cout << "    -H --disableLatencyHistograms" << std::endl;
+    std::cout << "        Don't record hot path latency histograms" << std::endl;
+    std::cout << "    -L --vendorLockPolicy policy" << std::endl;
+    std::cout << "        Vendor SAI lock policy (global|lanes|concurrent), default: value of" << std::endl;
+    std::cout << "        " SYNCD_PROFILE_KEY_VENDOR_LOCK_POLICY " profile key or global" << std::endl;
+    std::cout << "    -A --asicAuditInterval interval" << std::endl;
+    std::cout << "        Interval in ms between background ASIC audit slices, default: 0 (disabled)" << std::endl;
+    std::cout << "    -a --asicAuditBudget budget" << std::endl;
+    std::cout << "        Time budget in us of single background ASIC audit slice, default: 5000" << std::endl;
     std::cout << "    -g --globalContext" << std::endl;
     std::cout << "        Global context index to load from context config file" << std::endl;
     std::cout << "    -x --contextConfig" << std::endl;
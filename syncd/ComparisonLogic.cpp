@@ -64,11 +64,9 @@ ComparisonLogic::ComparisonLogic(
     m_current->m_defaultTrapGroupRid     = m_switch->getSwitchDefaultAttrOid(SAI_SWITCH_ATTR_DEFAULT_TRAP_GROUP);
     m_temp->m_defaultTrapGroupRid        = m_switch->getSwitchDefaultAttrOid(SAI_SWITCH_ATTR_DEFAULT_TRAP_GROUP);
 
-    auto seed = (unsigned int)std::time(0);
+    m_seed = (unsigned int)std::time(0);
 
-    SWSS_LOG_NOTICE("srand seed for switch %s: %u", sai_serialize_object_id(m_switch->getVid()).c_str(), seed);
-
-    std::srand(seed);
+    SWSS_LOG_NOTICE("random seed for switch %s: %u", sai_serialize_object_id(m_switch->getVid()).c_str(), m_seed);
 }
 
 ComparisonLogic::~ComparisonLogic()
@@ -85,6 +83,13 @@ void ComparisonLogic::compareViews()
     AsicView& current = *m_current;
     AsicView& temp = *m_temp;
 
+    /*
+     * Comparison can be executed on worker thread, so random generator must
+     * be seeded on thread that is executing comparison.
+     */
+
+    BestCandidateFinder::seedRandom(m_seed);
+
     /*
      * Match oids before calling populate existing objects since after
      * matching oids RID and VID maps will be populated.
@@ -236,6 +236,11 @@ namespace syncd
              */
             bool m_enableRefernceCountLogs;
 
+            /**
+             * @brief Seed used for random candidate selection.
+             */
+            unsigned int m_seed;
+
             std::shared_ptr<sairedis::SaiInterface> m_vendorSai;
 
             std::shared_ptr<SaiSwitchInterface> m_switch;
@@ -0,0 +1,202 @@
+#include "FdbIndex.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <limits>
+
+using namespace syncd;
+
+#define FDB_ENTRY_TYPE_UNKNOWN (-1)
+
+void FdbIndex::insert(
+        _In_ const std::string& key,
+        _In_ const sai_fdb_entry_t& fdbEntry,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_id_t portId = SAI_NULL_OBJECT_ID;
+
+    int32_t type = FDB_ENTRY_TYPE_UNKNOWN;
+
+    auto it = m_keys.find(key);
+
+    if (it != m_keys.end())
+    {
+        // entry is updated, keep attributes not present in values
+
+        portId = std::get<1>(it->second);
+        type = std::get<2>(it->second);
+    }
+
+    for (auto& fv: values)
+    {
+        if (fvField(fv) == "SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID")
+        {
+            sai_deserialize_object_id(fvValue(fv), portId);
+        }
+        else if (fvField(fv) == "SAI_FDB_ENTRY_ATTR_TYPE")
+        {
+            sai_deserialize_enum(fvValue(fv), &sai_metadata_enum_sai_fdb_entry_type_t, type);
+        }
+    }
+
+    insert(key, Group(fdbEntry.bv_id, portId, type));
+}
+
+void FdbIndex::setAttribute(
+        _In_ const std::string& key,
+        _In_ const std::string& attrId,
+        _In_ const std::string& attrValue)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_keys.find(key);
+
+    if (it == m_keys.end())
+    {
+        SWSS_LOG_WARN("fdb entry %s is not indexed", key.c_str());
+        return;
+    }
+
+    Group group = it->second;
+
+    if (attrId == "SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID")
+    {
+        sai_deserialize_object_id(attrValue, std::get<1>(group));
+    }
+    else if (attrId == "SAI_FDB_ENTRY_ATTR_TYPE")
+    {
+        sai_deserialize_enum(attrValue, &sai_metadata_enum_sai_fdb_entry_type_t, std::get<2>(group));
+    }
+    else
+    {
+        return;
+    }
+
+    insert(key, group);
+}
+
+void FdbIndex::insert(
+        _In_ const std::string& key,
+        _In_ const Group& group)
+{
+    SWSS_LOG_ENTER();
+
+    remove(key);
+
+    m_keys[key] = group;
+
+    m_groups[group].insert(key);
+}
+
+void FdbIndex::remove(
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_keys.find(key);
+
+    if (it == m_keys.end())
+    {
+        return;
+    }
+
+    auto git = m_groups.find(it->second);
+
+    if (git != m_groups.end())
+    {
+        git->second.erase(key);
+
+        if (git->second.empty())
+        {
+            m_groups.erase(git);
+        }
+    }
+
+    m_keys.erase(it);
+}
+
+void FdbIndex::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_groups.clear();
+
+    m_keys.clear();
+}
+
+size_t FdbIndex::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_keys.size();
+}
+
+bool FdbIndex::matchType(
+        _In_ int32_t entryType,
+        _In_ sai_fdb_flush_entry_type_t type)
+{
+    SWSS_LOG_ENTER();
+
+    switch (type)
+    {
+        case SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC:
+            return entryType == SAI_FDB_ENTRY_TYPE_DYNAMIC;
+
+        case SAI_FDB_FLUSH_ENTRY_TYPE_STATIC:
+            return entryType == SAI_FDB_ENTRY_TYPE_STATIC;
+
+        case SAI_FDB_FLUSH_ENTRY_TYPE_ALL:
+            return entryType == SAI_FDB_ENTRY_TYPE_DYNAMIC || entryType == SAI_FDB_ENTRY_TYPE_STATIC;
+
+        default:
+            SWSS_LOG_THROW("unknown fdb flush entry type: %d", type);
+    }
+}
+
+std::vector<std::string> FdbIndex::flush(
+        _In_ sai_object_id_t portId,
+        _In_ sai_object_id_t bvId,
+        _In_ sai_fdb_flush_entry_type_t type)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> keys;
+
+    // groups are sorted by bv_id, so when bv_id is specified we only need
+    // to visit groups of that bv_id
+
+    auto it = (bvId == SAI_NULL_OBJECT_ID)
+        ? m_groups.begin()
+        : m_groups.lower_bound(Group(bvId, SAI_NULL_OBJECT_ID, std::numeric_limits<int32_t>::min()));
+
+    while (it != m_groups.end())
+    {
+        const auto& group = it->first;
+
+        if (bvId != SAI_NULL_OBJECT_ID && std::get<0>(group) != bvId)
+        {
+            break;
+        }
+
+        if ((portId != SAI_NULL_OBJECT_ID && std::get<1>(group) != portId) || !matchType(std::get<2>(group), type))
+        {
+            it++;
+            continue;
+        }
+
+        for (auto& key: it->second)
+        {
+            keys.push_back(key);
+
+            m_keys.erase(key);
+        }
+
+        it = m_groups.erase(it);
+    }
+
+    return keys;
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+extern "C" {
+#include "saimetadata.h"
+}
+
+#include "swss/table.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace syncd
+{
+    /**
+     * @brief In memory index of FDB entries present in ASIC DB.
+     *
+     * Entries are grouped by bv_id, bridge port and entry type, so FDB flush
+     * can find exactly the keys to remove without scanning redis key space.
+     */
+    class FdbIndex
+    {
+        public:
+
+            FdbIndex() = default;
+
+            virtual ~FdbIndex() = default;
+
+        public:
+
+            /**
+             * @brief Insert or update FDB entry.
+             *
+             * Only bridge port and type attributes are taken into account,
+             * other attributes are ignored.
+             */
+            void insert(
+                    _In_ const std::string& key,
+                    _In_ const sai_fdb_entry_t& fdbEntry,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+            /**
+             * @brief Update single attribute of already indexed FDB entry.
+             */
+            void setAttribute(
+                    _In_ const std::string& key,
+                    _In_ const std::string& attrId,
+                    _In_ const std::string& attrValue);
+
+            void remove(
+                    _In_ const std::string& key);
+
+            void clear();
+
+            size_t size() const;
+
+            /**
+             * @brief Remove from index and return keys matching flush.
+             *
+             * NULL bv_id or port matches all entries.
+             */
+            std::vector<std::string> flush(
+                    _In_ sai_object_id_t portId,
+                    _In_ sai_object_id_t bvId,
+                    _In_ sai_fdb_flush_entry_type_t type);
+
+        private:
+
+            /**
+             * @brief Group key, bv_id, bridge port id and FDB entry type.
+             *
+             * Type is -1 when entry don't have type attribute.
+             */
+            typedef std::tuple<sai_object_id_t, sai_object_id_t, int32_t> Group;
+
+            void insert(
+                    _In_ const std::string& key,
+                    _In_ const Group& group);
+
+            static bool matchType(
+                    _In_ int32_t entryType,
+                    _In_ sai_fdb_flush_entry_type_t type);
+
+        private:
+
+            std::map<Group, std::unordered_set<std::string>> m_groups;
+
+            std::unordered_map<std::string, Group> m_keys;
+    };
+}
@@ -2,6 +2,7 @@
 #include "VidManager.h"
 
 #include "meta/sai_serialize.h"
+#include "meta/LatencyHistogram.h"
 
 #include "swss/redisapi.h"
 #include "swss/tokenize.h"
@@ -1330,7 +1331,13 @@ std::shared_ptr<BaseCounterContext> FlexCounter::getCounterContext(
         return iter->second;
     }
 
-    auto ret = m_counterContext.emplace(name, createCounterContext(name));
+    auto context = createCounterContext(name);
+
+    // histograms are never removed from registry, so pointer stays valid
+
+    context->collect_histogram = &sairediscommon::LatencyHistogramRegistry::getHistogram("FlexCounter:" + m_instanceId + ":" + name);
+
+    auto ret = m_counterContext.emplace(name, context);
     return ret.first->second;
 }
 
@@ -1364,6 +1371,8 @@ void FlexCounter::collectCounters(
 
     for (const auto &it : m_counterContext)
     {
+        sairediscommon::LatencyHistogramScope scope(*it.second->collect_histogram);
+
         it.second->collectData(countersTable);
     }
 
@@ -5,6 +5,7 @@ extern "C" {
 }
 
 #include "meta/SaiInterface.h"
+#include "meta/LatencyHistogram.h"
 
 #include "swss/table.h"
 
@@ -55,6 +56,11 @@ namespace syncd
         bool use_sai_stats_capa_query = true;
         bool use_sai_stats_ext = false;
         bool double_confirm_supported_counters = false;
+
+        /**
+         * @brief Histogram of collect cycle duration, set when context is created.
+         */
+        sairediscommon::LatencyHistogram* collect_histogram = nullptr;
     };
     class FlexCounter
     {
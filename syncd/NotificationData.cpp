@@ -0,0 +1,507 @@
+#include "NotificationData.h"
+
+#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <type_traits>
+
+using namespace syncd;
+
+template<typename T>
+static void allocList(
+        _Inout_ T& element)
+{
+    SWSS_LOG_ENTER();
+
+    // count is already copied from source, allocate with new[], since
+    // sai_deserialize_free_attribute_value is releasing list with delete[]
+
+    element.list = new typename std::remove_reference<decltype(*element.list)>::type[element.count];
+}
+
+/**
+ * @brief Allocate own list for non primitive FDB attribute value.
+ *
+ * Attribute value is shallow copy of source attribute, so list count is
+ * already set, and list content can be transferred after allocation.
+ */
+static void allocFdbAttrList(
+        _In_ const sai_attr_metadata_t& meta,
+        _Inout_ sai_attribute_t& attr)
+{
+    SWSS_LOG_ENTER();
+
+    switch (meta.attrvaluetype)
+    {
+        case SAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+            allocList(attr.value.objlist);
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_UINT8_LIST:
+            allocList(attr.value.u8list);
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_INT8_LIST:
+            allocList(attr.value.s8list);
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_UINT32_LIST:
+            allocList(attr.value.u32list);
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_INT32_LIST:
+            allocList(attr.value.s32list);
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_VLAN_LIST:
+            allocList(attr.value.vlanlist);
+            break;
+
+        case SAI_ATTR_VALUE_TYPE_IP_ADDRESS_LIST:
+            allocList(attr.value.ipaddrlist);
+            break;
+
+        default:
+            SWSS_LOG_THROW("fdb_entry attribute %s value type %d is not supported, FIXME",
+                    meta.attridname,
+                    meta.attrvaluetype);
+    }
+}
+
+NotificationData::NotificationData(
+        _In_ uint32_t count,
+        _In_ const sai_fdb_event_notification_data_t *data):
+    m_type(SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT),
+    m_name(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT),
+    m_switchId(SAI_NULL_OBJECT_ID),
+    m_switchOperStatus(SAI_SWITCH_OPER_STATUS_UNKNOWN)
+{
+    SWSS_LOG_ENTER();
+
+    if (count && data == nullptr)
+    {
+        SWSS_LOG_THROW("fdb event data pointer is null");
+    }
+
+    m_fdbEventData.assign(data, data + count);
+
+    m_fdbEventAttrs.resize(count);
+
+    try
+    {
+        for (uint32_t idx = 0; idx < count; idx++)
+        {
+            auto& attrs = m_fdbEventAttrs[idx];
+
+            attrs.reserve(data[idx].attr_count);
+
+            for (uint32_t i = 0; i < data[idx].attr_count; i++)
+            {
+                sai_attribute_t attr = data[idx].attr[i];
+
+                auto meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_FDB_ENTRY, attr.id);
+
+                if (meta == NULL)
+                {
+                    SWSS_LOG_THROW("unable to get metadata for fdb_entry attr.id = %d", attr.id);
+                }
+
+                if (meta->isprimitive)
+                {
+                    attrs.push_back(attr);
+                    continue;
+                }
+
+                // list is pointing to vendor memory, make our own copy, and
+                // add attribute right after allocation, so it's freed even
+                // when transfer fails
+
+                allocFdbAttrList(*meta, attr);
+
+                attrs.push_back(attr);
+
+                if (transfer_attributes(SAI_OBJECT_TYPE_FDB_ENTRY, 1, &data[idx].attr[i], &attrs.back(), false) != SAI_STATUS_SUCCESS)
+                {
+                    SWSS_LOG_THROW("failed to copy fdb_entry attribute %s", meta->attridname);
+                }
+            }
+
+            m_fdbEventData[idx].attr = attrs.data();
+        }
+    }
+    catch (const std::exception&)
+    {
+        // destructor is not called when constructor throws
+
+        freeFdbEventAttrs();
+
+        throw;
+    }
+}
+
+NotificationData::NotificationData(
+        _In_ uint32_t count,
+        _In_ const sai_nat_event_notification_data_t *data):
+    m_type(SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT),
+    m_name(SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT),
+    m_switchId(SAI_NULL_OBJECT_ID),
+    m_switchOperStatus(SAI_SWITCH_OPER_STATUS_UNKNOWN)
+{
+    SWSS_LOG_ENTER();
+
+    if (count && data == nullptr)
+    {
+        SWSS_LOG_THROW("nat event data pointer is null");
+    }
+
+    m_natEventData.assign(data, data + count);
+}
+
+NotificationData::NotificationData(
+        _In_ uint32_t count,
+        _In_ const sai_port_oper_status_notification_t *data):
+    m_type(SAI_SWITCH_NOTIFICATION_TYPE_PORT_STATE_CHANGE),
+    m_name(SAI_SWITCH_NOTIFICATION_NAME_PORT_STATE_CHANGE),
+    m_switchId(SAI_NULL_OBJECT_ID),
+    m_switchOperStatus(SAI_SWITCH_OPER_STATUS_UNKNOWN)
+{
+    SWSS_LOG_ENTER();
+
+    if (count && data == nullptr)
+    {
+        SWSS_LOG_THROW("port oper status data pointer is null");
+    }
+
+    m_portOperStatusData.assign(data, data + count);
+}
+
+NotificationData::NotificationData(
+        _In_ uint32_t count,
+        _In_ const sai_queue_deadlock_notification_data_t *data):
+    m_type(SAI_SWITCH_NOTIFICATION_TYPE_QUEUE_PFC_DEADLOCK),
+    m_name(SAI_SWITCH_NOTIFICATION_NAME_QUEUE_PFC_DEADLOCK),
+    m_switchId(SAI_NULL_OBJECT_ID),
+    m_switchOperStatus(SAI_SWITCH_OPER_STATUS_UNKNOWN)
+{
+    SWSS_LOG_ENTER();
+
+    if (count && data == nullptr)
+    {
+        SWSS_LOG_THROW("queue deadlock data pointer is null");
+    }
+
+    m_queueDeadlockData.assign(data, data + count);
+}
+
+NotificationData::NotificationData(
+        _In_ uint32_t count,
+        _In_ const sai_bfd_session_state_notification_t *data):
+    m_type(SAI_SWITCH_NOTIFICATION_TYPE_BFD_SESSION_STATE_CHANGE),
+    m_name(SAI_SWITCH_NOTIFICATION_NAME_BFD_SESSION_STATE_CHANGE),
+    m_switchId(SAI_NULL_OBJECT_ID),
+    m_switchOperStatus(SAI_SWITCH_OPER_STATUS_UNKNOWN)
+{
+    SWSS_LOG_ENTER();
+
+    if (count && data == nullptr)
+    {
+        SWSS_LOG_THROW("bfd session state data pointer is null");
+    }
+
+    m_bfdSessionStateData.assign(data, data + count);
+}
+
+NotificationData::NotificationData(
+        _In_ sai_object_id_t switchId,
+        _In_ sai_switch_oper_status_t switchOperStatus):
+    m_type(SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE),
+    m_name(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE),
+    m_switchId(switchId),
+    m_switchOperStatus(switchOperStatus)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+NotificationData::NotificationData(
+        _In_ sai_object_id_t switchId):
+    m_type(SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_SHUTDOWN_REQUEST),
+    m_name(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST),
+    m_switchId(switchId),
+    m_switchOperStatus(SAI_SWITCH_OPER_STATUS_UNKNOWN)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+NotificationData::~NotificationData()
+{
+    SWSS_LOG_ENTER();
+
+    freeFdbEventAttrs();
+}
+
+std::shared_ptr<NotificationData> NotificationData::deserialize(
+        _In_ const std::string& name,
+        _In_ const std::string& serializedNotification)
+{
+    SWSS_LOG_ENTER();
+
+    std::shared_ptr<NotificationData> notification;
+
+    uint32_t count;
+
+    if (name == SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT)
+    {
+        sai_fdb_event_notification_data_t *data = NULL;
+
+        sai_deserialize_fdb_event_ntf(serializedNotification, count, &data);
+
+        try
+        {
+            notification = std::make_shared<NotificationData>(count, data);
+        }
+        catch (const std::exception&)
+        {
+            sai_deserialize_free_fdb_event_ntf(count, data);
+
+            throw;
+        }
+
+        sai_deserialize_free_fdb_event_ntf(count, data);
+    }
+    else if (name == SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT)
+    {
+        sai_nat_event_notification_data_t *data = NULL;
+
+        sai_deserialize_nat_event_ntf(serializedNotification, count, &data);
+
+        notification = std::make_shared<NotificationData>(count, data);
+
+        sai_deserialize_free_nat_event_ntf(count, data);
+    }
+    else if (name == SAI_SWITCH_NOTIFICATION_NAME_PORT_STATE_CHANGE)
+    {
+        sai_port_oper_status_notification_t *data = NULL;
+
+        sai_deserialize_port_oper_status_ntf(serializedNotification, count, &data);
+
+        notification = std::make_shared<NotificationData>(count, data);
+
+        sai_deserialize_free_port_oper_status_ntf(count, data);
+    }
+    else if (name == SAI_SWITCH_NOTIFICATION_NAME_QUEUE_PFC_DEADLOCK)
+    {
+        sai_queue_deadlock_notification_data_t *data = NULL;
+
+        sai_deserialize_queue_deadlock_ntf(serializedNotification, count, &data);
+
+        notification = std::make_shared<NotificationData>(count, data);
+
+        sai_deserialize_free_queue_deadlock_ntf(count, data);
+    }
+    else if (name == SAI_SWITCH_NOTIFICATION_NAME_BFD_SESSION_STATE_CHANGE)
+    {
+        sai_bfd_session_state_notification_t *data = NULL;
+
+        sai_deserialize_bfd_session_state_ntf(serializedNotification, count, &data);
+
+        notification = std::make_shared<NotificationData>(count, data);
+
+        sai_deserialize_free_bfd_session_state_ntf(count, data);
+    }
+    else if (name == SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE)
+    {
+        sai_object_id_t switchId;
+        sai_switch_oper_status_t switchOperStatus;
+
+        sai_deserialize_switch_oper_status(serializedNotification, switchId, switchOperStatus);
+
+        notification = std::make_shared<NotificationData>(switchId, switchOperStatus);
+    }
+    else if (name == SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST)
+    {
+        sai_object_id_t switchId;
+
+        sai_deserialize_switch_shutdown_request(serializedNotification, switchId);
+
+        notification = std::make_shared<NotificationData>(switchId);
+    }
+    else
+    {
+        SWSS_LOG_THROW("unknown notification: '%s', FIXME", name.c_str());
+    }
+
+    return notification;
+}
+
+sai_switch_notification_type_t NotificationData::getType() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_type;
+}
+
+const std::string& NotificationData::getName() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_name;
+}
+
+std::string NotificationData::serialize() const
+{
+    SWSS_LOG_ENTER();
+
+    switch (m_type)
+    {
+        case SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT:
+            return sai_serialize_fdb_event_ntf(getCount(), m_fdbEventData.data());
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT:
+            return sai_serialize_nat_event_ntf(getCount(), m_natEventData.data());
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_PORT_STATE_CHANGE:
+            return sai_serialize_port_oper_status_ntf(getCount(), m_portOperStatusData.data());
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_QUEUE_PFC_DEADLOCK:
+            return sai_serialize_queue_deadlock_ntf(getCount(), m_queueDeadlockData.data());
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_BFD_SESSION_STATE_CHANGE:
+            return sai_serialize_bfd_session_state_ntf(getCount(), m_bfdSessionStateData.data());
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE:
+            return sai_serialize_switch_oper_status(m_switchId, m_switchOperStatus);
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_SHUTDOWN_REQUEST:
+            return sai_serialize_switch_shutdown_request(m_switchId);
+
+        default:
+            SWSS_LOG_THROW("notification %s is not supported, FIXME", m_name.c_str());
+    }
+}
+
+uint32_t NotificationData::getCount() const
+{
+    SWSS_LOG_ENTER();
+
+    switch (m_type)
+    {
+        case SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT:
+            return (uint32_t)m_fdbEventData.size();
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT:
+            return (uint32_t)m_natEventData.size();
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_PORT_STATE_CHANGE:
+            return (uint32_t)m_portOperStatusData.size();
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_QUEUE_PFC_DEADLOCK:
+            return (uint32_t)m_queueDeadlockData.size();
+
+        case SAI_SWITCH_NOTIFICATION_TYPE_BFD_SESSION_STATE_CHANGE:
+            return (uint32_t)m_bfdSessionStateData.size();
+
+        default:
+            return 1;
+    }
+}
+
+sai_fdb_event_notification_data_t* NotificationData::getFdbEventData()
+{
+    SWSS_LOG_ENTER();
+
+    checkType(SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT);
+
+    return m_fdbEventData.data();
+}
+
+sai_nat_event_notification_data_t* NotificationData::getNatEventData()
+{
+    SWSS_LOG_ENTER();
+
+    checkType(SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT);
+
+    return m_natEventData.data();
+}
+
+sai_port_oper_status_notification_t* NotificationData::getPortOperStatusData()
+{
+    SWSS_LOG_ENTER();
+
+    checkType(SAI_SWITCH_NOTIFICATION_TYPE_PORT_STATE_CHANGE);
+
+    return m_portOperStatusData.data();
+}
+
+sai_queue_deadlock_notification_data_t* NotificationData::getQueueDeadlockData()
+{
+    SWSS_LOG_ENTER();
+
+    checkType(SAI_SWITCH_NOTIFICATION_TYPE_QUEUE_PFC_DEADLOCK);
+
+    return m_queueDeadlockData.data();
+}
+
+sai_bfd_session_state_notification_t* NotificationData::getBfdSessionStateData()
+{
+    SWSS_LOG_ENTER();
+
+    checkType(SAI_SWITCH_NOTIFICATION_TYPE_BFD_SESSION_STATE_CHANGE);
+
+    return m_bfdSessionStateData.data();
+}
+
+sai_object_id_t NotificationData::getSwitchId() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_switchId;
+}
+
+sai_switch_oper_status_t NotificationData::getSwitchOperStatus() const
+{
+    SWSS_LOG_ENTER();
+
+    checkType(SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE);
+
+    return m_switchOperStatus;
+}
+
+void NotificationData::freeFdbEventAttrs()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& attrs: m_fdbEventAttrs)
+    {
+        for (auto& attr: attrs)
+        {
+            auto meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_FDB_ENTRY, attr.id);
+
+            if (meta == NULL || meta->isprimitive)
+            {
+                continue;
+            }
+
+            sai_deserialize_free_attribute_value(meta->attrvaluetype, attr);
+        }
+    }
+
+    m_fdbEventAttrs.clear();
+}
+
+void NotificationData::checkType(
+        _In_ sai_switch_notification_type_t type) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_type != type)
+    {
+        SWSS_LOG_THROW("notification %s is not of type %d", m_name.c_str(), type);
+    }
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+extern "C" {
+#include <sai.h>
+#include <saimetadata.h>
+}
+
+#include <string>
+#include <vector>
+#include <memory>
+
+namespace syncd
+{
+    /**
+     * @brief Notification data received from vendor SAI.
+     *
+     * Holds deep copy of notification structures, so notification can be
+     * queued and translated without string round trips. Notification is
+     * serialized only once, after RID to VID translation, when it's sent out.
+     */
+    class NotificationData
+    {
+        public:
+
+            NotificationData(
+                    _In_ uint32_t count,
+                    _In_ const sai_fdb_event_notification_data_t *data);
+
+            NotificationData(
+                    _In_ uint32_t count,
+                    _In_ const sai_nat_event_notification_data_t *data);
+
+            NotificationData(
+                    _In_ uint32_t count,
+                    _In_ const sai_port_oper_status_notification_t *data);
+
+            NotificationData(
+                    _In_ uint32_t count,
+                    _In_ const sai_queue_deadlock_notification_data_t *data);
+
+            NotificationData(
+                    _In_ uint32_t count,
+                    _In_ const sai_bfd_session_state_notification_t *data);
+
+            NotificationData(
+                    _In_ sai_object_id_t switchId,
+                    _In_ sai_switch_oper_status_t switchOperStatus);
+
+            /**
+             * @brief Switch shutdown request notification.
+             */
+            explicit NotificationData(
+                    _In_ sai_object_id_t switchId);
+
+            virtual ~NotificationData();
+
+        private:
+
+            NotificationData(const NotificationData&) = delete;
+            NotificationData& operator=(const NotificationData&) = delete;
+
+        public:
+
+            /**
+             * @brief Create notification data from serialized notification.
+             *
+             * Throws when notification name is unknown.
+             */
+            static std::shared_ptr<NotificationData> deserialize(
+                    _In_ const std::string& name,
+                    _In_ const std::string& serializedNotification);
+
+        public:
+
+            sai_switch_notification_type_t getType() const;
+
+            /**
+             * @brief Get notification name, like SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT.
+             */
+            const std::string& getName() const;
+
+            /**
+             * @brief Serialize notification data in current state.
+             */
+            std::string serialize() const;
+
+            /**
+             * @brief Get number of entries in notification data.
+             */
+            uint32_t getCount() const;
+
+            sai_fdb_event_notification_data_t* getFdbEventData();
+
+            sai_nat_event_notification_data_t* getNatEventData();
+
+            sai_port_oper_status_notification_t* getPortOperStatusData();
+
+            sai_queue_deadlock_notification_data_t* getQueueDeadlockData();
+
+            sai_bfd_session_state_notification_t* getBfdSessionStateData();
+
+            sai_object_id_t getSwitchId() const;
+
+            sai_switch_oper_status_t getSwitchOperStatus() const;
+
+        private:
+
+            void checkType(
+                    _In_ sai_switch_notification_type_t type) const;
+
+            void freeFdbEventAttrs();
+
+        private:
+
+            const sai_switch_notification_type_t m_type;
+
+            const std::string m_name;
+
+            std::vector<sai_fdb_event_notification_data_t> m_fdbEventData;
+
+            /**
+             * @brief Attributes of each FDB event.
+             *
+             * Non primitive attribute values are allocated and must be freed.
+             */
+            std::vector<std::vector<sai_attribute_t>> m_fdbEventAttrs;
+
+            std::vector<sai_nat_event_notification_data_t> m_natEventData;
+
+            std::vector<sai_port_oper_status_notification_t> m_portOperStatusData;
+
+            std::vector<sai_queue_deadlock_notification_data_t> m_queueDeadlockData;
+
+            std::vector<sai_bfd_session_state_notification_t> m_bfdSessionStateData;
+
+            sai_object_id_t m_switchId;
+
+            sai_switch_oper_status_t m_switchOperStatus;
+    };
+}
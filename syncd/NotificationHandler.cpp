@@ -128,18 +128,13 @@ void NotificationHandler::updateNotificationsPointers(
     }
 }
 
-// TODO use same Notification class from sairedis lib
-// then this will handle deserialize free
-
 void NotificationHandler::onFdbEvent(
         _In_ uint32_t count,
         _In_ const sai_fdb_event_notification_data_t *data)
 {
     SWSS_LOG_ENTER();
 
-    std::string s = sai_serialize_fdb_event_ntf(count, data);
-
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, s);
+    enqueueNotification(std::make_shared<NotificationData>(count, data));
 }
 
 void NotificationHandler::onNatEvent(
@@ -148,9 +143,7 @@ void NotificationHandler::onNatEvent(
 {
     SWSS_LOG_ENTER();
 
-    std::string s = sai_serialize_nat_event_ntf(count, data);
-
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT, s);
+    enqueueNotification(std::make_shared<NotificationData>(count, data));
 }
 
 void NotificationHandler::onPortStateChange(
@@ -159,9 +152,7 @@ void NotificationHandler::onPortStateChange(
 {
     SWSS_LOG_ENTER();
 
-    auto s = sai_serialize_port_oper_status_ntf(count, data);
-
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_PORT_STATE_CHANGE, s);
+    enqueueNotification(std::make_shared<NotificationData>(count, data));
 }
 
 void NotificationHandler::onQueuePfcDeadlock(
@@ -170,9 +161,7 @@ void NotificationHandler::onQueuePfcDeadlock(
 {
     SWSS_LOG_ENTER();
 
-    auto s = sai_serialize_queue_deadlock_ntf(count, data);
-
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_QUEUE_PFC_DEADLOCK, s);
+    enqueueNotification(std::make_shared<NotificationData>(count, data));
 }
 
 void NotificationHandler::onSwitchShutdownRequest(
@@ -180,9 +169,7 @@ void NotificationHandler::onSwitchShutdownRequest(
 {
     SWSS_LOG_ENTER();
 
-    auto s = sai_serialize_switch_shutdown_request(switch_id);
-
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST, s);
+    enqueueNotification(std::make_shared<NotificationData>(switch_id));
 }
 
 void NotificationHandler::onSwitchStateChange(
@@ -191,9 +178,7 @@ void NotificationHandler::onSwitchStateChange(
 {
     SWSS_LOG_ENTER();
 
-    auto s = sai_serialize_switch_oper_status(switch_id, switch_oper_status);
-
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE, s);
+    enqueueNotification(std::make_shared<NotificationData>(switch_id, switch_oper_status));
 }
 
 void NotificationHandler::onBfdSessionStateChange(
@@ -202,36 +187,21 @@ void NotificationHandler::onBfdSessionStateChange(
 {
     SWSS_LOG_ENTER();
 
-    std::string s = sai_serialize_bfd_session_state_ntf(count, data);
-
-    enqueueNotification(SAI_SWITCH_NOTIFICATION_NAME_BFD_SESSION_STATE_CHANGE, s);
+    enqueueNotification(std::make_shared<NotificationData>(count, data));
 }
 
 void NotificationHandler::enqueueNotification(
-        _In_ const std::string& op,
-        _In_ const std::string& data,
-        _In_ const std::vector<swss::FieldValueTuple> &entry)
+        _In_ std::shared_ptr<NotificationData> notification)
 {
     SWSS_LOG_ENTER();
 
-    SWSS_LOG_INFO("%s %s", op.c_str(), data.c_str());
+    // notification data is deep copy of vendor data, it will be serialized
+    // only once by processor, after translating RID to VID
 
-    swss::KeyOpFieldsValuesTuple item(op, data, entry);
+    SWSS_LOG_INFO("%s count: %u", notification->getName().c_str(), notification->getCount());
 
-    if (m_notificationQueue->enqueue(item))
+    if (m_notificationQueue->enqueue(std::move(notification)))
     {
         m_processor->signal();
     }
 }
-
-void NotificationHandler::enqueueNotification(
-        _In_ const std::string& op,
-        _In_ const std::string& data)
-{
-    SWSS_LOG_ENTER();
-
-    std::vector<swss::FieldValueTuple> entry;
-
-    enqueueNotification(op, data, entry);
-}
-
@@ -4,11 +4,10 @@ extern "C"{
 #include "saimetadata.h"
 }
 
+#include "NotificationData.h"
 #include "NotificationQueue.h"
 #include "NotificationProcessor.h"
 
-#include "swss/table.h"
-
 #include <string>
 #include <vector>
 #include <memory>
@@ -67,13 +66,7 @@ namespace syncd
         private:
 
             void enqueueNotification(
-                    _In_ const std::string& op,
-                    _In_ const std::string& data,
-                    _In_ const std::vector<swss::FieldValueTuple> &entry);
-
-            void enqueueNotification(
-                    _In_ const std::string& op,
-                    _In_ const std::string& data);
+                    _In_ std::shared_ptr<NotificationData> notification);
 
         private:
 
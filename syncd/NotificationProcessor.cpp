@@ -17,7 +17,7 @@ using namespace saimeta;
 NotificationProcessor::NotificationProcessor(
         _In_ std::shared_ptr<NotificationProducerBase> producer,
         _In_ std::shared_ptr<RedisClient> client,
-        _In_ std::function<void(const swss::KeyOpFieldsValuesTuple&)> synchronizer):
+        _In_ std::function<void(NotificationData&)> synchronizer):
     m_synchronizer(synchronizer),
     m_client(client),
     m_notifications(producer)
@@ -306,6 +306,45 @@ void NotificationProcessor::process_on_fdb_event(
 
     bool sendntf = true;
 
+    // all ASIC DB changes of this notification are executed in single
+    // transaction, before notification is sent
+
+    m_client->beginAsicStateBatch();
+
+    try
+    {
+        process_on_fdb_event_entries(count, data, sendntf);
+    }
+    catch (const std::exception&)
+    {
+        // don't write partial changes to ASIC DB
+
+        m_client->discardAsicStateBatch();
+
+        throw;
+    }
+
+    m_client->endAsicStateBatch();
+
+    if (sendntf)
+    {
+        std::string s = sai_serialize_fdb_event_ntf(count, data);
+
+        sendNotification(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, s);
+    }
+    else
+    {
+        SWSS_LOG_ERROR("FDB notification was not sent since it contain invalid OIDs, bug?");
+    }
+}
+
+void NotificationProcessor::process_on_fdb_event_entries(
+        _In_ uint32_t count,
+        _In_ sai_fdb_event_notification_data_t *data,
+        _Inout_ bool& sendntf)
+{
+    SWSS_LOG_ENTER();
+
     for (uint32_t i = 0; i < count; i++)
     {
         sai_fdb_event_notification_data_t *fdb = &data[i];
@@ -334,17 +373,6 @@ void NotificationProcessor::process_on_fdb_event(
 
         redisPutFdbEntryToAsicView(fdb);
     }
-
-    if (sendntf)
-    {
-        std::string s = sai_serialize_fdb_event_ntf(count, data);
-
-        sendNotification(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, s);
-    }
-    else
-    {
-        SWSS_LOG_ERROR("FDB notification was not sent since it contain invalid OIDs, bug?");
-    }
 }
 
 /**
@@ -541,158 +569,71 @@ void NotificationProcessor::process_on_switch_shutdown_request(
     sendNotification(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST, s);
 }
 
-void NotificationProcessor::handle_switch_state_change(
-        _In_ const std::string &data)
-{
-    SWSS_LOG_ENTER();
-
-    sai_switch_oper_status_t switch_oper_status;
-    sai_object_id_t switch_id;
-
-    sai_deserialize_switch_oper_status(data, switch_id, switch_oper_status);
-
-    process_on_switch_state_change(switch_id, switch_oper_status);
-}
-
-void NotificationProcessor::handle_fdb_event(
-        _In_ const std::string &data)
-{
-    SWSS_LOG_ENTER();
-
-    uint32_t count;
-    sai_fdb_event_notification_data_t *fdbevent = NULL;
-
-    sai_deserialize_fdb_event_ntf(data, count, &fdbevent);
-
-    if (contains_fdb_flush_event(count, fdbevent))
-    {
-        SWSS_LOG_NOTICE("got fdb flush event: %s", data.c_str());
-    }
-
-    process_on_fdb_event(count, fdbevent);
-
-    sai_deserialize_free_fdb_event_ntf(count, fdbevent);
-}
-
-void NotificationProcessor::handle_nat_event(
-        _In_ const std::string &data)
+void NotificationProcessor::processNotification(
+        _Inout_ NotificationData& notification)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t count;
-    sai_nat_event_notification_data_t *natevent = NULL;
-
-    sai_deserialize_nat_event_ntf(data, count, &natevent);
-
-    process_on_nat_event(count, natevent);
-
-    sai_deserialize_free_nat_event_ntf(count, natevent);
+    m_synchronizer(notification);
 }
 
-void NotificationProcessor::handle_queue_deadlock(
-        _In_ const std::string &data)
+void NotificationProcessor::syncProcessNotification(
+        _In_ const swss::KeyOpFieldsValuesTuple& item)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t count;
-    sai_queue_deadlock_notification_data_t *qdeadlockevent = NULL;
-
-    sai_deserialize_queue_deadlock_ntf(data, count, &qdeadlockevent);
+    std::string notification = kfvKey(item);
+    std::string data = kfvOp(item);
 
-    process_on_queue_deadlock_event(count, qdeadlockevent);
+    auto notificationData = NotificationData::deserialize(notification, data);
 
-    sai_deserialize_free_queue_deadlock_ntf(count, qdeadlockevent);
+    syncProcessNotification(*notificationData);
 }
 
-void NotificationProcessor::handle_port_state_change(
-        _In_ const std::string &data)
+void NotificationProcessor::syncProcessNotification(
+        _Inout_ NotificationData& notification)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t count;
-    sai_port_oper_status_notification_t *portoperstatus = NULL;
-
-    sai_deserialize_port_oper_status_ntf(data, count, &portoperstatus);
-
-    process_on_port_state_change(count, portoperstatus);
-
-    sai_deserialize_free_port_oper_status_ntf(count, portoperstatus);
-}
-
-void NotificationProcessor::handle_bfd_session_state_change(
-        _In_ const std::string &data)
-{
-    SWSS_LOG_ENTER();
+    switch (notification.getType())
+    {
+        case SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_STATE_CHANGE:
+            process_on_switch_state_change(notification.getSwitchId(), notification.getSwitchOperStatus());
+            break;
 
-    uint32_t count;
-    sai_bfd_session_state_notification_t *bfdsessionstate = NULL;
+        case SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT:
 
-    sai_deserialize_bfd_session_state_ntf(data, count, &bfdsessionstate);
+            if (contains_fdb_flush_event(notification.getCount(), notification.getFdbEventData()))
+            {
+                SWSS_LOG_NOTICE("got fdb flush event: %s", notification.serialize().c_str());
+            }
 
-    process_on_bfd_session_state_change(count, bfdsessionstate);
+            process_on_fdb_event(notification.getCount(), notification.getFdbEventData());
+            break;
 
-    sai_deserialize_free_bfd_session_state_ntf(count, bfdsessionstate);
-}
+        case SAI_SWITCH_NOTIFICATION_TYPE_NAT_EVENT:
+            process_on_nat_event(notification.getCount(), notification.getNatEventData());
+            break;
 
-void NotificationProcessor::handle_switch_shutdown_request(
-        _In_ const std::string &data)
-{
-    SWSS_LOG_ENTER();
+        case SAI_SWITCH_NOTIFICATION_TYPE_PORT_STATE_CHANGE:
+            process_on_port_state_change(notification.getCount(), notification.getPortOperStatusData());
+            break;
 
-    sai_object_id_t switch_id;
+        case SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_SHUTDOWN_REQUEST:
+            process_on_switch_shutdown_request(notification.getSwitchId());
+            break;
 
-    sai_deserialize_switch_shutdown_request(data, switch_id);
+        case SAI_SWITCH_NOTIFICATION_TYPE_QUEUE_PFC_DEADLOCK:
+            process_on_queue_deadlock_event(notification.getCount(), notification.getQueueDeadlockData());
+            break;
 
-    process_on_switch_shutdown_request(switch_id);
-}
+        case SAI_SWITCH_NOTIFICATION_TYPE_BFD_SESSION_STATE_CHANGE:
+            process_on_bfd_session_state_change(notification.getCount(), notification.getBfdSessionStateData());
+            break;
 
-void NotificationProcessor::processNotification(
-        _In_ const swss::KeyOpFieldsValuesTuple& item)
-{
-    SWSS_LOG_ENTER();
-
-    m_synchronizer(item);
-}
-
-void NotificationProcessor::syncProcessNotification(
-        _In_ const swss::KeyOpFieldsValuesTuple& item)
-{
-    SWSS_LOG_ENTER();
-
-    std::string notification = kfvKey(item);
-    std::string data = kfvOp(item);
-
-    if (notification == SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE)
-    {
-        handle_switch_state_change(data);
-    }
-    else if (notification == SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT)
-    {
-        handle_fdb_event(data);
-    }
-    else if (notification == SAI_SWITCH_NOTIFICATION_NAME_NAT_EVENT)
-    {
-        handle_nat_event(data);
-    }
-    else if (notification == SAI_SWITCH_NOTIFICATION_NAME_PORT_STATE_CHANGE)
-    {
-        handle_port_state_change(data);
-    }
-    else if (notification == SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST)
-    {
-        handle_switch_shutdown_request(data);
-    }
-    else if (notification == SAI_SWITCH_NOTIFICATION_NAME_QUEUE_PFC_DEADLOCK)
-    {
-        handle_queue_deadlock(data);
-    }
-    else if (notification == SAI_SWITCH_NOTIFICATION_NAME_BFD_SESSION_STATE_CHANGE)
-    {
-        handle_bfd_session_state_change(data);
-    }
-    else
-    {
-        SWSS_LOG_ERROR("unknown notification: %s", notification.c_str());
+        default:
+            SWSS_LOG_ERROR("unknown notification: %s", notification.getName().c_str());
+            break;
     }
 }
 
@@ -713,11 +654,11 @@ void NotificationProcessor::ntf_process_function()
         // processing each notification is under same mutex as processing main
         // events, counters and reinit
 
-        swss::KeyOpFieldsValuesTuple item;
+        std::shared_ptr<NotificationData> item;
 
         while (m_notificationQueue->tryDequeue(item))
         {
-            processNotification(item);
+            processNotification(*item);
         }
     }
 }
@@ -6,6 +6,7 @@
 #include "NotificationProducerBase.h"
 
 #include "swss/notificationproducer.h"
+#include "swss/table.h"
 
 #include <thread>
 #include <memory>
@@ -21,7 +22,7 @@ namespace syncd
             NotificationProcessor(
                     _In_ std::shared_ptr<NotificationProducerBase> producer,
                     _In_ std::shared_ptr<RedisClient> client,
-                    _In_ std::function<void(const swss::KeyOpFieldsValuesTuple&)> synchronizer);
+                    _In_ std::function<void(NotificationData&)> synchronizer);
 
             virtual ~NotificationProcessor();
 
@@ -76,6 +77,11 @@ namespace syncd
                     _In_ uint32_t count,
                     _In_ sai_fdb_event_notification_data_t *data);
 
+            void process_on_fdb_event_entries(
+                    _In_ uint32_t count,
+                    _In_ sai_fdb_event_notification_data_t *data,
+                    _Inout_ bool& sendntf);
+
             void process_on_nat_event(
                     _In_ uint32_t count,
                     _In_ sai_nat_event_notification_data_t *data);
@@ -95,37 +101,30 @@ namespace syncd
             void process_on_switch_shutdown_request(
                     _In_ sai_object_id_t switch_rid);
 
-        private: // handlers
-
-            void handle_switch_state_change(
-                    _In_ const std::string &data);
-
-            void handle_fdb_event(
-                    _In_ const std::string &data);
-
-            void handle_nat_event(
-                    _In_ const std::string &data);
-
-            void handle_queue_deadlock(
-                    _In_ const std::string &data);
-
-            void handle_port_state_change(
-                    _In_ const std::string &data);
-
-            void handle_bfd_session_state_change(
-                    _In_ const std::string &data);
-
-            void handle_switch_shutdown_request(
-                    _In_ const std::string &data);
+        private:
 
             void processNotification(
-                    _In_ const swss::KeyOpFieldsValuesTuple& item);
+                    _Inout_ NotificationData& notification);
 
         public:
 
+            /**
+             * @brief Process serialized notification.
+             *
+             * Notification is deserialized and processed as typed notification.
+             */
             void syncProcessNotification(
                     _In_ const swss::KeyOpFieldsValuesTuple& item);
 
+            /**
+             * @brief Process notification.
+             *
+             * Notification data are translated in place from RID to VID and
+             * serialized only once before sending.
+             */
+            void syncProcessNotification(
+                    _Inout_ NotificationData& notification);
+
         public: // TODO to private
 
             std::shared_ptr<VirtualOidTranslator> m_translator;
@@ -145,7 +144,7 @@ namespace syncd
 
             bool m_runThread;
 
-            std::function<void(const swss::KeyOpFieldsValuesTuple&)> m_synchronizer;
+            std::function<void(NotificationData&)> m_synchronizer;
 
             std::shared_ptr<RedisClient> m_client;
 
@@ -29,13 +29,12 @@ NotificationQueue::~NotificationQueue()
 }
 
 bool NotificationQueue::enqueue(
-        _In_ const swss::KeyOpFieldsValuesTuple& item)
+        _In_ std::shared_ptr<NotificationData> item)
 {
     MUTEX;
 
     SWSS_LOG_ENTER();
     bool candidateToDrop = false;
-    std::string currentEvent;
 
     /*
      * If the queue exceeds the limit, then drop all further FDB events This is
@@ -50,7 +49,7 @@ bool NotificationQueue::enqueue(
      * running out of memory
      */
     auto queueSize = m_queue.size();
-    currentEvent = kfvKey(item);
+    const std::string& currentEvent = item->getName();
     if (currentEvent == m_lastEvent)
     {
         m_lastEventCount++;
@@ -81,7 +80,7 @@ bool NotificationQueue::enqueue(
 
     if (!candidateToDrop)
     {
-        m_queue.push(item);
+        m_queue.push(std::move(item));
 
         return true;
     }
@@ -100,7 +99,7 @@ bool NotificationQueue::enqueue(
 }
 
 bool NotificationQueue::tryDequeue(
-        _Out_ swss::KeyOpFieldsValuesTuple& item)
+        _Out_ std::shared_ptr<NotificationData>& item)
 {
     MUTEX;
 
@@ -111,7 +110,7 @@ bool NotificationQueue::tryDequeue(
         return false;
     }
 
-    item = m_queue.front();
+    item = std::move(m_queue.front());
 
     m_queue.pop();
 
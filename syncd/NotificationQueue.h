@@ -5,10 +5,11 @@ extern "C" {
 #include<saimetadata.h>
 }
 
-#include "swss/table.h"
+#include "NotificationData.h"
 
 #include <queue>
 #include <mutex>
+#include <memory>
 
 /**
  * @brief Default notification queue size limit.
@@ -43,10 +44,10 @@ namespace syncd
         public:
 
             bool enqueue(
-                    _In_ const swss::KeyOpFieldsValuesTuple& msg);
+                    _In_ std::shared_ptr<NotificationData> notification);
 
             bool tryDequeue(
-                    _Out_ swss::KeyOpFieldsValuesTuple& msg);
+                    _Out_ std::shared_ptr<NotificationData>& notification);
 
             size_t getQueueSize();
 
@@ -54,7 +55,7 @@ namespace syncd
 
             std::mutex m_mutex;
 
-            std::queue<swss::KeyOpFieldsValuesTuple> m_queue;
+            std::queue<std::shared_ptr<NotificationData>> m_queue;
 
             size_t m_queueSizeLimit;
 
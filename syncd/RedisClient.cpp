@@ -2,11 +2,19 @@
 #include "VidManager.h"
 
 #include "sairediscommon.h"
+#include "RedisScanner.h"
+#include "RedisTransaction.h"
 
 #include "meta/sai_serialize.h"
 
 #include "swss/logger.h"
 #include "swss/redisapi.h"
+#include "swss/redispipeline.h"
+#include "swss/redisreply.h"
+
+#include <algorithm>
+#include <iterator>
+#include <cstring>
 
 using namespace syncd;
 
@@ -19,15 +27,120 @@ using namespace syncd;
 #define HIDDEN                      "HIDDEN"
 #define COLDVIDS                    "COLDVIDS"
 
+// number of commands buffered before pipeline is flushed to redis
+#define ASIC_STATE_PIPELINE_SIZE    1024
+
+// max number of keys passed to single DEL command
+#define ASIC_STATE_DEL_BATCH_SIZE   512
+
+// number of keys requested by single SCAN command
+#define ASIC_STATE_SCAN_COUNT       1000
+
+#define ASIC_STATE_FDB_ENTRY_PREFIX ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_FDB_ENTRY:"
+
+static size_t pushDelCommands(
+        _In_ sairedis::RedisTransaction& transaction,
+        _In_ const std::vector<std::string>& keys)
+{
+    SWSS_LOG_ENTER();
+
+    size_t commands = 0;
+
+    for (size_t idx = 0; idx < keys.size(); idx += ASIC_STATE_DEL_BATCH_SIZE)
+    {
+        std::vector<std::string> args { "DEL" };
+
+        size_t end = std::min(keys.size(), idx + ASIC_STATE_DEL_BATCH_SIZE);
+
+        args.insert(args.end(), keys.begin() + idx, keys.begin() + end);
+
+        transaction.push(args);
+
+        commands++;
+    }
+
+    return commands;
+}
+
+static size_t pushHashDiff(
+        _In_ sairedis::RedisTransaction& transaction,
+        _In_ const std::string& key,
+        _In_ const std::map<std::string, std::string>* currentHash,
+        _In_ const std::map<std::string, std::string>& newHash)
+{
+    SWSS_LOG_ENTER();
+
+    if (newHash.size() == 0)
+    {
+        if (currentHash == nullptr || currentHash->size() == 0)
+        {
+            return 0;
+        }
+
+        transaction.push({ "DEL", key });
+
+        return 1;
+    }
+
+    size_t commands = 0;
+
+    std::vector<std::string> hdel { "HDEL", key };
+
+    if (currentHash)
+    {
+        for (auto& fv: *currentHash)
+        {
+            if (newHash.find(fv.first) == newHash.end())
+            {
+                hdel.push_back(fv.first);
+            }
+        }
+    }
+
+    if (hdel.size() > 2)
+    {
+        transaction.push(hdel);
+
+        commands++;
+    }
+
+    std::vector<std::string> hset { "HSET", key };
+
+    for (auto& fv: newHash)
+    {
+        if (currentHash)
+        {
+            auto it = currentHash->find(fv.first);
+
+            if (it != currentHash->end() && it->second == fv.second)
+            {
+                continue;
+            }
+        }
+
+        hset.push_back(fv.first);
+        hset.push_back(fv.second);
+    }
+
+    if (hset.size() > 2)
+    {
+        transaction.push(hset);
+
+        commands++;
+    }
+
+    return commands;
+}
+
 RedisClient::RedisClient(
         _In_ std::shared_ptr<swss::DBConnector> dbAsic):
-    m_dbAsic(dbAsic)
+    m_dbAsic(dbAsic),
+    m_fdbIndexValid(false),
+    m_batchActive(false)
 {
     SWSS_LOG_ENTER();
 
-    std::string fdbFlushLuaScript = swss::loadLuaScript("fdb_flush.lua"); // TODO script must be updated to version 2
-
-    m_fdbFlushSha = swss::loadRedisScript(dbAsic.get(), fdbFlushLuaScript);
+    // FDB index will be built from ASIC DB on first FDB flush
 }
 
 RedisClient::~RedisClient()
@@ -228,6 +341,12 @@ void RedisClient::setDummyAsicStateObject(
 
     std::string strKey = ASIC_STATE_TABLE + (":" + strObjectType + ":" + strVid);
 
+    if (m_batchActive)
+    {
+        pushBatchCommand({ "HSET", strKey, "NULL", "NULL" });
+        return;
+    }
+
     m_dbAsic->hset(strKey, "NULL", "NULL");
 }
 
@@ -383,6 +502,30 @@ void RedisClient::setPortLanes(
 
     auto key = getRedisLanesKey(switchVid);
 
+    if (m_batchActive)
+    {
+        // all lanes are set by single command, HSET without fields would
+        // fail queuing and discard whole batch
+
+        if (lanes.empty())
+        {
+            return;
+        }
+
+        std::vector<std::string> args { "HSET", key };
+
+        std::string strPortRid = sai_serialize_object_id(portRid);
+
+        for (uint32_t lane: lanes)
+        {
+            args.push_back(sai_serialize_number(lane));
+            args.push_back(strPortRid);
+        }
+
+        pushBatchCommand(args);
+        return;
+    }
+
     for (uint32_t lane: lanes)
     {
         std::string strLane = sai_serialize_number(lane);
@@ -432,25 +575,52 @@ int RedisClient::removePortFromLanesMap(
 {
     SWSS_LOG_ENTER();
 
+    auto removed = removePortsFromLanesMap(switchVid, { portRid });
+
+    return removed.at(portRid);
+}
+
+std::map<sai_object_id_t, int> RedisClient::removePortsFromLanesMap(
+        _In_ sai_object_id_t switchVid,
+        _In_ const std::vector<sai_object_id_t>& portRids) const
+{
+    SWSS_LOG_ENTER();
+
+    std::map<sai_object_id_t, int> removed;
+
+    for (auto portRid: portRids)
+    {
+        removed[portRid] = 0;
+    }
+
     // key - lane number, value - port RID
     auto map = getLaneMap(switchVid);
 
-    int removed = 0;
-
     auto key = getRedisLanesKey(switchVid);
 
+    std::vector<std::string> hdel { "HDEL", key };
+
     for (auto& kv: map)
     {
-        if (kv.second == portRid)
-        {
-            std::string strLane = sai_serialize_number(kv.first);
+        auto it = removed.find(kv.second);
 
-            m_dbAsic->hdel(key, strLane);
+        if (it != removed.end())
+        {
+            hdel.push_back(sai_serialize_number(kv.first));
 
-            removed++;
+            it->second++;
         }
     }
 
+    if (hdel.size() > 2)
+    {
+        swss::RedisCommand command;
+
+        command.format(hdel);
+
+        swss::RedisReply r(m_dbAsic.get(), command, REDIS_REPLY_INTEGER);
+    }
+
     return removed;
 }
 
@@ -477,6 +647,22 @@ void RedisClient::removeAsicObject(
 
     std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
+    if (metaKey.objecttype == SAI_OBJECT_TYPE_FDB_ENTRY)
+    {
+        m_fdbIndex.remove(key);
+    }
+
+    if (m_batchActive)
+    {
+        if (metaKey.objecttype == SAI_OBJECT_TYPE_FDB_ENTRY && !m_fdbIndexValid)
+        {
+            m_batchFdbChanges.push_back({ key, true, metaKey.objectkey.key.fdb_entry, {} });
+        }
+
+        pushBatchCommand({ "DEL", key });
+        return;
+    }
+
     m_dbAsic->del(key);
 }
 
@@ -501,6 +687,8 @@ void RedisClient::removeAsicObjects(
     for (const auto& key: keys)
     {
          prefixKeys.push_back((ASIC_STATE_TABLE ":") + key);
+
+         m_fdbIndex.remove(prefixKeys.back());
     }
 
     m_dbAsic->del(prefixKeys);
@@ -532,6 +720,11 @@ void RedisClient::setAsicObject(
     std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
     m_dbAsic->hset(key, attr, value);
+
+    if (metaKey.objecttype == SAI_OBJECT_TYPE_FDB_ENTRY)
+    {
+        m_fdbIndex.setAttribute(key, attr, value);
+    }
 }
 
 void RedisClient::setTempAsicObject(
@@ -554,6 +747,35 @@ void RedisClient::createAsicObject(
 
     std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
 
+    updateFdbIndex(key, metaKey, attrs);
+
+    if (m_batchActive)
+    {
+        if (metaKey.objecttype == SAI_OBJECT_TYPE_FDB_ENTRY && !m_fdbIndexValid)
+        {
+            m_batchFdbChanges.push_back({ key, false, metaKey.objectkey.key.fdb_entry, attrs });
+        }
+
+        // all attributes are set by single command
+
+        std::vector<std::string> args { "HSET", key };
+
+        if (attrs.size() == 0)
+        {
+            args.push_back("NULL");
+            args.push_back("NULL");
+        }
+
+        for (const auto& e: attrs)
+        {
+            args.push_back(fvField(e));
+            args.push_back(fvValue(e));
+        }
+
+        pushBatchCommand(args);
+        return;
+    }
+
     if (attrs.size() == 0)
     {
         m_dbAsic->hset(key, "NULL", "NULL");
@@ -596,11 +818,22 @@ void RedisClient::createAsicObjects(
     // we need to rewrite hash to add table prefix
     for (const auto& kvp: multiHash)
     {
-        hash[(ASIC_STATE_TABLE ":") + kvp.first] = kvp.second;
+        std::string key = (ASIC_STATE_TABLE ":") + kvp.first;
+
+        if (key.compare(0, strlen(ASIC_STATE_FDB_ENTRY_PREFIX), ASIC_STATE_FDB_ENTRY_PREFIX) == 0)
+        {
+            sai_object_meta_key_t metaKey;
+
+            sai_deserialize_object_meta_key(kvp.first, metaKey);
+
+            updateFdbIndex(key, metaKey, kvp.second);
+        }
+
+        hash[key] = kvp.second;
 
         if (kvp.second.size() == 0)
         {
-            hash[(ASIC_STATE_TABLE ":") + kvp.first].emplace_back(std::make_pair<std::string, std::string>("NULL", "NULL"));
+            hash[key].emplace_back(std::make_pair<std::string, std::string>("NULL", "NULL"));
         }
     }
 
@@ -646,6 +879,107 @@ void RedisClient::setVidAndRidMap(
     }
 }
 
+void RedisClient::updateAsicState(
+        _In_ const swss::TableDump& currentView,
+        _In_ const swss::TableDump& newView,
+        _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t>& vid2rid)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("update asic state");
+
+    invalidateFdbIndex();
+
+    // temporary view can be large, so it's scanned in chunks instead of KEYS
+    // which would block redis for the whole key space
+
+    auto tempKeys = sairedis::RedisScanner::keys(m_dbAsic.get(), TEMP_PREFIX ASIC_STATE_TABLE ":*", ASIC_STATE_SCAN_COUNT);
+
+    std::map<std::string, std::string> currentVid2Rid;
+    std::map<std::string, std::string> currentRid2Vid;
+
+    m_dbAsic->hgetall(VIDTORID, std::inserter(currentVid2Rid, currentVid2Rid.end()));
+    m_dbAsic->hgetall(RIDTOVID, std::inserter(currentRid2Vid, currentRid2Vid.end()));
+
+    size_t roundTrips = 2; // 2x HGETALL, SCAN round trips are not counted
+
+    sairedis::RedisTransaction transaction(m_dbAsic.get(), ASIC_STATE_PIPELINE_SIZE);
+
+    size_t commands = 0;
+
+    size_t created = 0;
+    size_t modified = 0;
+
+    std::vector<std::string> removedKeys;
+
+    for (auto& kvp: currentView)
+    {
+        if (newView.find(kvp.first) == newView.end())
+        {
+            removedKeys.push_back((ASIC_STATE_TABLE ":") + kvp.first);
+        }
+    }
+
+    commands += pushDelCommands(transaction, removedKeys);
+
+    for (auto& kvp: newView)
+    {
+        auto it = currentView.find(kvp.first);
+
+        const std::map<std::string, std::string>* currentHash = (it == currentView.end()) ? nullptr : &it->second;
+
+        size_t count = pushHashDiff(transaction, (ASIC_STATE_TABLE ":") + kvp.first, currentHash, kvp.second);
+
+        if (count == 0)
+            continue;
+
+        commands += count;
+
+        if (currentHash)
+            modified++;
+        else
+            created++;
+    }
+
+    commands += pushDelCommands(transaction, tempKeys);
+
+    std::map<std::string, std::string> newVid2Rid;
+    std::map<std::string, std::string> newRid2Vid;
+
+    for (auto& kv: vid2rid)
+    {
+        std::string strVid = sai_serialize_object_id(kv.first);
+        std::string strRid = sai_serialize_object_id(kv.second);
+
+        newVid2Rid[strVid] = strRid;
+        newRid2Vid[strRid] = strVid;
+    }
+
+    commands += pushHashDiff(transaction, VIDTORID, &currentVid2Rid, newVid2Rid);
+    commands += pushHashDiff(transaction, RIDTOVID, &currentRid2Vid, newRid2Vid);
+
+    // nothing is sent when there is no difference
+
+    transaction.exec();
+
+    if (commands)
+    {
+        commands += 2; // MULTI and EXEC
+    }
+
+    roundTrips += (commands + ASIC_STATE_PIPELINE_SIZE - 1) / ASIC_STATE_PIPELINE_SIZE;
+
+    SWSS_LOG_NOTICE("asic state updated: %zu objects, created %zu, modified %zu, removed %zu, temp keys %zu, vid/rid %zu, commands %zu, round trips %zu",
+            newView.size(),
+            created,
+            modified,
+            removedKeys.size(),
+            tempKeys.size(),
+            vid2rid.size(),
+            commands,
+            roundTrips);
+}
+
 std::vector<std::string> RedisClient::getAsicStateKeys() const
 {
     SWSS_LOG_ENTER();
@@ -660,6 +994,16 @@ std::vector<std::string> RedisClient::getAsicStateSwitchesKeys() const
     return m_dbAsic->keys(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_SWITCH:*");
 }
 
+std::string RedisClient::scanAsicState(
+        _In_ const std::string& cursor,
+        _In_ uint32_t count,
+        _Out_ std::vector<std::pair<std::string, std::unordered_map<std::string, std::string>>>& entries) const
+{
+    SWSS_LOG_ENTER();
+
+    return sairedis::RedisScanner::scanHashes(m_dbAsic.get(), cursor, ASIC_STATE_TABLE ":*", count, entries);
+}
+
 void RedisClient::removeColdVid(
         _In_ sai_object_id_t vid)
 {
@@ -775,6 +1119,8 @@ void RedisClient::removeAsicStateTable()
     {
         m_dbAsic->del(key);
     }
+
+    invalidateFdbIndex();
 }
 
 void RedisClient::removeTempAsicStateTable()
@@ -862,48 +1208,304 @@ void RedisClient::processFlushEvent(
             sai_serialize_object_id(portVid).c_str(),
             sai_serialize_object_id(bvId).c_str());
 
-    // TODO script must be updated to version 2
+    if (!m_fdbIndexValid)
+    {
+        rebuildFdbIndex();
+
+        // changes pushed to current batch are not in ASIC DB yet, apply them
+        // to index, so batch is not committed in the middle
 
-    std::string pattern = (bvId == SAI_NULL_OBJECT_ID)
-        ? (ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_FDB_ENTRY:*")
-        : (ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_FDB_ENTRY:*" + sai_serialize_object_id(bvId) + "*");
+        for (auto& change: m_batchFdbChanges)
+        {
+            if (change.remove)
+                m_fdbIndex.remove(change.key);
+            else
+                m_fdbIndex.insert(change.key, change.fdbEntry, change.values);
+        }
 
-    std::string portStr = (portVid == SAI_NULL_OBJECT_ID) ? "" : sai_serialize_object_id(portVid);
+        m_batchFdbChanges.clear();
+    }
 
-    SWSS_LOG_NOTICE("pattern %s, portStr %s", pattern.c_str(), portStr.c_str());
+    // index gives exact keys to remove, so we don't need to scan redis key
+    // space which blocks all other redis clients
 
-    std::vector<int> vals; // 0 - flush dynamic, 1 - flush static
+    auto keys = m_fdbIndex.flush(portVid, bvId, type);
 
-    switch (type)
+    for (size_t idx = 0; idx < keys.size(); idx += ASIC_STATE_DEL_BATCH_SIZE)
     {
-        case SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC:
-            vals.push_back(0);
-            break;
+        std::vector<std::string> args { "DEL" };
+
+        size_t end = std::min(keys.size(), idx + ASIC_STATE_DEL_BATCH_SIZE);
+
+        args.insert(args.end(), keys.begin() + idx, keys.begin() + end);
+
+        if (m_batchActive)
+        {
+            pushBatchCommand(args);
+            continue;
+        }
+
+        swss::RedisCommand command;
+
+        command.format(args);
+
+        getPipeline()->push(command, REDIS_REPLY_INTEGER);
+    }
+
+    if (!m_batchActive)
+    {
+        getPipeline()->flush();
+    }
+
+    SWSS_LOG_NOTICE("flushed %zu fdb entries, %zu entries left",
+            keys.size(),
+            m_fdbIndex.size());
+}
+
+std::shared_ptr<swss::RedisPipeline> RedisClient::getPipeline()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_pipeline == nullptr)
+    {
+        m_pipeline = std::make_shared<swss::RedisPipeline>(m_dbAsic.get(), ASIC_STATE_PIPELINE_SIZE);
+    }
+
+    return m_pipeline;
+}
+
+std::shared_ptr<sairedis::RedisTransaction> RedisClient::getTransaction()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_transaction == nullptr)
+    {
+        m_transaction = std::make_shared<sairedis::RedisTransaction>(m_dbAsic.get(), ASIC_STATE_PIPELINE_SIZE);
+    }
+
+    return m_transaction;
+}
+
+void RedisClient::beginAsicStateBatch()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_batchActive)
+    {
+        SWSS_LOG_THROW("asic state batch already started");
+    }
+
+    m_batchActive = true;
+}
+
+void RedisClient::endAsicStateBatch()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_batchActive)
+    {
+        SWSS_LOG_THROW("asic state batch not started");
+    }
 
-        case SAI_FDB_FLUSH_ENTRY_TYPE_STATIC:
-            vals.push_back(1);
+    // reset state first, so batch will not stay active if commit throws
+
+    m_batchActive = false;
+
+    commitAsicStateBatch();
+}
+
+void RedisClient::discardAsicStateBatch()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_batchActive)
+    {
+        SWSS_LOG_THROW("asic state batch not started");
+    }
+
+    m_batchActive = false;
+
+    m_batchFdbChanges.clear();
+
+    // index already contains changes of discarded batch
+
+    invalidateFdbIndex();
+
+    auto transaction = getTransaction();
+
+    if (transaction->size() == 0)
+    {
+        return;
+    }
+
+    SWSS_LOG_WARN("asic state batch discarded, commands: %zu", transaction->size());
+
+    transaction->discard();
+}
+
+void RedisClient::pushBatchCommand(
+        _In_ const std::vector<std::string>& args)
+{
+    SWSS_LOG_ENTER();
+
+    try
+    {
+        getTransaction()->push(args);
+    }
+    catch (const std::exception&)
+    {
+        // transaction was discarded, so changes already in index will never
+        // reach ASIC DB
+
+        invalidateFdbIndex();
+
+        throw;
+    }
+}
+
+void RedisClient::commitAsicStateBatch()
+{
+    SWSS_LOG_ENTER();
+
+    m_batchFdbChanges.clear();
+
+    auto transaction = getTransaction();
+
+    size_t commands = transaction->size();
+
+    if (commands == 0)
+    {
+        return;
+    }
+
+    try
+    {
+        transaction->exec();
+    }
+    catch (const std::exception&)
+    {
+        // some commands may not be applied, so index may not reflect ASIC DB
+
+        invalidateFdbIndex();
+
+        throw;
+    }
+
+    SWSS_LOG_INFO("asic state batch committed, commands: %zu", commands);
+}
+
+void RedisClient::invalidateFdbIndex()
+{
+    SWSS_LOG_ENTER();
+
+    m_fdbIndex.clear();
+
+    m_fdbIndexValid = false;
+}
+
+void RedisClient::updateFdbIndex(
+        _In_ sai_common_api_t api,
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    if (metaKey.objecttype != SAI_OBJECT_TYPE_FDB_ENTRY || !m_fdbIndexValid)
+    {
+        // index which is not valid will be rebuilt on next flush anyway
+        return;
+    }
+
+    std::string key = (ASIC_STATE_TABLE ":") + sai_serialize_object_meta_key(metaKey);
+
+    switch (api)
+    {
+        case SAI_COMMON_API_CREATE:
+        case SAI_COMMON_API_SET:
+
+            // consumer table is setting each field, so attributes not
+            // present in values are preserved, the same as in index
+
+            m_fdbIndex.insert(key, metaKey.objectkey.key.fdb_entry, values);
             break;
 
-        case SAI_FDB_FLUSH_ENTRY_TYPE_ALL:
-            vals.push_back(0);
-            vals.push_back(1);
+        case SAI_COMMON_API_REMOVE:
+
+            m_fdbIndex.remove(key);
             break;
 
         default:
-            SWSS_LOG_THROW("unknown fdb flush entry type: %d", type);
+            break;
     }
+}
 
-    for (int flush_static: vals)
+void RedisClient::updateFdbIndex(
+        _In_ const std::string& key,
+        _In_ const sai_object_meta_key_t& metaKey,
+        _In_ const std::vector<swss::FieldValueTuple>& values)
+{
+    SWSS_LOG_ENTER();
+
+    if (metaKey.objecttype != SAI_OBJECT_TYPE_FDB_ENTRY)
     {
-        swss::RedisCommand command;
+        return;
+    }
 
-        command.format(
-                "EVALSHA %s 3 %s %s %s",
-                m_fdbFlushSha.c_str(),
-                pattern.c_str(),
-                portStr.c_str(),
-                std::to_string(flush_static).c_str());
+    m_fdbIndex.insert(key, metaKey.objectkey.key.fdb_entry, values);
+}
 
-        swss::RedisReply r(m_dbAsic.get(), command);
+void RedisClient::rebuildFdbIndex()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_TIMER("rebuild fdb index");
+
+    m_fdbIndex.clear();
+
+    /*
+     * Keys are scanned in chunks, so redis is not blocked by KEYS on large
+     * FDB. Syncd is the only writer of ASIC state and index is rebuilt under
+     * its lock, so entries don't change during scan. Insert to index replaces
+     * entry, so key returned twice by SCAN is harmless.
+     */
+
+    std::vector<std::pair<std::string, std::unordered_map<std::string, std::string>>> entries;
+
+    std::string cursor = "0";
+
+    do
+    {
+        cursor = sairedis::RedisScanner::scanHashes(m_dbAsic.get(), cursor, ASIC_STATE_FDB_ENTRY_PREFIX "*", ASIC_STATE_SCAN_COUNT, entries);
+
+        for (auto& entry: entries)
+        {
+            if (entry.second.empty())
+            {
+                continue;
+            }
+
+            std::vector<swss::FieldValueTuple> values;
+
+            for (auto field: { "SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID", "SAI_FDB_ENTRY_ATTR_TYPE" })
+            {
+                auto it = entry.second.find(field);
+
+                if (it != entry.second.end())
+                {
+                    values.emplace_back(it->first, it->second);
+                }
+            }
+
+            sai_object_meta_key_t metaKey;
+
+            sai_deserialize_object_meta_key(entry.first.substr(strlen(ASIC_STATE_TABLE ":")), metaKey);
+
+            m_fdbIndex.insert(entry.first, metaKey.objectkey.key.fdb_entry, values);
+        }
     }
+    while (cursor != "0");
+
+    m_fdbIndexValid = true;
+
+    SWSS_LOG_NOTICE("fdb index rebuilt with %zu entries", m_fdbIndex.size());
 }
@@ -4,6 +4,8 @@ extern "C" {
 #include "saimetadata.h"
 }
 
+#include "FdbIndex.h"
+
 #include "swss/table.h"
 
 #include <string>
@@ -12,6 +14,16 @@ extern "C" {
 #include <memory>
 #include <vector>
 
+namespace swss
+{
+    class RedisPipeline;
+}
+
+namespace sairedis
+{
+    class RedisTransaction;
+}
+
 namespace syncd
 {
     class RedisClient
@@ -76,6 +88,18 @@ namespace syncd
                     _In_ sai_object_id_t switchVid,
                     _In_ sai_object_id_t portRid) const;
 
+            /**
+             * @brief Remove lanes of multiple ports from lane map.
+             *
+             * Lane map is read once and lanes of all ports are removed by
+             * single command.
+             *
+             * @return Number of removed lanes for each port.
+             */
+            std::map<sai_object_id_t, int> removePortsFromLanesMap(
+                    _In_ sai_object_id_t switchVid,
+                    _In_ const std::vector<sai_object_id_t>& portRids) const;
+
             void removeAsicObject(
                     _In_ sai_object_id_t objectVid) const;
 
@@ -108,10 +132,41 @@ namespace syncd
             void setVidAndRidMap(
                     _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t>& map);
 
+            /**
+             * @brief Replace ASIC_STATE content with new view.
+             *
+             * Only differences between current and new view are written, all
+             * commands are pipelined and executed inside single MULTI/EXEC
+             * transaction, so readers will never see empty or partial
+             * ASIC_STATE table. Temporary ASIC_STATE table and VID/RID maps
+             * are updated in the same transaction.
+             *
+             * Dump keys are without ASIC_STATE table prefix.
+             */
+            void updateAsicState(
+                    _In_ const swss::TableDump& currentView,
+                    _In_ const swss::TableDump& newView,
+                    _In_ const std::unordered_map<sai_object_id_t, sai_object_id_t>& vid2rid);
+
             std::vector<std::string> getAsicStateKeys() const;
 
             std::vector<std::string> getAsicStateSwitchesKeys() const;
 
+            /**
+             * @brief Scan next batch of ASIC state keys with attributes.
+             *
+             * Scan starts and ends with cursor "0", count is only a hint for
+             * redis how many keys to return. Attributes of all returned keys
+             * are fetched in single pipelined round trip, keys removed between
+             * SCAN and HGETALL are returned with empty attributes.
+             *
+             * @return Cursor to be passed to next call.
+             */
+            std::string scanAsicState(
+                    _In_ const std::string& cursor,
+                    _In_ uint32_t count,
+                    _Out_ std::vector<std::pair<std::string, std::unordered_map<std::string, std::string>>>& entries) const;
+
             void removeColdVid(
                     _In_ sai_object_id_t vid);
 
@@ -158,8 +213,67 @@ namespace syncd
                     _In_ sai_object_id_t bvId,
                     _In_ sai_fdb_flush_entry_type_t type);
 
+            /**
+             * @brief Invalidate FDB index.
+             *
+             * Should be called when FDB entries in ASIC DB were modified
+             * outside of this client. Index will be rebuilt from ASIC DB on
+             * next FDB flush.
+             */
+            void invalidateFdbIndex();
+
+            /**
+             * @brief Update FDB index after FDB entry in ASIC DB was modified
+             * by consumer table.
+             *
+             * On asynchronous mode consumer table is applying changes to ASIC
+             * DB directly, regardless of API status, so index is updated from
+             * the same request data instead of being rebuilt from ASIC DB.
+             */
+            void updateFdbIndex(
+                    _In_ sai_common_api_t api,
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
+            /**
+             * @brief Begin ASIC DB batch.
+             *
+             * Changes done by createAsicObject, removeAsicObject (by meta key)
+             * and processFlushEvent are queued in MULTI/EXEC transaction on
+             * separate connection and executed on endAsicStateBatch.
+             */
+            void beginAsicStateBatch();
+
+            void endAsicStateBatch();
+
+            /**
+             * @brief Discard ASIC DB batch.
+             *
+             * Should be called instead of endAsicStateBatch when producing
+             * batch failed, so partial changes will not be written to ASIC
+             * DB. FDB index is invalidated, since it already contains changes
+             * of discarded batch.
+             */
+            void discardAsicStateBatch();
+
         private:
 
+            std::shared_ptr<swss::RedisPipeline> getPipeline();
+
+            std::shared_ptr<sairedis::RedisTransaction> getTransaction();
+
+            void pushBatchCommand(
+                    _In_ const std::vector<std::string>& args);
+
+            void commitAsicStateBatch();
+
+            void rebuildFdbIndex();
+
+            void updateFdbIndex(
+                    _In_ const std::string& key,
+                    _In_ const sai_object_meta_key_t& metaKey,
+                    _In_ const std::vector<swss::FieldValueTuple>& values);
+
             std::map<sai_object_id_t, swss::TableDump> getAsicView(
                     _In_ const std::string &tableName);
 
@@ -179,7 +293,50 @@ namespace syncd
 
             std::shared_ptr<swss::DBConnector> m_dbAsic;
 
-            std::string m_fdbFlushSha;
+            /**
+             * @brief FDB entries present in ASIC DB.
+             *
+             * Maintained on every FDB entry change done by this client.
+             */
+            FdbIndex m_fdbIndex;
+
+            bool m_fdbIndexValid;
+
+            /**
+             * @brief Pipeline used for FDB flush outside of batch.
+             *
+             * Created on first use, since pipeline has its own connection.
+             */
+            std::shared_ptr<swss::RedisPipeline> m_pipeline;
+
+            /**
+             * @brief Transaction used for ASIC DB batches.
+             *
+             * Created on first use, since transaction has its own connection.
+             */
+            std::shared_ptr<sairedis::RedisTransaction> m_transaction;
+
+            bool m_batchActive;
+
+            typedef struct _PendingFdbChange
+            {
+                std::string key;
+
+                bool remove;
+
+                sai_fdb_entry_t fdbEntry;
+
+                std::vector<swss::FieldValueTuple> values;
+
+            } PendingFdbChange;
 
+            /**
+             * @brief FDB changes pushed to current batch while index is not
+             * valid.
+             *
+             * Index rebuilt from ASIC DB during batch doesn't contain those
+             * changes, so they are applied to index after rebuild.
+             */
+            std::vector<PendingFdbChange> m_batchFdbChanges;
     };
 }
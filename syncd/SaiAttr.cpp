@@ -3,28 +3,89 @@
 #include "swss/logger.h"
 #include "meta/sai_serialize.h"
 
+#include <unordered_map>
+
 using namespace syncd;
 
+typedef std::unordered_map<const sai_attr_metadata_t*, std::string> AttrIdNames;
+
+static AttrIdNames buildAttrIdNames()
+{
+    SWSS_LOG_ENTER();
+
+    AttrIdNames names;
+
+    for (size_t idx = 0; idx < sai_metadata_attr_sorted_by_id_name_count; ++idx)
+    {
+        auto meta = sai_metadata_attr_sorted_by_id_name[idx];
+
+        names[meta] = meta->attridname;
+    }
+
+    return names;
+}
+
+/**
+ * @brief Attribute id names shared by all attributes.
+ *
+ * Created once and never modified, so it can be accessed concurrently.
+ */
+static const AttrIdNames& getAttrIdNames()
+{
+    SWSS_LOG_ENTER();
+
+    static const AttrIdNames names = buildAttrIdNames();
+
+    return names;
+}
+
+size_t SaiAttrValueHash::operator()(
+        _In_ const std::shared_ptr<const std::string>& value) const
+{
+    SWSS_LOG_ENTER();
+
+    return std::hash<std::string>()(*value);
+}
+
+bool SaiAttrValueEqual::operator()(
+        _In_ const std::shared_ptr<const std::string>& a,
+        _In_ const std::shared_ptr<const std::string>& b) const
+{
+    SWSS_LOG_ENTER();
+
+    return *a == *b;
+}
+
 SaiAttr::SaiAttr(
         _In_ const std::string &str_attr_id,
         _In_ const std::string &str_attr_value):
-    m_str_attr_id(str_attr_id),
-    m_str_attr_value(str_attr_value),
-    m_meta(NULL)
+    SaiAttr(str_attr_id, str_attr_value, nullptr)
 {
     SWSS_LOG_ENTER();
 
-    /*
-     * We perform deserialize here to have attribute value when we need
-     * it, this can include allocated lists, so on destructor we need
-     * to free this memory.
-     */
+    // empty
+}
 
-    sai_deserialize_attr_id(str_attr_id, &m_meta);
+SaiAttr::SaiAttr(
+        _In_ const std::string &str_attr_id,
+        _In_ const std::string &str_attr_value,
+        _Inout_ SaiAttrValuePool& valuePool):
+    SaiAttr(str_attr_id, str_attr_value, &valuePool)
+{
+    SWSS_LOG_ENTER();
 
-    m_attr.id = m_meta->attrid;
+    // empty
+}
+
+SaiAttr::SaiAttr(
+        _In_ const std::string &str_attr_id,
+        _In_ const std::string &str_attr_value,
+        _Inout_ SaiAttrValuePool* valuePool):
+    m_meta(NULL)
+{
+    SWSS_LOG_ENTER();
 
-    sai_deserialize_attr_value(str_attr_value, *m_meta, m_attr, false);
+    sai_deserialize_attr_id(str_attr_id, &m_meta);
 
     if (m_meta->isenum && m_meta->enummetadata->ignorevalues)
     {
@@ -33,53 +94,117 @@ SaiAttr::SaiAttr(
         // to update it to current one to not cause attribute compare confusion
         // since they are compared by string value
 
-        auto val = sai_serialize_enum(m_attr.value.s32, m_meta->enummetadata);
+        int32_t value;
 
-        if (val != m_str_attr_value)
+        sai_deserialize_enum(str_attr_value, m_meta->enummetadata, value);
+
+        auto val = sai_serialize_enum(value, m_meta->enummetadata);
+
+        if (val != str_attr_value)
         {
             SWSS_LOG_NOTICE("translating deprecated/ignore enum %s to %s",
-                    m_str_attr_value.c_str(),
+                    str_attr_value.c_str(),
                     val.c_str());
 
-            m_str_attr_value = val;
+            setStrAttrValue(val);
+
+            return;
         }
     }
+
+    if (valuePool == nullptr)
+    {
+        setStrAttrValue(str_attr_value);
+
+        return;
+    }
+
+    // non owning pointer, so lookup doesn't copy value string
+
+    std::shared_ptr<const std::string> key(std::shared_ptr<const std::string>(), &str_attr_value);
+
+    auto it = valuePool->find(key);
+
+    if (it == valuePool->end())
+    {
+        it = valuePool->insert(std::make_shared<const std::string>(str_attr_value)).first;
+    }
+
+    m_str_attr_value = *it;
 }
 
 SaiAttr::~SaiAttr()
 {
     SWSS_LOG_ENTER();
 
-    sai_deserialize_free_attribute_value(m_meta->attrvaluetype, m_attr);
+    if (m_attr)
+    {
+        sai_deserialize_free_attribute_value(m_meta->attrvaluetype, *m_attr);
+    }
+}
+
+void SaiAttr::setStrAttrValue(
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    m_str_attr_value = std::make_shared<const std::string>(value);
+}
+
+const sai_attribute_t& SaiAttr::getDeserializedAttr() const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_attr == nullptr)
+    {
+        /*
+         * Deserialize can include allocated lists, so on destructor we need
+         * to free this memory.
+         */
+
+        std::unique_ptr<sai_attribute_t> attr(new sai_attribute_t());
+
+        attr->id = m_meta->attrid;
+
+        sai_deserialize_attr_value(*m_str_attr_value, *m_meta, *attr, false);
+
+        m_attr = std::move(attr);
+    }
+
+    return *m_attr;
 }
 
 sai_attribute_t* SaiAttr::getRWSaiAttr()
 {
     SWSS_LOG_ENTER();
 
-    return &m_attr;
+    getDeserializedAttr();
+
+    return m_attr.get();
 }
 
 const sai_attribute_t* SaiAttr::getSaiAttr() const
 {
     SWSS_LOG_ENTER();
 
-    return &m_attr;
+    return &getDeserializedAttr();
 }
 
 sai_object_id_t SaiAttr::getOid() const
 {
     SWSS_LOG_ENTER();
 
+    const sai_attribute_t &attr = getDeserializedAttr();
+
     if (m_meta->attrvaluetype == SAI_ATTR_VALUE_TYPE_OBJECT_ID)
     {
-        return m_attr.value.oid;
+        return attr.value.oid;
     }
 
     if (m_meta->attrvaluetype == SAI_ATTR_VALUE_TYPE_ACL_ACTION_DATA_OBJECT_ID &&
-            m_attr.value.aclaction.enable)
+            attr.value.aclaction.enable)
     {
-        return m_attr.value.aclaction.parameter.oid;
+        return attr.value.aclaction.parameter.oid;
     }
 
     SWSS_LOG_THROW("attribute %s is not OID attribute", m_meta->attridname);
@@ -96,14 +221,14 @@ const std::string& SaiAttr::getStrAttrId() const
 {
     SWSS_LOG_ENTER();
 
-    return m_str_attr_id;
+    return getAttrIdNames().at(m_meta);
 }
 
 const std::string& SaiAttr::getStrAttrValue() const
 {
     SWSS_LOG_ENTER();
 
-    return m_str_attr_value;
+    return *m_str_attr_value;
 }
 
 const sai_attr_metadata_t* SaiAttr::getAttrMetadata() const
@@ -117,14 +242,14 @@ void SaiAttr::updateValue()
 {
     SWSS_LOG_ENTER();
 
-    m_str_attr_value = sai_serialize_attr_value(*m_meta, m_attr);
+    setStrAttrValue(sai_serialize_attr_value(*m_meta, getDeserializedAttr()));
 }
 
 std::vector<sai_object_id_t> SaiAttr::getOidListFromAttribute() const
 {
     SWSS_LOG_ENTER();
 
-    const sai_attribute_t &attr = m_attr;
+    const sai_attribute_t &attr = getDeserializedAttr();
 
     uint32_t count = 0;
 
@@ -6,14 +6,50 @@ extern "C" {
 
 #include <string>
 #include <vector>
+#include <memory>
+#include <unordered_set>
 
 namespace syncd
 {
+    /**
+     * @brief Hash of shared value, by value string.
+     */
+    struct SaiAttrValueHash
+    {
+        size_t operator()(
+                _In_ const std::shared_ptr<const std::string>& value) const;
+    };
+
+    /**
+     * @brief Equality of shared values, by value string.
+     */
+    struct SaiAttrValueEqual
+    {
+        bool operator()(
+                _In_ const std::shared_ptr<const std::string>& a,
+                _In_ const std::shared_ptr<const std::string>& b) const;
+    };
+
+    /**
+     * @brief Attribute value pool.
+     *
+     * Set of shared values compared by value string, so attributes created
+     * with the same pool and having equal values keep single copy of value
+     * string, and pool itself doesn't keep another copy. Pool is not thread
+     * safe, it's intended to be used by single view during its construction.
+     */
+    typedef std::unordered_set<std::shared_ptr<const std::string>, SaiAttrValueHash, SaiAttrValueEqual> SaiAttrValuePool;
+
     /**
      * @brief Class represents single attribute
      *
      * Some attributes are lists, and have allocated memory, this class will help to
      * handle memory management and also will keep metadata for attribute.
+     *
+     * To reduce memory usage of large views, attribute id string is shared by
+     * all attributes with the same id, value string is shared by all
+     * attributes with the same value created with the same value pool, and
+     * value is deserialized only when it's actually needed.
      */
     class SaiAttr
     {
@@ -43,8 +79,27 @@ namespace syncd
                     _In_ const std::string &str_attr_id,
                     _In_ const std::string &str_attr_value);
 
+            /**
+             * @brief Constructor
+             *
+             * @param[in] str_attr_id Attribute is as string
+             * @param[in] str_attr_value Attribute value as string
+             * @param[in] valuePool Pool from which value string is shared
+             */
+            SaiAttr(
+                    _In_ const std::string &str_attr_id,
+                    _In_ const std::string &str_attr_value,
+                    _Inout_ SaiAttrValuePool& valuePool);
+
             virtual ~SaiAttr();
 
+        private:
+
+            SaiAttr(
+                    _In_ const std::string &str_attr_id,
+                    _In_ const std::string &str_attr_value,
+                    _Inout_ SaiAttrValuePool* valuePool);
+
         public:
 
             sai_attribute_t* getRWSaiAttr();
@@ -67,7 +122,7 @@ namespace syncd
              */
             bool isObjectIdAttr() const;
 
-                const std::string& getStrAttrId() const;
+            const std::string& getStrAttrId() const;
 
             const std::string& getStrAttrValue() const;
 
@@ -89,12 +144,22 @@ namespace syncd
 
         private:
 
-            const std::string m_str_attr_id;
+            const sai_attribute_t& getDeserializedAttr() const;
+
+            void setStrAttrValue(
+                    _In_ const std::string& value);
+
+        private:
 
-            std::string m_str_attr_value;
+            std::shared_ptr<const std::string> m_str_attr_value;
 
             const sai_attr_metadata_t* m_meta;
 
-            sai_attribute_t m_attr;
+            /**
+             * @brief Deserialized attribute.
+             *
+             * Created on first access to attribute value.
+             */
+            mutable std::unique_ptr<sai_attribute_t> m_attr;
     };
 }
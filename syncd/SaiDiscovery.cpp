@@ -252,6 +252,14 @@ std::set<sai_object_id_t> SaiDiscovery::discover(
 {
     SWSS_LOG_ENTER();
 
+    return discover(std::vector<sai_object_id_t>{ startRid });
+}
+
+std::set<sai_object_id_t> SaiDiscovery::discover(
+        _In_ const std::vector<sai_object_id_t>& startRids)
+{
+    SWSS_LOG_ENTER();
+
     /*
      * Preform discovery on the switch to obtain ASIC view of
      * objects that are created internally.
@@ -266,7 +274,10 @@ std::set<sai_object_id_t> SaiDiscovery::discover(
 
         setApiLogLevel(SAI_LOG_LEVEL_CRITICAL);
 
-        discover(startRid, discovered_rids);
+        for (sai_object_id_t startRid: startRids)
+        {
+            discover(startRid, discovered_rids);
+        }
 
         setApiLogLevel(SAI_LOG_LEVEL_NOTICE);
     }
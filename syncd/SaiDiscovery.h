@@ -5,6 +5,7 @@
 #include <memory>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 namespace syncd
 {
@@ -26,6 +27,16 @@ namespace syncd
             std::set<sai_object_id_t> discover(
                     _In_ sai_object_id_t rid);
 
+            /**
+             * @brief Discover objects starting from multiple objects.
+             *
+             * All objects are discovered in single pass, so objects shared
+             * between them are queried only once. Default OID map contains
+             * attributes of all discovered objects.
+             */
+            std::set<sai_object_id_t> discover(
+                    _In_ const std::vector<sai_object_id_t>& rids);
+
             const DefaultOidMap& getDefaultOidMap() const;
 
         private:
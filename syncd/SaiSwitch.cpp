@@ -824,19 +824,33 @@ void SaiSwitch::helperSaveDiscoveredObjectsToRedis()
 
     SWSS_LOG_NOTICE("putting ALL discovered objects to redis");
 
-    for (sai_object_id_t rid: m_discovered_rids)
+    /*
+     * All objects are put to redis in single transaction.
+     *
+     * NOTE: We are also storing read only object's here, like default
+     * virtual router, CPU, default trap group, etc.
+     */
+
+    m_client->beginAsicStateBatch();
+
+    try
     {
-        /*
-         * We also could thing of optimizing this since it's one call to redis
-         * per rid, and probably this should be ATOMIC.
-         *
-         * NOTE: We are also storing read only object's here, like default
-         * virtual router, CPU, default trap group, etc.
-         */
+        for (sai_object_id_t rid: m_discovered_rids)
+        {
+            redisSetDummyAsicStateForRealObjectId(rid);
+        }
+    }
+    catch (const std::exception&)
+    {
+        // don't write partial changes to ASIC DB
+
+        m_client->discardAsicStateBatch();
 
-        redisSetDummyAsicStateForRealObjectId(rid);
+        throw;
     }
 
+    m_client->endAsicStateBatch();
+
     /*
      * If we are here, this is probably COLD boot, since any previous boot
      * would put lots of objects into redis DB (ports, queues, scheduler_groups
@@ -932,29 +946,26 @@ std::vector<uint32_t> SaiSwitch::saiGetPortLanes(
     return lanes;
 }
 
-void SaiSwitch::redisUpdatePortLaneMap(
-        _In_ sai_object_id_t port_rid)
+void SaiSwitch::onPostPortCreate(
+        _In_ sai_object_id_t port_rid,
+        _In_ sai_object_id_t port_vid)
 {
     SWSS_LOG_ENTER();
 
-    auto lanes = saiGetPortLanes(port_rid);
-
-    m_client->setPortLanes(m_switch_vid, port_rid, lanes);
+    SWSS_LOG_NOTICE("post port create actions for port VID: %s",
+            sai_serialize_object_id(port_vid).c_str());
 
-    SWSS_LOG_NOTICE("added %zu lanes to redis lane map for port RID %s",
-            lanes.size(),
-            sai_serialize_object_id(port_rid).c_str());
+    onPostPortsCreate({ port_rid });
 }
 
-void SaiSwitch::onPostPortCreate(
-        _In_ sai_object_id_t port_rid,
-        _In_ sai_object_id_t port_vid)
+void SaiSwitch::onPostPortsCreate(
+        _In_ const std::vector<sai_object_id_t>& portRids)
 {
     SWSS_LOG_ENTER();
 
     SaiDiscovery sd(m_vendorSai);
 
-    auto discovered = sd.discover(port_rid);
+    auto discovered = sd.discover(portRids);
 
     auto defaultOidMap = sd.getDefaultOidMap();
 
@@ -968,29 +979,63 @@ void SaiSwitch::onPostPortCreate(
         }
     }
 
-    SWSS_LOG_NOTICE("discovered %zu new objects (including port) after creating port VID: %s",
+    SWSS_LOG_NOTICE("discovered %zu new objects (including ports) after creating %zu ports",
             discovered.size(),
-            sai_serialize_object_id(port_vid).c_str());
+            portRids.size());
 
     m_discovered_rids.insert(discovered.begin(), discovered.end());
 
-    SWSS_LOG_NOTICE("putting ALL new discovered objects to redis for port %s",
-            sai_serialize_object_id(port_vid).c_str());
+    // lanes are obtained before ASIC DB is modified, since this can fail
+
+    std::vector<std::vector<uint32_t>> lanes;
 
-    for (sai_object_id_t rid: discovered)
+    for (auto portRid: portRids)
     {
-        /*
-         * We also could thing of optimizing this since it's one call to redis
-         * per rid, and probably this should be ATOMIC.
-         *
-         * NOTE: We are also storing read only object's here, like default
-         * virtual router, CPU, default trap group, etc.
-         */
+        lanes.push_back(saiGetPortLanes(portRid));
+    }
+
+    SWSS_LOG_NOTICE("putting ALL new discovered objects to redis for %zu ports",
+            portRids.size());
+
+    /*
+     * All new objects and lanes of all ports are put to redis in single
+     * transaction.
+     *
+     * NOTE: We are also storing read only object's here, like default
+     * virtual router, CPU, default trap group, etc.
+     */
+
+    m_client->beginAsicStateBatch();
+
+    try
+    {
+        for (sai_object_id_t rid: discovered)
+        {
+            redisSetDummyAsicStateForRealObjectId(rid);
+        }
+
+        for (size_t idx = 0; idx < portRids.size(); idx++)
+        {
+            m_client->setPortLanes(m_switch_vid, portRids[idx], lanes[idx]);
+        }
+    }
+    catch (const std::exception&)
+    {
+        // don't write partial changes to ASIC DB
+
+        m_client->discardAsicStateBatch();
 
-        redisSetDummyAsicStateForRealObjectId(rid);
+        throw;
     }
 
-    redisUpdatePortLaneMap(port_rid);
+    m_client->endAsicStateBatch();
+
+    for (size_t idx = 0; idx < portRids.size(); idx++)
+    {
+        SWSS_LOG_NOTICE("added %zu lanes to redis lane map for port RID %s",
+                lanes[idx].size(),
+                sai_serialize_object_id(portRids[idx]).c_str());
+    }
 }
 
 bool SaiSwitch::isWarmBoot() const
@@ -1007,43 +1052,47 @@ void SaiSwitch::collectPortRelatedObjects(
 
     std::set<sai_object_id_t> related;
 
-    sai_attr_id_t attrs[] = {
+    sai_attr_id_t ids[] = {
         SAI_PORT_ATTR_QOS_QUEUE_LIST,
         SAI_PORT_ATTR_QOS_SCHEDULER_GROUP_LIST,
         SAI_PORT_ATTR_INGRESS_PRIORITY_GROUP_LIST
     };
 
-    for (size_t i = 0; i < sizeof(attrs)/sizeof(sai_attr_id_t); i++)
-    {
-        std::vector<sai_object_id_t> objlist;
+    const size_t count = sizeof(ids)/sizeof(sai_attr_id_t);
 
-        objlist.resize(MAX_OBJLIST_LEN);
+    std::vector<std::vector<sai_object_id_t>> objlists(count);
 
-        sai_attribute_t attr;
+    sai_attribute_t attrs[count];
 
-        attr.id = attrs[i];
+    for (size_t i = 0; i < count; i++)
+    {
+        objlists[i].resize(MAX_OBJLIST_LEN);
 
-        attr.value.objlist.count = MAX_OBJLIST_LEN;
-        attr.value.objlist.list = objlist.data();
+        attrs[i].id = ids[i];
 
-        // since we have those objects already discovered we don't need to
-        // query SAI to get related objects, but lets do that since user could
-        // add/remove some of related objects (this should also be tracked in
-        // SaiSwitch class internally
+        attrs[i].value.objlist.count = MAX_OBJLIST_LEN;
+        attrs[i].value.objlist.list = objlists[i].data();
+    }
 
-        auto status = m_vendorSai->get(SAI_OBJECT_TYPE_PORT, portRid, 1, &attr);
+    // since we have those objects already discovered we don't need to
+    // query SAI to get related objects, but lets do that since user could
+    // add/remove some of related objects (this should also be tracked in
+    // SaiSwitch class internally), all lists are obtained by single call
 
-        if (status != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_THROW("failed to obtain related obejcts for port rid %s: %s, attr id: %d",
-                    sai_serialize_object_id(portRid).c_str(),
-                    sai_serialize_status(status).c_str(),
-                    attr.id);
-        }
+    auto status = m_vendorSai->get(SAI_OBJECT_TYPE_PORT, portRid, (uint32_t)count, attrs);
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_THROW("failed to obtain related obejcts for port rid %s: %s",
+                sai_serialize_object_id(portRid).c_str(),
+                sai_serialize_status(status).c_str());
+    }
 
-        objlist.resize(attr.value.objlist.count);
+    for (size_t i = 0; i < count; i++)
+    {
+        objlists[i].resize(attrs[i].value.objlist.count);
 
-        related.insert(objlist.begin(), objlist.end());
+        related.insert(objlists[i].begin(), objlists[i].end());
     }
 
     // treat port serdes as related object
@@ -1052,7 +1101,7 @@ void SaiSwitch::collectPortRelatedObjects(
 
     attr.id = SAI_PORT_ATTR_PORT_SERDES_ID;
 
-    auto status = m_vendorSai->get(SAI_OBJECT_TYPE_PORT, portRid, 1, &attr);
+    status = m_vendorSai->get(SAI_OBJECT_TYPE_PORT, portRid, 1, &attr);
 
     if (status == SAI_STATUS_SUCCESS && attr.value.oid != SAI_NULL_OBJECT_ID)
     {
@@ -1073,14 +1122,25 @@ void SaiSwitch::postPortRemove(
 {
     SWSS_LOG_ENTER();
 
-    if (m_portRelatedObjects.find(portRid) == m_portRelatedObjects.end())
+    postPortsRemove({ portRid });
+}
+
+void SaiSwitch::postPortsRemove(
+        _In_ const std::vector<sai_object_id_t>& portRids)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto portRid: portRids)
     {
-        SWSS_LOG_THROW("no port related objects populated for port RID %s",
-                sai_serialize_object_id(portRid).c_str());
+        if (m_portRelatedObjects.find(portRid) == m_portRelatedObjects.end())
+        {
+            SWSS_LOG_THROW("no port related objects populated for port RID %s",
+                    sai_serialize_object_id(portRid).c_str());
+        }
     }
 
     /*
-     * Port was successfully removed from vendor SAI,
+     * Ports were successfully removed from vendor SAI,
      * we need to remove queues, ipgs and sg from:
      *
      * - redis ASIC DB
@@ -1091,47 +1151,60 @@ void SaiSwitch::postPortRemove(
      * - also remove LANES mapping
      */
 
-    for (auto rid: m_portRelatedObjects.at(portRid))
-    {
-        // remove from existing objects
+    std::vector<std::string> keys;
 
-        if (isDiscoveredRid(rid))
+    for (auto portRid: portRids)
+    {
+        for (auto rid: m_portRelatedObjects.at(portRid))
         {
-            removeExistingObjectReference(rid);
-        }
+            // remove from existing objects
 
-        // remove from RID2VID and VID2RID map in redis
+            if (isDiscoveredRid(rid))
+            {
+                removeExistingObjectReference(rid);
+            }
 
-        auto vid = m_client->getVidForRid(rid);
+            // remove from RID2VID and VID2RID map in redis
 
-        if (vid == SAI_NULL_OBJECT_ID)
-        {
-            SWSS_LOG_THROW("expected rid %s to be present in RIDTOVID",
-                    sai_serialize_object_id(rid).c_str());
-        }
+            auto vid = m_client->getVidForRid(rid);
 
-        // TODO should this remove rid,vid and object be as db op?
+            if (vid == SAI_NULL_OBJECT_ID)
+            {
+                SWSS_LOG_THROW("expected rid %s to be present in RIDTOVID",
+                        sai_serialize_object_id(rid).c_str());
+            }
 
-        m_translator->eraseRidAndVid(rid, vid);
+            // TODO should this remove rid,vid and object be as db op?
 
-        // remove from ASIC DB
+            m_translator->eraseRidAndVid(rid, vid);
 
-        m_client->removeAsicObject(vid);
+            keys.push_back(sai_serialize_object_type(VidManager::objectTypeQuery(vid)) + ":" + sai_serialize_object_id(vid));
+        }
     }
 
-    int removed = m_client->removePortFromLanesMap(m_switch_vid, portRid);
+    // remove from ASIC DB, all objects by single command
 
-    SWSS_LOG_NOTICE("removed %u lanes from redis lane map for port RID %s",
-            removed,
-            sai_serialize_object_id(portRid).c_str());
+    if (keys.size())
+    {
+        m_client->removeAsicObjects(keys);
+    }
+
+    auto removed = m_client->removePortsFromLanesMap(m_switch_vid, portRids);
 
-    if (removed == 0)
+    for (auto portRid: portRids)
     {
-        SWSS_LOG_THROW("NO LANES found in redis lane map for given port RID %s",
+        SWSS_LOG_NOTICE("removed %u lanes from redis lane map for port RID %s",
+                removed.at(portRid),
                 sai_serialize_object_id(portRid).c_str());
+
+        if (removed.at(portRid) == 0)
+        {
+            SWSS_LOG_THROW("NO LANES found in redis lane map for given port RID %s",
+                    sai_serialize_object_id(portRid).c_str());
+        }
     }
 
-    SWSS_LOG_NOTICE("post port remove actions succeeded");
+    SWSS_LOG_NOTICE("post port remove actions succeeded for %zu ports", portRids.size());
 }
 
 void SaiSwitch::checkWarmBootDiscoveredRids()
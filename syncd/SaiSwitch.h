@@ -190,6 +190,17 @@ namespace syncd
                     _In_ sai_object_id_t port_rid,
                     _In_ sai_object_id_t port_vid) override;
 
+            /**
+             * @brief On post ports create.
+             *
+             * Same as onPostPortCreate for multiple ports, for example after
+             * port breakout. New objects of all ports are discovered in
+             * single pass and ASIC DB objects and lane map are updated in
+             * single transaction.
+             */
+            virtual void onPostPortsCreate(
+                    _In_ const std::vector<sai_object_id_t>& portRids) override;
+
             /**
              * @brief Post port remove.
              *
@@ -199,6 +210,16 @@ namespace syncd
             virtual void postPortRemove(
                     _In_ sai_object_id_t portRid) override;
 
+            /**
+             * @brief Post ports remove.
+             *
+             * Same as postPortRemove for multiple ports. Related objects of
+             * all ports are removed from ASIC DB and lanes from lane map by
+             * single command.
+             */
+            virtual void postPortsRemove(
+                    _In_ const std::vector<sai_object_id_t>& portRids) override;
+
             virtual void collectPortRelatedObjects(
                     _In_ sai_object_id_t portRid) override;
 
@@ -253,14 +274,6 @@ namespace syncd
              */
             void redisSaveColdBootDiscoveredVids() const;
 
-            /**
-             * @brief Update lane map for specific port.
-             *
-             * @param port_rid Port RID for which lane map should be updated
-             */
-            void redisUpdatePortLaneMap(
-                    _In_ sai_object_id_t port_rid);
-
             /*
              * Helper Methods.
              */
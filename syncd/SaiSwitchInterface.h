@@ -8,6 +8,7 @@ extern "C" {
 #include <set>
 #include <unordered_map>
 #include <map>
+#include <vector>
 
 namespace syncd
 {
@@ -91,9 +92,15 @@ namespace syncd
                     _In_ sai_object_id_t port_rid,
                     _In_ sai_object_id_t port_vid) = 0;
 
+            virtual void onPostPortsCreate(
+                    _In_ const std::vector<sai_object_id_t>& portRids) = 0;
+
             virtual void postPortRemove(
                     _In_ sai_object_id_t portRid) = 0;
 
+            virtual void postPortsRemove(
+                    _In_ const std::vector<sai_object_id_t>& portRids) = 0;
+
             virtual void collectPortRelatedObjects(
                     _In_ sai_object_id_t portRid) = 0;
 
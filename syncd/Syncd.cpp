@@ -24,6 +24,7 @@
 #include "meta/ZeroMQSelectableChannel.h"
 #include "meta/RedisSelectableChannel.h"
 #include "meta/PerformanceIntervalTimer.h"
+#include "meta/LatencyHistogram.h"
 
 #include "vslib/saivs.h"
 
@@ -32,9 +33,14 @@
 
 #include <iterator>
 #include <algorithm>
+#include <future>
+#include <chrono>
+#include <limits>
 
 #define DEF_SAI_WARM_BOOT_DATA_FILE "/var/warmboot/sai-warmboot.bin"
 
+#define BULK_PREPARE_MIN_CHUNK_SIZE (64)
+
 using namespace syncd;
 using namespace saimeta;
 using namespace sairediscommon;
@@ -51,7 +57,8 @@ Syncd::Syncd(
     m_vendorSai(vendorSai),
     m_veryFirstRun(false),
     m_enableSyncMode(false),
-    m_timerWatchdog(30 * 1000000) // watch for executions over 30 seconds
+    m_timerWatchdog(30 * 1000000), // watch for executions over 30 seconds
+    m_bulkPrepareDuration(std::chrono::nanoseconds::zero())
 {
     SWSS_LOG_ENTER();
 
@@ -103,6 +110,8 @@ Syncd::Syncd(
 
     m_profileIter = m_profileMap.begin();
 
+    setVendorLockPolicy();
+
     // we need STATE_DB ASIC_DB and COUNTERS_DB
 
     m_dbAsic = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbAsic, 0);
@@ -151,6 +160,15 @@ Syncd::Syncd(
 
     m_restartQuery = std::make_shared<swss::NotificationConsumer>(m_dbAsic.get(), SYNCD_NOTIFICATION_CHANNEL_RESTARTQUERY);
 
+    m_latencyQuery = std::make_shared<swss::NotificationConsumer>(m_dbAsic.get(), SYNCD_NOTIFICATION_CHANNEL_LATENCYQUERY);
+
+    LatencyHistogramRegistry::setEnabled(!m_commandLineOptions->m_disableLatencyHistograms);
+
+    if (m_commandLineOptions->m_bulkPrepareThreads)
+    {
+        m_bulkPrepareWorkerPool = std::make_shared<saimeta::WorkerPool>(m_commandLineOptions->m_bulkPrepareThreads);
+    }
+
     // TODO to be moved to ASIC_DB
     m_dbFlexCounter = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbFlex, 0);
     m_flexCounter = std::make_shared<swss::ConsumerTable>(m_dbFlexCounter.get(), FLEX_COUNTER_TABLE);
@@ -170,6 +188,28 @@ Syncd::Syncd(
 
     m_processor->m_translator = m_translator; // TODO as param
 
+    m_asicAuditor = std::make_shared<AsicAuditor>(
+            m_client,
+            m_translator,
+            m_vendorSai,
+            std::make_shared<swss::DBConnector>(m_contextConfig->m_dbState, 0));
+
+    m_asicAuditor->setBudget(std::numeric_limits<size_t>::max(), std::chrono::microseconds(m_commandLineOptions->m_asicAuditBudget));
+
+    if (m_commandLineOptions->m_asicAuditInterval)
+    {
+        uint32_t interval = m_commandLineOptions->m_asicAuditInterval;
+
+        timespec ts;
+
+        ts.tv_sec = interval / 1000;
+        ts.tv_nsec = (interval % 1000) * 1000000;
+
+        m_asicAuditTimer = std::make_shared<swss::SelectableTimer>(ts);
+
+        SWSS_LOG_NOTICE("background asic audit enabled, interval %u ms", interval);
+    }
+
     m_veryFirstRun = isVeryFirstRun();
 
     performStartupLogic();
@@ -353,6 +393,12 @@ sai_status_t Syncd::processSingleEvent(
     if (op == REDIS_ASIC_STATE_COMMAND_CLEAR_STATS)
         return processClearStatsEvent(kco);
 
+    if (op == REDIS_ASIC_STATE_COMMAND_BULK_GET_STATS)
+        return processBulkStatsEvent(false, kco);
+
+    if (op == REDIS_ASIC_STATE_COMMAND_BULK_CLEAR_STATS)
+        return processBulkStatsEvent(true, kco);
+
     if (op == REDIS_ASIC_STATE_COMMAND_FLUSH)
         return processFdbFlush(kco);
 
@@ -748,12 +794,183 @@ sai_status_t Syncd::processGetStatsEvent(
     return status;
 }
 
+sai_status_t Syncd::processBulkStatsEvent(
+        _In_ bool clear,
+        _In_ const swss::KeyOpFieldsValuesTuple &kco)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string &key = kfvKey(kco); // objectType:switchVid
+
+    auto pos = key.find(":");
+
+    if (pos == std::string::npos)
+    {
+        SWSS_LOG_THROW("invalid bulk stats key: %s", key.c_str());
+    }
+
+    sai_object_type_t objectType;
+    sai_deserialize_object_type(key.substr(0, pos), objectType);
+
+    sai_object_id_t switchVid;
+    sai_deserialize_object_id(key.substr(pos + 1), switchVid);
+
+    auto info = sai_metadata_get_object_type_info(objectType);
+
+    if (info == nullptr || info->isnonobjectid)
+    {
+        SWSS_LOG_THROW("non object id not supported on bulk stats: %s, FIXME", key.c_str());
+    }
+
+    const auto& values = kfvFieldsValues(kco);
+
+    if (values.empty())
+    {
+        SWSS_LOG_THROW("bulk stats mode and counters are missing: %s", key.c_str());
+    }
+
+    int32_t mode;
+    sai_deserialize_enum(fvField(values[0]), &sai_metadata_enum_sai_stats_mode_t, mode);
+
+    const std::string& strCounterIds = fvValue(values[0]);
+
+    uint32_t counterCount = strCounterIds.empty() ? 0 :
+        (uint32_t)std::count(strCounterIds.begin(), strCounterIds.end(), ',') + 1;
+
+    std::vector<uint64_t> ids(counterCount);
+
+    sai_deserialize_counter_list(strCounterIds, counterCount, ids.data());
+
+    std::vector<sai_stat_id_t> counterIds(ids.begin(), ids.end());
+
+    uint32_t objectCount = (uint32_t)(values.size() - 1);
+
+    std::vector<sai_object_key_t> objectKeys(objectCount);
+
+    sai_object_id_t switchRid = SAI_NULL_OBJECT_ID;
+
+    bool translated = m_translator->tryTranslateVidToRid(switchVid, switchRid);
+
+    for (uint32_t idx = 0; translated && idx < objectCount; idx++)
+    {
+        sai_object_id_t vid;
+        sai_deserialize_object_id(fvField(values[idx + 1]), vid);
+
+        if (isInitViewMode() && m_createdInInitView.find(vid) != m_createdInInitView.end())
+        {
+            SWSS_LOG_WARN("BULK STATS api can't be used on %s since it's created in INIT_VIEW mode",
+                    sai_serialize_object_id(vid).c_str());
+
+            translated = false;
+            break;
+        }
+
+        translated = m_translator->tryTranslateVidToRid(vid, objectKeys[idx].key.object_id);
+    }
+
+    if (!translated)
+    {
+        sai_status_t status = SAI_STATUS_INVALID_OBJECT_ID;
+
+        m_selectableChannel->set(sai_serialize_status(status), {}, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+        return status;
+    }
+
+    std::vector<sai_status_t> statuses(objectCount, SAI_STATUS_NOT_EXECUTED);
+
+    std::vector<uint64_t> counters(clear ? 0 : (size_t)objectCount * counterCount);
+
+    sai_status_t status = clear
+        ? m_vendorSai->bulkClearStats(
+                switchRid,
+                objectType,
+                objectCount,
+                objectKeys.data(),
+                counterCount,
+                counterIds.data(),
+                (sai_stats_mode_t)mode,
+                statuses.data())
+        : m_vendorSai->bulkGetStats(
+                switchRid,
+                objectType,
+                objectCount,
+                objectKeys.data(),
+                counterCount,
+                counterIds.data(),
+                (sai_stats_mode_t)mode,
+                statuses.data(),
+                counters.data());
+
+    if (status == SAI_STATUS_NOT_IMPLEMENTED || status == SAI_STATUS_NOT_SUPPORTED)
+    {
+        // vendor don't support bulk stats, query objects one by one, client
+        // still gets all of them in single response
+
+        status = SAI_STATUS_SUCCESS;
+
+        for (uint32_t idx = 0; idx < objectCount; idx++)
+        {
+            sai_object_id_t rid = objectKeys[idx].key.object_id;
+
+            if (clear)
+            {
+                statuses[idx] = m_vendorSai->clearStats(objectType, rid, counterCount, counterIds.data());
+            }
+            else if (mode == SAI_STATS_MODE_BULK_READ_AND_CLEAR)
+            {
+                statuses[idx] = m_vendorSai->getStatsExt(objectType, rid, counterCount, counterIds.data(),
+                        SAI_STATS_MODE_READ_AND_CLEAR, &counters[(size_t)idx * counterCount]);
+            }
+            else
+            {
+                statuses[idx] = m_vendorSai->getStats(objectType, rid, counterCount, counterIds.data(),
+                        &counters[(size_t)idx * counterCount]);
+            }
+
+            if (statuses[idx] != SAI_STATUS_SUCCESS)
+            {
+                status = SAI_STATUS_FAILURE;
+            }
+        }
+    }
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_NOTICE("Bulk %s stats error: %s", clear ? "clear" : "get", sai_serialize_status(status).c_str());
+    }
+
+    std::vector<swss::FieldValueTuple> entry;
+
+    entry.reserve(objectCount);
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        std::string strCounters;
+
+        if (!clear && statuses[idx] == SAI_STATUS_SUCCESS)
+        {
+            strCounters = sai_serialize_counter_list(counterCount, &counters[(size_t)idx * counterCount]);
+        }
+
+        entry.emplace_back(sai_serialize_status(statuses[idx]), strCounters);
+    }
+
+    m_selectableChannel->set(sai_serialize_status(status), entry, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    return status;
+}
+
 sai_status_t Syncd::processBulkQuadEvent(
         _In_ sai_common_api_t api,
         _In_ const swss::KeyOpFieldsValuesTuple &kco)
 {
     SWSS_LOG_ENTER();
 
+    static auto& histogram = LatencyHistogramRegistry::getHistogram("Syncd::processBulkQuadEvent");
+
+    LatencyHistogramScope scope(histogram);
+
     const std::string& key = kfvKey(kco); // objectType:count
 
     std::string strObjectType = key.substr(0, key.find(":"));
@@ -763,31 +980,40 @@ sai_status_t Syncd::processBulkQuadEvent(
 
     const std::vector<swss::FieldValueTuple> &values = kfvFieldsValues(kco);
 
-    std::vector<std::vector<swss::FieldValueTuple>> strAttributes;
+    m_bulkPrepareDuration = std::chrono::nanoseconds::zero();
+
+    size_t count = values.size();
+
+    std::vector<std::vector<swss::FieldValueTuple>> strAttributes(count);
 
     // field = objectId
     // value = attrid=attrvalue|...
 
-    std::vector<std::string> objectIds;
+    std::vector<std::string> objectIds(count);
 
-    std::vector<std::shared_ptr<SaiAttributeList>> attributes;
+    std::vector<std::shared_ptr<SaiAttributeList>> attributes(count);
 
-    for (const auto &fvt: values)
-    {
-        std::string strObjectId = fvField(fvt);
-        std::string joined = fvValue(fvt);
+    // attributes are translated here only when not in init view mode, each
+    // object is only accessing its own slot, so objects can be prepared in
+    // parallel
 
-        // decode values
+    bool translate = !isInitViewMode() && api != SAI_COMMON_API_BULK_GET;
+
+    runBulkPrepare(count, [&](size_t idx) {
 
-        auto v = swss::tokenize(joined, '|');
+        const auto& fvt = values[idx];
 
-        objectIds.push_back(strObjectId);
+        objectIds[idx] = fvField(fvt);
 
-        std::vector<swss::FieldValueTuple> entries; // attributes per object id
+        // decode values
+
+        auto v = swss::tokenize(fvValue(fvt), '|');
+
+        auto& entries = strAttributes[idx]; // attributes per object id
 
         for (size_t i = 0; i < v.size(); ++i)
         {
-            const std::string item = v.at(i);
+            const std::string& item = v.at(i);
 
             auto start = item.find_first_of("=");
 
@@ -797,14 +1023,17 @@ sai_status_t Syncd::processBulkQuadEvent(
             entries.emplace_back(field, value);
         }
 
-        strAttributes.push_back(entries);
-
         // since now we converted this to proper list, we can extract attributes
 
         auto list = std::make_shared<SaiAttributeList>(objectType, entries, false);
 
-        attributes.push_back(list);
-    }
+        if (translate)
+        {
+            m_translator->translateVidToRid(objectType, list->get_attr_count(), list->get_attr_list());
+        }
+
+        attributes[idx] = list;
+    });
 
     SWSS_LOG_INFO("bulk %s executing with %zu items",
             strObjectType.c_str(),
@@ -815,19 +1044,6 @@ sai_status_t Syncd::processBulkQuadEvent(
         return processBulkQuadEventInInitViewMode(objectType, objectIds, api, attributes, strAttributes);
     }
 
-    if (api != SAI_COMMON_API_BULK_GET)
-    {
-        // translate attributes for all objects
-
-        for (auto &list: attributes)
-        {
-            sai_attribute_t *attr_list = list->get_attr_list();
-            uint32_t attr_count = list->get_attr_count();
-
-            m_translator->translateVidToRid(objectType, attr_count, attr_list);
-        }
-    }
-
     auto info = sai_metadata_get_object_type_info(objectType);
 
     if (info->isobjectid)
@@ -945,13 +1161,14 @@ sai_status_t Syncd::processBulkCreateEntry(
         case SAI_OBJECT_TYPE_ROUTE_ENTRY:
         {
             std::vector<sai_route_entry_t> entries(object_count);
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_route_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
                 entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
-            }
+            });
 
             static PerformanceIntervalTimer timer("Syncd::processBulkCreateEntry(route_entry) CREATE");
 
@@ -974,13 +1191,14 @@ sai_status_t Syncd::processBulkCreateEntry(
         case SAI_OBJECT_TYPE_FDB_ENTRY:
         {
             std::vector<sai_fdb_entry_t> entries(object_count);
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_fdb_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
                 entries[it].bv_id = m_translator->translateVidToRid(entries[it].bv_id);
-            }
+            });
 
             status = m_vendorSai->bulkCreate(
                     object_count,
@@ -996,13 +1214,14 @@ sai_status_t Syncd::processBulkCreateEntry(
         case SAI_OBJECT_TYPE_NAT_ENTRY:
         {
             std::vector<sai_nat_entry_t> entries(object_count);
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_nat_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
                 entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
-            }
+            });
 
             status = m_vendorSai->bulkCreate(
                     object_count,
@@ -1018,12 +1237,13 @@ sai_status_t Syncd::processBulkCreateEntry(
         case SAI_OBJECT_TYPE_INSEG_ENTRY:
         {
             std::vector<sai_inseg_entry_t> entries(object_count);
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_inseg_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-            }
+            });
 
             status = m_vendorSai->bulkCreate(
                     object_count,
@@ -1040,13 +1260,13 @@ sai_status_t Syncd::processBulkCreateEntry(
         {
             std::vector<sai_my_sid_entry_t> entries(object_count);
 
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_my_sid_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
                 entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
-            }
+            });
 
             status = m_vendorSai->bulkCreate(
                     object_count,
@@ -1089,13 +1309,14 @@ sai_status_t Syncd::processBulkRemoveEntry(
         case SAI_OBJECT_TYPE_ROUTE_ENTRY:
         {
             std::vector<sai_route_entry_t> entries(object_count);
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_route_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
                 entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
-            }
+            });
 
             status = m_vendorSai->bulkRemove(
                     object_count,
@@ -1109,13 +1330,14 @@ sai_status_t Syncd::processBulkRemoveEntry(
         case SAI_OBJECT_TYPE_FDB_ENTRY:
         {
             std::vector<sai_fdb_entry_t> entries(object_count);
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_fdb_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
                 entries[it].bv_id = m_translator->translateVidToRid(entries[it].bv_id);
-            }
+            });
 
             status = m_vendorSai->bulkRemove(
                     object_count,
@@ -1129,13 +1351,14 @@ sai_status_t Syncd::processBulkRemoveEntry(
         case SAI_OBJECT_TYPE_NAT_ENTRY:
         {
             std::vector<sai_nat_entry_t> entries(object_count);
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_nat_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
                 entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
-            }
+            });
 
             status = m_vendorSai->bulkRemove(
                     object_count,
@@ -1150,13 +1373,13 @@ sai_status_t Syncd::processBulkRemoveEntry(
         {
             std::vector<sai_my_sid_entry_t> entries(object_count);
 
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_my_sid_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
                 entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
-            }
+            });
 
             status = m_vendorSai->bulkRemove(
                     object_count,
@@ -1169,12 +1392,13 @@ sai_status_t Syncd::processBulkRemoveEntry(
         case SAI_OBJECT_TYPE_INSEG_ENTRY:
         {
             std::vector<sai_inseg_entry_t> entries(object_count);
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_inseg_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-            }
+            });
 
             status = m_vendorSai->bulkRemove(
                     object_count,
@@ -1224,13 +1448,14 @@ sai_status_t Syncd::processBulkSetEntry(
         case SAI_OBJECT_TYPE_ROUTE_ENTRY:
         {
             std::vector<sai_route_entry_t> entries(object_count);
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_route_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
                 entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
-            }
+            });
 
             status = m_vendorSai->bulkSet(
                     object_count,
@@ -1245,13 +1470,14 @@ sai_status_t Syncd::processBulkSetEntry(
         case SAI_OBJECT_TYPE_FDB_ENTRY:
         {
             std::vector<sai_fdb_entry_t> entries(object_count);
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_fdb_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
                 entries[it].bv_id = m_translator->translateVidToRid(entries[it].bv_id);
-            }
+            });
 
             status = m_vendorSai->bulkSet(
                     object_count,
@@ -1266,13 +1492,14 @@ sai_status_t Syncd::processBulkSetEntry(
         case SAI_OBJECT_TYPE_NAT_ENTRY:
         {
             std::vector<sai_nat_entry_t> entries(object_count);
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_nat_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
                 entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
-            }
+            });
 
             status = m_vendorSai->bulkSet(
                     object_count,
@@ -1288,13 +1515,13 @@ sai_status_t Syncd::processBulkSetEntry(
         {
             std::vector<sai_my_sid_entry_t> entries(object_count);
 
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_my_sid_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
                 entries[it].vr_id = m_translator->translateVidToRid(entries[it].vr_id);
-            }
+            });
 
             status = m_vendorSai->bulkSet(
                     object_count,
@@ -1308,12 +1535,13 @@ sai_status_t Syncd::processBulkSetEntry(
         case SAI_OBJECT_TYPE_INSEG_ENTRY:
         {
             std::vector<sai_inseg_entry_t> entries(object_count);
-            for (uint32_t it = 0; it < object_count; it++)
-            {
+
+            runBulkPrepare(object_count, [&](size_t it) {
+
                 sai_deserialize_inseg_entry(objectIds[it], entries[it]);
 
                 entries[it].switch_id = m_translator->translateVidToRid(entries[it].switch_id);
-            }
+            });
 
             status = m_vendorSai->bulkSet(
                     object_count,
@@ -1332,6 +1560,57 @@ sai_status_t Syncd::processBulkSetEntry(
     return status;
 }
 
+void Syncd::runBulkPrepare(
+        _In_ size_t count,
+        _In_ const std::function<void(size_t idx)>& fn)
+{
+    SWSS_LOG_ENTER();
+
+    auto start = std::chrono::steady_clock::now();
+
+    if (m_bulkPrepareWorkerPool)
+    {
+        m_bulkPrepareWorkerPool->parallelFor(count, BULK_PREPARE_MIN_CHUNK_SIZE, [&](size_t begin, size_t end) {
+
+            for (size_t idx = begin; idx < end; idx++)
+            {
+                fn(idx);
+            }
+        });
+    }
+    else
+    {
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            fn(idx);
+        }
+    }
+
+    m_bulkPrepareDuration += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+}
+
+void Syncd::reportBulkDuration(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_common_api_t api,
+        _In_ size_t count,
+        _In_ std::chrono::nanoseconds vendorDuration)
+{
+    SWSS_LOG_ENTER();
+
+    static auto& prepareHistogram = LatencyHistogramRegistry::getHistogram("Syncd::bulkPrepare");
+    static auto& vendorHistogram = LatencyHistogramRegistry::getHistogram("Syncd::bulkVendorCall");
+
+    prepareHistogram.record((uint64_t)m_bulkPrepareDuration.count());
+    vendorHistogram.record((uint64_t)vendorDuration.count());
+
+    SWSS_LOG_INFO("bulk %s %s %zu objects: prepare %" PRId64 " us, vendor call %" PRId64 " us",
+            sai_serialize_common_api(api).c_str(),
+            sai_serialize_object_type(objectType).c_str(),
+            count,
+            (int64_t)std::chrono::duration_cast<std::chrono::microseconds>(m_bulkPrepareDuration).count(),
+            (int64_t)std::chrono::duration_cast<std::chrono::microseconds>(vendorDuration).count());
+}
+
 sai_status_t Syncd::processBulkEntry(
         _In_ sai_object_type_t objectType,
         _In_ const std::vector<std::string>& objectIds,
@@ -1354,6 +1633,10 @@ sai_status_t Syncd::processBulkEntry(
 
     if (m_commandLineOptions->m_enableSaiBulkSupport)
     {
+        auto prepareDuration = m_bulkPrepareDuration;
+
+        auto start = std::chrono::steady_clock::now();
+
         switch (api)
         {
             case SAI_COMMON_API_BULK_CREATE:
@@ -1375,6 +1658,14 @@ sai_status_t Syncd::processBulkEntry(
 
         if (all != SAI_STATUS_NOT_SUPPORTED && all != SAI_STATUS_NOT_IMPLEMENTED)
         {
+            // entries prepare time is measured inside bulk call, rest of it
+            // is spent in vendor SAI
+
+            auto vendorDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start)
+                - (m_bulkPrepareDuration - prepareDuration);
+
+            reportBulkDuration(objectType, api, objectIds.size(), vendorDuration);
+
             sendApiResponse(api, all, (uint32_t)objectIds.size(), statuses.data());
             syncUpdateRedisBulkQuadEvent(api, statuses, objectType, objectIds, strAttributes);
 
@@ -1577,6 +1868,26 @@ sai_status_t Syncd::processBulkOidCreate(
         }
     }
 
+    if (objectType == SAI_OBJECT_TYPE_PORT)
+    {
+        // post create actions of all created ports are executed together
+
+        std::vector<sai_object_id_t> portRids;
+
+        for (size_t idx = 0; idx < object_count; idx++)
+        {
+            if (statuses[idx] == SAI_STATUS_SUCCESS)
+            {
+                portRids.push_back(objectRids[idx]);
+            }
+        }
+
+        if (portRids.size())
+        {
+            m_switches.at(switchVid)->onPostPortsCreate(portRids);
+        }
+    }
+
     return status;
 }
 
@@ -1606,6 +1917,16 @@ sai_status_t Syncd::processBulkOidRemove(
         objectRids[idx] = m_translator->translateVidToRid(objectVids[idx]);
     }
 
+    if (objectType == SAI_OBJECT_TYPE_PORT)
+    {
+        for (size_t idx = 0; idx < object_count; idx++)
+        {
+            sai_object_id_t switchVid = VidManager::switchIdQuery(objectVids[idx]);
+
+            m_switches.at(switchVid)->collectPortRelatedObjects(objectRids[idx]);
+        }
+    }
+
     status = m_vendorSai->bulkRemove(
                                 objectType,
                                 (uint32_t)object_count,
@@ -1625,6 +1946,9 @@ sai_status_t Syncd::processBulkOidRemove(
      * object references since at this point they are no longer valid
      */
     sai_object_id_t switchVid;
+
+    std::map<sai_object_id_t, std::vector<sai_object_id_t>> removedPorts;
+
     for (size_t idx = 0; idx < object_count; idx++)
     {
         if (statuses[idx] == SAI_STATUS_SUCCESS)
@@ -1637,9 +1961,21 @@ sai_status_t Syncd::processBulkOidRemove(
             {
                 m_switches.at(switchVid)->removeExistingObjectReference(objectRids[idx]);
             }
+
+            if (objectType == SAI_OBJECT_TYPE_PORT)
+            {
+                removedPorts[switchVid].push_back(objectRids[idx]);
+            }
         }
     }
 
+    // post remove actions of all removed ports are executed together
+
+    for (auto& kvp: removedPorts)
+    {
+        m_switches.at(kvp.first)->postPortsRemove(kvp.second);
+    }
+
     return status;
 }
 
@@ -2161,6 +2497,17 @@ void Syncd::syncUpdateRedisQuadEvent(
 
     if (!m_enableSyncMode)
     {
+        // redis database was modified by consumer table, keep fdb index in
+        // client in sync with ASIC DB
+
+        if (kfvKey(kco).find("SAI_OBJECT_TYPE_FDB_ENTRY:") == 0)
+        {
+            sai_object_meta_key_t metaKey;
+            sai_deserialize_object_meta_key(kfvKey(kco), metaKey);
+
+            m_client->updateFdbIndex(api, metaKey, kfvFieldsValues(kco));
+        }
+
         return;
     }
 
@@ -2251,6 +2598,39 @@ void Syncd::syncUpdateRedisBulkQuadEvent(
 
     if (!m_enableSyncMode)
     {
+        if (objectType == SAI_OBJECT_TYPE_FDB_ENTRY)
+        {
+            sai_common_api_t singleApi;
+
+            switch (api)
+            {
+                case SAI_COMMON_API_BULK_CREATE:
+                    singleApi = SAI_COMMON_API_CREATE;
+                    break;
+
+                case SAI_COMMON_API_BULK_REMOVE:
+                    singleApi = SAI_COMMON_API_REMOVE;
+                    break;
+
+                case SAI_COMMON_API_BULK_SET:
+                    singleApi = SAI_COMMON_API_SET;
+                    break;
+
+                default:
+                    return;
+            }
+
+            const std::string strObjectType = sai_serialize_object_type(objectType);
+
+            for (size_t idx = 0; idx < objectIds.size(); idx++)
+            {
+                sai_object_meta_key_t metaKey;
+                sai_deserialize_object_meta_key(strObjectType + ":" + objectIds[idx], metaKey);
+
+                m_client->updateFdbIndex(singleApi, metaKey, strAttributes.at(idx));
+            }
+        }
+
         return;
     }
 
@@ -2355,6 +2735,10 @@ sai_status_t Syncd::processQuadEvent(
 {
     SWSS_LOG_ENTER();
 
+    static auto& histogram = LatencyHistogramRegistry::getHistogram("Syncd::processQuadEvent");
+
+    LatencyHistogramScope scope(histogram);
+
     const std::string& key = kfvKey(kco);
     const std::string& op = kfvOp(kco);
 
@@ -2872,6 +3256,49 @@ void Syncd::loadProfileMap()
     }
 }
 
+void Syncd::setVendorLockPolicy()
+{
+    SWSS_LOG_ENTER();
+
+    auto lockPolicy = m_commandLineOptions->m_vendorLockPolicy;
+
+    // policy given on command line, including global, takes precedence over
+    // profile
+
+    if (lockPolicy == VENDOR_SAI_LOCK_POLICY_UNKNOWN)
+    {
+        auto it = m_profileMap.find(SYNCD_PROFILE_KEY_VENDOR_LOCK_POLICY);
+
+        if (it == m_profileMap.end())
+        {
+            lockPolicy = VENDOR_SAI_LOCK_POLICY_GLOBAL;
+        }
+        else
+        {
+            lockPolicy = CommandLineOptions::lockPolicyStringToLockPolicy(it->second);
+
+            if (lockPolicy == VENDOR_SAI_LOCK_POLICY_UNKNOWN)
+            {
+                SWSS_LOG_THROW("unknown vendor lock policy '%s' in profile", it->second.c_str());
+            }
+        }
+    }
+
+    auto vendor = std::dynamic_pointer_cast<VendorSai>(m_vendorSai);
+
+    if (vendor)
+    {
+        vendor->setLockPolicy(lockPolicy);
+
+        SWSS_LOG_NOTICE("vendor SAI lock policy: %s", CommandLineOptions::lockPolicyToString(lockPolicy).c_str());
+    }
+    else if (lockPolicy != VENDOR_SAI_LOCK_POLICY_GLOBAL)
+    {
+        SWSS_LOG_WARN("lock policy %s ignored, SAI interface is not vendor SAI",
+                CommandLineOptions::lockPolicyToString(lockPolicy).c_str());
+    }
+}
+
 void Syncd::sendGetResponse(
         _In_ sai_object_type_t objectType,
         _In_ const std::string& strObjectId,
@@ -3139,106 +3566,28 @@ void Syncd::inspectAsic()
 {
     SWSS_LOG_ENTER();
 
-    // Fetch all the keys from ASIC DB
-    // Loop through all the keys in ASIC DB
-
-    for (const auto &key: m_client->getAsicStateKeys())
-    {
-        // ASIC_STATE:objecttype:objectid (object id may contain ':')
-
-        auto start = key.find_first_of(":");
-
-        if (start == std::string::npos)
-        {
-            SWSS_LOG_ERROR("invalid ASIC_STATE_TABLE %s: no start :", key.c_str());
-            break;
-        }
-
-        auto mk = key.substr(start + 1);
-
-        sai_object_meta_key_t metaKey;
-        sai_deserialize_object_meta_key(mk, metaKey);
-
-        // Find all the attrid from ASIC DB, and use them to query ASIC
-
-        auto hash = m_client->getAttributesFromAsicKey(key);
+    m_asicAuditor->runPass();
 
-        std::vector<swss::FieldValueTuple> values;
-
-        for (auto &kv: hash)
-        {
-            const std::string &skey = kv.first;
-            const std::string &svalue = kv.second;
-
-            swss::FieldValueTuple fvt(skey, svalue);
-
-            values.push_back(fvt);
-        }
-
-        SaiAttributeList list(metaKey.objecttype, values, false);
-
-        sai_attribute_t *attr_list = list.get_attr_list();
-
-        uint32_t attr_count = list.get_attr_count();
-
-        SWSS_LOG_DEBUG("attr count: %u", list.get_attr_count());
-
-        if (attr_count == 0)
-        {
-            // TODO: how to check ASIC on ASIC DB key with NULL:NULL hash
-            // just ignore for now
-            continue;
-        }
-
-        m_translator->translateVidToRid(metaKey);
-
-        sai_status_t status = m_vendorSai->get(metaKey, attr_count, attr_list);
-
-        if (status != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("failed to execute get api on %s: %s",
-                    sai_serialize_object_meta_key(metaKey).c_str(),
-                    sai_serialize_status(status).c_str());
-            continue;
-        }
-
-        // compare fields and values from ASIC_DB and SAI response and log the difference
-
-        for (uint32_t index = 0; index < attr_count; ++index)
-        {
-            const sai_attribute_t& attr = attr_list[index];
+    SWSS_LOG_NOTICE("inspected %lu objects, %lu mismatched",
+            m_asicAuditor->getPassObjectCount(),
+            m_asicAuditor->getPassMismatchCount());
+}
 
-            auto meta = sai_metadata_get_attr_metadata(metaKey.objecttype, attr.id);
+void Syncd::runAsicAuditSlice()
+{
+    SWSS_LOG_ENTER();
 
-            if (meta == NULL)
-            {
-                SWSS_LOG_ERROR("FATAL: failed to find metadata for object type %s and attr id %d",
-                        sai_serialize_object_type(metaKey.objecttype).c_str(),
-                        attr.id);
-                break;
-            }
+    std::lock_guard<std::mutex> lock(m_mutex);
 
-            std::string strSaiAttrValue = sai_serialize_attr_value(*meta, attr, false);
+    if (isInitViewMode())
+    {
+        // ASIC DB is changed by apply view at the end of init view
+        return;
+    }
 
-            std::string strRedisAttrValue = hash[meta->attridname];
+    WatchdogScope ws(m_timerWatchdog, "asic audit slice");
 
-            if (strRedisAttrValue == strSaiAttrValue)
-            {
-                SWSS_LOG_INFO("matched %s REDIS and ASIC attr value '%s' with on %s",
-                        meta->attridname,
-                        strRedisAttrValue.c_str(),
-                        sai_serialize_object_meta_key(metaKey).c_str());
-            }
-            else
-            {
-                SWSS_LOG_ERROR("failed to match %s REDIS attr '%s' with ASIC attr '%s' for %s",
-                        meta->attridname,
-                        strRedisAttrValue.c_str(),
-                        strSaiAttrValue.c_str(),
-                        sai_serialize_object_meta_key(metaKey).c_str());
-            }
-        }
-    }
+    m_asicAuditor->runSlice();
 }
 
 sai_status_t Syncd::processNotifySyncd(
@@ -3557,30 +3906,103 @@ sai_status_t Syncd::applyView()
 
     try
     {
+        /*
+         * We are starting first stage here, it still can throw exceptions
+         * but it's non destructive for ASIC, so just catch and return in
+         * case of failure.
+         *
+         * Each ASIC view at this point will contain only 1 switch.
+         *
+         * Views construction and comparison don't touch ASIC nor redis, and
+         * each switch have its own views, so for multiple switches they are
+         * executed on separate threads. Results are collected in switch
+         * order, so second stage is executed in the same order as before.
+         */
+
+        bool parallel = m_switches.size() > 1 && !m_commandLineOptions->m_disableParallelApplyView;
+
+        std::vector<std::future<std::pair<std::shared_ptr<AsicView>, std::shared_ptr<AsicView>>>> views;
+
+        // each switch is timed inside its own tasks, so waiting for other
+        // switches is not accounted
+
+        std::vector<std::chrono::steady_clock::duration> buildTimes(m_switches.size());
+        std::vector<std::chrono::steady_clock::duration> compareTimes(m_switches.size());
+
         for (auto& kvp: m_switches)
         {
             auto switchVid = kvp.first;
 
-            auto sw = m_switches.at(switchVid);
+            auto& current = currentMap.at(switchVid);
+            auto& temp = temporaryMap.at(switchVid);
 
-            /*
-             * We are starting first stage here, it still can throw exceptions
-             * but it's non destructive for ASIC, so just catch and return in
-             * case of failure.
-             *
-             * Each ASIC view at this point will contain only 1 switch.
-             */
+            auto& buildTime = buildTimes.at(views.size());
+
+            views.push_back(std::async(parallel ? std::launch::async : std::launch::deferred, [&current, &temp, &buildTime]() {
 
-            auto current = std::make_shared<AsicView>(currentMap.at(switchVid));
-            auto temp = std::make_shared<AsicView>(temporaryMap.at(switchVid));
+                auto start = std::chrono::steady_clock::now();
 
-            auto cl = std::make_shared<ComparisonLogic>(m_vendorSai, sw, m_handler, m_initViewRemovedVidSet, current, temp, m_breakConfig);
+                auto view = std::make_pair(std::make_shared<AsicView>(current), std::make_shared<AsicView>(temp));
 
-            cl->compareViews();
+                buildTime = std::chrono::steady_clock::now() - start;
 
-            currentViews.push_back(current);
-            tempViews.push_back(temp);
-            cls.push_back(cl);
+                return view;
+            }));
+        }
+
+        // comparison logic constructor reads RID/VID maps from redis, so it
+        // must be created on this thread
+
+        for (auto& kvp: m_switches)
+        {
+            auto view = views.at(cls.size()).get();
+
+            currentViews.push_back(view.first);
+            tempViews.push_back(view.second);
+
+            cls.push_back(std::make_shared<ComparisonLogic>(m_vendorSai, kvp.second, m_handler, m_initViewRemovedVidSet, view.first, view.second, m_breakConfig));
+        }
+
+        std::vector<std::future<void>> comparisons;
+
+        for (size_t idx = 0; idx < cls.size(); idx++)
+        {
+            auto cl = cls.at(idx);
+
+            auto& compareTime = compareTimes.at(idx);
+
+            comparisons.push_back(std::async(parallel ? std::launch::async : std::launch::deferred, [cl, &compareTime]() {
+
+                auto start = std::chrono::steady_clock::now();
+
+                cl->compareViews();
+
+                compareTime = std::chrono::steady_clock::now() - start;
+            }));
+        }
+
+        // on exception, destructors of remaining futures will wait for their
+        // threads to finish
+
+        for (auto& f: comparisons)
+        {
+            f.get();
+        }
+
+        size_t idx = 0;
+
+        for (auto& kvp: m_switches)
+        {
+            auto buildUs = std::chrono::duration_cast<std::chrono::microseconds>(buildTimes.at(idx)).count();
+            auto compareUs = std::chrono::duration_cast<std::chrono::microseconds>(compareTimes.at(idx)).count();
+
+            SWSS_LOG_NOTICE("switch %s: views build took %.3f ms, comparison took %.3f ms, asic operations: %zu",
+                    sai_serialize_object_id(kvp.first).c_str(),
+                    (double)buildUs / 1000.0,
+                    (double)compareUs / 1000.0,
+                    currentViews.at(idx)->asicGetOperationsCount());
+
+            idx++;
         }
     }
     catch (const std::exception &e)
@@ -3610,7 +4032,7 @@ sai_status_t Syncd::applyView()
         cl->executeOperationsOnAsic(); // can throw, if so asic will be in inconsistent state
     }
 
-    updateRedisDatabase(tempViews);
+    updateRedisDatabase(currentMap, tempViews);
 
     for (auto& cl: cls)
     {
@@ -3683,23 +4105,34 @@ void Syncd::dumpComparisonLogicOutput(
 }
 
 void Syncd::updateRedisDatabase(
+    _In_ const std::map<sai_object_id_t, swss::TableDump>& currentMap,
     _In_ const std::vector<std::shared_ptr<AsicView>>& temporaryViews)
 {
     SWSS_LOG_ENTER();
 
-    // TODO: We can make LUA script for this which will be much faster.
-    //
-    // TODO: Needs to be revisited if ASIC views will be across multiple redis
-    // database indexes.
+    /*
+     * Current map contains ASIC_STATE exactly as it was read at the beginning
+     * of apply view, nothing was written there since then, so we only need to
+     * write differences between current and temporary views. Whole update is
+     * done in single transaction, so ASIC_STATE is never seen empty.
+     *
+     * TODO: Needs to be revisited if ASIC views will be across multiple redis
+     * database indexes.
+     */
 
     SWSS_LOG_TIMER("redis update");
 
-    m_client->removeAsicStateTable();
+    swss::TableDump currentView;
 
-    m_client->removeTempAsicStateTable();
+    for (auto& kvp: currentMap)
+    {
+        currentView.insert(kvp.second.begin(), kvp.second.end());
+    }
 
     // Save temporary views as current view in redis database.
 
+    swss::TableDump newView;
+
     for (auto& tv: temporaryViews)
     {
         for (const auto &pair: tv->m_soAll)
@@ -3708,21 +4141,24 @@ void Syncd::updateRedisDatabase(
 
             const auto &attr = obj->getAllAttributes();
 
-            std::vector<swss::FieldValueTuple> entry;
+            auto& entry = newView[sai_serialize_object_meta_key(obj->m_meta_key)];
 
             for (const auto &ap: attr)
             {
                 const auto saiAttr = ap.second;
 
-                entry.emplace_back(saiAttr->getStrAttrId(), saiAttr->getStrAttrValue());
+                entry[saiAttr->getStrAttrId()] = saiAttr->getStrAttrValue();
             }
 
-            m_client->createAsicObject(obj->m_meta_key, entry);
+            if (entry.size() == 0)
+            {
+                entry["NULL"] = "NULL";
+            }
         }
     }
 
     /*
-     * Remove previous RID2VID maps and apply new map.
+     * Previous RID2VID maps are replaced by new map.
      *
      * NOTE: This needs to be done per switch, we can't remove all maps.
      */
@@ -3739,7 +4175,7 @@ void Syncd::updateRedisDatabase(
         }
     }
 
-    m_client->setVidAndRidMap(allVid2Rid);
+    m_client->updateAsicState(currentView, newView, allVid2Rid);
 
     SWSS_LOG_NOTICE("updated redis database");
 }
@@ -4441,13 +4877,17 @@ sai_status_t Syncd::setUninitDataPlaneOnRemovalOnAllSwitches()
 }
 
 void Syncd::syncProcessNotification(
-        _In_ const swss::KeyOpFieldsValuesTuple& item)
+        _Inout_ NotificationData& notification)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
     SWSS_LOG_ENTER();
 
-    m_processor->syncProcessNotification(item);
+    static auto& histogram = LatencyHistogramRegistry::getHistogram("Syncd::syncProcessNotification");
+
+    LatencyHistogramScope scope(histogram);
+
+    m_processor->syncProcessNotification(notification);
 }
 
 bool Syncd::isVeryFirstRun()
@@ -4518,6 +4958,14 @@ void Syncd::run()
         s->addSelectable(m_restartQuery.get());
         s->addSelectable(m_flexCounter.get());
         s->addSelectable(m_flexCounterGroup.get());
+        s->addSelectable(m_latencyQuery.get());
+
+        if (m_asicAuditTimer)
+        {
+            s->addSelectable(m_asicAuditTimer.get());
+
+            m_asicAuditTimer->start();
+        }
 
         SWSS_LOG_NOTICE("starting main loop");
     }
@@ -4629,10 +5077,18 @@ void Syncd::run()
             {
                 processFlexCounterGroupEvent(*(swss::ConsumerTable*)sel);
             }
+            else if (sel == m_latencyQuery.get())
+            {
+                handleLatencyQuery(*m_latencyQuery);
+            }
             else if (sel == m_selectableChannel.get())
             {
                 processEvent(*m_selectableChannel.get());
             }
+            else if (m_asicAuditTimer && sel == m_asicAuditTimer.get())
+            {
+                runAsicAuditSlice();
+            }
             else
             {
                 SWSS_LOG_ERROR("select failed: %d", result);
@@ -4737,3 +5193,75 @@ syncd_restart_type_t Syncd::handleRestartQuery(
 
     return RequestShutdownCommandLineOptions::stringToRestartType(op);
 }
+
+void Syncd::handleLatencyQuery(
+        _In_ swss::NotificationConsumer &latencyQuery)
+{
+    SWSS_LOG_ENTER();
+
+    std::string op;
+    std::string data;
+    std::vector<swss::FieldValueTuple> values;
+
+    latencyQuery.pop(op, data, values);
+
+    SWSS_LOG_NOTICE("received %s latency query", op.c_str());
+
+    if (op == SYNCD_LATENCY_QUERY_SNAPSHOT)
+    {
+        writeLatencyHistograms();
+    }
+    else if (op == SYNCD_LATENCY_QUERY_RESET)
+    {
+        LatencyHistogramRegistry::reset();
+    }
+    else
+    {
+        SWSS_LOG_ERROR("unknown latency query: %s", op.c_str());
+    }
+}
+
+void Syncd::writeLatencyHistograms()
+{
+    SWSS_LOG_ENTER();
+
+    swss::DBConnector db(m_contextConfig->m_dbState, 0);
+
+    swss::Table table(&db, SYNCD_LATENCY_HISTOGRAM_TABLE);
+
+    for (auto& kvp: LatencyHistogramRegistry::snapshot())
+    {
+        auto& snapshot = kvp.second;
+
+        std::vector<swss::FieldValueTuple> values;
+
+        values.emplace_back("count", std::to_string(snapshot.m_count));
+        values.emplace_back("min_ns", std::to_string(snapshot.m_min));
+        values.emplace_back("max_ns", std::to_string(snapshot.m_max));
+        values.emplace_back("mean_ns", std::to_string(snapshot.getMean()));
+        values.emplace_back("p50_ns", std::to_string(snapshot.getValueAtPercentile(50)));
+        values.emplace_back("p90_ns", std::to_string(snapshot.getValueAtPercentile(90)));
+        values.emplace_back("p99_ns", std::to_string(snapshot.getValueAtPercentile(99)));
+        values.emplace_back("p999_ns", std::to_string(snapshot.getValueAtPercentile(99.9)));
+
+        // non empty buckets as upper_bound:count pairs, so distribution can
+        // be rebuilt by external tools
+
+        std::string buckets;
+
+        for (size_t idx = 0; idx < LatencyHistogram::BUCKET_COUNT; idx++)
+        {
+            if (snapshot.m_buckets[idx] == 0)
+                continue;
+
+            if (buckets.size())
+                buckets += ",";
+
+            buckets += std::to_string(LatencyHistogram::getBucketUpperBound(idx)) + ":" + std::to_string(snapshot.m_buckets[idx]);
+        }
+
+        values.emplace_back("buckets", buckets);
+
+        table.set(kvp.first, values);
+    }
+}
@@ -18,15 +18,32 @@
 #include "NotificationProducerBase.h"
 #include "TimerWatchdog.h"
 #include "MdioIpcServer.h"
+#include "AsicAuditor.h"
 
 #include "meta/SaiAttributeList.h"
 #include "meta/SelectableChannel.h"
+#include "meta/WorkerPool.h"
 
 #include "swss/consumertable.h"
 #include "swss/producertable.h"
 #include "swss/notificationconsumer.h"
+#include "swss/selectabletimer.h"
 
 #include <memory>
+#include <chrono>
+#include <functional>
+
+/**
+ * @brief Latency histograms query channel in ASIC DB.
+ *
+ * SNAPSHOT writes all histograms to STATE DB, RESET clears all histograms.
+ */
+#define SYNCD_NOTIFICATION_CHANNEL_LATENCYQUERY "LATENCYQUERY"
+
+#define SYNCD_LATENCY_QUERY_SNAPSHOT    "SNAPSHOT"
+#define SYNCD_LATENCY_QUERY_RESET       "RESET"
+
+#define SYNCD_LATENCY_HISTOGRAM_TABLE   "SYNCD_LATENCY_HISTOGRAM"
 
 namespace syncd
 {
@@ -111,6 +128,11 @@ namespace syncd
 
             void loadProfileMap();
 
+            /**
+             * @brief Set vendor SAI lock policy from command line or profile.
+             */
+            void setVendorLockPolicy();
+
             void saiLoglevelNotify(
                     _In_ std::string strApi,
                     _In_ std::string strLogLevel);
@@ -143,6 +165,16 @@ namespace syncd
             sai_status_t processGetStatsEvent(
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
 
+            /**
+             * @brief Process bulk get or clear stats.
+             *
+             * Vendor bulk stats API is used when supported, otherwise objects
+             * are queried one by one and returned in single response.
+             */
+            sai_status_t processBulkStatsEvent(
+                    _In_ bool clear,
+                    _In_ const swss::KeyOpFieldsValuesTuple &kco);
+
             sai_status_t processQuadEvent(
                     _In_ sai_common_api_t api,
                     _In_ const swss::KeyOpFieldsValuesTuple &kco);
@@ -234,6 +266,25 @@ namespace syncd
                     _In_ const std::vector<std::string>& objectIds,
                     _Out_ std::vector<sai_status_t>& statuses);
 
+        private: // bulk prepare
+
+            /**
+             * @brief Execute function for each bulk object index.
+             *
+             * When bulk prepare threads are enabled, indexes are split into
+             * chunks executed on worker pool, otherwise function is executed
+             * serially. Execution time is added to bulk prepare duration.
+             */
+            void runBulkPrepare(
+                    _In_ size_t count,
+                    _In_ const std::function<void(size_t idx)>& fn);
+
+            void reportBulkDuration(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_common_api_t api,
+                    _In_ size_t count,
+                    _In_ std::chrono::nanoseconds vendorDuration);
+
         private: // process quad in init view mode
 
             sai_status_t processQuadInInitViewModeCreate(
@@ -280,7 +331,7 @@ namespace syncd
                     _In_ sai_attribute_t *attr_list);
 
             void syncProcessNotification(
-                    _In_ const swss::KeyOpFieldsValuesTuple& item);
+                    _Inout_ NotificationData& notification);
 
         private:
 
@@ -296,6 +347,7 @@ namespace syncd
                     _In_ const std::vector<std::shared_ptr<AsicView>>& currentViews);
 
             void updateRedisDatabase(
+                    _In_ const std::map<sai_object_id_t, swss::TableDump>& currentMap,
                     _In_ const std::vector<std::shared_ptr<AsicView>>& temporaryViews);
 
             std::map<sai_object_id_t, swss::TableDump> redisGetAsicView(
@@ -320,6 +372,13 @@ namespace syncd
             syncd_restart_type_t handleRestartQuery(
                     _In_ swss::NotificationConsumer &restartQuery);
 
+            void handleLatencyQuery(
+                    _In_ swss::NotificationConsumer &latencyQuery);
+
+            void writeLatencyHistograms();
+
+            void runAsicAuditSlice();
+
         private:
 
             /**
@@ -480,6 +539,8 @@ namespace syncd
 
             std::shared_ptr<swss::NotificationConsumer> m_restartQuery;
 
+            std::shared_ptr<swss::NotificationConsumer> m_latencyQuery;
+
             std::shared_ptr<swss::DBConnector> m_dbFlexCounter;
             std::shared_ptr<swss::ConsumerTable> m_flexCounter;
             std::shared_ptr<swss::ConsumerTable> m_flexCounterGroup;
@@ -497,5 +558,19 @@ namespace syncd
             TimerWatchdog m_timerWatchdog;
 
             std::set<sai_object_id_t> m_createdInInitView;
+
+            std::shared_ptr<saimeta::WorkerPool> m_bulkPrepareWorkerPool;
+
+            /**
+             * @brief Time spent in deserialize and translate of current bulk.
+             */
+            std::chrono::nanoseconds m_bulkPrepareDuration;
+
+            std::shared_ptr<AsicAuditor> m_asicAuditor;
+
+            /**
+             * @brief Background ASIC audit timer, null when disabled.
+             */
+            std::shared_ptr<swss::SelectableTimer> m_asicAuditTimer;
     };
 }
@@ -6,10 +6,14 @@
 
 #include <cinttypes>
 #include <cstring>
+#include <chrono>
 
 using namespace syncd;
+using namespace sairediscommon;
 
-#define MUTEX() std::lock_guard<std::mutex> _lock(m_apimutex)
+#define MUTEX() auto _lock = lockLane(m_programmingLane)
+
+#define STATS_MUTEX() auto _lock = lockLane(m_statsLane)
 
 #define VENDOR_CHECK_API_INITIALIZED()                                       \
     if (!m_apiInitialized) {                                                \
@@ -23,6 +27,11 @@ VendorSai::VendorSai()
     m_apiInitialized = false;
 
     memset(&m_apis, 0, sizeof(m_apis));
+
+    m_programmingLane.m_waitHistogram = &LatencyHistogramRegistry::getHistogram("VendorSai:programming:lockWait");
+    m_statsLane.m_waitHistogram = &LatencyHistogramRegistry::getHistogram("VendorSai:stats:lockWait");
+
+    setLockPolicy(VENDOR_SAI_LOCK_POLICY_GLOBAL);
 }
 
 VendorSai::~VendorSai()
@@ -35,6 +44,76 @@ VendorSai::~VendorSai()
     }
 }
 
+// LOCK POLICY
+
+void VendorSai::setLockPolicy(
+        _In_ vendor_sai_lock_policy_t lockPolicy)
+{
+    SWSS_LOG_ENTER();
+
+    switch (lockPolicy)
+    {
+        case VENDOR_SAI_LOCK_POLICY_GLOBAL:
+            m_programmingLane.m_mutex = &m_apimutex;
+            m_statsLane.m_mutex = &m_apimutex;
+            break;
+
+        case VENDOR_SAI_LOCK_POLICY_LANES:
+            m_programmingLane.m_mutex = &m_apimutex;
+            m_statsLane.m_mutex = &m_statsmutex;
+            break;
+
+        case VENDOR_SAI_LOCK_POLICY_CONCURRENT:
+            m_programmingLane.m_mutex = nullptr;
+            m_statsLane.m_mutex = nullptr;
+            break;
+
+        default:
+            SWSS_LOG_THROW("unknown lock policy: %d", lockPolicy);
+    }
+
+    m_lockPolicy = lockPolicy;
+}
+
+vendor_sai_lock_policy_t VendorSai::getLockPolicy() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_lockPolicy;
+}
+
+std::unique_lock<std::mutex> VendorSai::lockLane(
+        _In_ const Lane& lane)
+{
+    SWSS_LOG_ENTER();
+
+    if (lane.m_mutex == nullptr)
+    {
+        return std::unique_lock<std::mutex>();
+    }
+
+    std::unique_lock<std::mutex> lock(*lane.m_mutex, std::try_to_lock);
+
+    if (lock.owns_lock())
+    {
+        // not contended, skip reading clock
+
+        lane.m_waitHistogram->record(0);
+
+        return lock;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    lock.lock();
+
+    auto wait = std::chrono::steady_clock::now() - start;
+
+    lane.m_waitHistogram->record((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(wait).count());
+
+    return lock;
+}
+
 // INITIALIZE UNINITIALIZE
 
 sai_status_t VendorSai::initialize(
@@ -212,7 +291,7 @@ sai_status_t VendorSai::set(
         _In_ sai_object_id_t objectId,
         _In_ const sai_attribute_t *attr)
 {
-    std::unique_lock<std::mutex> _lock(m_apimutex);
+    MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -248,7 +327,11 @@ sai_status_t VendorSai::set(
     {
         // in case of diagnostic shell, this vendor api can be blocking, so
         // release lock here to not cause deadlock for other events in syncd
-        _lock.unlock();
+
+        if (_lock.owns_lock())
+        {
+            _lock.unlock();
+        }
     }
 
     return info->set(&mk, attr);
@@ -371,7 +454,7 @@ sai_status_t VendorSai::getStats(
         _In_ const sai_stat_id_t *counter_ids,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -462,7 +545,7 @@ sai_status_t VendorSai::queryStatsCapability(
         _In_ sai_object_type_t objectType,
         _Inout_ sai_stat_capability_list_t *stats_capability)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -480,7 +563,7 @@ sai_status_t VendorSai::getStatsExt(
         _In_ sai_stats_mode_t mode,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -567,7 +650,7 @@ sai_status_t VendorSai::clearStats(
         _In_ uint32_t number_of_counters,
         _In_ const sai_stat_id_t *counter_ids)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -657,7 +740,7 @@ sai_status_t VendorSai::bulkGetStats(
         _Inout_ sai_status_t *object_statuses,
         _Out_ uint64_t *counters)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -687,7 +770,7 @@ sai_status_t VendorSai::bulkClearStats(
         _In_ sai_stats_mode_t mode,
         _Inout_ sai_status_t *object_statuses)
 {
-    MUTEX();
+    STATS_MUTEX();
     SWSS_LOG_ENTER();
     VENDOR_CHECK_API_INITIALIZED();
 
@@ -741,6 +824,10 @@ sai_status_t VendorSai::bulkCreate(
             ptr = m_apis.next_hop_group_api->create_next_hop_group_members;
             break;
 
+        case SAI_OBJECT_TYPE_PORT:
+            ptr = m_apis.port_api->create_ports;
+            break;
+
         case SAI_OBJECT_TYPE_SRV6_SIDLIST:
             ptr = m_apis.srv6_api->create_srv6_sidlists;
             break;
@@ -800,6 +887,10 @@ sai_status_t VendorSai::bulkRemove(
             ptr = m_apis.next_hop_group_api->remove_next_hop_group_members;
             break;
 
+        case SAI_OBJECT_TYPE_PORT:
+            ptr = m_apis.port_api->remove_ports;
+            break;
+
         case SAI_OBJECT_TYPE_SRV6_SIDLIST:
             ptr = m_apis.srv6_api->remove_srv6_sidlists;
             break;
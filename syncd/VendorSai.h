@@ -4,7 +4,10 @@ extern "C" {
 #include "sai.h"
 }
 
+#include "VendorSaiLockPolicy.h"
+
 #include "meta/SaiInterface.h"
+#include "meta/LatencyHistogram.h"
 
 #include <string>
 #include <vector>
@@ -201,12 +204,51 @@ namespace syncd
                     _In_ sai_api_t api,
                     _In_ sai_log_level_t log_level) override;
 
+        public:
+
+            /**
+             * @brief Set lock policy used for vendor SAI calls.
+             *
+             * Should be called before initialize, when there are no vendor
+             * calls in progress.
+             */
+            void setLockPolicy(
+                    _In_ vendor_sai_lock_policy_t lockPolicy);
+
+            vendor_sai_lock_policy_t getLockPolicy() const;
+
+        private:
+
+            /**
+             * @brief Group of vendor calls serialized by the same lock.
+             *
+             * Mutex is NULL when lane calls are not serialized.
+             */
+            typedef struct _Lane
+            {
+                std::mutex* m_mutex;
+
+                sairediscommon::LatencyHistogram* m_waitHistogram;
+
+            } Lane;
+
+            std::unique_lock<std::mutex> lockLane(
+                    _In_ const Lane& lane);
+
         private:
 
             bool m_apiInitialized;
 
             std::mutex m_apimutex;
 
+            std::mutex m_statsmutex;
+
+            vendor_sai_lock_policy_t m_lockPolicy;
+
+            Lane m_programmingLane;
+
+            Lane m_statsLane;
+
             sai_service_method_table_t m_service_method_table;
 
             sai_apis_t m_apis;
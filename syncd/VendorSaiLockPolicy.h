@@ -0,0 +1,47 @@
+#pragma once
+
+#define STRING_VENDOR_SAI_LOCK_POLICY_GLOBAL        "global"
+#define STRING_VENDOR_SAI_LOCK_POLICY_LANES         "lanes"
+#define STRING_VENDOR_SAI_LOCK_POLICY_CONCURRENT    "concurrent"
+#define STRING_VENDOR_SAI_LOCK_POLICY_UNKNOWN       "unknown"
+
+/**
+ * @brief Profile key selecting vendor SAI lock policy.
+ *
+ * Used when lock policy is not changed from default on command line.
+ */
+#define SYNCD_PROFILE_KEY_VENDOR_LOCK_POLICY        "SYNCD_VENDOR_LOCK_POLICY"
+
+namespace syncd
+{
+    typedef enum _vendor_sai_lock_policy_t
+    {
+        /**
+         * @brief Single lock serializes all vendor SAI calls.
+         */
+        VENDOR_SAI_LOCK_POLICY_GLOBAL = 0,
+
+        /**
+         * @brief Programming calls (create/remove/set/get, bulk, FDB
+         * flush, MDIO, capability queries) and statistics calls are
+         * serialized on separate locks.
+         *
+         * Statistics reads from flex counter threads will not block
+         * programming on main loop, vendor SAI must be thread safe for
+         * those two groups of calls.
+         */
+        VENDOR_SAI_LOCK_POLICY_LANES = 1,
+
+        /**
+         * @brief No lock, vendor SAI must be fully thread safe.
+         */
+        VENDOR_SAI_LOCK_POLICY_CONCURRENT = 2,
+
+        /**
+         * Set at last, just for error purpose, also used when policy was
+         * not specified.
+         */
+        VENDOR_SAI_LOCK_POLICY_UNKNOWN
+
+    } vendor_sai_lock_policy_t;
+}
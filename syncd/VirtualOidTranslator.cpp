@@ -28,7 +28,7 @@ bool VirtualOidTranslator::tryTranslateRidToVid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
 
     if (rid == SAI_NULL_OBJECT_ID)
     {
@@ -64,7 +64,7 @@ sai_object_id_t VirtualOidTranslator::translateRidToVid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
 
     /*
      * NOTE: switch_vid here is Virtual ID of switch for which we need
@@ -153,7 +153,7 @@ bool VirtualOidTranslator::checkRidExists(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
 
     if (rid == SAI_NULL_OBJECT_ID)
         return true;
@@ -273,8 +273,6 @@ sai_object_id_t VirtualOidTranslator::translateVidToRid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     if (vid == SAI_NULL_OBJECT_ID)
     {
         SWSS_LOG_DEBUG("translated VID null to RID null");
@@ -282,6 +280,24 @@ sai_object_id_t VirtualOidTranslator::translateVidToRid(
         return SAI_NULL_OBJECT_ID;
     }
 
+    {
+        // cache hit is the common case, so lookups done by bulk prepare
+        // worker threads don't block each other
+
+        std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+
+        auto it = m_vid2rid.find(vid);
+
+        if (it != m_vid2rid.end())
+        {
+            return it->second;
+        }
+    }
+
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+
+    // other thread could insert the same VID while lock was released
+
     auto it = m_vid2rid.find(vid);
 
     if (it != m_vid2rid.end())
@@ -338,8 +354,6 @@ bool VirtualOidTranslator::tryTranslateVidToRid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     if (vid == SAI_NULL_OBJECT_ID)
     {
         SWSS_LOG_DEBUG("translated VID null to RID null");
@@ -348,6 +362,25 @@ bool VirtualOidTranslator::tryTranslateVidToRid(
         return true;
     }
 
+    {
+        // cache hit is the common case, so lookups done by bulk prepare
+        // worker threads don't block each other
+
+        std::shared_lock<std::shared_timed_mutex> lock(m_mutex);
+
+        auto it = m_vid2rid.find(vid);
+
+        if (it != m_vid2rid.end())
+        {
+            rid = it->second;
+            return true;
+        }
+    }
+
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
+
+    // other thread could insert the same VID while lock was released
+
     auto it = m_vid2rid.find(vid);
 
     if (it != m_vid2rid.end())
@@ -533,7 +566,7 @@ void VirtualOidTranslator::insertRidAndVid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
 
     // to support multiple switches vid/rid map must be per switch
 
@@ -549,7 +582,7 @@ void VirtualOidTranslator::eraseRidAndVid(
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
 
     m_client->removeVidAndRid(vid, rid);
 
@@ -565,7 +598,7 @@ void VirtualOidTranslator::clearLocalCache()
 {
     SWSS_LOG_ENTER();
 
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::shared_timed_mutex> lock(m_mutex);
 
     m_rid2vid.clear();
     m_vid2rid.clear();
@@ -10,6 +10,7 @@ extern "C"{
 #include "meta/SaiInterface.h"
 
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <memory>
 
@@ -119,7 +120,12 @@ namespace syncd
 
             std::shared_ptr<sairedis::SaiInterface> m_vendorSai;
 
-            std::mutex m_mutex;
+            /**
+             * @brief Guards local caches.
+             *
+             * Cache lookups take shared lock, cache updates exclusive lock.
+             */
+            std::shared_timed_mutex m_mutex;
 
             // those hashes keep mapping from all switches
 
@@ -697,6 +697,27 @@ sub test_multi_switch_key
     play("-p", "$utils::DIR/vsprofile_ctx_multi.ini", "multi_switch_key.rec");
 }
 
+sub test_multi_switch_serial_apply_view
+{
+    fresh_start("-p", "$utils::DIR/vsprofile_ctx_multi.ini", "-g", "0", "-x", "$utils::DIR/ctx_multi.json");
+
+    play("-p", "$utils::DIR/vsprofile_ctx_multi.ini", "multi_switch_key.rec");
+
+    my $parallel = `cat applyview.log`;
+
+    fresh_start("-p", "$utils::DIR/vsprofile_ctx_multi.ini", "-g", "0", "-x", "$utils::DIR/ctx_multi.json", "-V");
+
+    play("-p", "$utils::DIR/vsprofile_ctx_multi.ini", "multi_switch_key.rec");
+
+    my $serial = `cat applyview.log`;
+
+    if ($parallel eq "" or $parallel ne $serial)
+    {
+        print color('red') . "parallel and serial apply view produced different operations" . color('reset') . "\n";
+        exit 1;
+    }
+}
+
 sub test_buffer_profile_get
 {
     fresh_start;
@@ -792,6 +813,7 @@ test_lag_member;
 test_remove_port_serdes;
 test_brcm_warm_new_object_port_serdes;
 test_buffer_profile_get;
+test_multi_switch_serial_apply_view;
 test_multi_switch_key;
 test_ignore_attributes;
 test_sairedis_client;
@@ -0,0 +1,1510 @@
+#include <arpa/inet.h>
+#include <string.h>
+#include <getopt.h>
+#include <errno.h>
+#include <sys/resource.h>
+
+extern "C" {
+#include <sai.h>
+}
+
+#include "lib/Sai.h"
+#include "lib/sairedis.h"
+#include "lib/sairediscommon.h"
+
+#include "syncd/Syncd.h"
+#include "syncd/VendorSai.h"
+#include "syncd/MetadataLogger.h"
+#include "syncd/CommandLineOptions.h"
+#include "syncd/RequestShutdown.h"
+#include "syncd/AsicView.h"
+#include "syncd/BestCandidateFinder.h"
+#include "syncd/VidManager.h"
+#include "syncd/NotificationHandler.h"
+#include "syncd/NotificationProcessor.h"
+#include "syncd/RedisClient.h"
+
+#include "meta/OidRefCounter.h"
+#include "meta/SaiObjectCollection.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+#include "swss/dbconnector.h"
+#include "swss/redisreply.h"
+#include "swss/notificationproducer.h"
+#include "swss/json.hpp"
+
+#include <set>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <limits>
+#include <functional>
+
+/*
+ * End to end benchmark of sairedis client and syncd.
+ *
+ * Syncd is started in a thread of this process on top of virtual switch, and
+ * configured objects are created and removed using sairedis::Sai client,
+ * the same way orchagent is doing it. Redis server must be running locally,
+ * since it's used as ASIC_DB and as a communication channel in redis modes.
+ *
+ * Each phase reports number of operations, throughput, per call latency
+ * percentiles and resident memory of the process, as a single JSON document,
+ * so results of different runs can be compared by scripts.
+ *
+ * In components mode syncd is not started, instead internal components (like
+ * apply view) are exercised directly with synthetic data.
+ */
+
+using namespace syncd;
+
+#define DEFAULT_PROFILE_MAP_FILE "BCM56850/vsprofile.ini"
+
+struct CmdOptions
+{
+    uint32_t neighbors;
+    uint32_t routes;
+    uint32_t nextHopGroups;
+    uint32_t nextHopGroupMembers;
+    uint32_t bulkSize;
+    uint32_t breakoutPorts;
+    bool record;
+    bool latencyHistograms;
+    bool components;
+    sai_redis_communication_mode_t redisCommunicationMode;
+    std::string profileMapFile;
+    std::string outputFile;
+};
+
+static CmdOptions g_cmdOptions;
+
+static std::shared_ptr<sairedis::Sai> g_sai;
+
+static sai_object_id_t g_switchId = SAI_NULL_OBJECT_ID;
+
+void printUsage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << "Usage: benchmark [-n count] [-r count] [-g count] [-m count] [-b size] [-P count] [-z mode] [-R] [-H] [-c] [-p profile] [-o file] [-h]" << std::endl;
+    std::cout << "    -n --neighbors:" << std::endl;
+    std::cout << "        Number of neighbors and next hops to create (default 1000)" << std::endl;
+    std::cout << "    -r --routes:" << std::endl;
+    std::cout << "        Number of routes to create (default 10000)" << std::endl;
+    std::cout << "    -g --nextHopGroups:" << std::endl;
+    std::cout << "        Number of next hop groups to create, routes point to groups when non zero (default 100)" << std::endl;
+    std::cout << "    -m --nextHopGroupMembers:" << std::endl;
+    std::cout << "        Number of members in each next hop group (default 4)" << std::endl;
+    std::cout << "    -b --bulkSize:" << std::endl;
+    std::cout << "        Number of objects in single bulk call, 0 to use single object API (default 0)" << std::endl;
+    std::cout << "    -P --breakoutPorts:" << std::endl;
+    std::cout << "        Number of ports to break out to single lane ports at the end (default 0)" << std::endl;
+    std::cout << "    -z --redisCommunicationMode:" << std::endl;
+    std::cout << "        Redis communication mode (redis_async|redis_sync|zmq_sync), (default redis_async)" << std::endl;
+    std::cout << "    -R --record:" << std::endl;
+    std::cout << "        Enable recording on sairedis client" << std::endl;
+    std::cout << "    -H --disableLatencyHistograms:" << std::endl;
+    std::cout << "        Disable syncd latency histograms, to measure their overhead" << std::endl;
+    std::cout << "    -c --components:" << std::endl;
+    std::cout << "        Benchmark syncd components directly instead of end to end, sized by routes and neighbors" << std::endl;
+    std::cout << "    -p --profile:" << std::endl;
+    std::cout << "        Profile map file used by syncd (default " << DEFAULT_PROFILE_MAP_FILE << ")" << std::endl;
+    std::cout << "    -o --output:" << std::endl;
+    std::cout << "        Write JSON results to file instead of standard output" << std::endl;
+    std::cout << "    -h --help:" << std::endl;
+    std::cout << "        Print out this message" << std::endl;
+}
+
+static uint32_t parseCount(
+        _In_ const char* arg)
+{
+    SWSS_LOG_ENTER();
+
+    char *end = nullptr;
+
+    errno = 0;
+
+    long long value = strtoll(arg, &end, 10);
+
+    if (end == arg || *end != '\0' || errno == ERANGE || value < 0 || value > std::numeric_limits<uint32_t>::max())
+    {
+        SWSS_LOG_ERROR("count must be non negative 32 bit number: %s", arg);
+
+        std::cerr << "invalid count: " << arg << std::endl;
+
+        exit(EXIT_FAILURE);
+    }
+
+    return (uint32_t)value;
+}
+
+CmdOptions handleCmdLine(int argc, char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    CmdOptions options;
+
+    options.neighbors = 1000;
+    options.routes = 10000;
+    options.nextHopGroups = 100;
+    options.nextHopGroupMembers = 4;
+    options.bulkSize = 0;
+    options.breakoutPorts = 0;
+    options.record = false;
+    options.latencyHistograms = true;
+    options.components = false;
+    options.redisCommunicationMode = SAI_REDIS_COMMUNICATION_MODE_REDIS_ASYNC;
+    options.profileMapFile = DEFAULT_PROFILE_MAP_FILE;
+
+    const char* const optstring = "n:r:g:m:b:P:z:RHcp:o:h";
+
+    while (true)
+    {
+        static struct option long_options[] =
+        {
+            { "neighbors",              required_argument, 0, 'n' },
+            { "routes",                 required_argument, 0, 'r' },
+            { "nextHopGroups",          required_argument, 0, 'g' },
+            { "nextHopGroupMembers",    required_argument, 0, 'm' },
+            { "bulkSize",               required_argument, 0, 'b' },
+            { "breakoutPorts",          required_argument, 0, 'P' },
+            { "redisCommunicationMode", required_argument, 0, 'z' },
+            { "record",                 no_argument,       0, 'R' },
+            { "disableLatencyHistograms", no_argument,       0, 'H' },
+            { "components",             no_argument,       0, 'c' },
+            { "profile",                required_argument, 0, 'p' },
+            { "output",                 required_argument, 0, 'o' },
+            { "help",                   no_argument,       0, 'h' },
+            { 0,                        0,                 0,  0  }
+        };
+
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+
+        if (c == -1)
+        {
+            break;
+        }
+
+        switch (c)
+        {
+            case 'n':
+                options.neighbors = parseCount(optarg);
+                break;
+
+            case 'r':
+                options.routes = parseCount(optarg);
+                break;
+
+            case 'g':
+                options.nextHopGroups = parseCount(optarg);
+                break;
+
+            case 'm':
+                options.nextHopGroupMembers = parseCount(optarg);
+                break;
+
+            case 'b':
+                options.bulkSize = parseCount(optarg);
+                break;
+
+            case 'P':
+                options.breakoutPorts = parseCount(optarg);
+                break;
+
+            case 'z':
+                sai_deserialize_redis_communication_mode(optarg, options.redisCommunicationMode);
+                break;
+
+            case 'R':
+                options.record = true;
+                break;
+
+            case 'H':
+                options.latencyHistograms = false;
+                break;
+
+            case 'c':
+                options.components = true;
+                break;
+
+            case 'p':
+                options.profileMapFile = optarg;
+                break;
+
+            case 'o':
+                options.outputFile = optarg;
+                break;
+
+            case 'h':
+                printUsage();
+                exit(EXIT_SUCCESS);
+
+            case '?':
+                SWSS_LOG_WARN("unknown option %c", optopt);
+                printUsage();
+                exit(EXIT_FAILURE);
+
+            default:
+                SWSS_LOG_ERROR("getopt_long failure");
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (options.neighbors == 0 && (options.routes || options.nextHopGroups * options.nextHopGroupMembers))
+    {
+        SWSS_LOG_ERROR("at least one neighbor is required to create routes and next hop group members");
+        exit(EXIT_FAILURE);
+    }
+
+    return options;
+}
+
+static const char* profile_get_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable)
+{
+    SWSS_LOG_ENTER();
+
+    return NULL;
+}
+
+static int profile_get_next_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _Out_ const char** variable,
+        _Out_ const char** value)
+{
+    SWSS_LOG_ENTER();
+
+    return -1;
+}
+
+static sai_service_method_table_t test_services = {
+    profile_get_value,
+    profile_get_next_value
+};
+
+static uint64_t getRssKb()
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream statm("/proc/self/statm");
+
+    uint64_t size = 0;
+    uint64_t resident = 0;
+
+    statm >> size >> resident;
+
+    return resident * (uint64_t)sysconf(_SC_PAGESIZE) / 1024;
+}
+
+static uint64_t getMaxRssKb()
+{
+    SWSS_LOG_ENTER();
+
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    return (uint64_t)usage.ru_maxrss;
+}
+
+static double percentile(
+        _In_ const std::vector<double>& sorted,
+        _In_ double p)
+{
+    SWSS_LOG_ENTER();
+
+    if (sorted.empty())
+    {
+        return 0;
+    }
+
+    return sorted[(size_t)(p * (double)(sorted.size() - 1))];
+}
+
+static void checkStatus(
+        _In_ const std::string& name,
+        _In_ sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_THROW("%s failed: %s", name.c_str(), sai_serialize_status(status).c_str());
+    }
+}
+
+static void checkStatuses(
+        _In_ const std::string& name,
+        _In_ const std::vector<sai_status_t>& statuses)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto status: statuses)
+    {
+        checkStatus(name, status);
+    }
+}
+
+/**
+ * @brief Wait until syncd processed all previous operations.
+ *
+ * GET is always synchronous, so in redis async mode response arrives only
+ * after all previously queued operations were executed by syncd.
+ */
+static void barrier()
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID;
+
+    checkStatus("barrier", g_sai->get(SAI_OBJECT_TYPE_SWITCH, g_switchId, 1, &attr));
+}
+
+/**
+ * @brief Operation executed on objects [index, index + count).
+ */
+typedef std::function<sai_status_t(uint32_t index, uint32_t count)> Operation;
+
+/**
+ * @brief Run operation on all objects and measure it.
+ *
+ * Operation is called for single object at a time, or for bulk size objects
+ * when bulk is enabled. Phase duration includes barrier, so throughput is
+ * end to end also in async mode, where latency measures only client side.
+ */
+static nlohmann::json runPhase(
+        _In_ const std::string& name,
+        _In_ uint32_t objectCount,
+        _In_ const Operation& operation)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t batch = g_cmdOptions.bulkSize ? g_cmdOptions.bulkSize : 1;
+
+    std::vector<double> latencies;
+
+    latencies.reserve(objectCount / batch + 1);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t index = 0; index < objectCount; index += batch)
+    {
+        uint32_t count = std::min(batch, objectCount - index);
+
+        auto begin = std::chrono::steady_clock::now();
+
+        checkStatus(name, operation(index, count));
+
+        auto end = std::chrono::steady_clock::now();
+
+        latencies.push_back(std::chrono::duration<double, std::micro>(end - begin).count());
+    }
+
+    barrier();
+
+    double duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::sort(latencies.begin(), latencies.end());
+
+    nlohmann::json j;
+
+    j["name"] = name;
+    j["ops"] = objectCount;
+    j["calls"] = latencies.size();
+    j["duration_ms"] = duration * 1000;
+    j["ops_per_sec"] = duration > 0 ? objectCount / duration : 0;
+    j["latency_us"]["p50"] = percentile(latencies, 0.5);
+    j["latency_us"]["p99"] = percentile(latencies, 0.99);
+    j["latency_us"]["max"] = latencies.empty() ? 0 : latencies.back();
+    j["rss_kb"] = getRssKb();
+
+    SWSS_LOG_NOTICE("%s: %u ops in %.3f s", name.c_str(), objectCount, duration);
+
+    return j;
+}
+
+static sai_ip_address_t makeIp(
+        _In_ uint32_t index)
+{
+    SWSS_LOG_ENTER();
+
+    sai_ip_address_t ip;
+
+    ip.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    ip.addr.ip4 = htonl(0x0a000000 + index + 1);
+
+    return ip;
+}
+
+static std::vector<sai_neighbor_entry_t> makeNeighbors(
+        _In_ sai_object_id_t rif)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_neighbor_entry_t> neighbors(g_cmdOptions.neighbors);
+
+    for (uint32_t idx = 0; idx < g_cmdOptions.neighbors; idx++)
+    {
+        neighbors[idx].switch_id = g_switchId;
+        neighbors[idx].rif_id = rif;
+        neighbors[idx].ip_address = makeIp(idx);
+    }
+
+    return neighbors;
+}
+
+static std::vector<sai_route_entry_t> makeRoutes(
+        _In_ sai_object_id_t vr)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_route_entry_t> routes(g_cmdOptions.routes);
+
+    for (uint32_t idx = 0; idx < g_cmdOptions.routes; idx++)
+    {
+        routes[idx].switch_id = g_switchId;
+        routes[idx].vr_id = vr;
+        routes[idx].destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        routes[idx].destination.addr.ip4 = htonl(0x14000000 + (idx << 8));
+        routes[idx].destination.mask.ip4 = htonl(0xffffff00);
+    }
+
+    return routes;
+}
+
+/**
+ * @brief Create objects with object id, using single or bulk API.
+ *
+ * Attribute list of each object is provided by attrs function.
+ */
+static sai_status_t createOids(
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t index,
+        _In_ uint32_t count,
+        _In_ const std::function<std::vector<sai_attribute_t>(uint32_t)>& attrs,
+        _Inout_ std::vector<sai_object_id_t>& oids)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::vector<sai_attribute_t>> attrLists;
+    std::vector<const sai_attribute_t*> attrListPtrs;
+    std::vector<uint32_t> attrCounts;
+
+    for (uint32_t idx = index; idx < index + count; idx++)
+    {
+        attrLists.push_back(attrs(idx));
+    }
+
+    for (auto& list: attrLists)
+    {
+        attrListPtrs.push_back(list.data());
+        attrCounts.push_back((uint32_t)list.size());
+    }
+
+    if (g_cmdOptions.bulkSize == 0)
+    {
+        return g_sai->create(objectType, &oids[index], g_switchId, attrCounts[0], attrListPtrs[0]);
+    }
+
+    std::vector<sai_status_t> statuses(count);
+
+    sai_status_t status = g_sai->bulkCreate(objectType, g_switchId, count, attrCounts.data(), attrListPtrs.data(),
+            SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, &oids[index], statuses.data());
+
+    checkStatuses(sai_serialize_object_type(objectType), statuses);
+
+    return status;
+}
+
+static sai_status_t removeOids(
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t index,
+        _In_ uint32_t count,
+        _In_ const std::vector<sai_object_id_t>& oids)
+{
+    SWSS_LOG_ENTER();
+
+    if (g_cmdOptions.bulkSize == 0)
+    {
+        return g_sai->remove(objectType, oids[index]);
+    }
+
+    std::vector<sai_status_t> statuses(count);
+
+    sai_status_t status = g_sai->bulkRemove(objectType, count, &oids[index],
+            SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+
+    checkStatuses(sai_serialize_object_type(objectType), statuses);
+
+    return status;
+}
+
+/**
+ * @brief Create entries with single attribute each, using single or bulk API.
+ */
+template <typename T>
+static sai_status_t createEntries(
+        _In_ const std::vector<T>& entries,
+        _In_ uint32_t index,
+        _In_ uint32_t count,
+        _In_ const std::vector<sai_attribute_t>& attrs)
+{
+    SWSS_LOG_ENTER();
+
+    if (g_cmdOptions.bulkSize == 0)
+    {
+        return g_sai->create(&entries[index], 1, attrs.data());
+    }
+
+    std::vector<uint32_t> attrCounts(count, 1);
+    std::vector<const sai_attribute_t*> attrListPtrs;
+    std::vector<sai_status_t> statuses(count);
+
+    for (auto& attr: attrs)
+    {
+        attrListPtrs.push_back(&attr);
+    }
+
+    sai_status_t status = g_sai->bulkCreate(count, &entries[index], attrCounts.data(), attrListPtrs.data(),
+            SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+
+    checkStatuses("bulk create", statuses);
+
+    return status;
+}
+
+template <typename T>
+static sai_status_t removeEntries(
+        _In_ const std::vector<T>& entries,
+        _In_ uint32_t index,
+        _In_ uint32_t count)
+{
+    SWSS_LOG_ENTER();
+
+    if (g_cmdOptions.bulkSize == 0)
+    {
+        return g_sai->remove(&entries[index]);
+    }
+
+    std::vector<sai_status_t> statuses(count);
+
+    sai_status_t status = g_sai->bulkRemove(count, &entries[index],
+            SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+
+    checkStatuses("bulk remove", statuses);
+
+    return status;
+}
+
+static sai_object_id_t getOid(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ sai_attr_id_t attrId)
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attr;
+
+    attr.id = attrId;
+
+    checkStatus("get " + sai_serialize_object_type(objectType), g_sai->get(objectType, objectId, 1, &attr));
+
+    return attr.value.oid;
+}
+
+static std::vector<sai_object_id_t> getOidList(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ sai_attr_id_t attrId)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_id_t> list(1024);
+
+    sai_attribute_t attr;
+
+    attr.id = attrId;
+    attr.value.objlist.count = (uint32_t)list.size();
+    attr.value.objlist.list = list.data();
+
+    checkStatus("get " + sai_serialize_object_type(objectType), g_sai->get(objectType, objectId, 1, &attr));
+
+    list.resize(attr.value.objlist.count);
+
+    return list;
+}
+
+/**
+ * @brief Remove objects which reference given ports.
+ *
+ * Virtual switch creates vlan member, bridge port and port serdes for each
+ * port, and those must be removed before port is removed, the same way
+ * orchagent is doing it before port breakout.
+ */
+static void removePortDependencies(
+        _In_ const std::vector<sai_object_id_t>& ports)
+{
+    SWSS_LOG_ENTER();
+
+    std::set<sai_object_id_t> portSet(ports.begin(), ports.end());
+
+    std::set<sai_object_id_t> bridgePorts;
+
+    auto bridge = getOid(SAI_OBJECT_TYPE_SWITCH, g_switchId, SAI_SWITCH_ATTR_DEFAULT_1Q_BRIDGE_ID);
+
+    for (auto bp: getOidList(SAI_OBJECT_TYPE_BRIDGE, bridge, SAI_BRIDGE_ATTR_PORT_LIST))
+    {
+        sai_attribute_t attr;
+
+        attr.id = SAI_BRIDGE_PORT_ATTR_PORT_ID;
+
+        // only bridge ports of type port have port id
+
+        if (g_sai->get(SAI_OBJECT_TYPE_BRIDGE_PORT, bp, 1, &attr) == SAI_STATUS_SUCCESS && portSet.count(attr.value.oid))
+        {
+            bridgePorts.insert(bp);
+        }
+    }
+
+    auto vlan = getOid(SAI_OBJECT_TYPE_SWITCH, g_switchId, SAI_SWITCH_ATTR_DEFAULT_VLAN_ID);
+
+    for (auto member: getOidList(SAI_OBJECT_TYPE_VLAN, vlan, SAI_VLAN_ATTR_MEMBER_LIST))
+    {
+        if (bridgePorts.count(getOid(SAI_OBJECT_TYPE_VLAN_MEMBER, member, SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID)))
+        {
+            checkStatus("remove vlan member", g_sai->remove(SAI_OBJECT_TYPE_VLAN_MEMBER, member));
+        }
+    }
+
+    for (auto bp: bridgePorts)
+    {
+        checkStatus("remove bridge port", g_sai->remove(SAI_OBJECT_TYPE_BRIDGE_PORT, bp));
+    }
+
+    for (auto port: ports)
+    {
+        auto serdes = getOid(SAI_OBJECT_TYPE_PORT, port, SAI_PORT_ATTR_PORT_SERDES_ID);
+
+        if (serdes != SAI_NULL_OBJECT_ID)
+        {
+            checkStatus("remove port serdes", g_sai->remove(SAI_OBJECT_TYPE_PORT_SERDES, serdes));
+        }
+    }
+}
+
+/**
+ * @brief Break out last ports of the switch to single lane ports.
+ *
+ * Only port remove and create are measured, since their cost depends on
+ * syncd post port actions, removal of port dependencies is not measured.
+ */
+static void runBreakout(
+        _In_ const std::vector<sai_object_id_t>& switchPorts,
+        _Inout_ nlohmann::json& phases)
+{
+    SWSS_LOG_ENTER();
+
+    // first port is used by router interface
+
+    if (g_cmdOptions.breakoutPorts >= switchPorts.size())
+    {
+        SWSS_LOG_THROW("switch has only %zu ports, can't break out %u ports",
+                switchPorts.size(),
+                g_cmdOptions.breakoutPorts);
+    }
+
+    std::vector<sai_object_id_t> ports(switchPorts.end() - g_cmdOptions.breakoutPorts, switchPorts.end());
+
+    std::vector<uint32_t> lanes;
+
+    for (auto port: ports)
+    {
+        std::vector<uint32_t> list(32);
+
+        sai_attribute_t attr;
+
+        attr.id = SAI_PORT_ATTR_HW_LANE_LIST;
+        attr.value.u32list.count = (uint32_t)list.size();
+        attr.value.u32list.list = list.data();
+
+        checkStatus("get port lanes", g_sai->get(SAI_OBJECT_TYPE_PORT, port, 1, &attr));
+
+        lanes.insert(lanes.end(), list.begin(), list.begin() + attr.value.u32list.count);
+    }
+
+    removePortDependencies(ports);
+
+    barrier();
+
+    auto removePorts = [&](uint32_t index, uint32_t count) -> sai_status_t
+    {
+        return removeOids(SAI_OBJECT_TYPE_PORT, index, count, ports);
+    };
+
+    phases.push_back(runPhase("breakout_remove_port", (uint32_t)ports.size(), removePorts));
+
+    std::vector<sai_object_id_t> newPorts(lanes.size());
+
+    auto portAttrs = [&](uint32_t idx) -> std::vector<sai_attribute_t>
+    {
+        std::vector<sai_attribute_t> list(2);
+
+        list[0].id = SAI_PORT_ATTR_HW_LANE_LIST;
+        list[0].value.u32list.count = 1;
+        list[0].value.u32list.list = &lanes[idx];
+
+        list[1].id = SAI_PORT_ATTR_SPEED;
+        list[1].value.u32 = 10000;
+
+        return list;
+    };
+
+    auto createPorts = [&](uint32_t index, uint32_t count) -> sai_status_t
+    {
+        return createOids(SAI_OBJECT_TYPE_PORT, index, count, portAttrs, newPorts);
+    };
+
+    phases.push_back(runPhase("breakout_create_port", (uint32_t)newPorts.size(), createPorts));
+}
+
+#define SYNCD_READY_TIMEOUT_MS (30 * 1000)
+
+/**
+ * @brief Set by syncd thread when syncd is subscribed to all channels.
+ */
+static std::atomic<bool> g_syncdReady(false);
+
+static void syncdThread()
+{
+    SWSS_LOG_ENTER();
+
+    MetadataLogger::initialize();
+
+    auto vendorSai = std::make_shared<VendorSai>();
+
+    auto commandLineOptions = std::make_shared<CommandLineOptions>();
+
+    commandLineOptions->m_disableExitSleep = true;
+    commandLineOptions->m_enableSaiBulkSupport = g_cmdOptions.bulkSize != 0;
+    commandLineOptions->m_redisCommunicationMode = g_cmdOptions.redisCommunicationMode;
+    commandLineOptions->m_profileMapFile = g_cmdOptions.profileMapFile;
+    commandLineOptions->m_disableLatencyHistograms = !g_cmdOptions.latencyHistograms;
+
+    auto syncd = std::make_shared<Syncd>(vendorSai, commandLineOptions, false);
+
+    // channels are subscribed in constructor, requests sent from now on will
+    // be processed when run loop starts
+
+    g_syncdReady = true;
+
+    syncd->run();
+}
+
+static nlohmann::json runBenchmark()
+{
+    SWSS_LOG_ENTER();
+
+    nlohmann::json phases = nlohmann::json::array();
+
+    g_sai = std::make_shared<sairedis::Sai>();
+
+    checkStatus("initialize", g_sai->initialize(0, &test_services));
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_RECORD;
+    attr.value.booldata = g_cmdOptions.record;
+
+    checkStatus("set record", g_sai->set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+
+    attr.id = SAI_REDIS_SWITCH_ATTR_REDIS_COMMUNICATION_MODE;
+    attr.value.s32 = g_cmdOptions.redisCommunicationMode;
+
+    checkStatus("set communication mode", g_sai->set(SAI_OBJECT_TYPE_SWITCH, SAI_NULL_OBJECT_ID, &attr));
+
+    auto createSwitch = [&](uint32_t index, uint32_t count) -> sai_status_t
+    {
+        sai_attribute_t initAttr;
+
+        initAttr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+        initAttr.value.booldata = true;
+
+        return g_sai->create(SAI_OBJECT_TYPE_SWITCH, &g_switchId, SAI_NULL_OBJECT_ID, 1, &initAttr);
+    };
+
+    phases.push_back(runPhase("create_switch", 1, createSwitch));
+
+    sai_attribute_t attrs[3];
+
+    attrs[0].id = SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID;
+
+    checkStatus("get virtual router", g_sai->get(SAI_OBJECT_TYPE_SWITCH, g_switchId, 1, attrs));
+
+    sai_object_id_t vr = attrs[0].value.oid;
+
+    std::vector<sai_object_id_t> ports(1024);
+
+    attrs[0].id = SAI_SWITCH_ATTR_PORT_LIST;
+    attrs[0].value.objlist.count = (uint32_t)ports.size();
+    attrs[0].value.objlist.list = ports.data();
+
+    checkStatus("get port list", g_sai->get(SAI_OBJECT_TYPE_SWITCH, g_switchId, 1, attrs));
+
+    ports.resize(attrs[0].value.objlist.count);
+
+    attrs[0].id = SAI_ROUTER_INTERFACE_ATTR_VIRTUAL_ROUTER_ID;
+    attrs[0].value.oid = vr;
+
+    attrs[1].id = SAI_ROUTER_INTERFACE_ATTR_TYPE;
+    attrs[1].value.s32 = SAI_ROUTER_INTERFACE_TYPE_PORT;
+
+    attrs[2].id = SAI_ROUTER_INTERFACE_ATTR_PORT_ID;
+    attrs[2].value.oid = ports[0];
+
+    sai_object_id_t rif;
+
+    checkStatus("create router interface", g_sai->create(SAI_OBJECT_TYPE_ROUTER_INTERFACE, &rif, g_switchId, 3, attrs));
+
+    auto neighbors = makeNeighbors(rif);
+    auto routes = makeRoutes(vr);
+
+    std::vector<sai_object_id_t> nextHops(g_cmdOptions.neighbors);
+    std::vector<sai_object_id_t> groups(g_cmdOptions.nextHopGroups);
+    std::vector<sai_object_id_t> members(g_cmdOptions.nextHopGroups * g_cmdOptions.nextHopGroupMembers);
+
+    auto createNeighbors = [&](uint32_t index, uint32_t count) -> sai_status_t
+    {
+        std::vector<sai_attribute_t> list(count);
+
+        for (uint32_t idx = 0; idx < count; idx++)
+        {
+            list[idx].id = SAI_NEIGHBOR_ENTRY_ATTR_DST_MAC_ADDRESS;
+
+            sai_mac_t mac = { 0x02, 0x00, (uint8_t)((index + idx) >> 16), (uint8_t)((index + idx) >> 8), (uint8_t)(index + idx), 0x01 };
+
+            memcpy(list[idx].value.mac, mac, sizeof(mac));
+        }
+
+        return createEntries(neighbors, index, count, list);
+    };
+
+    phases.push_back(runPhase("create_neighbor", g_cmdOptions.neighbors, createNeighbors));
+
+    auto nextHopAttrs = [&](uint32_t idx) -> std::vector<sai_attribute_t>
+    {
+        std::vector<sai_attribute_t> list(3);
+
+        list[0].id = SAI_NEXT_HOP_ATTR_TYPE;
+        list[0].value.s32 = SAI_NEXT_HOP_TYPE_IP;
+
+        list[1].id = SAI_NEXT_HOP_ATTR_IP;
+        list[1].value.ipaddr = makeIp(idx);
+
+        list[2].id = SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID;
+        list[2].value.oid = rif;
+
+        return list;
+    };
+
+    auto createNextHops = [&](uint32_t index, uint32_t count) -> sai_status_t
+    {
+        return createOids(SAI_OBJECT_TYPE_NEXT_HOP, index, count, nextHopAttrs, nextHops);
+    };
+
+    phases.push_back(runPhase("create_next_hop", g_cmdOptions.neighbors, createNextHops));
+
+    auto groupAttrs = [&](uint32_t idx) -> std::vector<sai_attribute_t>
+    {
+        std::vector<sai_attribute_t> list(1);
+
+        list[0].id = SAI_NEXT_HOP_GROUP_ATTR_TYPE;
+        list[0].value.s32 = SAI_NEXT_HOP_GROUP_TYPE_DYNAMIC_UNORDERED_ECMP;
+
+        return list;
+    };
+
+    auto createGroups = [&](uint32_t index, uint32_t count) -> sai_status_t
+    {
+        return createOids(SAI_OBJECT_TYPE_NEXT_HOP_GROUP, index, count, groupAttrs, groups);
+    };
+
+    phases.push_back(runPhase("create_next_hop_group", g_cmdOptions.nextHopGroups, createGroups));
+
+    auto memberAttrs = [&](uint32_t idx) -> std::vector<sai_attribute_t>
+    {
+        std::vector<sai_attribute_t> list(2);
+
+        list[0].id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_GROUP_ID;
+        list[0].value.oid = groups[idx / g_cmdOptions.nextHopGroupMembers];
+
+        list[1].id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+        list[1].value.oid = nextHops[idx % nextHops.size()];
+
+        return list;
+    };
+
+    auto createMembers = [&](uint32_t index, uint32_t count) -> sai_status_t
+    {
+        return createOids(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, index, count, memberAttrs, members);
+    };
+
+    phases.push_back(runPhase("create_next_hop_group_member", (uint32_t)members.size(), createMembers));
+
+    auto createRoutes = [&](uint32_t index, uint32_t count) -> sai_status_t
+    {
+        std::vector<sai_attribute_t> list(count);
+
+        for (uint32_t idx = 0; idx < count; idx++)
+        {
+            list[idx].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+            list[idx].value.oid = groups.size()
+                ? groups[(index + idx) % groups.size()]
+                : nextHops[(index + idx) % nextHops.size()];
+        }
+
+        return createEntries(routes, index, count, list);
+    };
+
+    phases.push_back(runPhase("create_route", g_cmdOptions.routes, createRoutes));
+
+    auto removeRoutes = [&](uint32_t index, uint32_t count) -> sai_status_t
+    {
+        return removeEntries(routes, index, count);
+    };
+
+    phases.push_back(runPhase("remove_route", g_cmdOptions.routes, removeRoutes));
+
+    auto removeMembers = [&](uint32_t index, uint32_t count) -> sai_status_t
+    {
+        return removeOids(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, index, count, members);
+    };
+
+    phases.push_back(runPhase("remove_next_hop_group_member", (uint32_t)members.size(), removeMembers));
+
+    auto removeGroups = [&](uint32_t index, uint32_t count) -> sai_status_t
+    {
+        return removeOids(SAI_OBJECT_TYPE_NEXT_HOP_GROUP, index, count, groups);
+    };
+
+    phases.push_back(runPhase("remove_next_hop_group", g_cmdOptions.nextHopGroups, removeGroups));
+
+    auto removeNextHops = [&](uint32_t index, uint32_t count) -> sai_status_t
+    {
+        return removeOids(SAI_OBJECT_TYPE_NEXT_HOP, index, count, nextHops);
+    };
+
+    phases.push_back(runPhase("remove_next_hop", g_cmdOptions.neighbors, removeNextHops));
+
+    auto removeNeighbors = [&](uint32_t index, uint32_t count) -> sai_status_t
+    {
+        return removeEntries(neighbors, index, count);
+    };
+
+    phases.push_back(runPhase("remove_neighbor", g_cmdOptions.neighbors, removeNeighbors));
+
+    if (g_cmdOptions.breakoutPorts)
+    {
+        runBreakout(ports, phases);
+    }
+
+    g_sai->uninitialize();
+
+    return phases;
+}
+
+/**
+ * @brief Create result of component phase.
+ *
+ * Component phases are executed as single operation, so there are no per
+ * call latencies.
+ */
+static nlohmann::json componentPhase(
+        _In_ const std::string& name,
+        _In_ uint32_t objectCount,
+        _In_ std::chrono::steady_clock::duration duration)
+{
+    SWSS_LOG_ENTER();
+
+    double seconds = std::chrono::duration<double>(duration).count();
+
+    nlohmann::json j;
+
+    j["name"] = name;
+    j["ops"] = objectCount;
+    j["duration_ms"] = seconds * 1000;
+    j["ops_per_sec"] = seconds > 0 ? objectCount / seconds : 0;
+    j["rss_kb"] = getRssKb();
+
+    SWSS_LOG_NOTICE("%s: %u ops in %.3f s", name.c_str(), objectCount, seconds);
+
+    return j;
+}
+
+static sai_object_id_t makeVid(
+        _In_ sai_object_type_t objectType,
+        _In_ uint64_t index)
+{
+    SWSS_LOG_ENTER();
+
+    // switch index 0, object type on bits 48..55
+
+    return (((uint64_t)objectType) << 48) | index;
+}
+
+/**
+ * @brief Build ASIC view with routes pointing to few next hops.
+ *
+ * Reports view build time and RSS growth while view is alive.
+ */
+static nlohmann::json runAsicViewBuild()
+{
+    SWSS_LOG_ENTER();
+
+    const uint32_t nextHopCount = 16;
+
+    sai_object_id_t switchVid = makeVid(SAI_OBJECT_TYPE_SWITCH, 0);
+    sai_object_id_t vrVid = makeVid(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, 1);
+
+    swss::TableDump dump;
+
+    dump[sai_serialize_object_type(SAI_OBJECT_TYPE_SWITCH) + ":" + sai_serialize_object_id(switchVid)]["NULL"] = "NULL";
+    dump[sai_serialize_object_type(SAI_OBJECT_TYPE_VIRTUAL_ROUTER) + ":" + sai_serialize_object_id(vrVid)]["NULL"] = "NULL";
+
+    std::vector<std::string> nextHops;
+
+    for (uint32_t idx = 0; idx < nextHopCount; ++idx)
+    {
+        auto nh = sai_serialize_object_id(makeVid(SAI_OBJECT_TYPE_NEXT_HOP, 0x100 + idx));
+
+        dump[sai_serialize_object_type(SAI_OBJECT_TYPE_NEXT_HOP) + ":" + nh]["NULL"] = "NULL";
+
+        nextHops.push_back(nh);
+    }
+
+    for (uint32_t idx = 0; idx < g_cmdOptions.routes; ++idx)
+    {
+        sai_route_entry_t route;
+
+        memset(&route, 0, sizeof(route));
+
+        route.switch_id = switchVid;
+        route.vr_id = vrVid;
+        route.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        route.destination.addr.ip4 = htonl(0x0a000000 | idx);
+        route.destination.mask.ip4 = 0xffffffff;
+
+        auto key = sai_serialize_object_type(SAI_OBJECT_TYPE_ROUTE_ENTRY) + ":" + sai_serialize_route_entry(route);
+
+        dump[key]["SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID"] = nextHops[idx % nextHopCount];
+        dump[key]["SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION"] = "SAI_PACKET_ACTION_FORWARD";
+    }
+
+    auto rss = getRssKb();
+
+    auto start = std::chrono::steady_clock::now();
+
+    AsicView view(dump);
+
+    auto j = componentPhase("asic_view_build", (uint32_t)dump.size(), std::chrono::steady_clock::now() - start);
+
+    j["rss_delta_kb"] = (int64_t)getRssKb() - (int64_t)rss;
+
+    return j;
+}
+
+static void populateNextHops(
+        _Inout_ AsicView& view,
+        _In_ uint32_t count,
+        _In_ uint64_t vidOffset)
+{
+    SWSS_LOG_ENTER();
+
+    swss::TableDump dump;
+
+    sai_object_id_t rifVid = makeVid(SAI_OBJECT_TYPE_ROUTER_INTERFACE, 1);
+
+    dump[sai_serialize_object_type(SAI_OBJECT_TYPE_ROUTER_INTERFACE) + ":" + sai_serialize_object_id(rifVid)]["NULL"] = "NULL";
+
+    for (uint32_t idx = 0; idx < count; ++idx)
+    {
+        sai_object_id_t vid = makeVid(SAI_OBJECT_TYPE_NEXT_HOP, vidOffset + idx);
+
+        sai_ip_address_t ip;
+
+        ip.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+        ip.addr.ip4 = htonl(0x0a000000 | idx);
+
+        auto key = sai_serialize_object_type(SAI_OBJECT_TYPE_NEXT_HOP) + ":" + sai_serialize_object_id(vid);
+
+        dump[key]["SAI_NEXT_HOP_ATTR_TYPE"] = "SAI_NEXT_HOP_TYPE_IP";
+        dump[key]["SAI_NEXT_HOP_ATTR_IP"] = sai_serialize_ip_address(ip);
+        dump[key]["SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID"] = sai_serialize_object_id(rifVid);
+
+        // current view objects exist on ASIC
+
+        if (vidOffset == 0)
+        {
+            view.m_vidToRid[vid] = 0x1000 + idx;
+        }
+    }
+
+    view.fromDump(dump);
+
+    // router interface is already matched in both views
+
+    view.m_vidToRid[rifVid] = 0x1;
+    view.m_ridToVid[0x1] = rifVid;
+}
+
+/**
+ * @brief Find best current match for each temporary next hop.
+ *
+ * Both views contain the same next hops, so each lookup finds object with
+ * all attributes equal, which is the common case on warm restart.
+ */
+static nlohmann::json runBestCandidateFinder()
+{
+    SWSS_LOG_ENTER();
+
+    AsicView current;
+    AsicView temporary;
+
+    populateNextHops(current, g_cmdOptions.neighbors, 0);
+    populateNextHops(temporary, g_cmdOptions.neighbors, 0x100000);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (auto& tmp: temporary.getObjectsByObjectType(SAI_OBJECT_TYPE_NEXT_HOP))
+    {
+        BestCandidateFinder bcf(current, temporary, nullptr);
+
+        auto cur = bcf.findCurrentBestMatch(tmp);
+
+        if (cur == nullptr)
+        {
+            SWSS_LOG_THROW("no match found for %s", tmp->m_str_object_id.c_str());
+        }
+
+        cur->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
+        tmp->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
+    }
+
+    return componentPhase("best_candidate_next_hop", g_cmdOptions.neighbors, std::chrono::steady_clock::now() - start);
+}
+
+/**
+ * @brief Remove one of two switches from metadata reference counter and
+ * object collection.
+ *
+ * Objects are partitioned per switch, so only objects of removed switch
+ * are visited.
+ */
+static nlohmann::json runMetaSwitchRemove()
+{
+    SWSS_LOG_ENTER();
+
+    const uint64_t count = g_cmdOptions.routes;
+
+    saimeta::OidRefCounter oids;
+    saimeta::SaiObjectCollection objects;
+
+    oids.setSwitchIdQuery(VidManager::switchIdQuery);
+    objects.setSwitchIdQuery(VidManager::switchIdQuery);
+
+    std::vector<sai_object_id_t> switches;
+
+    for (uint64_t switchIndex = 0; switchIndex < 2; switchIndex++)
+    {
+        sai_object_id_t switchId = (switchIndex << 56) | makeVid(SAI_OBJECT_TYPE_SWITCH, switchIndex);
+
+        switches.push_back(switchId);
+
+        for (uint64_t idx = 1; idx <= count; idx++)
+        {
+            sai_object_meta_key_t mk;
+
+            mk.objecttype = SAI_OBJECT_TYPE_NEXT_HOP;
+            mk.objectkey.key.object_id = (switchIndex << 56) | makeVid(SAI_OBJECT_TYPE_NEXT_HOP, idx);
+
+            oids.objectReferenceInsert(mk.objectkey.key.object_id);
+            objects.createObject(mk);
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    oids.removeSwitch(switches.at(0));
+    objects.removeSwitch(switches.at(0));
+
+    auto j = componentPhase("meta_switch_remove", (uint32_t)count, std::chrono::steady_clock::now() - start);
+
+    if (oids.getAllOids().size() != count)
+    {
+        SWSS_LOG_THROW("expected %lu oids after switch remove", (unsigned long)count);
+    }
+
+    return j;
+}
+
+/**
+ * @brief Send FDB learn events through notification handler, queue and
+ * processing thread.
+ *
+ * Each notification is serialized once, like before sending it to OA.
+ */
+static nlohmann::json runNotificationStorm()
+{
+    SWSS_LOG_ENTER();
+
+    const uint32_t count = g_cmdOptions.routes;
+
+    std::atomic<uint32_t> processed(0);
+
+    auto processor = std::make_shared<NotificationProcessor>(nullptr, nullptr, [&](NotificationData& ntf) {
+
+            auto s = ntf.serialize();
+
+            processed++;
+    });
+
+    NotificationHandler handler(processor);
+
+    processor->startNotificationsProcessingThread();
+
+    sai_attribute_t attrs[2];
+
+    attrs[0].id = SAI_FDB_ENTRY_ATTR_TYPE;
+    attrs[0].value.s32 = SAI_FDB_ENTRY_TYPE_DYNAMIC;
+    attrs[1].id = SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID;
+    attrs[1].value.oid = makeVid(SAI_OBJECT_TYPE_BRIDGE_PORT, 1);
+
+    sai_fdb_event_notification_data_t data;
+
+    memset(&data, 0, sizeof(data));
+
+    data.event_type = SAI_FDB_EVENT_LEARNED;
+    data.fdb_entry.switch_id = makeVid(SAI_OBJECT_TYPE_SWITCH, 0);
+    data.fdb_entry.bv_id = makeVid(SAI_OBJECT_TYPE_VLAN, 1);
+    data.attr_count = 2;
+    data.attr = attrs;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        data.fdb_entry.mac_address[3] = (uint8_t)(idx >> 16);
+        data.fdb_entry.mac_address[4] = (uint8_t)(idx >> 8);
+        data.fdb_entry.mac_address[5] = (uint8_t)idx;
+
+        handler.onFdbEvent(1, &data);
+    }
+
+    while (processed < count)
+    {
+        processor->signal();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    auto j = componentPhase("notification_fdb_event", count, std::chrono::steady_clock::now() - start);
+
+    processor->stopNotificationsProcessingThread();
+
+    return j;
+}
+
+/**
+ * @brief Flush dynamic FDB entries of one port and vlan from ASIC DB.
+ *
+ * Operates on ASIC_DB, so redis server must be running.
+ */
+static void runFdbFlush(
+        _Inout_ nlohmann::json& phases)
+{
+    SWSS_LOG_ENTER();
+
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::RedisReply r(dbAsic.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    r.checkStatusOK();
+
+    RedisClient client(dbAsic);
+
+    sai_object_id_t switchId = makeVid(SAI_OBJECT_TYPE_SWITCH, 0);
+    sai_object_id_t bvId = makeVid(SAI_OBJECT_TYPE_VLAN, 1);
+    sai_object_id_t portId = makeVid(SAI_OBJECT_TYPE_BRIDGE_PORT, 1);
+
+    // first flush builds index from ASIC DB
+
+    client.processFlushEvent(switchId, SAI_NULL_OBJECT_ID, SAI_NULL_OBJECT_ID, SAI_FDB_FLUSH_ENTRY_TYPE_ALL);
+
+    for (uint32_t count: { 1000, 16000, 64000 })
+    {
+        std::unordered_map<std::string, std::vector<swss::FieldValueTuple>> multiHash;
+
+        for (uint32_t idx = 0; idx < count; idx++)
+        {
+            sai_object_meta_key_t mk;
+
+            mk.objecttype = SAI_OBJECT_TYPE_FDB_ENTRY;
+
+            memset(&mk.objectkey.key.fdb_entry, 0, sizeof(mk.objectkey.key.fdb_entry));
+
+            mk.objectkey.key.fdb_entry.switch_id = switchId;
+            mk.objectkey.key.fdb_entry.bv_id = bvId;
+            mk.objectkey.key.fdb_entry.mac_address[3] = (uint8_t)(idx >> 16);
+            mk.objectkey.key.fdb_entry.mac_address[4] = (uint8_t)(idx >> 8);
+            mk.objectkey.key.fdb_entry.mac_address[5] = (uint8_t)idx;
+
+            auto& values = multiHash[sai_serialize_object_meta_key(mk)];
+
+            values.emplace_back("SAI_FDB_ENTRY_ATTR_TYPE", "SAI_FDB_ENTRY_TYPE_DYNAMIC");
+            values.emplace_back("SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID", sai_serialize_object_id(portId));
+        }
+
+        client.createAsicObjects(multiHash);
+
+        auto start = std::chrono::steady_clock::now();
+
+        client.processFlushEvent(switchId, portId, bvId, SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC);
+
+        phases.push_back(componentPhase("fdb_flush", count, std::chrono::steady_clock::now() - start));
+
+        auto left = dbAsic->keys(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_FDB_ENTRY:*");
+
+        if (left.size())
+        {
+            SWSS_LOG_THROW("%zu fdb entries left after flush", left.size());
+        }
+    }
+}
+
+static nlohmann::json runComponents()
+{
+    SWSS_LOG_ENTER();
+
+    nlohmann::json phases = nlohmann::json::array();
+
+    phases.push_back(runAsicViewBuild());
+
+    phases.push_back(runBestCandidateFinder());
+
+    phases.push_back(runMetaSwitchRemove());
+
+    phases.push_back(runNotificationStorm());
+
+    runFdbFlush(phases);
+
+    return phases;
+}
+
+static void writeResults(
+        _In_ const nlohmann::json& j)
+{
+    SWSS_LOG_ENTER();
+
+    if (g_cmdOptions.outputFile.empty())
+    {
+        std::cout << j.dump(4) << std::endl;
+    }
+    else
+    {
+        std::ofstream out(g_cmdOptions.outputFile);
+
+        out << j.dump(4) << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_WARN);
+
+    g_cmdOptions = handleCmdLine(argc, argv);
+
+    nlohmann::json j;
+
+    j["config"]["neighbors"] = g_cmdOptions.neighbors;
+    j["config"]["routes"] = g_cmdOptions.routes;
+    j["config"]["next_hop_groups"] = g_cmdOptions.nextHopGroups;
+    j["config"]["next_hop_group_members"] = g_cmdOptions.nextHopGroupMembers;
+    j["config"]["bulk_size"] = g_cmdOptions.bulkSize;
+    j["config"]["breakout_ports"] = g_cmdOptions.breakoutPorts;
+    j["config"]["record"] = g_cmdOptions.record;
+    j["config"]["latency_histograms"] = g_cmdOptions.latencyHistograms;
+    j["config"]["components"] = g_cmdOptions.components;
+    j["config"]["redis_communication_mode"] = sai_serialize_redis_communication_mode(g_cmdOptions.redisCommunicationMode);
+
+    if (g_cmdOptions.components)
+    {
+        j["phases"] = runComponents();
+
+        j["max_rss_kb"] = getMaxRssKb();
+
+        writeResults(j);
+
+        return EXIT_SUCCESS;
+    }
+
+    // start from empty ASIC_DB, so previous runs don't affect results
+
+    swss::DBConnector db("ASIC_DB", 0);
+
+    swss::RedisReply r(&db, "FLUSHDB", REDIS_REPLY_STATUS);
+
+    r.checkStatusOK();
+
+    auto syncd = std::make_shared<std::thread>(syncdThread);
+
+    // there is no notification when syncd is ready, poll until it's created
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(SYNCD_READY_TIMEOUT_MS);
+
+    while (!g_syncdReady)
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            SWSS_LOG_ERROR("syncd not ready after %d ms", SYNCD_READY_TIMEOUT_MS);
+
+            std::cerr << "syncd not ready" << std::endl;
+
+            exit(EXIT_FAILURE);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    j["phases"] = runBenchmark();
+
+    // request cold shutdown, syncd will remove switch and exit run loop
+
+    swss::NotificationProducer restartQuery(&db, SYNCD_NOTIFICATION_CHANNEL_RESTARTQUERY);
+
+    auto op = RequestShutdownCommandLineOptions::restartTypeToString(SYNCD_RESTART_TYPE_COLD);
+
+    restartQuery.send(op, op, {});
+
+    syncd->join();
+
+    j["max_rss_kb"] = getMaxRssKb();
+
+    writeResults(j);
+
+    return EXIT_SUCCESS;
+}
@@ -1,13 +1,23 @@
 #include "ClientServerSai.h"
 
 #include "sairedis.h"
+#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
 
 #include "swss/logger.h"
+#include "swss/dbconnector.h"
+#include "swss/redisreply.h"
+#include "swss/consumertable.h"
+#include "swss/producertable.h"
+#include "swss/select.h"
 
 #include <gtest/gtest.h>
 
 #include <arpa/inet.h>
 
+#include <thread>
+
 using namespace sairedis;
 
 static const char* profile_get_value(
@@ -130,25 +140,27 @@ TEST(ClientServerSai, bulkGetClearStats)
 
     EXPECT_EQ(SAI_STATUS_SUCCESS, css->initialize(0, &test_services));
 
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, css->bulkGetStats(SAI_NULL_OBJECT_ID,
-                                                            SAI_OBJECT_TYPE_PORT,
-                                                            0,
-                                                            nullptr,
-                                                            0,
-                                                            nullptr,
-                                                            SAI_STATS_MODE_BULK_READ,
-                                                            nullptr,
-                                                            nullptr));
+    // passed to metadata validation
 
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, css->bulkClearStats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, css->bulkGetStats(SAI_NULL_OBJECT_ID,
                                                               SAI_OBJECT_TYPE_PORT,
                                                               0,
                                                               nullptr,
                                                               0,
                                                               nullptr,
-                                                              SAI_STATS_MODE_BULK_CLEAR,
+                                                              SAI_STATS_MODE_BULK_READ,
+                                                              nullptr,
                                                               nullptr));
 
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, css->bulkClearStats(SAI_NULL_OBJECT_ID,
+                                                                SAI_OBJECT_TYPE_PORT,
+                                                                0,
+                                                                nullptr,
+                                                                0,
+                                                                nullptr,
+                                                                SAI_STATS_MODE_BULK_CLEAR,
+                                                                nullptr));
+
     css = std::make_shared<ClientServerSai>();
     EXPECT_EQ(SAI_STATUS_SUCCESS, css->initialize(0, &test_client_services));
 
@@ -172,6 +184,143 @@ TEST(ClientServerSai, bulkGetClearStats)
                                                               nullptr));
 }
 
+/**
+ * @brief Respond to given number of bulk stats requests like syncd does.
+ *
+ * Each object gets counter value object_index * 100 + counter_index, and
+ * last object gets SAI_STATUS_INVALID_OBJECT_ID.
+ */
+static void respondBulkStats(
+        _In_ std::shared_ptr<swss::ConsumerTable> asicState,
+        _In_ std::shared_ptr<swss::ProducerTable> getResponse,
+        _In_ uint32_t numberOfCounters,
+        _In_ int requests)
+{
+    SWSS_LOG_ENTER();
+
+    swss::Select s;
+
+    s.addSelectable(asicState.get());
+
+    // give up after client response timeout passed
+
+    int timeouts = 0;
+
+    while (requests > 0 && timeouts < 90)
+    {
+        swss::Selectable *sel = nullptr;
+
+        if (s.select(&sel, 1000) != swss::Select::OBJECT)
+        {
+            timeouts++;
+            continue;
+        }
+
+        swss::KeyOpFieldsValuesTuple kco;
+
+        asicState->pop(kco);
+
+        auto& op = kfvOp(kco);
+
+        if (op != REDIS_ASIC_STATE_COMMAND_BULK_GET_STATS && op != REDIS_ASIC_STATE_COMMAND_BULK_CLEAR_STATS)
+        {
+            continue; // create switch and counters
+        }
+
+        requests--;
+
+        auto& values = kfvFieldsValues(kco);
+
+        uint32_t objectCount = (uint32_t)values.size() - 1;
+
+        std::vector<uint64_t> ids(numberOfCounters);
+
+        // throws if request carries different number of counter ids
+
+        sai_deserialize_counter_list(fvValue(values[0]), numberOfCounters, ids.data());
+
+        std::vector<swss::FieldValueTuple> entries;
+
+        for (uint32_t idx = 0; idx < objectCount; idx++)
+        {
+            if (idx == objectCount - 1)
+            {
+                entries.emplace_back(sai_serialize_status(SAI_STATUS_INVALID_OBJECT_ID), "");
+                continue;
+            }
+
+            std::vector<uint64_t> counters;
+
+            for (uint32_t c = 0; op == REDIS_ASIC_STATE_COMMAND_BULK_GET_STATS && c < numberOfCounters; c++)
+            {
+                counters.push_back(idx * 100 + c);
+            }
+
+            entries.emplace_back(sai_serialize_status(SAI_STATUS_SUCCESS),
+                    sai_serialize_counter_list((uint32_t)counters.size(), counters.data()));
+        }
+
+        getResponse->set(sai_serialize_status(SAI_STATUS_SUCCESS), entries, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+    }
+}
+
+TEST(ClientServerSai, bulkGetClearStatsRoundTrip)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::RedisReply r(db.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    auto asicState = std::make_shared<swss::ConsumerTable>(db.get(), ASIC_STATE_TABLE);
+    auto getResponse = std::make_shared<swss::ProducerTable>(db.get(), REDIS_TABLE_GETRESPONSE);
+
+    std::thread responder(respondBulkStats, asicState, getResponse, 2, 2);
+
+    auto css = std::make_shared<ClientServerSai>();
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, css->initialize(0, &test_services));
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    sai_object_id_t switchId;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, css->create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr));
+
+    sai_object_key_t keys[3];
+
+    for (int idx = 0; idx < 3; idx++)
+    {
+        EXPECT_EQ(SAI_STATUS_SUCCESS, css->create(SAI_OBJECT_TYPE_COUNTER, &keys[idx].key.object_id, switchId, 0, nullptr));
+    }
+
+    sai_stat_id_t ids[2] = { SAI_COUNTER_STAT_PACKETS, SAI_COUNTER_STAT_BYTES };
+
+    sai_status_t statuses[3];
+
+    uint64_t counters[3 * 2] = { 0 };
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, css->bulkGetStats(switchId, SAI_OBJECT_TYPE_COUNTER, 3, keys, 2, ids, SAI_STATS_MODE_BULK_READ, statuses, counters));
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[0]);
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[1]);
+    EXPECT_EQ(SAI_STATUS_INVALID_OBJECT_ID, statuses[2]);
+
+    EXPECT_EQ(0, counters[0]);
+    EXPECT_EQ(1, counters[1]);
+    EXPECT_EQ(100, counters[2]);
+    EXPECT_EQ(101, counters[3]);
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, css->bulkClearStats(switchId, SAI_OBJECT_TYPE_COUNTER, 3, keys, 2, ids, SAI_STATS_MODE_BULK_CLEAR, statuses));
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[0]);
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[1]);
+    EXPECT_EQ(SAI_STATUS_INVALID_OBJECT_ID, statuses[2]);
+
+    responder.join();
+}
+
 TEST(ClientServerSai, bulk_neighbor_op)
 {
     auto css = std::make_shared<ClientServerSai>();
@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
 using namespace sairedis;
 
 static sai_switch_notifications_t handle_notification(
@@ -38,21 +40,62 @@ TEST(Context, bulkGetClearStats)
 
     auto ctx = std::make_shared<Context>(cc, recorder,handle_notification);
 
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, ctx->m_redisSai->bulkGetStats(SAI_NULL_OBJECT_ID,
+    // rejected by metadata before request is sent to syncd
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, ctx->m_meta->bulkGetStats(SAI_NULL_OBJECT_ID,
+                                                                      SAI_OBJECT_TYPE_PORT,
+                                                                      0,
+                                                                      nullptr,
+                                                                      0,
+                                                                      nullptr,
+                                                                      SAI_STATS_MODE_BULK_READ,
+                                                                      nullptr,
+                                                                      nullptr));
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, ctx->m_meta->bulkClearStats(SAI_NULL_OBJECT_ID,
                                                                         SAI_OBJECT_TYPE_PORT,
                                                                         0,
                                                                         nullptr,
                                                                         0,
                                                                         nullptr,
-                                                                        SAI_STATS_MODE_BULK_READ,
-                                                                        nullptr,
+                                                                        SAI_STATS_MODE_BULK_CLEAR,
                                                                         nullptr));
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, ctx->m_redisSai->bulkClearStats(SAI_NULL_OBJECT_ID,
-                                                                          SAI_OBJECT_TYPE_PORT,
-                                                                          0,
-                                                                          nullptr,
-                                                                          0,
-                                                                          nullptr,
-                                                                          SAI_STATS_MODE_BULK_CLEAR,
-                                                                          nullptr));
+}
+
+TEST(Context, sharedMutex)
+{
+    auto recorder = std::make_shared<Recorder>();
+
+    auto cc = std::make_shared<ContextConfig>(0, "syncd", "ASIC_DB", "COUNTERS_DB","FLEX_DB", "STATE_DB");
+
+    auto ctx = std::make_shared<Context>(cc, recorder,handle_notification);
+
+    {
+        // read only queries can hold context concurrently
+
+        std::shared_lock<std::shared_timed_mutex> reader(ctx->m_mutex);
+
+        std::thread thread([&]() {
+
+            std::shared_lock<std::shared_timed_mutex> lock(ctx->m_mutex, std::try_to_lock);
+
+            EXPECT_TRUE(lock.owns_lock());
+
+            std::unique_lock<std::shared_timed_mutex> writer(ctx->m_mutex, std::try_to_lock);
+
+            EXPECT_FALSE(writer.owns_lock());
+        });
+
+        thread.join();
+    }
+
+    std::unique_lock<std::shared_timed_mutex> writer(ctx->m_mutex);
+
+    std::thread thread([&]() {
+
+        std::shared_lock<std::shared_timed_mutex> lock(ctx->m_mutex, std::try_to_lock);
+
+        EXPECT_FALSE(lock.owns_lock());
+    });
+
+    thread.join();
 }
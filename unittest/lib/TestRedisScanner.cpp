@@ -0,0 +1,85 @@
+#include "RedisScanner.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <algorithm>
+
+using namespace sairedis;
+
+TEST(RedisScanner, keys)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    for (int idx = 0; idx < 250; idx++)
+    {
+        db->hset("SCANNER_TEST:" + std::to_string(idx), "NULL", "NULL");
+    }
+
+    db->hset("SCANNER_OTHER:0", "NULL", "NULL");
+
+    // small count forces multiple chunks
+
+    auto keys = RedisScanner::keys(db.get(), "SCANNER_TEST:*", 10);
+
+    EXPECT_EQ(keys.size(), 250);
+
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+    EXPECT_EQ(std::adjacent_find(keys.begin(), keys.end()), keys.end());
+
+    for (auto& key: keys)
+    {
+        EXPECT_EQ(key.rfind("SCANNER_TEST:", 0), 0);
+
+        db->del(key);
+    }
+
+    db->del("SCANNER_OTHER:0");
+
+    EXPECT_EQ(RedisScanner::keys(db.get(), "SCANNER_TEST:*", 10).size(), 0);
+}
+
+TEST(RedisScanner, scanHashes)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    for (int idx = 0; idx < 100; idx++)
+    {
+        db->hset("SCANNER_HASH:" + std::to_string(idx), "INDEX", std::to_string(idx));
+        db->hset("SCANNER_HASH:" + std::to_string(idx), "NAME", "hash");
+    }
+
+    std::map<std::string, std::unordered_map<std::string, std::string>> all;
+
+    std::vector<std::pair<std::string, std::unordered_map<std::string, std::string>>> hashes;
+
+    std::string cursor = "0";
+
+    do
+    {
+        cursor = RedisScanner::scanHashes(db.get(), cursor, "SCANNER_HASH:*", 10, hashes);
+
+        for (auto& hash: hashes)
+        {
+            all[hash.first] = hash.second;
+        }
+    }
+    while (cursor != "0");
+
+    EXPECT_EQ(all.size(), 100);
+
+    for (auto& kvp: all)
+    {
+        EXPECT_EQ(kvp.second.size(), 2);
+        EXPECT_EQ("SCANNER_HASH:" + kvp.second.at("INDEX"), kvp.first);
+        EXPECT_EQ(kvp.second.at("NAME"), "hash");
+
+        db->del(kvp.first);
+    }
+
+    // connection is usable after pipelined replies
+
+    EXPECT_EQ(RedisScanner::keys(db.get(), "SCANNER_HASH:*", 10).size(), 0);
+}
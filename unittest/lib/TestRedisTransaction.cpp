@@ -0,0 +1,135 @@
+#include "RedisTransaction.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace sairedis;
+
+TEST(RedisTransaction, exec)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    db->del("TRANSACTION_TEST");
+
+    // small buffer forces queued replies to be read before EXEC
+
+    RedisTransaction transaction(db.get(), 4);
+
+    for (int idx = 0; idx < 10; idx++)
+    {
+        transaction.push({ "HSET", "TRANSACTION_TEST", std::to_string(idx), "NULL" });
+    }
+
+    EXPECT_EQ(transaction.size(), 10);
+
+    // commands are not applied before EXEC
+
+    EXPECT_FALSE(db->exists("TRANSACTION_TEST"));
+
+    transaction.exec();
+
+    EXPECT_EQ(transaction.size(), 0);
+
+    EXPECT_EQ(db->hgetall("TRANSACTION_TEST").size(), 10);
+
+    // transaction can be reused
+
+    transaction.push({ "DEL", "TRANSACTION_TEST" });
+
+    transaction.exec();
+
+    EXPECT_FALSE(db->exists("TRANSACTION_TEST"));
+
+    // empty transaction is not sent
+
+    transaction.exec();
+    transaction.discard();
+}
+
+TEST(RedisTransaction, discard)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    db->del("TRANSACTION_TEST");
+
+    RedisTransaction transaction(db.get(), 4);
+
+    for (int idx = 0; idx < 10; idx++)
+    {
+        transaction.push({ "HSET", "TRANSACTION_TEST", std::to_string(idx), "NULL" });
+    }
+
+    transaction.discard();
+
+    EXPECT_EQ(transaction.size(), 0);
+
+    EXPECT_FALSE(db->exists("TRANSACTION_TEST"));
+
+    transaction.push({ "HSET", "TRANSACTION_TEST", "NAME", "NULL" });
+
+    transaction.exec();
+
+    EXPECT_TRUE(db->exists("TRANSACTION_TEST"));
+
+    db->del("TRANSACTION_TEST");
+}
+
+TEST(RedisTransaction, queueError)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    db->del("TRANSACTION_TEST");
+
+    RedisTransaction transaction(db.get(), 1024);
+
+    transaction.push({ "HSET", "TRANSACTION_TEST", "NAME", "NULL" });
+
+    // wrong number of arguments is reported when command is queued
+
+    transaction.push({ "HSET", "TRANSACTION_TEST" });
+
+    EXPECT_THROW(transaction.exec(), std::runtime_error);
+
+    EXPECT_FALSE(db->exists("TRANSACTION_TEST"));
+
+    // error while buffer is flushed discards transaction
+
+    RedisTransaction small(db.get(), 2);
+
+    EXPECT_THROW(small.push({ "HSET", "TRANSACTION_TEST" }), std::runtime_error);
+
+    EXPECT_EQ(small.size(), 0);
+
+    small.push({ "HSET", "TRANSACTION_TEST", "NAME", "NULL" });
+
+    small.exec();
+
+    EXPECT_TRUE(db->exists("TRANSACTION_TEST"));
+
+    db->del("TRANSACTION_TEST");
+}
+
+TEST(RedisTransaction, execError)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    db->del("TRANSACTION_TEST");
+    db->del("TRANSACTION_OTHER");
+
+    db->hset("TRANSACTION_TEST", "NAME", "NULL");
+
+    RedisTransaction transaction(db.get(), 1024);
+
+    // wrong type is reported only by EXEC, other commands are applied
+
+    transaction.push({ "INCR", "TRANSACTION_TEST" });
+    transaction.push({ "HSET", "TRANSACTION_OTHER", "NAME", "NULL" });
+
+    EXPECT_THROW(transaction.exec(), std::runtime_error);
+
+    EXPECT_TRUE(db->exists("TRANSACTION_OTHER"));
+
+    db->del("TRANSACTION_TEST");
+    db->del("TRANSACTION_OTHER");
+}
@@ -0,0 +1,165 @@
+#include "Sai.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <atomic>
+
+using namespace sairedis;
+
+static const char* profile_get_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable)
+{
+    SWSS_LOG_ENTER();
+
+    return nullptr;
+}
+
+static int profile_get_next_value(
+        _In_ sai_switch_profile_id_t profile_id,
+        _Out_ const char** variable,
+        _Out_ const char** value)
+{
+    SWSS_LOG_ENTER();
+
+    return 0;
+}
+
+static sai_service_method_table_t test_services = {
+    profile_get_value,
+    profile_get_next_value
+};
+
+static sai_status_t getStats(
+        _In_ Sai& sai)
+{
+    SWSS_LOG_ENTER();
+
+    sai_stat_id_t id = SAI_PORT_STAT_IF_IN_OCTETS;
+
+    uint64_t counter = 0;
+
+    return sai.getStats(SAI_OBJECT_TYPE_PORT, SAI_NULL_OBJECT_ID, 1, &id, &counter);
+}
+
+static sai_status_t getAvailability(
+        _In_ Sai& sai)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t count = 0;
+
+    return sai.objectTypeGetAvailability(SAI_NULL_OBJECT_ID, SAI_OBJECT_TYPE_ROUTE_ENTRY, 0, nullptr, &count);
+}
+
+static sai_status_t setMtu(
+        _In_ Sai& sai)
+{
+    SWSS_LOG_ENTER();
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_PORT_ATTR_MTU;
+    attr.value.u32 = 9100;
+
+    return sai.set(SAI_OBJECT_TYPE_PORT, SAI_NULL_OBJECT_ID, &attr);
+}
+
+TEST(Sai, concurrentApiCalls)
+{
+    Sai sai;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.initialize(0, &test_services));
+
+    // expected statuses are the ones returned by serial execution
+
+    auto statsStatus = getStats(sai);
+    auto availabilityStatus = getAvailability(sai);
+    auto setStatus = setMtu(sai);
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, statsStatus);
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, availabilityStatus);
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, setStatus);
+
+    std::atomic<int> mismatch(0);
+
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&]() {
+
+            for (int i = 0; i < 500; i++)
+            {
+                if (getStats(sai) != statsStatus)
+                    mismatch++;
+
+                if (getAvailability(sai) != availabilityStatus)
+                    mismatch++;
+
+                if (setMtu(sai) != setStatus)
+                    mismatch++;
+            }
+        });
+    }
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, mismatch);
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.uninitialize());
+}
+
+TEST(Sai, uninitializeDuringApiCalls)
+{
+    Sai sai;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.initialize(0, &test_services));
+
+    std::atomic<bool> stop(false);
+    std::atomic<int> unexpected(0);
+    std::atomic<int> calls(0);
+
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&]() {
+
+            while (!stop)
+            {
+                // after uninitialize api calls must fail, but not crash
+
+                auto status = (calls++ % 2) ? getStats(sai) : setMtu(sai);
+
+                if (status != SAI_STATUS_INVALID_PARAMETER && status != SAI_STATUS_FAILURE)
+                    unexpected++;
+            }
+        });
+    }
+
+    while (calls < 100)
+    {
+        std::this_thread::yield();
+    }
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.uninitialize());
+
+    EXPECT_EQ(SAI_STATUS_FAILURE, getStats(sai));
+    EXPECT_EQ(SAI_STATUS_FAILURE, setMtu(sai));
+
+    stop = true;
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, unexpected);
+}
@@ -33,3 +33,56 @@ TEST(AttrKeyMap, clear)
 
     EXPECT_EQ(akm.getAllKeys().size(), 0);
 }
+
+TEST(AttrKeyMap, attrKeyExists)
+{
+    AttrKeyMap akm;
+
+    EXPECT_FALSE(akm.attrKeyExists("bar"));
+
+    akm.insert("foo", "bar");
+
+    EXPECT_TRUE(akm.attrKeyExists("bar"));
+
+    akm.insert("foo", "baz");
+
+    EXPECT_FALSE(akm.attrKeyExists("bar"));
+    EXPECT_TRUE(akm.attrKeyExists("baz"));
+
+    akm.eraseMetaKey("foo");
+
+    EXPECT_FALSE(akm.attrKeyExists("baz"));
+}
+
+TEST(AttrKeyMap, eraseSwitch)
+{
+    AttrKeyMap akm;
+
+    akm.insert("foo", "oid:0x21000000000000;SAI_VLAN_ATTR_VLAN_ID:2");
+    akm.insert("bar", "oid:0x121000000000000;SAI_VLAN_ATTR_VLAN_ID:2");
+
+    EXPECT_EQ(akm.getAllKeys().size(), 2);
+
+    akm.eraseSwitch(0x21000000000000);
+
+    EXPECT_EQ(akm.getAllKeys().size(), 1);
+
+    EXPECT_FALSE(akm.attrKeyExists("oid:0x21000000000000;SAI_VLAN_ATTR_VLAN_ID:2"));
+    EXPECT_TRUE(akm.attrKeyExists("oid:0x121000000000000;SAI_VLAN_ATTR_VLAN_ID:2"));
+}
+
+TEST(AttrKeyMap, attrKeyExists_sameKey)
+{
+    AttrKeyMap akm;
+
+    akm.insert("foo", "bar");
+    akm.insert("baz", "bar");
+
+    akm.eraseMetaKey("foo");
+
+    EXPECT_TRUE(akm.attrKeyExists("bar"));
+
+    akm.eraseMetaKey("baz");
+
+    EXPECT_FALSE(akm.attrKeyExists("bar"));
+}
@@ -0,0 +1,175 @@
+#include "LatencyHistogram.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace sairediscommon;
+
+TEST(LatencyHistogram, getBucketIndex)
+{
+    for (uint64_t value = 0; value < 16; value++)
+    {
+        EXPECT_EQ(LatencyHistogram::getBucketIndex(value), value);
+        EXPECT_EQ(LatencyHistogram::getBucketUpperBound(value), value);
+    }
+
+    EXPECT_EQ(LatencyHistogram::getBucketIndex(16), 16);
+    EXPECT_EQ(LatencyHistogram::getBucketIndex(17), 16);
+    EXPECT_EQ(LatencyHistogram::getBucketIndex(18), 17);
+    EXPECT_EQ(LatencyHistogram::getBucketUpperBound(16), 17);
+
+    EXPECT_EQ(LatencyHistogram::getBucketIndex(UINT64_MAX), LatencyHistogram::BUCKET_COUNT - 1);
+    EXPECT_EQ(LatencyHistogram::getBucketUpperBound(LatencyHistogram::BUCKET_COUNT - 1), UINT64_MAX);
+
+    // each value must fall into bucket which upper bound is not lower
+
+    for (uint64_t value = 1; value < (1ULL << 40); value = value * 3 + 1)
+    {
+        auto idx = LatencyHistogram::getBucketIndex(value);
+
+        EXPECT_GE(LatencyHistogram::getBucketUpperBound(idx), value);
+        EXPECT_LT(LatencyHistogram::getBucketUpperBound(idx - 1), value);
+    }
+}
+
+TEST(LatencyHistogram, percentile)
+{
+    LatencyHistogram h;
+
+    auto empty = h.snapshot();
+
+    EXPECT_EQ(empty.m_count, 0);
+    EXPECT_EQ(empty.getValueAtPercentile(99), 0);
+
+    for (uint64_t value = 1; value <= 1000; value++)
+    {
+        h.record(value * 1000);
+    }
+
+    auto s = h.snapshot();
+
+    EXPECT_EQ(s.m_count, 1000);
+    EXPECT_EQ(s.m_min, 1000);
+    EXPECT_EQ(s.m_max, 1000000);
+    EXPECT_EQ(s.getMean(), 500500);
+
+    // precision is 1/8 of the value
+
+    EXPECT_NEAR((double)s.getValueAtPercentile(50), 500000, 500000 / 8);
+    EXPECT_NEAR((double)s.getValueAtPercentile(99), 990000, 990000 / 8);
+    EXPECT_EQ(s.getValueAtPercentile(100), 1000000);
+
+    h.reset();
+
+    EXPECT_EQ(h.snapshot().m_count, 0);
+}
+
+TEST(LatencyHistogram, multipleThreads)
+{
+    LatencyHistogram h;
+
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&]() {
+                for (uint64_t value = 0; value < 10000; value++)
+                    h.record(value);
+                });
+    }
+
+    for (auto& t: threads)
+    {
+        t.join();
+    }
+
+    auto s = h.snapshot();
+
+    EXPECT_EQ(s.m_count, 40000);
+    EXPECT_EQ(s.m_max, 9999);
+    EXPECT_EQ(s.m_min, 0);
+}
+
+TEST(LatencyHistogram, merge)
+{
+    LatencyHistogram a;
+    LatencyHistogram b;
+
+    a.record(10);
+    a.record(20);
+
+    b.record(5);
+    b.record(1000);
+
+    auto s = a.snapshot();
+
+    s.merge(LatencyHistogram().snapshot());
+
+    EXPECT_EQ(s.m_count, 2);
+    EXPECT_EQ(s.m_min, 10);
+
+    s.merge(b.snapshot());
+
+    EXPECT_EQ(s.m_count, 4);
+    EXPECT_EQ(s.m_sum, 1035);
+    EXPECT_EQ(s.m_min, 5);
+    EXPECT_EQ(s.m_max, 1000);
+    EXPECT_EQ(s.getValueAtPercentile(100), 1000);
+
+    LatencyHistogram::Snapshot empty;
+
+    empty.merge(b.snapshot());
+
+    EXPECT_EQ(empty.m_min, 5);
+    EXPECT_EQ(empty.m_max, 1000);
+}
+
+TEST(LatencyHistogramRegistry, getHistogram)
+{
+    auto& h = LatencyHistogramRegistry::getHistogram("foo");
+
+    EXPECT_EQ(&h, &LatencyHistogramRegistry::getHistogram("foo"));
+
+    {
+        LatencyHistogramScope scope(h);
+    }
+
+    auto snapshots = LatencyHistogramRegistry::snapshot();
+
+    EXPECT_EQ(snapshots.at("foo").m_count, 1);
+
+    LatencyHistogramRegistry::reset();
+
+    EXPECT_EQ(LatencyHistogramRegistry::snapshot().at("foo").m_count, 0);
+}
+
+TEST(LatencyHistogramRegistry, setEnabled)
+{
+    auto& h = LatencyHistogramRegistry::getHistogram("TestLatencyHistogram:setEnabled");
+
+    h.reset();
+
+    LatencyHistogramRegistry::setEnabled(false);
+
+    EXPECT_FALSE(LatencyHistogramRegistry::isEnabled());
+
+    h.record(10);
+
+    {
+        LatencyHistogramScope scope(h);
+    }
+
+    EXPECT_EQ(h.snapshot().m_count, 0);
+
+    LatencyHistogramRegistry::setEnabled(true);
+
+    h.record(10);
+
+    {
+        LatencyHistogramScope scope(h);
+    }
+
+    EXPECT_EQ(h.snapshot().m_count, 2);
+}
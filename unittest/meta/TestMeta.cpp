@@ -1,6 +1,7 @@
 #include "Meta.h"
 #include "MockMeta.h"
 #include "MetaTestSaiInterface.h"
+#include "sai_serialize.h"
 
 #include <arpa/inet.h>
 
@@ -680,6 +681,133 @@ TEST(Meta, quad_bulk_route_entry)
     EXPECT_EQ(SAI_STATUS_SUCCESS, m.bulkRemove(2, e, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses));
 }
 
+static std::vector<sai_status_t> bulk_route_entry_validation(
+        _In_ bool serial)
+{
+    SWSS_LOG_ENTER();
+
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    // validation is serial when unittests are enabled
+
+    m.meta_unittests_enable(serial);
+
+    sai_object_id_t switchId = 0;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr));
+
+    sai_object_id_t vrId = 0;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.create(SAI_OBJECT_TYPE_VIRTUAL_ROUTER, &vrId, switchId, 0, &attr));
+
+    const uint32_t count = 2048;
+
+    std::vector<sai_route_entry_t> e(count);
+    std::vector<uint32_t> attr_count(count, 0);
+    std::vector<const sai_attribute_t*> attr_list(count, &attr);
+    std::vector<sai_status_t> statuses(count);
+
+    std::vector<sai_status_t> result;
+
+    auto collect = [&](sai_status_t status) {
+
+        result.push_back(status);
+        result.insert(result.end(), statuses.begin(), statuses.end());
+    };
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        memset(&e[idx], 0, sizeof(sai_route_entry_t));
+
+        e[idx].switch_id = switchId;
+        e[idx].vr_id = vrId;
+        e[idx].destination.addr.ip4 = idx + 1;
+    }
+
+    // invalid entries in different chunks fail the whole bulk before execution
+
+    e[1500].vr_id = SAI_NULL_OBJECT_ID;
+    e[1800].vr_id = switchId;
+
+    collect(m.bulkCreate(count, e.data(), attr_count.data(), attr_list.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()));
+
+    e[1500].vr_id = vrId;
+    e[1800].vr_id = vrId;
+
+    collect(m.bulkCreate(count, e.data(), attr_count.data(), attr_list.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()));
+
+    std::vector<sai_attribute_t> setlist(count);
+
+    for (uint32_t idx = 0; idx < count; idx++)
+    {
+        setlist[idx].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+        setlist[idx].value.s32 = SAI_PACKET_ACTION_DROP;
+    }
+
+    setlist[700].value.s32 = -1;
+    setlist[1900].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    setlist[1900].value.oid = vrId;
+
+    collect(m.bulkSet(count, e.data(), setlist.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()));
+
+    setlist[700].value.s32 = SAI_PACKET_ACTION_DROP;
+    setlist[1900].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    setlist[1900].value.s32 = SAI_PACKET_ACTION_DROP;
+
+    collect(m.bulkSet(count, e.data(), setlist.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()));
+
+    // entry which don't exist
+
+    e[1000].destination.addr.ip4 = count + 1;
+
+    collect(m.bulkRemove(count, e.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()));
+
+    e[1000].destination.addr.ip4 = 1000 + 1;
+
+    collect(m.bulkRemove(count, e.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data()));
+
+    return result;
+}
+
+TEST(Meta, quad_bulk_route_entry_parallel_validation)
+{
+    auto parallel = bulk_route_entry_validation(false);
+
+    // returned statuses and object statuses are the same as in serial mode
+
+    EXPECT_EQ(parallel, bulk_route_entry_validation(true));
+
+    const size_t count = 2048;
+
+    ASSERT_EQ(parallel.size(), 6 * (count + 1));
+
+    for (size_t call = 0; call < 6; call++)
+    {
+        auto status = parallel[call * (count + 1)];
+
+        // failing calls don't execute any entry
+
+        if (call % 2 == 0)
+        {
+            EXPECT_NE(SAI_STATUS_SUCCESS, status);
+
+            for (size_t idx = 1; idx <= count; idx++)
+            {
+                EXPECT_EQ(SAI_STATUS_NOT_EXECUTED, parallel[call * (count + 1) + idx]);
+            }
+        }
+        else
+        {
+            EXPECT_EQ(SAI_STATUS_SUCCESS, status);
+        }
+    }
+}
+
 sai_object_id_t create_port(
         _In_ Meta &m,
         _In_ sai_object_id_t switch_id)
@@ -1202,24 +1330,93 @@ TEST(Meta, populate)
     m.populate(dump);
 }
 
+TEST(Meta, populate_large)
+{
+    Meta m(std::make_shared<MetaTestSaiInterface>());
+
+    swss::TableDump dump;
+
+    std::string lastKey;
+
+    // more entries than single populate window
+
+    for (int idx = 0; idx < 70000; idx++)
+    {
+        lastKey = "SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10." + std::to_string(idx >> 16) + "." + std::to_string((idx >> 8) & 0xff)
+            + "." + std::to_string(idx & 0xff) + "/32\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}";
+
+        dump[lastKey]["SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID"] = "oid:0x60000000005cf";
+    }
+
+    m.populate(dump);
+
+    EXPECT_EQ(m.getObjectReferenceCount(0x60000000005cf), 70000);
+    EXPECT_EQ(m.getObjectReferenceCount(0x3000000000022), 70000);
+
+    sai_object_meta_key_t mk;
+    sai_deserialize_object_meta_key(lastKey, mk);
+
+    EXPECT_TRUE(m.objectExists(mk));
+
+    dump[lastKey]["SAI_ROUTE_ENTRY_ATTR_FOO"] = "oid:0x60000000005cf";
+
+    Meta m2(std::make_shared<MetaTestSaiInterface>());
+
+    EXPECT_ANY_THROW(m2.populate(dump));
+}
+
 TEST(Meta, bulkGetClearStats)
 {
     Meta m(std::make_shared<MetaTestSaiInterface>());
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, m.bulkGetStats(SAI_NULL_OBJECT_ID,
-                                                         SAI_OBJECT_TYPE_PORT,
-                                                         0,
-                                                         nullptr,
-                                                         0,
-                                                         nullptr,
-                                                         SAI_STATS_MODE_BULK_READ,
-                                                         nullptr,
-                                                         nullptr));
-    EXPECT_EQ(SAI_STATUS_NOT_IMPLEMENTED, m.bulkClearStats(SAI_NULL_OBJECT_ID,
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkGetStats(SAI_NULL_OBJECT_ID,
                                                            SAI_OBJECT_TYPE_PORT,
                                                            0,
                                                            nullptr,
                                                            0,
                                                            nullptr,
-                                                           SAI_STATS_MODE_BULK_CLEAR,
+                                                           SAI_STATS_MODE_BULK_READ,
+                                                           nullptr,
                                                            nullptr));
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkClearStats(SAI_NULL_OBJECT_ID,
+                                                             SAI_OBJECT_TYPE_PORT,
+                                                             0,
+                                                             nullptr,
+                                                             0,
+                                                             nullptr,
+                                                             SAI_STATS_MODE_BULK_CLEAR,
+                                                             nullptr));
+
+    sai_object_id_t switchId = 0;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr));
+
+    sai_stat_id_t counter_ids[2];
+
+    counter_ids[0] = SAI_SWITCH_STAT_IN_CONFIGURED_DROP_REASONS_0_DROPPED_PKTS;
+    counter_ids[1] = SAI_SWITCH_STAT_IN_CONFIGURED_DROP_REASONS_1_DROPPED_PKTS;
+
+    sai_object_key_t keys[1];
+
+    keys[0].key.object_id = switchId;
+
+    sai_status_t statuses[1];
+
+    uint64_t counters[2];
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.bulkGetStats(switchId, SAI_OBJECT_TYPE_SWITCH, 1, keys, 2, counter_ids, SAI_STATS_MODE_BULK_READ, statuses, counters));
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, m.bulkClearStats(switchId, SAI_OBJECT_TYPE_SWITCH, 1, keys, 2, counter_ids, SAI_STATS_MODE_BULK_CLEAR, statuses));
+
+    // object type mismatch
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkGetStats(switchId, SAI_OBJECT_TYPE_PORT, 1, keys, 2, counter_ids, SAI_STATS_MODE_BULK_READ, statuses, counters));
+
+    // counters are required
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER, m.bulkGetStats(switchId, SAI_OBJECT_TYPE_SWITCH, 1, keys, 2, counter_ids, SAI_STATS_MODE_BULK_READ, statuses, nullptr));
 }
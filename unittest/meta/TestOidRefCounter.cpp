@@ -88,3 +88,58 @@ TEST(OidRefCounter, objectReferenceClear)
 
     EXPECT_THROW(c.objectReferenceClear(2), std::runtime_error);
 }
+
+TEST(OidRefCounter, removeSwitch)
+{
+    OidRefCounter c;
+
+    c.setSwitchIdQuery([](sai_object_id_t oid) { return oid & ~0xffULL; });
+
+    c.objectReferenceInsert(0x100);
+    c.objectReferenceInsert(0x101);
+    c.objectReferenceInsert(0x200);
+    c.objectReferenceInsert(0x201);
+
+    c.objectReferenceIncrement(0x101);
+
+    EXPECT_EQ(c.getAllOids().size(), 4);
+
+    c.removeSwitch(0x100);
+
+    EXPECT_EQ(c.getAllOids().size(), 2);
+
+    EXPECT_FALSE(c.objectReferenceExists(0x101));
+    EXPECT_TRUE(c.objectReferenceExists(0x201));
+
+    c.removeSwitch(0x300);
+
+    EXPECT_EQ(c.getAllOids().size(), 2);
+}
+
+TEST(OidRefCounter, unknownOidNoSwitchQuery)
+{
+    OidRefCounter c;
+
+    int queries = 0;
+
+    c.setSwitchIdQuery([&](sai_object_id_t oid) { queries++; return oid & ~0xffULL; });
+
+    c.objectReferenceInsert(0x101);
+
+    EXPECT_EQ(queries, 1);
+
+    // switch is not queried for oids which may be invalid
+
+    EXPECT_FALSE(c.objectReferenceExists(0x301));
+    EXPECT_TRUE(c.objectReferenceExists(0x101));
+
+    EXPECT_THROW(c.objectReferenceIncrement(0x301), std::runtime_error);
+    EXPECT_THROW(c.objectReferenceClear(0x301), std::runtime_error);
+    EXPECT_THROW(c.objectReferenceRemove(0x301), std::runtime_error);
+
+    c.objectReferenceRemove(0x101);
+
+    EXPECT_EQ(queries, 1);
+
+    EXPECT_EQ(c.getAllOids().size(), 0);
+}
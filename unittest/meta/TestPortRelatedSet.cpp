@@ -16,3 +16,21 @@ TEST(PortRelatedSet, inc)
 
     EXPECT_THROW(set.insert(0, 1), std::runtime_error);
 }
+
+TEST(PortRelatedSet, removeSwitch)
+{
+    PortRelatedSet set;
+
+    set.setSwitchIdQuery([](sai_object_id_t oid) { return oid & ~0xffULL; });
+
+    set.insert(0x101, 0x102);
+    set.insert(0x201, 0x202);
+
+    EXPECT_EQ(set.getAllPorts().size(), 2);
+
+    set.removeSwitch(0x100);
+
+    EXPECT_EQ(set.getAllPorts().size(), 1);
+    EXPECT_EQ(set.getPortRelatedObjects(0x101).size(), 0);
+    EXPECT_EQ(set.getPortRelatedObjects(0x201).size(), 1);
+}
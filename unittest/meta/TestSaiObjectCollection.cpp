@@ -56,3 +56,138 @@ TEST(SaiObjectCollection, getObject)
 
     EXPECT_THROW(oc.getObject(mk), std::runtime_error);
 }
+
+TEST(SaiObjectCollection, setObjectAttr_shared)
+{
+    sai_object_meta_key_t mk1 = { .objecttype = SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, .objectkey = { .key = { .object_id = 1 } } };
+    sai_object_meta_key_t mk2 = { .objecttype = SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, .objectkey = { .key = { .object_id = 2 } } };
+
+    SaiObjectCollection oc;
+
+    oc.createObject(mk1);
+    oc.createObject(mk2);
+
+    auto meta = sai_metadata_get_attr_metadata(
+            SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER,
+            SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+    attr.value.oid = 0x42;
+
+    oc.setObjectAttr(mk1, *meta, &attr);
+    oc.setObjectAttr(mk2, *meta, &attr);
+
+    EXPECT_EQ(oc.getObjectAttr(mk1, attr.id), oc.getObjectAttr(mk2, attr.id));
+
+    attr.value.oid = 0x43;
+
+    oc.setObjectAttr(mk2, *meta, &attr);
+
+    EXPECT_NE(oc.getObjectAttr(mk1, attr.id), oc.getObjectAttr(mk2, attr.id));
+
+    EXPECT_EQ(oc.getObjectAttr(mk1, attr.id)->getSaiAttr()->value.oid, 0x42);
+    EXPECT_EQ(oc.getObjectAttr(mk2, attr.id)->getSaiAttr()->value.oid, 0x43);
+
+    auto usage = oc.getMemoryUsage();
+
+    EXPECT_EQ(usage[SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER].objects, 2);
+    EXPECT_EQ(usage[SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER].attributes, 2);
+}
+
+TEST(SaiObjectCollection, removeSwitch)
+{
+    sai_object_meta_key_t mk1 = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = 0x101 } } };
+    sai_object_meta_key_t mk2 = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = 0x201 } } };
+
+    SaiObjectCollection oc;
+
+    oc.setSwitchIdQuery([](sai_object_id_t oid) { return oid & ~0xffULL; });
+
+    oc.createObject(mk1);
+    oc.createObject(mk2);
+
+    oc.removeSwitch(0x100);
+
+    EXPECT_FALSE(oc.objectExists(mk1));
+    EXPECT_TRUE(oc.objectExists(mk2));
+
+    EXPECT_EQ(oc.getObjectsByObjectType(SAI_OBJECT_TYPE_PORT).size(), 1);
+}
+
+TEST(SaiObjectCollection, setObjectAttr_notShared)
+{
+    sai_object_meta_key_t mk1 = { .objecttype = SAI_OBJECT_TYPE_NEXT_HOP, .objectkey = { .key = { .object_id = 1 } } };
+    sai_object_meta_key_t mk2 = { .objecttype = SAI_OBJECT_TYPE_NEXT_HOP, .objectkey = { .key = { .object_id = 2 } } };
+
+    SaiObjectCollection oc;
+
+    oc.createObject(mk1);
+    oc.createObject(mk2);
+
+    auto meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_NEXT_HOP, SAI_NEXT_HOP_ATTR_IP);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_NEXT_HOP_ATTR_IP;
+    attr.value.ipaddr.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    attr.value.ipaddr.addr.ip4 = 0x0100000a;
+
+    oc.setObjectAttr(mk1, *meta, &attr);
+    oc.setObjectAttr(mk2, *meta, &attr);
+
+    // addresses are usually unique, so they are not kept in pool
+
+    EXPECT_NE(oc.getObjectAttr(mk1, attr.id), oc.getObjectAttr(mk2, attr.id));
+
+    EXPECT_EQ(oc.getAttrPoolMemoryUsage().objects, 0);
+
+    meta = sai_metadata_get_attr_metadata(SAI_OBJECT_TYPE_NEXT_HOP, SAI_NEXT_HOP_ATTR_TYPE);
+
+    attr.id = SAI_NEXT_HOP_ATTR_TYPE;
+    attr.value.s32 = SAI_NEXT_HOP_TYPE_IP;
+
+    oc.setObjectAttr(mk1, *meta, &attr);
+    oc.setObjectAttr(mk2, *meta, &attr);
+
+    EXPECT_EQ(oc.getObjectAttr(mk1, attr.id), oc.getObjectAttr(mk2, attr.id));
+
+    auto pool = oc.getAttrPoolMemoryUsage();
+
+    EXPECT_EQ(pool.objects, 1);
+    EXPECT_EQ(pool.attributes, 1);
+
+    oc.removeObject(mk1);
+    oc.removeObject(mk2);
+
+    EXPECT_EQ(oc.getAttrPoolMemoryUsage().attributes, 0);
+}
+
+TEST(SaiObjectCollection, unknownObjectNoSwitchQuery)
+{
+    sai_object_meta_key_t mk1 = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = 0x101 } } };
+    sai_object_meta_key_t mk2 = { .objecttype = SAI_OBJECT_TYPE_PORT, .objectkey = { .key = { .object_id = 0x301 } } };
+
+    SaiObjectCollection oc;
+
+    int queries = 0;
+
+    oc.setSwitchIdQuery([&](sai_object_id_t oid) { queries++; return oid & ~0xffULL; });
+
+    oc.createObject(mk1);
+
+    EXPECT_EQ(queries, 1);
+
+    // switch is not queried for keys which may contain invalid oid
+
+    EXPECT_FALSE(oc.objectExists(mk2));
+    EXPECT_EQ(oc.getObject(mk2), nullptr);
+    EXPECT_THROW(oc.removeObject(mk2), std::runtime_error);
+
+    oc.removeObject(mk1);
+
+    EXPECT_EQ(queries, 1);
+
+    EXPECT_FALSE(oc.objectExists(mk1));
+}
@@ -1259,3 +1259,29 @@ TEST(SaiSerialize, serialize_number)
     EXPECT_EQ(sn, -0x12345678);
     EXPECT_EQ(u,   0x12345678);
 }
+
+TEST(SaiSerialize, serialize_counter_list)
+{
+    uint64_t counters[3] = { 0, 42, UINT64_MAX };
+
+    auto s = sai_serialize_counter_list(3, counters);
+
+    EXPECT_EQ(s, "0,42,18446744073709551615");
+
+    EXPECT_EQ(sai_serialize_counter_list(0, counters), "");
+
+    uint64_t result[3] = { 1, 1, 1 };
+
+    sai_deserialize_counter_list(s, 3, result);
+
+    EXPECT_EQ(result[0], 0);
+    EXPECT_EQ(result[1], 42);
+    EXPECT_EQ(result[2], UINT64_MAX);
+
+    sai_deserialize_counter_list("", 0, result);
+
+    EXPECT_THROW(sai_deserialize_counter_list(s, 2, result), std::runtime_error);
+    EXPECT_THROW(sai_deserialize_counter_list("1,2", 3, result), std::runtime_error);
+    EXPECT_THROW(sai_deserialize_counter_list("1,x,3", 3, result), std::runtime_error);
+    EXPECT_THROW(sai_deserialize_counter_list("1;2;3", 3, result), std::runtime_error);
+}
@@ -0,0 +1,100 @@
+#include "WorkerPool.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <atomic>
+
+using namespace saimeta;
+
+TEST(WorkerPool, parallelFor)
+{
+    WorkerPool pool(3);
+
+    EXPECT_EQ(pool.getThreadCount(), 3);
+
+    std::vector<int> values(1000, 0);
+
+    pool.parallelFor(values.size(), 16, [&](size_t begin, size_t end) {
+
+        for (size_t idx = begin; idx < end; idx++)
+        {
+            values[idx] += (int)idx;
+        }
+    });
+
+    for (size_t idx = 0; idx < values.size(); idx++)
+    {
+        EXPECT_EQ(values[idx], (int)idx);
+    }
+}
+
+TEST(WorkerPool, parallelFor_smallCount)
+{
+    WorkerPool pool(4);
+
+    std::atomic<int> calls(0);
+
+    pool.parallelFor(10, 64, [&](size_t begin, size_t end) {
+
+        EXPECT_EQ(begin, 0);
+        EXPECT_EQ(end, 10);
+
+        calls++;
+    });
+
+    EXPECT_EQ(calls, 1);
+
+    pool.parallelFor(0, 64, [&](size_t begin, size_t end) { calls++; });
+
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(WorkerPool, parallelFor_noThreads)
+{
+    WorkerPool pool(0);
+
+    size_t sum = 0;
+
+    pool.parallelFor(100, 1, [&](size_t begin, size_t end) {
+
+        for (size_t idx = begin; idx < end; idx++)
+        {
+            sum += idx;
+        }
+    });
+
+    EXPECT_EQ(sum, 4950);
+}
+
+TEST(WorkerPool, parallelFor_exception)
+{
+    WorkerPool pool(3);
+
+    // lowest failing index must be reported, like in serial execution
+
+    for (int i = 0; i < 20; i++)
+    {
+        try
+        {
+            pool.parallelFor(400, 1, [&](size_t begin, size_t end) {
+
+                for (size_t idx = begin; idx < end; idx++)
+                {
+                    if (idx == 150 || idx == 350)
+                    {
+                        throw std::runtime_error(std::to_string(idx));
+                    }
+                }
+            });
+
+            FAIL();
+        }
+        catch (const std::runtime_error& e)
+        {
+            EXPECT_EQ(std::string(e.what()), "150");
+        }
+    }
+}
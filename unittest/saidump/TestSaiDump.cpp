@@ -0,0 +1,111 @@
+#include "SaiDump.h"
+
+#include "sairediscommon.h"
+
+#include "swss/redisreply.h"
+
+#include <gtest/gtest.h>
+
+#include <getopt.h>
+
+#include <vector>
+
+static CmdOptions parse(
+        _In_ std::vector<std::string> args)
+{
+    SWSS_LOG_ENTER();
+
+    args.insert(args.begin(), "saidump");
+
+    std::vector<char*> argv;
+
+    for (auto& arg: args)
+    {
+        argv.push_back(&arg[0]);
+    }
+
+    argv.push_back(nullptr);
+
+    // reset getopt state, since each test parses new command line
+
+    optind = 0;
+
+    return handleCmdLine((int)args.size(), argv.data());
+}
+
+TEST(SaiDump, handleCmdLine)
+{
+    auto options = parse({ "-s", "-b", "100", "-o", "ROUTE_ENTRY", "-k", "*10.0.0.*", "-j" });
+
+    EXPECT_TRUE(options.stream);
+    EXPECT_TRUE(options.json);
+    EXPECT_FALSE(options.dumpGraph);
+    EXPECT_FALSE(options.dumpTempView);
+    EXPECT_EQ(options.batchSize, 100);
+    EXPECT_EQ(options.objectType, "SAI_OBJECT_TYPE_ROUTE_ENTRY");
+    EXPECT_EQ(options.keyPattern, "*10.0.0.*");
+
+    options = parse({ "-g", "-t", "--objectType", "SAI_OBJECT_TYPE_PORT" });
+
+    EXPECT_TRUE(options.dumpGraph);
+    EXPECT_TRUE(options.dumpTempView);
+    EXPECT_FALSE(options.stream);
+    EXPECT_EQ(options.objectType, "SAI_OBJECT_TYPE_PORT");
+    EXPECT_EQ(options.keyPattern, "");
+}
+
+TEST(SaiDump, handleCmdLine_invalid)
+{
+    EXPECT_EXIT(parse({ "-b", "abc" }), ::testing::ExitedWithCode(EXIT_FAILURE), "batch size");
+    EXPECT_EXIT(parse({ "-b", "10abc" }), ::testing::ExitedWithCode(EXIT_FAILURE), "batch size");
+    EXPECT_EXIT(parse({ "-b", "0" }), ::testing::ExitedWithCode(EXIT_FAILURE), "batch size");
+    EXPECT_EXIT(parse({ "-b", "99999999999" }), ::testing::ExitedWithCode(EXIT_FAILURE), "batch size");
+    EXPECT_EXIT(parse({ "-o", "FOO" }), ::testing::ExitedWithCode(EXIT_FAILURE), "invalid object type");
+}
+
+TEST(SaiDump, match_filters)
+{
+    g_cmdOptions = parse({ "-o", "ROUTE_ENTRY", "-k", "*10.0.0.0/24*" });
+
+    EXPECT_TRUE(match_filters("SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.0.0/24\"}"));
+    EXPECT_FALSE(match_filters("SAI_OBJECT_TYPE_ROUTE_ENTRY:{\"dest\":\"10.0.1.0/24\"}"));
+    EXPECT_FALSE(match_filters("SAI_OBJECT_TYPE_NEIGHBOR_ENTRY:{\"ip\":\"10.0.0.0/24\"}"));
+
+    // stream mode applies the same filters on redis side
+
+    EXPECT_EQ(get_scan_pattern(ASIC_STATE_TABLE), ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_ROUTE_ENTRY:*10.0.0.0/24*");
+
+    g_cmdOptions = parse({ "-g" });
+
+    EXPECT_TRUE(match_filters("SAI_OBJECT_TYPE_PORT:oid:0x1000000000001"));
+
+    EXPECT_EQ(get_scan_pattern(ASIC_STATE_TABLE), ASIC_STATE_TABLE ":*:*");
+}
+
+TEST(SaiDump, dumpTable_graphMissingReference)
+{
+    swss::DBConnector db("ASIC_DB", 0);
+
+    swss::RedisReply r(&db, "FLUSHDB", REDIS_REPLY_STATUS);
+
+    // router interface references port which is not in ASIC DB
+
+    db.hset(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000003", "NULL", "NULL");
+    db.hset(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x6000000000001", "SAI_ROUTER_INTERFACE_ATTR_VIRTUAL_ROUTER_ID", "oid:0x3000000000003");
+    db.hset(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_ROUTER_INTERFACE:oid:0x6000000000001", "SAI_ROUTER_INTERFACE_ATTR_PORT_ID", "oid:0x1000000000002");
+
+    g_cmdOptions = parse({ "-g" });
+
+    testing::internal::CaptureStdout();
+
+    EXPECT_EQ(dumpTable(db, ASIC_STATE_TABLE), EXIT_SUCCESS);
+
+    auto out = testing::internal::GetCapturedStdout();
+
+    // missing object is skipped, other links are still drawn
+
+    EXPECT_NE(out.find("VIRTUAL_ROUTER -> ROUTER_INTERFACE"), std::string::npos);
+    EXPECT_EQ(out.find("PORT -> ROUTER_INTERFACE"), std::string::npos);
+
+    swss::RedisReply flush(&db, "FLUSHDB", REDIS_REPLY_STATUS);
+}
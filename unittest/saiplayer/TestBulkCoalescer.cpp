@@ -0,0 +1,194 @@
+#include "BulkCoalescer.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+using namespace saiplayer;
+
+static sai_object_id_t makeOid(
+        _In_ uint64_t switchIndex,
+        _In_ sai_object_type_t objectType,
+        _In_ uint64_t index)
+{
+    SWSS_LOG_ENTER();
+
+    // switch index on bits 56..63, object type on bits 48..55
+
+    return (switchIndex << 56) | (((uint64_t)objectType) << 48) | index;
+}
+
+static std::string makeStrOid(
+        _In_ uint64_t switchIndex,
+        _In_ sai_object_type_t objectType,
+        _In_ uint64_t index)
+{
+    SWSS_LOG_ENTER();
+
+    return sai_serialize_object_id(makeOid(switchIndex, objectType, index));
+}
+
+static const std::vector<swss::FieldValueTuple> noValues;
+
+TEST(BulkCoalescer, ctr)
+{
+    EXPECT_THROW(BulkCoalescer(0), std::runtime_error);
+}
+
+TEST(BulkCoalescer, isEligible)
+{
+    EXPECT_TRUE(BulkCoalescer::isEligible(SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_COMMON_API_CREATE, 2));
+    EXPECT_TRUE(BulkCoalescer::isEligible(SAI_OBJECT_TYPE_SCHEDULER, SAI_COMMON_API_REMOVE, 0));
+    EXPECT_TRUE(BulkCoalescer::isEligible(SAI_OBJECT_TYPE_SCHEDULER, SAI_COMMON_API_SET, 1));
+
+    EXPECT_FALSE(BulkCoalescer::isEligible(SAI_OBJECT_TYPE_SCHEDULER, SAI_COMMON_API_SET, 2));
+    EXPECT_FALSE(BulkCoalescer::isEligible(SAI_OBJECT_TYPE_SCHEDULER, SAI_COMMON_API_GET, 1));
+    EXPECT_FALSE(BulkCoalescer::isEligible(SAI_OBJECT_TYPE_SWITCH, SAI_COMMON_API_CREATE, 1));
+
+    // scheduler group can be removed only after its children
+
+    EXPECT_TRUE(BulkCoalescer::isSelfReferencing(SAI_OBJECT_TYPE_SCHEDULER_GROUP));
+    EXPECT_FALSE(BulkCoalescer::isSelfReferencing(SAI_OBJECT_TYPE_SCHEDULER));
+
+    EXPECT_TRUE(BulkCoalescer::isEligible(SAI_OBJECT_TYPE_SCHEDULER_GROUP, SAI_COMMON_API_CREATE, 1));
+    EXPECT_FALSE(BulkCoalescer::isEligible(SAI_OBJECT_TYPE_SCHEDULER_GROUP, SAI_COMMON_API_REMOVE, 0));
+}
+
+TEST(BulkCoalescer, append)
+{
+    BulkCoalescer bc(8);
+
+    EXPECT_TRUE(bc.empty());
+
+    auto ot = SAI_OBJECT_TYPE_SCHEDULER;
+
+    EXPECT_TRUE(bc.canAppend(ot, SAI_COMMON_API_REMOVE, makeStrOid(0, ot, 1), noValues));
+
+    bc.append(ot, SAI_COMMON_API_REMOVE, makeStrOid(0, ot, 1), nullptr);
+    bc.append(ot, SAI_COMMON_API_REMOVE, makeStrOid(0, ot, 2), nullptr);
+
+    EXPECT_FALSE(bc.empty());
+    EXPECT_EQ(bc.getObjectType(), ot);
+    EXPECT_EQ(bc.getBulkApi(), SAI_COMMON_API_BULK_REMOVE);
+    EXPECT_EQ(bc.getObjectIds(), std::vector<std::string>({ makeStrOid(0, ot, 1), makeStrOid(0, ot, 2) }));
+    EXPECT_EQ(bc.getAttributes().size(), 2);
+
+    bc.clear();
+
+    EXPECT_TRUE(bc.empty());
+
+    // removed object can be appended again to new batch
+
+    EXPECT_TRUE(bc.canAppend(ot, SAI_COMMON_API_REMOVE, makeStrOid(0, ot, 1), noValues));
+}
+
+TEST(BulkCoalescer, flushOnTypeChange)
+{
+    BulkCoalescer bc(8);
+
+    bc.append(SAI_OBJECT_TYPE_SCHEDULER, SAI_COMMON_API_REMOVE, makeStrOid(0, SAI_OBJECT_TYPE_SCHEDULER, 1), nullptr);
+
+    EXPECT_TRUE(bc.canAppend(SAI_OBJECT_TYPE_SCHEDULER, SAI_COMMON_API_REMOVE,
+                makeStrOid(0, SAI_OBJECT_TYPE_SCHEDULER, 2), noValues));
+
+    EXPECT_FALSE(bc.canAppend(SAI_OBJECT_TYPE_WRED, SAI_COMMON_API_REMOVE,
+                makeStrOid(0, SAI_OBJECT_TYPE_WRED, 2), noValues));
+}
+
+TEST(BulkCoalescer, flushOnApiChange)
+{
+    BulkCoalescer bc(8);
+
+    auto ot = SAI_OBJECT_TYPE_SCHEDULER;
+
+    bc.append(ot, SAI_COMMON_API_CREATE, makeStrOid(0, ot, 1), nullptr);
+
+    EXPECT_FALSE(bc.canAppend(ot, SAI_COMMON_API_REMOVE, makeStrOid(0, ot, 2), noValues));
+
+    std::vector<swss::FieldValueTuple> values = {{ "SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT", "10" }};
+
+    EXPECT_FALSE(bc.canAppend(ot, SAI_COMMON_API_SET, makeStrOid(0, ot, 2), values));
+}
+
+TEST(BulkCoalescer, flushOnDuplicateKey)
+{
+    BulkCoalescer bc(8);
+
+    auto ot = SAI_OBJECT_TYPE_SCHEDULER;
+
+    std::vector<swss::FieldValueTuple> values = {{ "SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT", "10" }};
+
+    bc.append(ot, SAI_COMMON_API_SET, makeStrOid(0, ot, 1), nullptr);
+
+    // second set of the same object must be executed after the first one
+
+    EXPECT_FALSE(bc.canAppend(ot, SAI_COMMON_API_SET, makeStrOid(0, ot, 1), values));
+    EXPECT_TRUE(bc.canAppend(ot, SAI_COMMON_API_SET, makeStrOid(0, ot, 2), values));
+
+    // entries are compared by serialized key
+
+    BulkCoalescer routes(8);
+
+    auto route = "{\"dest\":\"10.0.0.0/8\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000001\"}";
+    auto other = "{\"dest\":\"11.0.0.0/8\",\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000001\"}";
+
+    routes.append(SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_COMMON_API_REMOVE, route, nullptr);
+
+    EXPECT_FALSE(routes.canAppend(SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_COMMON_API_REMOVE, route, noValues));
+    EXPECT_TRUE(routes.canAppend(SAI_OBJECT_TYPE_ROUTE_ENTRY, SAI_COMMON_API_REMOVE, other, noValues));
+}
+
+TEST(BulkCoalescer, flushOnSwitchChange)
+{
+    BulkCoalescer bc(8);
+
+    auto ot = SAI_OBJECT_TYPE_SCHEDULER;
+
+    bc.append(ot, SAI_COMMON_API_REMOVE, makeStrOid(0, ot, 1), nullptr);
+
+    EXPECT_TRUE(bc.canAppend(ot, SAI_COMMON_API_REMOVE, makeStrOid(0, ot, 2), noValues));
+    EXPECT_FALSE(bc.canAppend(ot, SAI_COMMON_API_REMOVE, makeStrOid(1, ot, 2), noValues));
+}
+
+TEST(BulkCoalescer, flushOnReferenceToCreated)
+{
+    BulkCoalescer bc(8);
+
+    auto ot = SAI_OBJECT_TYPE_SCHEDULER_GROUP;
+
+    auto port = makeStrOid(0, SAI_OBJECT_TYPE_PORT, 1);
+
+    std::vector<swss::FieldValueTuple> values = {
+        { "SAI_SCHEDULER_GROUP_ATTR_PORT_ID", port },
+        { "SAI_SCHEDULER_GROUP_ATTR_PARENT_NODE", port },
+    };
+
+    bc.append(ot, SAI_COMMON_API_CREATE, makeStrOid(0, ot, 1), nullptr);
+
+    EXPECT_TRUE(bc.canAppend(ot, SAI_COMMON_API_CREATE, makeStrOid(0, ot, 2), values));
+
+    // parent node is created by current batch, its redis id is not known yet
+
+    values[1] = swss::FieldValueTuple("SAI_SCHEDULER_GROUP_ATTR_PARENT_NODE", makeStrOid(0, ot, 1));
+
+    EXPECT_FALSE(bc.canAppend(ot, SAI_COMMON_API_CREATE, makeStrOid(0, ot, 2), values));
+}
+
+TEST(BulkCoalescer, flushOnFull)
+{
+    BulkCoalescer bc(2);
+
+    auto ot = SAI_OBJECT_TYPE_SCHEDULER;
+
+    bc.append(ot, SAI_COMMON_API_REMOVE, makeStrOid(0, ot, 1), nullptr);
+
+    EXPECT_FALSE(bc.full());
+    EXPECT_TRUE(bc.canAppend(ot, SAI_COMMON_API_REMOVE, makeStrOid(0, ot, 2), noValues));
+
+    bc.append(ot, SAI_COMMON_API_REMOVE, makeStrOid(0, ot, 2), nullptr);
+
+    EXPECT_TRUE(bc.full());
+    EXPECT_FALSE(bc.canAppend(ot, SAI_COMMON_API_REMOVE, makeStrOid(0, ot, 3), noValues));
+}
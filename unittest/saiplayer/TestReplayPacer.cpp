@@ -0,0 +1,140 @@
+#include "ReplayPacer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace saiplayer;
+
+TEST(ReplayPacer, parseTimestamp)
+{
+    int64_t us;
+
+    EXPECT_TRUE(ReplayPacer::parseTimestamp("2020-01-01.00:00:00.000000", us));
+    EXPECT_EQ(us, 1577836800000000);
+
+    EXPECT_TRUE(ReplayPacer::parseTimestamp("2020-01-02.03:04:05.123456", us));
+    EXPECT_EQ(us, (1577836800 + 86400 + 3 * 3600 + 4 * 60 + 5) * 1000000LL + 123456);
+}
+
+TEST(ReplayPacer, parseTimestamp_microseconds)
+{
+    int64_t first;
+    int64_t second;
+
+    EXPECT_TRUE(ReplayPacer::parseTimestamp("2020-01-01.23:59:59.999999", first));
+    EXPECT_TRUE(ReplayPacer::parseTimestamp("2020-01-02.00:00:00.000000", second));
+
+    // day and second rollover
+
+    EXPECT_EQ(second - first, 1);
+
+    EXPECT_TRUE(ReplayPacer::parseTimestamp("2020-01-02.00:00:00.000001", second));
+
+    EXPECT_EQ(second - first, 2);
+
+    // month rollover
+
+    EXPECT_TRUE(ReplayPacer::parseTimestamp("2020-01-31.12:00:00.500000", first));
+    EXPECT_TRUE(ReplayPacer::parseTimestamp("2020-02-01.12:00:00.250000", second));
+
+    EXPECT_EQ(second - first, 86400 * 1000000LL - 250000);
+}
+
+TEST(ReplayPacer, parseTimestamp_invalid)
+{
+    int64_t us = 7;
+
+    // trailing junk
+
+    EXPECT_FALSE(ReplayPacer::parseTimestamp("2020-01-01.00:00:00.000000x", us));
+    EXPECT_FALSE(ReplayPacer::parseTimestamp("2020-01-01.00:00:00.000000 ", us));
+    EXPECT_FALSE(ReplayPacer::parseTimestamp("2020-01-01.00:00:00.0000001", us));
+    EXPECT_FALSE(ReplayPacer::parseTimestamp("2020-01-01.00:00:00.000000|c|SAI_OBJECT_TYPE_PORT", us));
+
+    // missing fields
+
+    EXPECT_FALSE(ReplayPacer::parseTimestamp("2020-01-01.00:00:00", us));
+    EXPECT_FALSE(ReplayPacer::parseTimestamp("2020-01-01.00:00:00.", us));
+    EXPECT_FALSE(ReplayPacer::parseTimestamp("2020-01-01", us));
+    EXPECT_FALSE(ReplayPacer::parseTimestamp("", us));
+
+    // wrong format
+
+    EXPECT_FALSE(ReplayPacer::parseTimestamp("2020/01/01 00:00:00.000000", us));
+    EXPECT_FALSE(ReplayPacer::parseTimestamp("garbage", us));
+
+    EXPECT_EQ(us, 7);
+}
+
+TEST(ReplayPacer, ctr)
+{
+    EXPECT_THROW(ReplayPacer(REPLAY_TIMING_RECORDED, 0), std::runtime_error);
+    EXPECT_THROW(ReplayPacer(REPLAY_TIMING_RECORDED, -1), std::runtime_error);
+    EXPECT_NO_THROW(ReplayPacer(REPLAY_TIMING_RECORDED, 0.5));
+}
+
+TEST(ReplayPacer, timingMax)
+{
+    ReplayPacer pacer(REPLAY_TIMING_MAX, 1);
+
+    pacer.wait("2020-01-01.00:00:00.000000");
+
+    EXPECT_TRUE(pacer.isDue("2020-01-01.01:00:00.000000"));
+
+    auto start = std::chrono::steady_clock::now();
+
+    pacer.wait("2020-01-01.00:00:00.100000");
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+
+    EXPECT_EQ(pacer.getMaxLag(), 0);
+}
+
+TEST(ReplayPacer, timingRecorded)
+{
+    ReplayPacer pacer(REPLAY_TIMING_RECORDED, 2);
+
+    // first line is executed immediately
+
+    EXPECT_TRUE(pacer.isDue("2020-01-01.01:00:00.000000"));
+
+    pacer.wait("2020-01-01.00:00:00.000000");
+
+    EXPECT_FALSE(pacer.isDue("2020-01-01.01:00:00.000000"));
+
+    // invalid timestamp is always due
+
+    EXPECT_TRUE(pacer.isDue("garbage"));
+
+    // 100 ms recorded at double speed
+
+    auto start = std::chrono::steady_clock::now();
+
+    pacer.wait("2020-01-01.00:00:00.100000");
+
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(45));
+
+    EXPECT_EQ(pacer.getMaxLag(), 0);
+}
+
+TEST(ReplayPacer, maxLag)
+{
+    ReplayPacer pacer(REPLAY_TIMING_RECORDED, 1);
+
+    pacer.wait("2020-01-01.00:00:00.000000");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+
+    EXPECT_TRUE(pacer.isDue("2020-01-01.00:00:00.010000"));
+
+    pacer.wait("2020-01-01.00:00:00.010000");
+
+    EXPECT_GE(pacer.getMaxLag(), 20000);
+
+    // clock going back is not waited for
+
+    pacer.wait("2019-12-31.23:59:59.000000");
+
+    EXPECT_GE(pacer.getMaxLag(), 30000);
+}
@@ -0,0 +1,124 @@
+#include "ReplayReport.h"
+
+#include "swss/json.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace saiplayer;
+
+TEST(ReplayReport, emptyToJson)
+{
+    ReplayReport report;
+
+    auto j = nlohmann::json::parse(report.toJson("max", 1, 0));
+
+    EXPECT_EQ(j["timing"], "max");
+    EXPECT_EQ(j["speed"], 1.0);
+    EXPECT_EQ(j["ops"], 0);
+    EXPECT_EQ(j["max_lag_us"], 0);
+    EXPECT_EQ(j.count("wall_time_ms"), 1);
+    EXPECT_EQ(j.count("ops_per_sec"), 1);
+    EXPECT_TRUE(j["entries"].is_array());
+    EXPECT_EQ(j["entries"].size(), 0);
+}
+
+TEST(ReplayReport, toJson)
+{
+    ReplayReport report;
+
+    auto now = std::chrono::steady_clock::now();
+
+    report.record("SAI_OBJECT_TYPE_ROUTE_ENTRY", "bulkcreate", 100, now);
+    report.record("SAI_OBJECT_TYPE_ROUTE_ENTRY", "bulkcreate", 28, now);
+    report.record("SAI_OBJECT_TYPE_PORT", "set", 1, now);
+    report.record("SAI_OBJECT_TYPE_PORT", "create", 1, now);
+
+    auto j = nlohmann::json::parse(report.toJson("recorded", 2.5, 1234));
+
+    EXPECT_EQ(j["timing"], "recorded");
+    EXPECT_EQ(j["speed"], 2.5);
+    EXPECT_EQ(j["ops"], 4);
+    EXPECT_EQ(j["max_lag_us"], 1234);
+
+    auto& entries = j["entries"];
+
+    ASSERT_EQ(entries.size(), 3);
+
+    // entries are sorted by object type and api
+
+    EXPECT_EQ(entries[0]["object_type"], "SAI_OBJECT_TYPE_PORT");
+    EXPECT_EQ(entries[0]["api"], "create");
+    EXPECT_EQ(entries[1]["object_type"], "SAI_OBJECT_TYPE_PORT");
+    EXPECT_EQ(entries[1]["api"], "set");
+    EXPECT_EQ(entries[2]["object_type"], "SAI_OBJECT_TYPE_ROUTE_ENTRY");
+    EXPECT_EQ(entries[2]["api"], "bulkcreate");
+
+    // bulk operations count all objects
+
+    EXPECT_EQ(entries[2]["ops"], 2);
+    EXPECT_EQ(entries[2]["objects"], 128);
+
+    for (auto& e: entries)
+    {
+        for (auto name: { "ops_per_sec", "objects_per_sec", "min_ns", "mean_ns",
+                "p50_ns", "p90_ns", "p99_ns", "p999_ns", "max_ns" })
+        {
+            EXPECT_EQ(e.count(name), 1) << name;
+        }
+    }
+}
+
+TEST(ReplayReport, percentiles)
+{
+    ReplayReport report;
+
+    // 100 operations from 10 us to 1 ms
+
+    for (int idx = 1; idx <= 100; idx++)
+    {
+        auto start = std::chrono::steady_clock::now() - std::chrono::microseconds(idx * 10);
+
+        report.record("SAI_OBJECT_TYPE_PORT", "get", 1, start);
+    }
+
+    auto j = nlohmann::json::parse(report.toJson("max", 1, 0));
+
+    ASSERT_EQ(j["entries"].size(), 1);
+
+    auto& e = j["entries"][0];
+
+    uint64_t min = e["min_ns"];
+    uint64_t mean = e["mean_ns"];
+    uint64_t p50 = e["p50_ns"];
+    uint64_t p90 = e["p90_ns"];
+    uint64_t p99 = e["p99_ns"];
+    uint64_t p999 = e["p999_ns"];
+    uint64_t max = e["max_ns"];
+
+    EXPECT_EQ(e["ops"], 100);
+    EXPECT_EQ(e["objects"], 100);
+
+    EXPECT_GE(min, 10000);
+    EXPECT_GE(max, 1000000);
+
+    EXPECT_LE(min, mean);
+    EXPECT_LE(mean, max);
+
+    EXPECT_LE(min, p50);
+    EXPECT_LE(p50, p90);
+    EXPECT_LE(p90, p99);
+    EXPECT_LE(p99, p999);
+    EXPECT_LE(p999, max);
+
+    // percentile is upper bound of bucket, precise to 1/8 of the value
+
+    EXPECT_GE(p50, 500000);
+    EXPECT_GE(p90, 900000);
+    EXPECT_GE(p99, 990000);
+
+    EXPECT_EQ(p999, max);
+
+    double busySeconds = (double)mean * 100 / 1e9;
+
+    EXPECT_NEAR((double)e["ops_per_sec"], 100 / busySeconds, 100 / busySeconds * 0.05);
+}
@@ -0,0 +1,91 @@
+#include "RecordingAnalysis.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+using namespace sairecanalyzer;
+
+// 2020-01-01.00:00:00.000000, aligned to windows of power of two seconds
+
+#define BASE_TIMESTAMP (1577836800LL * 1000000)
+
+static void processCreates(
+        _Inout_ RecordingAnalysis& analysis,
+        _In_ int seconds)
+{
+    SWSS_LOG_ENTER();
+
+    for (int idx = 0; idx < seconds; idx++)
+    {
+        auto ts = RecordingAnalysis::formatTimestamp(BASE_TIMESTAMP + idx * 1000000LL + idx);
+
+        analysis.processLine(ts + "|c|SAI_OBJECT_TYPE_SCHEDULER:oid:0x10000000000" + std::to_string(idx));
+    }
+
+    analysis.finishChunk();
+}
+
+TEST(RecordingAnalysis, ctr)
+{
+    EXPECT_THROW(RecordingAnalysis(0, 1, 1), std::runtime_error);
+    EXPECT_THROW(RecordingAnalysis(1, 0, 1), std::runtime_error);
+}
+
+TEST(RecordingAnalysis, formatTimestamp)
+{
+    EXPECT_EQ(RecordingAnalysis::formatTimestamp(BASE_TIMESTAMP + 123456), "2020-01-01.00:00:00.123456");
+}
+
+TEST(RecordingAnalysis, maxWindows)
+{
+    RecordingAnalysis analysis(1, 4, 0);
+
+    processCreates(analysis, 10);
+
+    auto j = analysis.toJson();
+
+    // 10 windows of 1 second are joined to 5 of 2 seconds and then to 3
+    // windows of 4 seconds
+
+    EXPECT_EQ(j["ops"], 10);
+    EXPECT_EQ(j["window_seconds"], 4);
+
+    auto& windows = j["windows"];
+
+    ASSERT_EQ(windows.size(), 3);
+
+    EXPECT_EQ(windows[0]["start"], "2020-01-01.00:00:00.000000");
+    EXPECT_EQ(windows[0]["ops"], 4);
+    EXPECT_EQ(windows[1]["start"], "2020-01-01.00:00:04.000000");
+    EXPECT_EQ(windows[1]["ops"], 4);
+    EXPECT_EQ(windows[2]["start"], "2020-01-01.00:00:08.000000");
+    EXPECT_EQ(windows[2]["ops"], 2);
+    EXPECT_EQ(windows[2]["objects_per_sec"], 0.5);
+}
+
+TEST(RecordingAnalysis, mergeWindowLength)
+{
+    RecordingAnalysis longer(1, 4, 0);
+    RecordingAnalysis shorter(1, 4, 0);
+
+    processCreates(longer, 10);
+    processCreates(shorter, 2);
+
+    RecordingAnalysis merged(1, 4, 0);
+
+    merged.merge(shorter);
+    merged.merge(longer);
+
+    longer.merge(shorter);
+
+    // windows are aligned regardless of merge order
+
+    EXPECT_EQ(merged.toJson(), longer.toJson());
+
+    auto j = merged.toJson();
+
+    EXPECT_EQ(j["ops"], 12);
+    EXPECT_EQ(j["window_seconds"], 4);
+    EXPECT_EQ(j["windows"][0]["ops"], 6);
+}
@@ -0,0 +1,176 @@
+#include "RecordingAnalyzer.h"
+#include "RecordingReader.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <unistd.h>
+
+using namespace sairecanalyzer;
+
+#define RECORDING_FILE "TestRecordingAnalyzer.rec"
+
+// 2020-01-01.00:00:00.000000
+
+#define BASE_TIMESTAMP (1577836800LL * 1000000)
+
+/**
+ * @brief Write recording with all kinds of lines, return offsets of lines.
+ */
+static std::vector<uint64_t> writeRecording()
+{
+    SWSS_LOG_ENTER();
+
+    std::ofstream ofs(RECORDING_FILE);
+
+    std::vector<uint64_t> offsets;
+
+    int64_t ts = BASE_TIMESTAMP;
+
+    auto line = [&](const std::string& text) {
+
+        offsets.push_back((uint64_t)ofs.tellp());
+
+        // durations differ, so slowest operations are the same in any order
+
+        ts += 1000 + (int64_t)((offsets.size() * 7919) % 50000);
+
+        ofs << RecordingAnalysis::formatTimestamp(ts) << "|" << text << "\n";
+    };
+
+    for (int idx = 0; idx < 400; idx++)
+    {
+        auto oid = "oid:0x60000000000" + std::to_string(100 + idx);
+
+        switch (idx % 10)
+        {
+            case 0:
+                line("c|SAI_OBJECT_TYPE_ROUTER_INTERFACE:" + oid + "|SAI_ROUTER_INTERFACE_ATTR_MTU=9100");
+                break;
+
+            case 1:
+                line("s|SAI_OBJECT_TYPE_ROUTER_INTERFACE:" + oid + "|SAI_ROUTER_INTERFACE_ATTR_MTU=1500");
+                break;
+
+            case 2:
+                line("g|SAI_OBJECT_TYPE_ROUTER_INTERFACE:" + oid + "|SAI_ROUTER_INTERFACE_ATTR_MTU=0");
+
+                if (idx % 3 == 0)
+                {
+                    line("n|port_state_change|[{\"port_id\":\"oid:0x1000000000002\",\"port_state\":\"SAI_PORT_OPER_STATUS_UP\"}]|");
+                }
+
+                line("G|SAI_STATUS_SUCCESS|SAI_ROUTER_INTERFACE_ATTR_MTU=1500");
+                break;
+
+            case 3:
+
+                {
+                    std::string bulk = "C|SAI_OBJECT_TYPE_ROUTE_ENTRY";
+
+                    for (int i = 0; i <= idx % 7; i++)
+                    {
+                        bulk += "||{\"dest\":\"10." + std::to_string(idx) + "." + std::to_string(i) + ".0/24\","
+                            "\"switch_id\":\"oid:0x21000000000000\",\"vr\":\"oid:0x3000000000022\"}"
+                            "|SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION=SAI_PACKET_ACTION_FORWARD";
+                    }
+
+                    line(bulk);
+                }
+
+                break;
+
+            case 4:
+                line("r|SAI_OBJECT_TYPE_ROUTER_INTERFACE:" + oid);
+                line("E|SAI_STATUS_OBJECT_IN_USE");
+                break;
+
+            case 5:
+                line("#|recording comment");
+                break;
+
+            case 6:
+                line("q|attr_capability|SAI_OBJECT_TYPE_PORT:oid:0x21000000000000|SAI_PORT_ATTR_MTU=");
+                line("Q|attr_capability|SAI_STATUS_SUCCESS|CREATE_IMPLEMENTED=true");
+                break;
+
+            case 7:
+                ofs << "invalid line " << idx << "\n";
+                break;
+
+            case 8:
+                line("a|INIT_VIEW");
+                line("A|SAI_STATUS_SUCCESS");
+                break;
+
+            default:
+                line("n|fdb_event|[{\"fdb_event\":\"SAI_FDB_EVENT_LEARNED\"}]|");
+                break;
+        }
+    }
+
+    return offsets;
+}
+
+static std::string analyze(
+        _In_ uint64_t chunkSize,
+        _In_ uint32_t threads,
+        _In_ uint32_t maxWindows)
+{
+    SWSS_LOG_ENTER();
+
+    auto options = std::make_shared<CommandLineOptions>();
+
+    options->m_files = { RECORDING_FILE };
+    options->m_chunkSize = chunkSize;
+    options->m_threads = threads;
+    options->m_maxWindows = maxWindows;
+
+    RecordingAnalyzer analyzer(options);
+
+    return analyzer.analyze()->toJson().dump(4);
+}
+
+TEST(RecordingAnalyzer, chunksMatchSingleChunk)
+{
+    auto offsets = writeRecording();
+
+    auto size = RecordingReader::getFileSize(RECORDING_FILE);
+
+    for (uint32_t maxWindows: { 10000, 3 })
+    {
+        auto expected = analyze(size, 1, maxWindows);
+
+        auto j = nlohmann::json::parse(expected);
+
+        EXPECT_EQ(j["invalid_lines"], 40);
+        EXPECT_EQ(j["notifications"]["port_state_change"], 13);
+        EXPECT_GT(j["ops"], 0);
+
+        // chunk boundaries on line start, right after line start, on new
+        // line character, inside long bulk line, and many tiny chunks
+
+        std::vector<uint64_t> chunkSizes = { 97, 1000, 4099, size / 2, size / 2 + 1, size - 1 };
+
+        for (size_t idx: { 5, 33, 34 })
+        {
+            chunkSizes.push_back(offsets[idx]);
+            chunkSizes.push_back(offsets[idx] + 1);
+            chunkSizes.push_back(offsets[idx] - 1);
+        }
+
+        for (auto chunkSize: chunkSizes)
+        {
+            for (uint32_t threads: { 1, 4 })
+            {
+                EXPECT_EQ(analyze(chunkSize, threads, maxWindows), expected)
+                    << "chunk size " << chunkSize << ", threads " << threads << ", max windows " << maxWindows;
+            }
+        }
+    }
+
+    unlink(RECORDING_FILE);
+}
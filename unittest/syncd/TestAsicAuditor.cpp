@@ -0,0 +1,143 @@
+#include "AsicAuditor.h"
+#include "VirtualOidTranslator.h"
+#include "MockableSaiInterface.h"
+#include "lib/RedisVidIndexGenerator.h"
+#include "lib/sairediscommon.h"
+
+#include "swss/redisreply.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+#define PORT_KEY(x) ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_PORT:oid:0x100000000000" #x
+
+static const uint32_t mtu[4] = { 0, 9100, 1500, 9100 };
+
+static sai_status_t mockGet(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        if (attr_list[idx].id == SAI_PORT_ATTR_MTU)
+        {
+            attr_list[idx].value.u32 = mtu[objectId & 0x3];
+        }
+    }
+
+    return SAI_STATUS_SUCCESS;
+}
+
+TEST(AsicAuditor, runSlice)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto dbState = std::make_shared<swss::DBConnector>("STATE_DB", 0);
+
+    swss::RedisReply r1(dbAsic.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+    swss::RedisReply r2(dbState.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    auto client = std::make_shared<RedisClient>(dbAsic);
+    auto vendorSai = std::make_shared<MockableSaiInterface>();
+
+    vendorSai->mock_get = mockGet;
+
+    auto switchConfigContainer = std::make_shared<sairedis::SwitchConfigContainer>();
+    auto redisVidIndexGenerator = std::make_shared<sairedis::RedisVidIndexGenerator>(dbAsic, REDIS_KEY_VIDCOUNTER);
+
+    auto virtualObjectIdManager =
+        std::make_shared<sairedis::VirtualObjectIdManager>(
+                0,
+                switchConfigContainer,
+                redisVidIndexGenerator);
+
+    auto translator = std::make_shared<VirtualOidTranslator>(client, virtualObjectIdManager, vendorSai);
+
+    dbAsic->hset(PORT_KEY(1), "SAI_PORT_ATTR_MTU", "9100");
+    dbAsic->hset(PORT_KEY(2), "SAI_PORT_ATTR_MTU", "9100");
+    dbAsic->hset(PORT_KEY(3), "SAI_PORT_ATTR_MTU", "9100");
+
+    // port 3 has no RID, like when it's removed during pass
+
+    translator->insertRidAndVid(0x1, 0x1000000000001);
+    translator->insertRidAndVid(0x2, 0x1000000000002);
+
+    AsicAuditor auditor(client, translator, vendorSai, dbState);
+
+    auditor.setBudget(1, std::chrono::seconds(10));
+
+    EXPECT_FALSE(auditor.runSlice());
+
+    EXPECT_EQ(auditor.getPassObjectCount(), 1);
+
+    int slices = 1;
+
+    while (!auditor.runSlice())
+    {
+        slices++;
+    }
+
+    EXPECT_GE(slices, 3);
+
+    EXPECT_EQ(auditor.getPassCount(), 1);
+    EXPECT_EQ(auditor.getObjectCount(), 3);
+    EXPECT_EQ(auditor.getMismatchCount(), 1);
+    EXPECT_EQ(auditor.getErrorCount(), 0);
+
+    swss::Table audit(dbState.get(), SYNCD_ASIC_AUDIT_TABLE);
+    swss::Table stats(dbState.get(), SYNCD_ASIC_AUDIT_STATS_TABLE);
+
+    std::string value;
+
+    EXPECT_TRUE(audit.hget("SAI_OBJECT_TYPE_PORT:oid:0x1000000000002", "SAI_PORT_ATTR_MTU", value));
+    EXPECT_EQ(value, "1500");
+
+    EXPECT_FALSE(audit.hget("SAI_OBJECT_TYPE_PORT:oid:0x1000000000001", "SAI_PORT_ATTR_MTU", value));
+
+    EXPECT_TRUE(stats.hget(SYNCD_ASIC_AUDIT_STATS_KEY, "last_pass_mismatches", value));
+    EXPECT_EQ(value, "1");
+
+    // ASIC was fixed, entry is removed by next pass
+
+    dbAsic->hset(PORT_KEY(2), "SAI_PORT_ATTR_MTU", "1500");
+
+    auditor.runPass();
+
+    EXPECT_EQ(auditor.getPassCount(), 2);
+    EXPECT_EQ(auditor.getPassObjectCount(), 3);
+    EXPECT_EQ(auditor.getPassMismatchCount(), 0);
+
+    EXPECT_FALSE(audit.hget("SAI_OBJECT_TYPE_PORT:oid:0x1000000000002", "SAI_PORT_ATTR_MTU", value));
+
+    EXPECT_TRUE(stats.hget(SYNCD_ASIC_AUDIT_STATS_KEY, "pass_count", value));
+    EXPECT_EQ(value, "2");
+}
+
+TEST(AsicAuditor, clearPreviousRun)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto dbState = std::make_shared<swss::DBConnector>("STATE_DB", 0);
+
+    swss::RedisReply r(dbState.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    swss::Table audit(dbState.get(), SYNCD_ASIC_AUDIT_TABLE);
+
+    // entry written by previous syncd run
+
+    audit.hset("SAI_OBJECT_TYPE_PORT:oid:0x1000000000005", "SAI_PORT_ATTR_MTU", "1500");
+
+    auto client = std::make_shared<RedisClient>(dbAsic);
+    auto vendorSai = std::make_shared<MockableSaiInterface>();
+
+    AsicAuditor auditor(client, nullptr, vendorSai, dbState);
+
+    std::vector<std::string> keys;
+
+    audit.getKeys(keys);
+
+    EXPECT_EQ(keys.size(), 0);
+}
@@ -0,0 +1,99 @@
+#include "AsicView.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+
+#include <set>
+
+using namespace syncd;
+
+static std::string routeKey(
+        _In_ uint32_t idx)
+{
+    SWSS_LOG_ENTER();
+
+    sai_route_entry_t route;
+
+    memset(&route, 0, sizeof(route));
+
+    route.switch_id = 0x21000000000000;
+    route.vr_id = 0x3000000000022;
+    route.destination.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    route.destination.addr.ip4 = htonl(0x0a000000 | idx);
+    route.destination.mask.ip4 = 0xffffffff;
+
+    return sai_serialize_object_type(SAI_OBJECT_TYPE_ROUTE_ENTRY) + ":" + sai_serialize_route_entry(route);
+}
+
+TEST(AsicView, sharedAttrValues)
+{
+    swss::TableDump dump;
+
+    dump["SAI_OBJECT_TYPE_SWITCH:oid:0x21000000000000"]["NULL"] = "NULL";
+    dump["SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000022"]["NULL"] = "NULL";
+    dump["SAI_OBJECT_TYPE_NEXT_HOP:oid:0x4000000000100"]["NULL"] = "NULL";
+
+    for (uint32_t idx = 0; idx < 3; idx++)
+    {
+        dump[routeKey(idx)]["SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID"] = "oid:0x4000000000100";
+        dump[routeKey(idx)]["SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION"] = "SAI_PACKET_ACTION_FORWARD";
+    }
+
+    AsicView view(dump);
+
+    std::set<const std::string*> values;
+
+    for (auto& route: view.getObjectsByObjectType(SAI_OBJECT_TYPE_ROUTE_ENTRY))
+    {
+        auto attr = route->getSaiAttr(SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID);
+
+        EXPECT_EQ(attr->getStrAttrValue(), "oid:0x4000000000100");
+        EXPECT_EQ(attr->getOid(), 0x4000000000100);
+
+        values.insert(&attr->getStrAttrValue());
+    }
+
+    // all routes in view share single copy of next hop value
+
+    EXPECT_EQ(values.size(), 1);
+
+    // attribute created outside of view has its own copy
+
+    SaiAttr attr("SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID", "oid:0x4000000000100");
+
+    EXPECT_EQ(values.count(&attr.getStrAttrValue()), 0);
+}
+
+TEST(SaiAttr, valuePool)
+{
+    SaiAttrValuePool pool;
+
+    SaiAttr a("SAI_PORT_ATTR_MTU", "9100", pool);
+    SaiAttr b("SAI_ROUTER_INTERFACE_ATTR_MTU", "9100", pool);
+    SaiAttr c("SAI_PORT_ATTR_MTU", "1500", pool);
+
+    EXPECT_EQ(&a.getStrAttrValue(), &b.getStrAttrValue());
+    EXPECT_NE(&a.getStrAttrValue(), &c.getStrAttrValue());
+
+    EXPECT_EQ(pool.size(), 2);
+
+    // pool holds the same strings as attributes, not its own copies
+
+    for (auto& value: pool)
+    {
+        EXPECT_TRUE(value.get() == &a.getStrAttrValue() || value.get() == &c.getStrAttrValue());
+    }
+
+    // updated value is not shared anymore
+
+    a.getRWSaiAttr()->value.u32 = 1500;
+    a.updateValue();
+
+    EXPECT_EQ(a.getStrAttrValue(), "1500");
+    EXPECT_EQ(b.getStrAttrValue(), "9100");
+}
@@ -0,0 +1,198 @@
+#include "BestCandidateFinder.h"
+#include "VidManager.h"
+
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+
+using namespace syncd;
+
+typedef std::map<sai_object_id_t, sai_object_id_t> Selection;
+
+static sai_object_id_t makeVid(
+        _In_ sai_object_type_t objectType,
+        _In_ uint64_t index)
+{
+    SWSS_LOG_ENTER();
+
+    // switch index 0, object type on bits 48..55
+
+    return (((uint64_t)objectType) << 48) | index;
+}
+
+static std::string key(
+        _In_ sai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    return sai_serialize_object_type(VidManager::objectTypeQuery(vid)) + ":" + sai_serialize_object_id(vid);
+}
+
+static std::string ipAddress(
+        _In_ uint32_t idx)
+{
+    SWSS_LOG_ENTER();
+
+    sai_ip_address_t ip;
+
+    ip.addr_family = SAI_IP_ADDR_FAMILY_IPV4;
+    ip.addr.ip4 = htonl(0x0a000000 | idx);
+
+    return sai_serialize_ip_address(ip);
+}
+
+static void populateCurrent(
+        _Inout_ AsicView& view)
+{
+    SWSS_LOG_ENTER();
+
+    swss::TableDump dump;
+
+    auto rif = makeVid(SAI_OBJECT_TYPE_ROUTER_INTERFACE, 1);
+
+    dump[key(rif)]["NULL"] = "NULL";
+
+    // next hops, one per ip address
+
+    for (uint32_t idx = 0; idx < 4; idx++)
+    {
+        auto nh = key(makeVid(SAI_OBJECT_TYPE_NEXT_HOP, 0x10 + idx));
+
+        dump[nh]["SAI_NEXT_HOP_ATTR_TYPE"] = "SAI_NEXT_HOP_TYPE_IP";
+        dump[nh]["SAI_NEXT_HOP_ATTR_IP"] = ipAddress(idx);
+        dump[nh]["SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID"] = sai_serialize_object_id(rif);
+    }
+
+    // unique scheduler
+
+    dump[key(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x20))]["SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT"] = "10";
+
+    // two identical schedulers
+
+    dump[key(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x21))]["SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT"] = "20";
+    dump[key(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x22))]["SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT"] = "20";
+
+    // scheduler with same weight, and the one with additional attribute
+
+    dump[key(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x23))]["SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT"] = "30";
+    dump[key(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x24))]["SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT"] = "30";
+    dump[key(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x24))]["SAI_SCHEDULER_ATTR_MIN_BANDWIDTH_RATE"] = "100";
+
+    // scheduler which only partially matches
+
+    dump[key(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x25))]["SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT"] = "40";
+    dump[key(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x25))]["SAI_SCHEDULER_ATTR_MIN_BANDWIDTH_RATE"] = "200";
+
+    view.fromDump(dump);
+
+    view.m_vidToRid[rif] = 0x1;
+    view.m_ridToVid[0x1] = rif;
+}
+
+static void populateTemporary(
+        _Inout_ AsicView& view)
+{
+    SWSS_LOG_ENTER();
+
+    swss::TableDump dump;
+
+    auto rif = makeVid(SAI_OBJECT_TYPE_ROUTER_INTERFACE, 0x101);
+
+    dump[key(rif)]["NULL"] = "NULL";
+
+    // next hops in reverse order, on matched router interface
+
+    for (uint32_t idx = 0; idx < 4; idx++)
+    {
+        auto nh = key(makeVid(SAI_OBJECT_TYPE_NEXT_HOP, 0x110 + idx));
+
+        dump[nh]["SAI_NEXT_HOP_ATTR_TYPE"] = "SAI_NEXT_HOP_TYPE_IP";
+        dump[nh]["SAI_NEXT_HOP_ATTR_IP"] = ipAddress(3 - idx);
+        dump[nh]["SAI_NEXT_HOP_ATTR_ROUTER_INTERFACE_ID"] = sai_serialize_object_id(rif);
+    }
+
+    dump[key(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x120))]["SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT"] = "10";
+    dump[key(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x121))]["SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT"] = "20";
+    dump[key(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x123))]["SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT"] = "30";
+    dump[key(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x125))]["SAI_SCHEDULER_ATTR_SCHEDULING_WEIGHT"] = "40";
+
+    view.fromDump(dump);
+
+    view.m_vidToRid[rif] = 0x1;
+    view.m_ridToVid[0x1] = rif;
+}
+
+static Selection findBestMatches(
+        _In_ bool useSignatureIndex)
+{
+    SWSS_LOG_ENTER();
+
+    AsicView current;
+    AsicView temporary;
+
+    populateCurrent(current);
+    populateTemporary(temporary);
+
+    if (!useSignatureIndex)
+    {
+        // index which is not complete is never used
+
+        for (auto ot: { SAI_OBJECT_TYPE_NEXT_HOP, SAI_OBJECT_TYPE_SCHEDULER })
+        {
+            current.m_signatureIndex[ot].complete = false;
+            current.m_signatureIndex[ot].maxAttrCount = 0;
+        }
+    }
+
+    BestCandidateFinder::seedRandom(1);
+
+    Selection selection;
+
+    for (auto ot: { SAI_OBJECT_TYPE_NEXT_HOP, SAI_OBJECT_TYPE_SCHEDULER })
+    {
+        for (auto& tmp: temporary.getObjectsByObjectType(ot))
+        {
+            BestCandidateFinder bcf(current, temporary, nullptr);
+
+            auto cur = bcf.findCurrentBestMatch(tmp);
+
+            selection[tmp->getVid()] = cur ? cur->getVid() : SAI_NULL_OBJECT_ID;
+
+            if (cur)
+            {
+                cur->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
+                tmp->setObjectStatus(SAI_OBJECT_STATUS_FINAL);
+            }
+        }
+    }
+
+    return selection;
+}
+
+TEST(BestCandidateFinder, signatureIndexSelection)
+{
+    auto selection = findBestMatches(true);
+
+    // next hops with all attributes equal
+
+    for (uint32_t idx = 0; idx < 4; idx++)
+    {
+        EXPECT_EQ(selection.at(makeVid(SAI_OBJECT_TYPE_NEXT_HOP, 0x110 + idx)),
+                makeVid(SAI_OBJECT_TYPE_NEXT_HOP, 0x10 + 3 - idx));
+    }
+
+    EXPECT_EQ(selection.at(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x120)), makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x20));
+    EXPECT_EQ(selection.at(makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x125)), makeVid(SAI_OBJECT_TYPE_SCHEDULER, 0x25));
+}
+
+TEST(BestCandidateFinder, signatureIndexSameAsFullCompare)
+{
+    // selection with index must be the same as with comparing all objects,
+    // including identical objects and objects with additional attributes
+
+    EXPECT_EQ(findBestMatches(true), findBestMatches(false));
+}
@@ -12,7 +12,7 @@ TEST(CommandLineOptions, getCommandLineString)
 
     EXPECT_EQ(str, " EnableDiagShell=NO EnableTempView=NO DisableExitSleep=NO EnableUnittests=NO"
             " EnableConsistencyCheck=NO EnableSyncMode=NO RedisCommunicationMode=redis_async"
-            " EnableSaiBulkSuport=NO StartType=cold ProfileMapFile= GlobalContext=0 ContextConfig= BreakConfig=");
+            " EnableSaiBulkSuport=NO BulkPrepareThreads=0 DisableParallelApplyView=NO DisableLatencyHistograms=NO AsicAuditInterval=0 AsicAuditBudget=5000 VendorLockPolicy=unknown StartType=cold ProfileMapFile= GlobalContext=0 ContextConfig= BreakConfig=");
 }
 
 TEST(CommandLineOptions, startTypeStringToStartType)
@@ -21,3 +21,12 @@ TEST(CommandLineOptions, startTypeStringToStartType)
 
     EXPECT_EQ(st, SAI_START_TYPE_UNKNOWN);
 }
+
+TEST(CommandLineOptions, lockPolicyStringToLockPolicy)
+{
+    EXPECT_EQ(syncd::CommandLineOptions::lockPolicyStringToLockPolicy("foo"), VENDOR_SAI_LOCK_POLICY_UNKNOWN);
+
+    EXPECT_EQ(syncd::CommandLineOptions::lockPolicyStringToLockPolicy("lanes"), VENDOR_SAI_LOCK_POLICY_LANES);
+
+    EXPECT_EQ(syncd::CommandLineOptions::lockPolicyToString(VENDOR_SAI_LOCK_POLICY_CONCURRENT), "concurrent");
+}
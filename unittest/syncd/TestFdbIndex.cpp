@@ -0,0 +1,75 @@
+#include "FdbIndex.h"
+
+#include "swss/logger.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace syncd;
+
+static void insertEntry(
+        _In_ FdbIndex& index,
+        _In_ const std::string& key,
+        _In_ sai_object_id_t bvId,
+        _In_ const std::string& port,
+        _In_ const std::string& type)
+{
+    SWSS_LOG_ENTER();
+
+    sai_fdb_entry_t fdbEntry;
+
+    memset(&fdbEntry, 0, sizeof(fdbEntry));
+
+    fdbEntry.bv_id = bvId;
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID", port);
+    values.emplace_back("SAI_FDB_ENTRY_ATTR_TYPE", type);
+
+    index.insert(key, fdbEntry, values);
+}
+
+TEST(FdbIndex, flush)
+{
+    FdbIndex index;
+
+    insertEntry(index, "a", 0x26000000000001, "oid:0x3a000000000001", "SAI_FDB_ENTRY_TYPE_DYNAMIC");
+    insertEntry(index, "b", 0x26000000000001, "oid:0x3a000000000002", "SAI_FDB_ENTRY_TYPE_DYNAMIC");
+    insertEntry(index, "c", 0x26000000000002, "oid:0x3a000000000001", "SAI_FDB_ENTRY_TYPE_DYNAMIC");
+    insertEntry(index, "d", 0x26000000000002, "oid:0x3a000000000001", "SAI_FDB_ENTRY_TYPE_STATIC");
+
+    EXPECT_EQ(index.size(), 4);
+
+    auto keys = index.flush(0x3a000000000001, SAI_NULL_OBJECT_ID, SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC);
+
+    std::sort(keys.begin(), keys.end());
+
+    EXPECT_EQ(keys, std::vector<std::string>({ "a", "c" }));
+
+    keys = index.flush(SAI_NULL_OBJECT_ID, 0x26000000000002, SAI_FDB_FLUSH_ENTRY_TYPE_ALL);
+
+    EXPECT_EQ(keys, std::vector<std::string>({ "d" }));
+
+    EXPECT_EQ(index.size(), 1);
+}
+
+TEST(FdbIndex, setAttribute)
+{
+    FdbIndex index;
+
+    insertEntry(index, "a", 0x26000000000001, "oid:0x3a000000000001", "SAI_FDB_ENTRY_TYPE_DYNAMIC");
+
+    // fdb move
+
+    index.setAttribute("a", "SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID", "oid:0x3a000000000002");
+
+    EXPECT_EQ(index.flush(0x3a000000000001, SAI_NULL_OBJECT_ID, SAI_FDB_FLUSH_ENTRY_TYPE_ALL).size(), 0);
+    EXPECT_EQ(index.flush(0x3a000000000002, SAI_NULL_OBJECT_ID, SAI_FDB_FLUSH_ENTRY_TYPE_STATIC).size(), 0);
+    EXPECT_EQ(index.flush(0x3a000000000002, SAI_NULL_OBJECT_ID, SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC).size(), 1);
+
+    index.remove("a");
+
+    EXPECT_EQ(index.size(), 0);
+}
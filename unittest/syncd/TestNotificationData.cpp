@@ -0,0 +1,70 @@
+#include "NotificationData.h"
+
+#include "sairediscommon.h"
+
+#include "meta/sai_serialize.h"
+
+#include <gtest/gtest.h>
+
+using namespace syncd;
+
+static std::string fdbData =
+"[{\"fdb_entry\":\"{\\\"bvid\\\":\\\"oid:0x260000000005be\\\",\\\"mac\\\":\\\"52:54:00:86:DD:7A\\\",\\\"switch_id\\\":\\\"oid:0x21000000000000\\\"}\","
+"\"fdb_event\":\"SAI_FDB_EVENT_LEARNED\","
+"\"list\":[{\"id\":\"SAI_FDB_ENTRY_ATTR_TYPE\",\"value\":\"SAI_FDB_ENTRY_TYPE_DYNAMIC\"},{\"id\":\"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID\",\"value\":\"oid:0x3a000000000660\"}]}]";
+
+TEST(NotificationData, fdbEventDeepCopy)
+{
+    uint32_t count;
+    sai_fdb_event_notification_data_t *data = NULL;
+
+    sai_deserialize_fdb_event_ntf(fdbData, count, &data);
+
+    NotificationData ntf(count, data);
+
+    // vendor memory can be released right after callback returns
+
+    sai_deserialize_free_fdb_event_ntf(count, data);
+
+    EXPECT_EQ(ntf.getType(), SAI_SWITCH_NOTIFICATION_TYPE_FDB_EVENT);
+    EXPECT_EQ(ntf.getName(), SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT);
+    EXPECT_EQ(ntf.getCount(), 1);
+    EXPECT_EQ(ntf.serialize(), fdbData);
+
+    ntf.getFdbEventData()[0].attr[1].value.oid = 0x3a000000000661;
+
+    EXPECT_NE(ntf.serialize(), fdbData);
+
+    EXPECT_THROW(ntf.getNatEventData(), std::runtime_error);
+}
+
+TEST(NotificationData, fdbEventCopyFailure)
+{
+    uint32_t count;
+    sai_fdb_event_notification_data_t *data = NULL;
+
+    sai_deserialize_fdb_event_ntf("[" + fdbData.substr(1, fdbData.size() - 2) + "," + fdbData.substr(1), count, &data);
+
+    ASSERT_EQ(count, 2);
+
+    // attributes of first event are already copied when second one fails
+
+    data[1].attr[0].id = 0xffff;
+
+    EXPECT_THROW(NotificationData(count, data), std::runtime_error);
+
+    data[1].attr[0].id = SAI_FDB_ENTRY_ATTR_TYPE;
+
+    sai_deserialize_free_fdb_event_ntf(count, data);
+}
+
+TEST(NotificationData, deserialize)
+{
+    auto ntf = NotificationData::deserialize(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_SHUTDOWN_REQUEST,
+            "{\"switch_id\":\"oid:0x21000000000000\"}");
+
+    EXPECT_EQ(ntf->getType(), SAI_SWITCH_NOTIFICATION_TYPE_SWITCH_SHUTDOWN_REQUEST);
+    EXPECT_EQ(ntf->getSwitchId(), 0x21000000000000);
+
+    EXPECT_THROW(NotificationData::deserialize("foo", "bar"), std::runtime_error);
+}
@@ -20,7 +20,7 @@ TEST(NotificationProcessor, NotificationProcessorTest)
     auto producer = std::make_shared<syncd::RedisNotificationProducer>("ASIC_DB");
 
     auto notificationProcessor = std::make_shared<NotificationProcessor>(producer, client,
-                                                             [](const swss::KeyOpFieldsValuesTuple&){});
+                                                             [](NotificationData&){});
     EXPECT_NE(notificationProcessor, nullptr);
 
     auto switchConfigContainer = std::make_shared<sairedis::SwitchConfigContainer>();
@@ -50,3 +50,54 @@ TEST(NotificationProcessor, NotificationProcessorTest)
     translator->eraseRidAndVid(0x21000000000000,0x210000000000);
     translator->eraseRidAndVid(0x3000000000048,0x30000000048);
 }
+
+TEST(NotificationProcessor, fdbEventBatch)
+{
+    auto sai = std::make_shared<saivs::Sai>();
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+    auto producer = std::make_shared<syncd::RedisNotificationProducer>("ASIC_DB");
+
+    auto notificationProcessor = std::make_shared<NotificationProcessor>(producer, client,
+                                                             [](NotificationData&){});
+
+    auto switchConfigContainer = std::make_shared<sairedis::SwitchConfigContainer>();
+    auto redisVidIndexGenerator = std::make_shared<sairedis::RedisVidIndexGenerator>(dbAsic, REDIS_KEY_VIDCOUNTER);
+    auto virtualObjectIdManager = std::make_shared<sairedis::VirtualObjectIdManager>(0, switchConfigContainer, redisVidIndexGenerator);
+    auto translator = std::make_shared<VirtualOidTranslator>(client, virtualObjectIdManager, sai);
+
+    notificationProcessor->m_translator = translator;
+
+    translator->insertRidAndVid(0x21000000000000, 0x21000000000000);
+    translator->insertRidAndVid(0x260000000005be, 0x26000000000001);
+    translator->insertRidAndVid(0x3a000000000660, 0x3a000000000001);
+
+    // two learned entries and aged first one, all in single notification
+
+    std::string fdbData =
+        "[{\"fdb_entry\":\"{\\\"bvid\\\":\\\"oid:0x260000000005be\\\",\\\"mac\\\":\\\"52:54:00:86:DD:7A\\\",\\\"switch_id\\\":\\\"oid:0x21000000000000\\\"}\","
+        "\"fdb_event\":\"SAI_FDB_EVENT_LEARNED\","
+        "\"list\":[{\"id\":\"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID\",\"value\":\"oid:0x3a000000000660\"}]},"
+        "{\"fdb_entry\":\"{\\\"bvid\\\":\\\"oid:0x260000000005be\\\",\\\"mac\\\":\\\"52:54:00:86:DD:7B\\\",\\\"switch_id\\\":\\\"oid:0x21000000000000\\\"}\","
+        "\"fdb_event\":\"SAI_FDB_EVENT_LEARNED\","
+        "\"list\":[{\"id\":\"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID\",\"value\":\"oid:0x3a000000000660\"}]},"
+        "{\"fdb_entry\":\"{\\\"bvid\\\":\\\"oid:0x260000000005be\\\",\\\"mac\\\":\\\"52:54:00:86:DD:7A\\\",\\\"switch_id\\\":\\\"oid:0x21000000000000\\\"}\","
+        "\"fdb_event\":\"SAI_FDB_EVENT_AGED\","
+        "\"list\":[{\"id\":\"SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID\",\"value\":\"oid:0x3a000000000660\"}]}]";
+
+    std::vector<swss::FieldValueTuple> fdbEntry;
+    swss::KeyOpFieldsValuesTuple fdbFV(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, fdbData, fdbEntry);
+
+    notificationProcessor->syncProcessNotification(fdbFV);
+
+    std::string prefix = "ASIC_STATE:SAI_OBJECT_TYPE_FDB_ENTRY:{\"bvid\":\"oid:0x26000000000001\",\"mac\":";
+
+    EXPECT_FALSE(dbAsic->exists(prefix + "\"52:54:00:86:DD:7A\",\"switch_id\":\"oid:0x21000000000000\"}"));
+    EXPECT_TRUE(dbAsic->exists(prefix + "\"52:54:00:86:DD:7B\",\"switch_id\":\"oid:0x21000000000000\"}"));
+
+    dbAsic->del(prefix + "\"52:54:00:86:DD:7B\",\"switch_id\":\"oid:0x21000000000000\"}");
+
+    translator->eraseRidAndVid(0x21000000000000, 0x21000000000000);
+    translator->eraseRidAndVid(0x260000000005be, 0x26000000000001);
+    translator->eraseRidAndVid(0x3a000000000660, 0x3a000000000001);
+}
@@ -17,14 +17,12 @@ TEST(NotificationQueue, EnqueueLimitTest)
 {
     bool status;
     int i;
-    std::vector<swss::FieldValueTuple> fdbEntry;
-    std::vector<swss::FieldValueTuple> sscEntry;
 
     // Set up a queue with limit at 5 and threshold at 3 where after this is reached event starts dropping
     syncd::NotificationQueue testQ(5, 3);
 
     // Try queue up 5 fake FDB event and expect them to be added successfully
-    swss::KeyOpFieldsValuesTuple fdbItem(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, fdbData, fdbEntry);
+    auto fdbItem = NotificationData::deserialize(SAI_SWITCH_NOTIFICATION_NAME_FDB_EVENT, fdbData);
     for (i = 0; i < 5; ++i)
     {
         status = testQ.enqueue(fdbItem);
@@ -36,7 +34,7 @@ TEST(NotificationQueue, EnqueueLimitTest)
     EXPECT_EQ(status, false);
 
     // Add 2 switch state change events expect both are accepted as consecutive limit not yet reached
-    swss::KeyOpFieldsValuesTuple sscItem(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE, sscData, sscEntry);
+    auto sscItem = NotificationData::deserialize(SAI_SWITCH_NOTIFICATION_NAME_SWITCH_STATE_CHANGE, sscData);
     for (i = 0; i < 2; ++i)
     {
         status = testQ.enqueue(sscItem);
@@ -0,0 +1,456 @@
+#include "RedisClient.h"
+
+#include "lib/sairediscommon.h"
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+#include "swss/redisreply.h"
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <algorithm>
+#include <cstring>
+
+using namespace syncd;
+
+typedef std::map<std::string, std::map<std::string, std::string>> DbDump;
+
+static DbDump dumpDb(
+        _In_ swss::DBConnector& db)
+{
+    SWSS_LOG_ENTER();
+
+    DbDump dump;
+
+    for (auto& key: db.keys("*"))
+    {
+        auto& hash = dump[key];
+
+        db.hgetall(key, std::inserter(hash, hash.end()));
+    }
+
+    return dump;
+}
+
+static void setCurrentState(
+        _In_ swss::DBConnector& db)
+{
+    SWSS_LOG_ENTER();
+
+    swss::RedisReply r(&db, "FLUSHDB", REDIS_REPLY_STATUS);
+
+    db.hset(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_PORT:oid:0x1000000000001", "SAI_PORT_ATTR_MTU", "1500");
+    db.hset(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_PORT:oid:0x1000000000001", "SAI_PORT_ATTR_SPEED", "10000");
+    db.hset(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_PORT:oid:0x1000000000001", "SAI_PORT_ATTR_ADMIN_STATE", "true");
+    db.hset(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_PORT:oid:0x1000000000002", "SAI_PORT_ATTR_MTU", "9100");
+    db.hset(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000003", "NULL", "NULL");
+
+    db.hset(TEMP_PREFIX ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_PORT:oid:0x1000000000001", "SAI_PORT_ATTR_MTU", "9100");
+    db.hset(TEMP_PREFIX ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_PORT:oid:0x1000000000004", "SAI_PORT_ATTR_MTU", "1500");
+
+    db.hset("VIDTORID", "oid:0x1000000000001", "oid:0x1");
+    db.hset("VIDTORID", "oid:0x1000000000002", "oid:0x2");
+    db.hset("VIDTORID", "oid:0x3000000000003", "oid:0x3");
+    db.hset("RIDTOVID", "oid:0x1", "oid:0x1000000000001");
+    db.hset("RIDTOVID", "oid:0x2", "oid:0x1000000000002");
+    db.hset("RIDTOVID", "oid:0x3", "oid:0x3000000000003");
+
+    db.hset("LANES", "1", "oid:0x1");
+}
+
+TEST(RedisClient, updateAsicState)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    // current view as it's stored in ASIC_STATE, without table prefix
+
+    setCurrentState(*dbAsic);
+
+    swss::TableDump currentView;
+
+    for (auto& kvp: dumpDb(*dbAsic))
+    {
+        if (kvp.first.rfind(ASIC_STATE_TABLE ":", 0) == 0)
+        {
+            currentView[kvp.first.substr(strlen(ASIC_STATE_TABLE ":"))] = kvp.second;
+        }
+    }
+
+    ASSERT_EQ(currentView.size(), 3);
+
+    // port 1 modified, port 2 removed, router unchanged, port 4 created
+
+    swss::TableDump newView;
+
+    newView["SAI_OBJECT_TYPE_PORT:oid:0x1000000000001"]["SAI_PORT_ATTR_MTU"] = "9100";
+    newView["SAI_OBJECT_TYPE_PORT:oid:0x1000000000001"]["SAI_PORT_ATTR_SPEED"] = "10000";
+    newView["SAI_OBJECT_TYPE_VIRTUAL_ROUTER:oid:0x3000000000003"]["NULL"] = "NULL";
+    newView["SAI_OBJECT_TYPE_PORT:oid:0x1000000000004"]["SAI_PORT_ATTR_MTU"] = "1500";
+
+    std::unordered_map<sai_object_id_t, sai_object_id_t> vid2rid;
+
+    vid2rid[0x1000000000001] = 0x1;
+    vid2rid[0x3000000000003] = 0x3;
+    vid2rid[0x1000000000004] = 0x4;
+
+    // expected state is produced by full rewrite, the way it was done before
+
+    {
+        RedisClient client(dbAsic);
+
+        client.removeAsicStateTable();
+        client.removeTempAsicStateTable();
+
+        for (auto& kvp: newView)
+        {
+            sai_object_meta_key_t metaKey;
+
+            sai_deserialize_object_meta_key(kvp.first, metaKey);
+
+            std::vector<swss::FieldValueTuple> values(kvp.second.begin(), kvp.second.end());
+
+            client.createAsicObject(metaKey, values);
+        }
+
+        client.setVidAndRidMap(vid2rid);
+    }
+
+    auto expected = dumpDb(*dbAsic);
+
+    setCurrentState(*dbAsic);
+
+    RedisClient client(dbAsic);
+
+    client.updateAsicState(currentView, newView, vid2rid);
+
+    EXPECT_EQ(dumpDb(*dbAsic), expected);
+
+    EXPECT_EQ(expected.count(TEMP_PREFIX ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_PORT:oid:0x1000000000004"), 0);
+    EXPECT_EQ(expected.count(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_PORT:oid:0x1000000000002"), 0);
+    EXPECT_EQ(expected.at("LANES").size(), 1);
+
+    // applying the same view again doesn't change anything
+
+    client.updateAsicState(newView, newView, vid2rid);
+
+    EXPECT_EQ(dumpDb(*dbAsic), expected);
+}
+
+TEST(RedisClient, updateFdbIndex)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::RedisReply r(dbAsic.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    RedisClient client(dbAsic);
+
+    sai_object_id_t switchId = 0x21000000000000;
+    sai_object_id_t bvId = 0x26000000000001;
+
+    // first flush builds index from empty ASIC DB
+
+    client.processFlushEvent(switchId, SAI_NULL_OBJECT_ID, SAI_NULL_OBJECT_ID, SAI_FDB_FLUSH_ENTRY_TYPE_ALL);
+
+    std::vector<sai_object_meta_key_t> metaKeys;
+
+    for (uint8_t idx = 0; idx < 3; idx++)
+    {
+        sai_object_meta_key_t mk;
+
+        mk.objecttype = SAI_OBJECT_TYPE_FDB_ENTRY;
+
+        memset(&mk.objectkey.key.fdb_entry, 0, sizeof(mk.objectkey.key.fdb_entry));
+
+        mk.objectkey.key.fdb_entry.switch_id = switchId;
+        mk.objectkey.key.fdb_entry.bv_id = bvId;
+        mk.objectkey.key.fdb_entry.mac_address[5] = idx;
+
+        metaKeys.push_back(mk);
+
+        // consumer table is modifying ASIC DB on asynchronous mode
+
+        std::vector<swss::FieldValueTuple> values;
+
+        values.emplace_back("SAI_FDB_ENTRY_ATTR_TYPE", "SAI_FDB_ENTRY_TYPE_DYNAMIC");
+        values.emplace_back("SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID", "oid:0x3a000000000001");
+
+        auto key = ASIC_STATE_TABLE ":" + sai_serialize_object_meta_key(mk);
+
+        for (auto& fv: values)
+        {
+            dbAsic->hset(key, fvField(fv), fvValue(fv));
+        }
+
+        client.updateFdbIndex(SAI_COMMON_API_CREATE, mk, values);
+    }
+
+    // entry 1 moved to other port, entry 2 removed
+
+    std::vector<swss::FieldValueTuple> move { { "SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID", "oid:0x3a000000000002" } };
+
+    dbAsic->hset(ASIC_STATE_TABLE ":" + sai_serialize_object_meta_key(metaKeys[1]), "SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID", "oid:0x3a000000000002");
+
+    client.updateFdbIndex(SAI_COMMON_API_SET, metaKeys[1], move);
+
+    dbAsic->del(ASIC_STATE_TABLE ":" + sai_serialize_object_meta_key(metaKeys[2]));
+
+    client.updateFdbIndex(SAI_COMMON_API_REMOVE, metaKeys[2], {});
+
+    client.processFlushEvent(switchId, 0x3a000000000001, bvId, SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC);
+
+    auto keys = dbAsic->keys(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_FDB_ENTRY:*");
+
+    ASSERT_EQ(keys.size(), 1);
+
+    EXPECT_EQ(keys.at(0), ASIC_STATE_TABLE ":" + sai_serialize_object_meta_key(metaKeys[1]));
+}
+
+static sai_object_meta_key_t fdbMetaKey(
+        _In_ uint8_t mac)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_meta_key_t mk;
+
+    mk.objecttype = SAI_OBJECT_TYPE_FDB_ENTRY;
+
+    memset(&mk.objectkey.key.fdb_entry, 0, sizeof(mk.objectkey.key.fdb_entry));
+
+    mk.objectkey.key.fdb_entry.switch_id = 0x21000000000000;
+    mk.objectkey.key.fdb_entry.bv_id = 0x26000000000001;
+    mk.objectkey.key.fdb_entry.mac_address[5] = mac;
+
+    return mk;
+}
+
+static std::vector<swss::FieldValueTuple> fdbValues(
+        _In_ const std::string& port)
+{
+    SWSS_LOG_ENTER();
+
+    return {
+        { "SAI_FDB_ENTRY_ATTR_TYPE", "SAI_FDB_ENTRY_TYPE_DYNAMIC" },
+        { "SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID", port } };
+}
+
+static std::vector<std::string> fdbKeys(
+        _In_ swss::DBConnector& db)
+{
+    SWSS_LOG_ENTER();
+
+    auto keys = db.keys(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_FDB_ENTRY:*");
+
+    std::sort(keys.begin(), keys.end());
+
+    return keys;
+}
+
+TEST(RedisClient, asicStateBatchFlushInvalidIndex)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::RedisReply r(dbAsic.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    RedisClient client(dbAsic);
+
+    client.createAsicObject(fdbMetaKey(1), fdbValues("oid:0x3a000000000001"));
+
+    auto before = fdbKeys(*dbAsic);
+
+    ASSERT_EQ(before.size(), 1);
+
+    // index is not valid yet, so flush will rebuild it inside batch
+
+    client.beginAsicStateBatch();
+
+    client.createAsicObject(fdbMetaKey(2), fdbValues("oid:0x3a000000000001"));
+    client.createAsicObject(fdbMetaKey(3), fdbValues("oid:0x3a000000000002"));
+
+    client.processFlushEvent(0x21000000000000, 0x3a000000000001, SAI_NULL_OBJECT_ID, SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC);
+
+    // nothing is committed before batch end
+
+    EXPECT_EQ(fdbKeys(*dbAsic), before);
+
+    client.endAsicStateBatch();
+
+    auto after = fdbKeys(*dbAsic);
+
+    ASSERT_EQ(after.size(), 1);
+
+    EXPECT_EQ(after.at(0), ASIC_STATE_TABLE ":" + sai_serialize_object_meta_key(fdbMetaKey(3)));
+}
+
+TEST(RedisClient, discardAsicStateBatch)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::RedisReply r(dbAsic.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    RedisClient client(dbAsic);
+
+    EXPECT_THROW(client.discardAsicStateBatch(), std::runtime_error);
+
+    client.beginAsicStateBatch();
+
+    client.createAsicObject(fdbMetaKey(1), fdbValues("oid:0x3a000000000001"));
+
+    client.discardAsicStateBatch();
+
+    EXPECT_EQ(fdbKeys(*dbAsic).size(), 0);
+
+    // next batch starts new transaction
+
+    client.beginAsicStateBatch();
+
+    client.createAsicObject(fdbMetaKey(2), fdbValues("oid:0x3a000000000001"));
+
+    client.endAsicStateBatch();
+
+    EXPECT_EQ(fdbKeys(*dbAsic).size(), 1);
+
+    // index doesn't contain discarded entry
+
+    client.processFlushEvent(0x21000000000000, 0x3a000000000001, SAI_NULL_OBJECT_ID, SAI_FDB_FLUSH_ENTRY_TYPE_DYNAMIC);
+
+    EXPECT_EQ(fdbKeys(*dbAsic).size(), 0);
+}
+
+TEST(RedisClient, discardAsicStateBatch_queuedReplies)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::RedisReply r(dbAsic.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    RedisClient client(dbAsic);
+
+    client.beginAsicStateBatch();
+
+    // more commands than transaction buffer, so QUEUED replies are read
+    // before DISCARD
+
+    for (int idx = 0; idx < 1200; idx++)
+    {
+        auto mk = fdbMetaKey((uint8_t)idx);
+
+        mk.objectkey.key.fdb_entry.mac_address[4] = (uint8_t)(idx >> 8);
+
+        client.createAsicObject(mk, fdbValues("oid:0x3a000000000001"));
+    }
+
+    client.discardAsicStateBatch();
+
+    EXPECT_EQ(fdbKeys(*dbAsic).size(), 0);
+
+    client.beginAsicStateBatch();
+
+    client.createAsicObject(fdbMetaKey(1), fdbValues("oid:0x3a000000000001"));
+
+    client.endAsicStateBatch();
+
+    EXPECT_EQ(fdbKeys(*dbAsic).size(), 1);
+}
+
+TEST(RedisClient, endAsicStateBatch_commandError)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::RedisReply r(dbAsic.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    auto key = ASIC_STATE_TABLE ":" + sai_serialize_object_meta_key(fdbMetaKey(1));
+
+    // HSET on string key fails inside transaction with WRONGTYPE error
+
+    dbAsic->set(key, "foo");
+
+    RedisClient client(dbAsic);
+
+    client.beginAsicStateBatch();
+
+    client.createAsicObject(fdbMetaKey(1), fdbValues("oid:0x3a000000000001"));
+    client.createAsicObject(fdbMetaKey(2), fdbValues("oid:0x3a000000000001"));
+
+    EXPECT_THROW(client.endAsicStateBatch(), std::runtime_error);
+
+    // batch is not active any more, and next one can be committed
+
+    client.beginAsicStateBatch();
+
+    client.createAsicObject(fdbMetaKey(3), fdbValues("oid:0x3a000000000001"));
+
+    client.endAsicStateBatch();
+
+    EXPECT_EQ(fdbKeys(*dbAsic).size(), 3);
+}
+
+TEST(RedisClient, removePortsFromLanesMap)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::RedisReply r(dbAsic.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    RedisClient client(dbAsic);
+
+    sai_object_id_t switchVid = 0x21000000000000;
+
+    client.setPortLanes(switchVid, 0x1001, { 1, 2, 3, 4 });
+    client.setPortLanes(switchVid, 0x1002, { 5, 6 });
+    client.setPortLanes(switchVid, 0x1003, { 7 });
+
+    // port without lanes is reported with zero count
+
+    auto removed = client.removePortsFromLanesMap(switchVid, { 0x1001, 0x1003, 0x1004 });
+
+    ASSERT_EQ(removed.size(), 3);
+
+    EXPECT_EQ(removed.at(0x1001), 4);
+    EXPECT_EQ(removed.at(0x1003), 1);
+    EXPECT_EQ(removed.at(0x1004), 0);
+
+    auto map = client.getLaneMap(switchVid);
+
+    ASSERT_EQ(map.size(), 2);
+
+    EXPECT_EQ(map.at(5), 0x1002);
+    EXPECT_EQ(map.at(6), 0x1002);
+
+    EXPECT_EQ(client.removePortFromLanesMap(switchVid, 0x1001), 0);
+    EXPECT_EQ(client.removePortFromLanesMap(switchVid, 0x1002), 2);
+
+    EXPECT_EQ(client.getLaneMap(switchVid).size(), 0);
+}
+
+TEST(RedisClient, setPortLanes_batch)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::RedisReply r(dbAsic.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    RedisClient client(dbAsic);
+
+    sai_object_id_t switchVid = 0x21000000000000;
+
+    client.beginAsicStateBatch();
+
+    client.setDummyAsicStateObject(0x1000000000001);
+
+    client.setPortLanes(switchVid, 0x1001, { 1, 2 });
+
+    // port without lanes doesn't break the batch
+
+    client.setPortLanes(switchVid, 0x1002, { });
+
+    EXPECT_EQ(client.getLaneMap(switchVid).size(), 0);
+
+    client.endAsicStateBatch();
+
+    auto map = client.getLaneMap(switchVid);
+
+    ASSERT_EQ(map.size(), 2);
+
+    EXPECT_EQ(map.at(1), 0x1001);
+    EXPECT_EQ(map.at(2), 0x1001);
+
+    EXPECT_TRUE(dbAsic->exists(ASIC_STATE_TABLE ":SAI_OBJECT_TYPE_PORT:oid:0x1000000000001"));
+}
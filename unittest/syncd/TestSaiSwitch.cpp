@@ -0,0 +1,280 @@
+#include "SaiSwitch.h"
+#include "VirtualOidTranslator.h"
+#include "RedisClient.h"
+#include "VidManager.h"
+#include "ServiceMethodTable.h"
+#include "lib/RedisVidIndexGenerator.h"
+#include "lib/sairediscommon.h"
+#include "meta/sai_serialize.h"
+#include "vslib/Sai.h"
+
+#include "swss/logger.h"
+#include "swss/redisreply.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace syncd;
+using namespace std::placeholders;
+
+static std::map<std::string, std::string> profileMap;
+
+static std::map<std::string, std::string>::iterator profileIter;
+
+static const char* profileGetValue(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable)
+{
+    SWSS_LOG_ENTER();
+
+    if (variable == NULL)
+    {
+        return NULL;
+    }
+
+    auto it = profileMap.find(variable);
+
+    if (it == profileMap.end())
+    {
+        return NULL;
+    }
+
+    return it->second.c_str();
+}
+
+static int profileGetNextValue(
+        _In_ sai_switch_profile_id_t profile_id,
+        _Out_ const char** variable,
+        _Out_ const char** value)
+{
+    SWSS_LOG_ENTER();
+
+    if (value == NULL)
+    {
+        profileIter = profileMap.begin();
+        return 0;
+    }
+
+    if (variable == NULL || profileIter == profileMap.end())
+    {
+        return -1;
+    }
+
+    *variable = profileIter->first.c_str();
+    *value = profileIter->second.c_str();
+
+    profileIter++;
+
+    return 0;
+}
+
+static std::string asicKey(
+        _In_ sai_object_id_t vid)
+{
+    SWSS_LOG_ENTER();
+
+    return ASIC_STATE_TABLE ":" + sai_serialize_object_type(VidManager::objectTypeQuery(vid)) + ":" + sai_serialize_object_id(vid);
+}
+
+/**
+ * @brief Get queues, ipgs, scheduler groups and serdes of given port.
+ */
+static std::vector<sai_object_id_t> getPortRelatedObjects(
+        _In_ std::shared_ptr<sairedis::SaiInterface> sai,
+        _In_ sai_object_id_t portRid)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_id_t> related;
+
+    for (auto id: { SAI_PORT_ATTR_QOS_QUEUE_LIST, SAI_PORT_ATTR_QOS_SCHEDULER_GROUP_LIST, SAI_PORT_ATTR_INGRESS_PRIORITY_GROUP_LIST })
+    {
+        std::vector<sai_object_id_t> list(1024);
+
+        sai_attribute_t attr;
+
+        attr.id = id;
+        attr.value.objlist.count = (uint32_t)list.size();
+        attr.value.objlist.list = list.data();
+
+        EXPECT_EQ(sai->get(SAI_OBJECT_TYPE_PORT, portRid, 1, &attr), SAI_STATUS_SUCCESS);
+
+        related.insert(related.end(), list.begin(), list.begin() + attr.value.objlist.count);
+    }
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_PORT_ATTR_PORT_SERDES_ID;
+
+    if (sai->get(SAI_OBJECT_TYPE_PORT, portRid, 1, &attr) == SAI_STATUS_SUCCESS && attr.value.oid != SAI_NULL_OBJECT_ID)
+    {
+        related.push_back(attr.value.oid);
+    }
+
+    return related;
+}
+
+TEST(SaiSwitch, postPortsCreateAndRemove)
+{
+    profileMap["SAI_VS_SWITCH_TYPE"] = "SAI_VS_SWITCH_TYPE_BCM56850";
+
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::RedisReply r(dbAsic.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    auto client = std::make_shared<RedisClient>(dbAsic);
+    auto sai = std::make_shared<saivs::Sai>();
+
+    ServiceMethodTable smt;
+
+    smt.profileGetValue = std::bind(&profileGetValue, _1, _2);
+    smt.profileGetNextValue = std::bind(&profileGetNextValue, _1, _2, _3);
+
+    sai_service_method_table_t test_services = smt.getServiceMethodTable();
+
+    ASSERT_EQ(sai->initialize(0, &test_services), SAI_STATUS_SUCCESS);
+
+    auto switchConfigContainer = std::make_shared<sairedis::SwitchConfigContainer>();
+    auto redisVidIndexGenerator = std::make_shared<sairedis::RedisVidIndexGenerator>(dbAsic, REDIS_KEY_VIDCOUNTER);
+
+    auto virtualObjectIdManager =
+        std::make_shared<sairedis::VirtualObjectIdManager>(
+                0,
+                switchConfigContainer,
+                redisVidIndexGenerator);
+
+    auto translator = std::make_shared<VirtualOidTranslator>(client, virtualObjectIdManager, sai);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    sai_object_id_t switchVid = 0x21000000000000;
+    sai_object_id_t switchRid;
+
+    ASSERT_EQ(sai->create(SAI_OBJECT_TYPE_SWITCH, &switchRid, SAI_NULL_OBJECT_ID, 1, &attr), SAI_STATUS_SUCCESS);
+
+    translator->insertRidAndVid(switchRid, switchVid);
+
+    auto sw = std::make_shared<SaiSwitch>(switchVid, switchRid, client, translator, sai);
+
+    auto laneMapSize = client->getLaneMap(switchVid).size();
+
+    // single lane ports on lanes not used by any existing port
+
+    std::vector<uint32_t> lanes = { 1000, 1001, 1002, 1003 };
+
+    std::vector<sai_object_id_t> portRids;
+    std::vector<sai_object_id_t> portVids;
+
+    for (auto& lane: lanes)
+    {
+        sai_attribute_t attrs[2];
+
+        attrs[0].id = SAI_PORT_ATTR_HW_LANE_LIST;
+        attrs[0].value.u32list.count = 1;
+        attrs[0].value.u32list.list = &lane;
+
+        attrs[1].id = SAI_PORT_ATTR_SPEED;
+        attrs[1].value.u32 = 10000;
+
+        sai_object_id_t portRid;
+
+        ASSERT_EQ(sai->create(SAI_OBJECT_TYPE_PORT, &portRid, switchRid, 2, attrs), SAI_STATUS_SUCCESS);
+
+        // the same as syncd is doing after port create
+
+        auto portVid = virtualObjectIdManager->allocateNewObjectId(SAI_OBJECT_TYPE_PORT, switchVid);
+
+        translator->insertRidAndVid(portRid, portVid);
+
+        portRids.push_back(portRid);
+        portVids.push_back(portVid);
+    }
+
+    sw->onPostPortsCreate(portRids);
+
+    auto laneMap = client->getLaneMap(switchVid);
+
+    EXPECT_EQ(laneMap.size(), laneMapSize + lanes.size());
+
+    for (size_t idx = 0; idx < lanes.size(); idx++)
+    {
+        EXPECT_EQ(laneMap.at(lanes[idx]), portRids[idx]);
+
+        EXPECT_TRUE(dbAsic->exists(asicKey(portVids[idx])));
+    }
+
+    // discovered objects of new ports are in ASIC DB and in RID/VID maps
+
+    std::vector<sai_object_id_t> related;
+    std::vector<sai_object_id_t> relatedVids;
+
+    for (auto portRid: portRids)
+    {
+        auto objects = getPortRelatedObjects(sai, portRid);
+
+        EXPECT_NE(objects.size(), 0);
+
+        related.insert(related.end(), objects.begin(), objects.end());
+    }
+
+    for (auto rid: related)
+    {
+        auto vid = client->getVidForRid(rid);
+
+        ASSERT_NE(vid, SAI_NULL_OBJECT_ID);
+
+        EXPECT_EQ(client->getRidForVid(vid), rid);
+
+        EXPECT_TRUE(dbAsic->exists(asicKey(vid)));
+
+        EXPECT_TRUE(sw->isDiscoveredRid(rid));
+
+        relatedVids.push_back(vid);
+    }
+
+    // related objects must be collected before port is removed
+
+    EXPECT_THROW(sw->postPortsRemove(portRids), std::runtime_error);
+
+    for (size_t idx = 0; idx < portRids.size(); idx++)
+    {
+        sw->collectPortRelatedObjects(portRids[idx]);
+
+        ASSERT_EQ(sai->remove(SAI_OBJECT_TYPE_PORT, portRids[idx]), SAI_STATUS_SUCCESS);
+
+        // the same as syncd is doing after port remove
+
+        translator->eraseRidAndVid(portRids[idx], portVids[idx]);
+
+        sw->removeExistingObjectReference(portRids[idx]);
+    }
+
+    sw->postPortsRemove(portRids);
+
+    for (size_t idx = 0; idx < related.size(); idx++)
+    {
+        EXPECT_EQ(client->getVidForRid(related[idx]), SAI_NULL_OBJECT_ID);
+        EXPECT_EQ(client->getRidForVid(relatedVids[idx]), SAI_NULL_OBJECT_ID);
+
+        EXPECT_FALSE(dbAsic->exists(asicKey(relatedVids[idx])));
+
+        EXPECT_FALSE(sw->isDiscoveredRid(related[idx]));
+    }
+
+    // lanes of removed ports are removed, lanes of switch ports are intact
+
+    laneMap = client->getLaneMap(switchVid);
+
+    EXPECT_EQ(laneMap.size(), laneMapSize);
+
+    for (auto lane: lanes)
+    {
+        EXPECT_EQ(laneMap.count(lane), 0);
+    }
+
+    sai->uninitialize();
+}
@@ -0,0 +1,368 @@
+#include "Syncd.h"
+#include "RedisClient.h"
+#include "RedisSelectableChannel.h"
+#include "MockableSaiInterface.h"
+#include "VidManager.h"
+
+#include "vslib/Sai.h"
+
+#include "lib/sairediscommon.h"
+#include "meta/sai_serialize.h"
+
+#include "swss/logger.h"
+#include "swss/redisreply.h"
+#include "swss/producertable.h"
+#include "swss/consumertable.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace syncd;
+
+static sai_object_id_t makeVid(
+        _In_ sai_object_type_t objectType,
+        _In_ uint64_t index)
+{
+    SWSS_LOG_ENTER();
+
+    // switch index 0, object type on bits 48..55
+
+    return (((uint64_t)objectType) << 48) | index;
+}
+
+static std::string counterIds(
+        _In_ const std::vector<sai_stat_id_t>& ids)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<uint64_t> list(ids.begin(), ids.end());
+
+    return sai_serialize_counter_list((uint32_t)list.size(), list.data());
+}
+
+TEST(Syncd, processBulkStatsEvent_fallback)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::RedisReply r(db.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    auto sai = std::make_shared<MockableSaiInterface>();
+
+    auto opt = std::make_shared<CommandLineOptions>();
+
+    Syncd syncd(sai, opt, false);
+
+    RedisClient client(db);
+
+    auto switchVid = makeVid(SAI_OBJECT_TYPE_SWITCH, 1);
+
+    client.insertVidAndRid(switchVid, 0x1000);
+
+    for (uint64_t idx = 0; idx < 3; idx++)
+    {
+        client.insertVidAndRid(makeVid(SAI_OBJECT_TYPE_PORT, 0x10 + idx), 0x2000 + idx);
+    }
+
+    // vendor SAI without bulk stats support
+
+    sai->mock_bulkGetStats = [](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *, uint32_t,
+            const sai_stat_id_t *, sai_stats_mode_t, sai_status_t *, uint64_t *) {
+        return SAI_STATUS_NOT_IMPLEMENTED;
+    };
+
+    sai->mock_bulkClearStats = [](sai_object_id_t, sai_object_type_t, uint32_t, const sai_object_key_t *, uint32_t,
+            const sai_stat_id_t *, sai_stats_mode_t, sai_status_t *) {
+        return SAI_STATUS_NOT_SUPPORTED;
+    };
+
+    // last port is failing
+
+    sai->mock_getStats = [](sai_object_type_t, sai_object_id_t rid, uint32_t count, const sai_stat_id_t *, uint64_t *counters) {
+
+        if (rid == 0x2002)
+            return SAI_STATUS_INVALID_OBJECT_ID;
+
+        for (uint32_t idx = 0; idx < count; idx++)
+        {
+            counters[idx] = (rid - 0x2000) * 100 + idx;
+        }
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    std::vector<sai_object_id_t> cleared;
+
+    sai->mock_clearStats = [&](sai_object_type_t, sai_object_id_t rid, uint32_t count, const sai_stat_id_t *) {
+
+        EXPECT_EQ(count, 2);
+
+        cleared.push_back(rid);
+
+        return SAI_STATUS_SUCCESS;
+    };
+
+    sairedis::RedisSelectableChannel consumer(db, ASIC_STATE_TABLE, REDIS_TABLE_GETRESPONSE, TEMP_PREFIX, false);
+
+    swss::ProducerTable asicState(db.get(), ASIC_STATE_TABLE);
+    swss::ConsumerTable getResponse(db.get(), REDIS_TABLE_GETRESPONSE);
+
+    auto key = sai_serialize_object_type(SAI_OBJECT_TYPE_PORT) + ":" + sai_serialize_object_id(switchVid);
+
+    auto ids = counterIds({ SAI_PORT_STAT_IF_IN_OCTETS, SAI_PORT_STAT_IF_OUT_OCTETS });
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("SAI_STATS_MODE_BULK_READ", ids);
+
+    for (uint64_t idx = 0; idx < 3; idx++)
+    {
+        values.emplace_back(sai_serialize_object_id(makeVid(SAI_OBJECT_TYPE_PORT, 0x10 + idx)), "");
+    }
+
+    asicState.set(key, values, REDIS_ASIC_STATE_COMMAND_BULK_GET_STATS);
+
+    syncd.processEvent(consumer);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    getResponse.pop(kco);
+
+    // all objects are in single response, each with own status
+
+    EXPECT_EQ(kfvKey(kco), sai_serialize_status(SAI_STATUS_FAILURE));
+    EXPECT_EQ(kfvOp(kco), REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    auto entry = kfvFieldsValues(kco);
+
+    ASSERT_EQ(entry.size(), 3);
+
+    EXPECT_EQ(fvField(entry[0]), sai_serialize_status(SAI_STATUS_SUCCESS));
+    EXPECT_EQ(fvValue(entry[0]), "0,1");
+    EXPECT_EQ(fvField(entry[1]), sai_serialize_status(SAI_STATUS_SUCCESS));
+    EXPECT_EQ(fvValue(entry[1]), "100,101");
+    EXPECT_EQ(fvField(entry[2]), sai_serialize_status(SAI_STATUS_INVALID_OBJECT_ID));
+    EXPECT_EQ(fvValue(entry[2]), "");
+
+    values[0] = swss::FieldValueTuple("SAI_STATS_MODE_BULK_CLEAR", ids);
+
+    asicState.set(key, values, REDIS_ASIC_STATE_COMMAND_BULK_CLEAR_STATS);
+
+    syncd.processEvent(consumer);
+
+    getResponse.pop(kco);
+
+    EXPECT_EQ(kfvKey(kco), sai_serialize_status(SAI_STATUS_SUCCESS));
+
+    entry = kfvFieldsValues(kco);
+
+    ASSERT_EQ(entry.size(), 3);
+
+    for (auto& fv: entry)
+    {
+        EXPECT_EQ(fvField(fv), sai_serialize_status(SAI_STATUS_SUCCESS));
+        EXPECT_EQ(fvValue(fv), "");
+    }
+
+    EXPECT_EQ(cleared, std::vector<sai_object_id_t>({ 0x2000, 0x2001, 0x2002 }));
+}
+
+TEST(Syncd, processBulkStatsEvent_unknownObject)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::RedisReply r(db.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    auto sai = std::make_shared<MockableSaiInterface>();
+
+    auto opt = std::make_shared<CommandLineOptions>();
+
+    Syncd syncd(sai, opt, false);
+
+    RedisClient client(db);
+
+    auto switchVid = makeVid(SAI_OBJECT_TYPE_SWITCH, 1);
+
+    client.insertVidAndRid(switchVid, 0x1000);
+
+    sairedis::RedisSelectableChannel consumer(db, ASIC_STATE_TABLE, REDIS_TABLE_GETRESPONSE, TEMP_PREFIX, false);
+
+    swss::ProducerTable asicState(db.get(), ASIC_STATE_TABLE);
+    swss::ConsumerTable getResponse(db.get(), REDIS_TABLE_GETRESPONSE);
+
+    auto key = sai_serialize_object_type(SAI_OBJECT_TYPE_PORT) + ":" + sai_serialize_object_id(switchVid);
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("SAI_STATS_MODE_BULK_READ", counterIds({ SAI_PORT_STAT_IF_IN_OCTETS }));
+    values.emplace_back(sai_serialize_object_id(makeVid(SAI_OBJECT_TYPE_PORT, 0x10)), "");
+
+    asicState.set(key, values, REDIS_ASIC_STATE_COMMAND_BULK_GET_STATS);
+
+    syncd.processEvent(consumer);
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    getResponse.pop(kco);
+
+    // request is rejected as a whole
+
+    EXPECT_EQ(kfvKey(kco), sai_serialize_status(SAI_STATUS_INVALID_OBJECT_ID));
+    EXPECT_EQ(kfvFieldsValues(kco).size(), 0);
+}
+
+static std::vector<sai_object_id_t> getPortQueues(
+        _In_ std::shared_ptr<sairedis::SaiInterface> sai,
+        _In_ sai_object_id_t portRid)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<sai_object_id_t> queues(1024);
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_PORT_ATTR_QOS_QUEUE_LIST;
+    attr.value.objlist.count = (uint32_t)queues.size();
+    attr.value.objlist.list = queues.data();
+
+    EXPECT_EQ(sai->get(SAI_OBJECT_TYPE_PORT, portRid, 1, &attr), SAI_STATUS_SUCCESS);
+
+    queues.resize(attr.value.objlist.count);
+
+    return queues;
+}
+
+TEST(Syncd, processBulkOid_portPostActions)
+{
+    auto db = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+
+    swss::RedisReply r(db.get(), "FLUSHDB", REDIS_REPLY_STATUS);
+
+    // virtual switch is used as vendor SAI, since post port actions discover
+    // port objects on real switch
+
+    auto sai = std::make_shared<saivs::Sai>();
+
+    auto opt = std::make_shared<CommandLineOptions>();
+
+    opt->m_enableSaiBulkSupport = true;
+    opt->m_profileMapFile = "files/vsprofile.ini";
+
+    Syncd syncd(sai, opt, false);
+
+    RedisClient client(db);
+
+    sairedis::RedisSelectableChannel consumer(db, ASIC_STATE_TABLE, REDIS_TABLE_GETRESPONSE, TEMP_PREFIX, false);
+
+    swss::ProducerTable asicState(db.get(), ASIC_STATE_TABLE);
+
+    auto switchVid = makeVid(SAI_OBJECT_TYPE_SWITCH, 0);
+
+    asicState.set(
+            sai_serialize_object_type(SAI_OBJECT_TYPE_SWITCH) + ":" + sai_serialize_object_id(switchVid),
+            { swss::FieldValueTuple("SAI_SWITCH_ATTR_INIT_SWITCH", "true") },
+            REDIS_ASIC_STATE_COMMAND_CREATE);
+
+    syncd.processEvent(consumer);
+
+    ASSERT_NE(client.getRidForVid(switchVid), SAI_NULL_OBJECT_ID);
+
+    auto laneMapSize = client.getLaneMap(switchVid).size();
+
+    // break out to single lane ports on lanes not used by any existing port
+
+    std::vector<uint32_t> lanes = { 1000, 1001, 1002, 1003 };
+
+    std::vector<sai_object_id_t> portVids;
+
+    std::vector<swss::FieldValueTuple> values;
+
+    for (uint64_t idx = 0; idx < lanes.size(); idx++)
+    {
+        portVids.push_back(makeVid(SAI_OBJECT_TYPE_PORT, 0x10000 + idx));
+
+        values.emplace_back(
+                sai_serialize_object_id(portVids.back()),
+                "SAI_PORT_ATTR_HW_LANE_LIST=1:" + std::to_string(lanes[idx]) + "|SAI_PORT_ATTR_SPEED=10000");
+    }
+
+    auto key = sai_serialize_object_type(SAI_OBJECT_TYPE_PORT) + ":" + std::to_string(values.size());
+
+    asicState.set(key, values, REDIS_ASIC_STATE_COMMAND_BULK_CREATE);
+
+    syncd.processEvent(consumer);
+
+    auto laneMap = client.getLaneMap(switchVid);
+
+    EXPECT_EQ(laneMap.size(), laneMapSize + lanes.size());
+
+    std::vector<sai_object_id_t> portRids;
+    std::vector<sai_object_id_t> queueVids;
+
+    for (size_t idx = 0; idx < lanes.size(); idx++)
+    {
+        auto portRid = client.getRidForVid(portVids[idx]);
+
+        ASSERT_NE(portRid, SAI_NULL_OBJECT_ID);
+
+        EXPECT_EQ(laneMap.at(lanes[idx]), portRid);
+
+        // queues of new ports were discovered and put to ASIC DB
+
+        auto queues = getPortQueues(sai, portRid);
+
+        EXPECT_NE(queues.size(), 0);
+
+        for (auto queueRid: queues)
+        {
+            auto queueVid = client.getVidForRid(queueRid);
+
+            ASSERT_NE(queueVid, SAI_NULL_OBJECT_ID);
+
+            EXPECT_TRUE(db->exists(ASIC_STATE_TABLE ":" +
+                        sai_serialize_object_type(VidManager::objectTypeQuery(queueVid)) + ":" +
+                        sai_serialize_object_id(queueVid)));
+
+            queueVids.push_back(queueVid);
+        }
+
+        portRids.push_back(portRid);
+    }
+
+    for (auto& fv: values)
+    {
+        fv = swss::FieldValueTuple(fvField(fv), "");
+    }
+
+    asicState.set(key, values, REDIS_ASIC_STATE_COMMAND_BULK_REMOVE);
+
+    syncd.processEvent(consumer);
+
+    for (size_t idx = 0; idx < portVids.size(); idx++)
+    {
+        EXPECT_EQ(client.getRidForVid(portVids[idx]), SAI_NULL_OBJECT_ID);
+        EXPECT_EQ(client.getVidForRid(portRids[idx]), SAI_NULL_OBJECT_ID);
+    }
+
+    // related objects of removed ports are removed from ASIC DB and maps
+
+    for (auto queueVid: queueVids)
+    {
+        EXPECT_EQ(client.getRidForVid(queueVid), SAI_NULL_OBJECT_ID);
+
+        EXPECT_FALSE(db->exists(ASIC_STATE_TABLE ":" +
+                    sai_serialize_object_type(VidManager::objectTypeQuery(queueVid)) + ":" +
+                    sai_serialize_object_id(queueVid)));
+    }
+
+    laneMap = client.getLaneMap(switchVid);
+
+    EXPECT_EQ(laneMap.size(), laneMapSize);
+
+    for (auto lane: lanes)
+    {
+        EXPECT_EQ(laneMap.count(lane), 0);
+    }
+
+    sai->uninitialize();
+}
@@ -4,6 +4,9 @@
 
 #include <arpa/inet.h>
 
+#include <future>
+#include <chrono>
+
 #ifdef HAVE_SAI_BULK_OBJECT_GET_STATS
 #undef HAVE_SAI_BULK_OBJECT_GET_STATS
 #endif
@@ -203,3 +206,192 @@ TEST(VendorSai, quad_bulk_neighbor_entry)
     EXPECT_EQ(SAI_STATUS_SUCCESS, sai.bulkRemove(2, e, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses));
 
 }
+
+TEST(VendorSai, bulk_port)
+{
+    VendorSai sai;
+    sai.initialize(0, &test_services);
+
+    sai_object_id_t switchId = 0;
+
+    sai_attribute_t attr;
+
+    attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+    attr.value.booldata = true;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.create(SAI_OBJECT_TYPE_SWITCH, &switchId, SAI_NULL_OBJECT_ID, 1, &attr));
+
+    // create
+
+    uint32_t lanes[2] = { 1000, 1001 };
+
+    sai_attribute_t list1[2];
+    sai_attribute_t list2[2];
+
+    list1[0].id = SAI_PORT_ATTR_HW_LANE_LIST;
+    list1[0].value.u32list.count = 1;
+    list1[0].value.u32list.list = &lanes[0];
+    list1[1].id = SAI_PORT_ATTR_SPEED;
+    list1[1].value.u32 = 10000;
+
+    list2[0].id = SAI_PORT_ATTR_HW_LANE_LIST;
+    list2[0].value.u32list.count = 1;
+    list2[0].value.u32list.list = &lanes[1];
+    list2[1].id = SAI_PORT_ATTR_SPEED;
+    list2[1].value.u32 = 10000;
+
+    uint32_t attr_count[2] = { 2, 2 };
+
+    const sai_attribute_t* attr_list[2] = { list1, list2 };
+
+    sai_object_id_t ports[2];
+
+    sai_status_t statuses[2];
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.bulkCreate(SAI_OBJECT_TYPE_PORT, switchId, 2, attr_count, attr_list,
+                SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, ports, statuses));
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[0]);
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[1]);
+    EXPECT_NE(ports[0], ports[1]);
+
+    // port dependencies are created by bulk create
+
+    attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES;
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.get(SAI_OBJECT_TYPE_PORT, ports[1], 1, &attr));
+    EXPECT_NE(0u, attr.value.u32);
+
+    // remove, port serdes must be removed first
+
+    for (auto port: ports)
+    {
+        attr.id = SAI_PORT_ATTR_PORT_SERDES_ID;
+
+        EXPECT_EQ(SAI_STATUS_SUCCESS, sai.get(SAI_OBJECT_TYPE_PORT, port, 1, &attr));
+
+        if (attr.value.oid != SAI_NULL_OBJECT_ID)
+        {
+            EXPECT_EQ(SAI_STATUS_SUCCESS, sai.remove(SAI_OBJECT_TYPE_PORT_SERDES, attr.value.oid));
+        }
+    }
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, sai.bulkRemove(SAI_OBJECT_TYPE_PORT, 2, ports, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses));
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[0]);
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[1]);
+}
+
+static VendorSai* g_lockTestSai = nullptr;
+
+static std::chrono::milliseconds g_lockTestWait;
+
+static std::future<sai_status_t> g_lockTestStats;
+
+static std::future_status g_lockTestStatsStatus;
+
+static const char* profile_get_value_lock_test(
+        _In_ sai_switch_profile_id_t profile_id,
+        _In_ const char* variable)
+{
+    SWSS_LOG_ENTER();
+
+    // called by vendor SAI inside initialize, while programming lane is locked
+
+    if (g_lockTestSai && !g_lockTestStats.valid())
+    {
+        auto sai = g_lockTestSai;
+
+        g_lockTestStats = std::async(std::launch::async, [sai]() {
+                return sai->clearStats(SAI_OBJECT_TYPE_PORT, SAI_NULL_OBJECT_ID, 0, nullptr);
+        });
+
+        g_lockTestStatsStatus = g_lockTestStats.wait_for(g_lockTestWait);
+    }
+
+    return profile_get_value(profile_id, variable);
+}
+
+static sai_service_method_table_t lock_test_services = {
+    profile_get_value_lock_test,
+    profile_get_next_value
+};
+
+/**
+ * @brief Execute stats call from other thread while initialize holds
+ * programming lane, and get whether it finished within given time.
+ */
+static std::future_status statsDuringInitialize(
+        _In_ vendor_sai_lock_policy_t lockPolicy,
+        _In_ std::chrono::milliseconds wait)
+{
+    SWSS_LOG_ENTER();
+
+    VendorSai sai;
+
+    sai.setLockPolicy(lockPolicy);
+
+    g_lockTestSai = &sai;
+    g_lockTestWait = wait;
+    g_lockTestStats = std::future<sai_status_t>();
+    g_lockTestStatsStatus = std::future_status::deferred;
+
+    sai.initialize(0, &lock_test_services);
+
+    g_lockTestSai = nullptr;
+
+    EXPECT_TRUE(g_lockTestStats.valid());
+
+    if (g_lockTestStats.valid())
+    {
+        // stats call can finish at latest when programming lane is released
+
+        g_lockTestStats.wait();
+
+        g_lockTestStats = std::future<sai_status_t>();
+    }
+
+    return g_lockTestStatsStatus;
+}
+
+TEST(VendorSai, setLockPolicy_lanesConcurrent)
+{
+    // stats lane is not blocked by programming lane
+
+    EXPECT_EQ(statsDuringInitialize(VENDOR_SAI_LOCK_POLICY_LANES, std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(statsDuringInitialize(VENDOR_SAI_LOCK_POLICY_CONCURRENT, std::chrono::seconds(5)), std::future_status::ready);
+
+    // both lanes share single lock
+
+    EXPECT_EQ(statsDuringInitialize(VENDOR_SAI_LOCK_POLICY_GLOBAL, std::chrono::milliseconds(100)), std::future_status::timeout);
+}
+
+TEST(VendorSai, setLockPolicy)
+{
+    VendorSai sai;
+
+    EXPECT_EQ(sai.getLockPolicy(), VENDOR_SAI_LOCK_POLICY_GLOBAL);
+
+    sai.setLockPolicy(VENDOR_SAI_LOCK_POLICY_LANES);
+
+    EXPECT_EQ(sai.getLockPolicy(), VENDOR_SAI_LOCK_POLICY_LANES);
+
+    sai.initialize(0, &test_services);
+
+    // stats calls are executed on stats lane
+
+    ASSERT_EQ(SAI_STATUS_NOT_IMPLEMENTED, sai.bulkClearStats(SAI_NULL_OBJECT_ID,
+                                                             SAI_OBJECT_TYPE_PORT,
+                                                             0,
+                                                             nullptr,
+                                                             0,
+                                                             nullptr,
+                                                             SAI_STATS_MODE_BULK_READ_AND_CLEAR,
+                                                             nullptr));
+
+    sai.setLockPolicy(VENDOR_SAI_LOCK_POLICY_CONCURRENT);
+
+    EXPECT_EQ(sai.getLockPolicy(), VENDOR_SAI_LOCK_POLICY_CONCURRENT);
+
+    EXPECT_THROW(sai.setLockPolicy(VENDOR_SAI_LOCK_POLICY_UNKNOWN), std::exception);
+}
@@ -7,6 +7,9 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <atomic>
+
 using namespace syncd;
 using namespace std::placeholders;
 
@@ -160,3 +163,55 @@ TEST(VirtualOidTranslator, tryTranslateVidToRid)
 
     sai->uninitialize();
 }
+
+TEST(VirtualOidTranslator, translateVidToRid_concurrent)
+{
+    auto dbAsic = std::make_shared<swss::DBConnector>("ASIC_DB", 0);
+    auto client = std::make_shared<RedisClient>(dbAsic);
+
+    VirtualOidTranslator vot(client, nullptr, nullptr);
+
+    const sai_object_id_t count = 256;
+
+    for (sai_object_id_t idx = 1; idx <= count; idx++)
+    {
+        vot.insertRidAndVid(0x1000 + idx, 0x1000000000000 + idx);
+    }
+
+    // half of lookups will miss local cache and go to redis
+
+    vot.clearLocalCache();
+
+    for (sai_object_id_t idx = 1; idx <= count; idx += 2)
+    {
+        EXPECT_EQ(vot.translateVidToRid(0x1000000000000 + idx), 0x1000 + idx);
+    }
+
+    std::atomic<uint32_t> errors(0);
+
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&]() {
+
+            for (sai_object_id_t idx = 1; idx <= count; idx++)
+            {
+                sai_object_id_t rid;
+
+                if (vot.translateVidToRid(0x1000000000000 + idx) != 0x1000 + idx)
+                    errors++;
+
+                if (!vot.tryTranslateVidToRid(0x1000000000000 + idx, rid) || rid != 0x1000 + idx)
+                    errors++;
+            }
+        });
+    }
+
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(errors, 0);
+}
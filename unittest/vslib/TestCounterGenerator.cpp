@@ -0,0 +1,52 @@
+#include "CounterGenerator.h"
+
+#include <gtest/gtest.h>
+
+using namespace saivs;
+
+TEST(CounterGenerator, getRate)
+{
+    CounterGenerator cg(0);
+
+    EXPECT_EQ(cg.getRate(SAI_OBJECT_TYPE_PORT, 0x1, SAI_PORT_STAT_IF_IN_OCTETS), 0);
+
+    cg.setRate(SAI_OBJECT_TYPE_PORT, SAI_PORT_STAT_IF_IN_OCTETS, 100);
+
+    EXPECT_EQ(cg.getRate(SAI_OBJECT_TYPE_PORT, 0x1, SAI_PORT_STAT_IF_IN_OCTETS), 100);
+    EXPECT_EQ(cg.getRate(SAI_OBJECT_TYPE_PORT, 0x1, SAI_PORT_STAT_IF_OUT_OCTETS), 0);
+    EXPECT_EQ(cg.getRate(SAI_OBJECT_TYPE_QUEUE, 0x1, SAI_PORT_STAT_IF_IN_OCTETS), 0);
+
+    // object rate takes precedence over object type rate
+
+    cg.setObjectRate(0x2, SAI_PORT_STAT_IF_IN_OCTETS, 7);
+    cg.setObjectRate(0x2, SAI_PORT_STAT_IF_OUT_OCTETS, 9);
+
+    EXPECT_EQ(cg.getRate(SAI_OBJECT_TYPE_PORT, 0x1, SAI_PORT_STAT_IF_IN_OCTETS), 100);
+    EXPECT_EQ(cg.getRate(SAI_OBJECT_TYPE_PORT, 0x2, SAI_PORT_STAT_IF_IN_OCTETS), 7);
+    EXPECT_EQ(cg.getRate(SAI_OBJECT_TYPE_PORT, 0x2, SAI_PORT_STAT_IF_OUT_OCTETS), 9);
+    EXPECT_EQ(cg.getRate(SAI_OBJECT_TYPE_PORT, 0x1, SAI_PORT_STAT_IF_OUT_OCTETS), 0);
+
+    cg.clearRates();
+
+    EXPECT_EQ(cg.getRate(SAI_OBJECT_TYPE_PORT, 0x1, SAI_PORT_STAT_IF_IN_OCTETS), 0);
+    EXPECT_EQ(cg.getRate(SAI_OBJECT_TYPE_PORT, 0x2, SAI_PORT_STAT_IF_IN_OCTETS), 0);
+}
+
+TEST(CounterGenerator, getGeneratedValue)
+{
+    using namespace std::chrono;
+
+    EXPECT_EQ(CounterGenerator::getGeneratedValue(100, nanoseconds(0)), 0);
+    EXPECT_EQ(CounterGenerator::getGeneratedValue(100, nanoseconds(-5)), 0);
+
+    EXPECT_EQ(CounterGenerator::getGeneratedValue(100, seconds(3)), 300);
+    EXPECT_EQ(CounterGenerator::getGeneratedValue(100, milliseconds(1500)), 150);
+    EXPECT_EQ(CounterGenerator::getGeneratedValue(1, milliseconds(999)), 0);
+
+    // 400G port in bytes per second for one day don't overflow
+
+    uint64_t rate = 50000000000ULL;
+
+    EXPECT_EQ(CounterGenerator::getGeneratedValue(rate, hours(24) + milliseconds(500)),
+            rate * 86400 + rate / 2);
+}
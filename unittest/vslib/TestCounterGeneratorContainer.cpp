@@ -0,0 +1,54 @@
+#include "CounterGeneratorContainer.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace saivs;
+
+TEST(CounterGeneratorContainer, insert)
+{
+    auto cg = std::make_shared<CounterGenerator>(0);
+
+    CounterGeneratorContainer cgc;
+
+    EXPECT_THROW(cgc.insert(0, nullptr), std::runtime_error);
+
+    cgc.insert(0, cg);
+
+    EXPECT_NE(cgc.getCounterGenerator(0), nullptr);
+}
+
+TEST(CounterGeneratorContainer, remove)
+{
+    auto cg = std::make_shared<CounterGenerator>(0);
+
+    CounterGeneratorContainer cgc;
+
+    EXPECT_THROW(cgc.insert(0, nullptr), std::runtime_error);
+
+    cgc.insert(0, cg);
+
+    EXPECT_NE(cgc.getCounterGenerator(0), nullptr);
+
+    cgc.remove(0);
+
+    EXPECT_EQ(cgc.getCounterGenerator(0), nullptr);
+}
+
+TEST(CounterGeneratorContainer, getCounterGenerator)
+{
+    auto cg = std::make_shared<CounterGenerator>(0);
+
+    CounterGeneratorContainer cgc;
+
+    EXPECT_THROW(cgc.insert(0, nullptr), std::runtime_error);
+
+    cgc.insert(0, cg);
+
+    EXPECT_NE(cgc.getCounterGenerator(0), nullptr);
+
+    cgc.clear();
+
+    EXPECT_EQ(cgc.getCounterGenerator(0), nullptr);
+}
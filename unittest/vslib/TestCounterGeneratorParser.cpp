@@ -0,0 +1,35 @@
+#include "CounterGeneratorParser.h"
+
+#include <gtest/gtest.h>
+
+using namespace saivs;
+
+TEST(CounterGeneratorParser, parseFromFile)
+{
+    EXPECT_NE(CounterGeneratorParser::parseFromFile(nullptr), nullptr);
+
+    EXPECT_NE(CounterGeneratorParser::parseFromFile("not_existing"), nullptr);
+
+    auto bad = CounterGeneratorParser::parseFromFile("files/counter_generator_bad.txt");
+
+    EXPECT_NE(bad, nullptr);
+
+    EXPECT_EQ(bad->getCounterGenerator(0), nullptr);
+
+    auto cgc = CounterGeneratorParser::parseFromFile("files/counter_generator_ok.txt");
+
+    auto cg = cgc->getCounterGenerator(0);
+
+    ASSERT_NE(cg, nullptr);
+
+    EXPECT_EQ(cg->getRate(SAI_OBJECT_TYPE_PORT, 0x1, SAI_PORT_STAT_IF_IN_OCTETS), 1000);
+    EXPECT_EQ(cg->getRate(SAI_OBJECT_TYPE_PORT, 0x1000000000002, SAI_PORT_STAT_IF_IN_OCTETS), 20);
+
+    cg = cgc->getCounterGenerator(1);
+
+    ASSERT_NE(cg, nullptr);
+
+    EXPECT_EQ(cg->getRate(SAI_OBJECT_TYPE_QUEUE, 0x1, SAI_QUEUE_STAT_PACKETS), 5);
+    EXPECT_EQ(cg->getRate(SAI_OBJECT_TYPE_QUEUE, 0x15000000000003, SAI_QUEUE_STAT_PACKETS), 3);
+    EXPECT_EQ(cg->getRate(SAI_OBJECT_TYPE_PORT, 0x1, SAI_PORT_STAT_IF_IN_OCTETS), 0);
+}
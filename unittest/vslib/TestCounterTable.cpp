@@ -0,0 +1,219 @@
+#include "CounterTable.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace saivs;
+
+TEST(CounterTable, readWriteCounters)
+{
+    CounterTable ct(nullptr);
+
+    sai_stat_id_t ids[] = { SAI_PORT_STAT_IF_IN_OCTETS, SAI_PORT_STAT_IF_OUT_OCTETS };
+
+    std::vector<size_t> indexes;
+
+    ct.getCounterIndexes(SAI_OBJECT_TYPE_PORT, 2, ids, indexes);
+
+    EXPECT_EQ(indexes, std::vector<size_t>({ 0, 1 }));
+
+    uint64_t counters[2] = { 1, 1 };
+
+    // not set counters are zero
+
+    ct.readCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, false, counters);
+
+    EXPECT_EQ(counters[0], 0);
+    EXPECT_EQ(counters[1], 0);
+
+    uint64_t values[2] = { 10, 20 };
+
+    ct.writeCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, values);
+
+    // reversed order resolves to same indexes
+
+    sai_stat_id_t rids[] = { SAI_PORT_STAT_IF_OUT_OCTETS, SAI_PORT_STAT_IF_IN_OCTETS };
+
+    std::vector<size_t> rindexes;
+
+    ct.getCounterIndexes(SAI_OBJECT_TYPE_PORT, 2, rids, rindexes);
+
+    EXPECT_EQ(rindexes, std::vector<size_t>({ 1, 0 }));
+
+    ct.readCounters(SAI_OBJECT_TYPE_PORT, 0x1, rindexes, true, counters);
+
+    EXPECT_EQ(counters[0], 20);
+    EXPECT_EQ(counters[1], 10);
+
+    ct.readCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, false, counters);
+
+    EXPECT_EQ(counters[0], 0);
+    EXPECT_EQ(counters[1], 0);
+
+    ct.writeCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, values);
+
+    ct.removeObject(0x1);
+
+    ct.readCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, false, counters);
+
+    EXPECT_EQ(counters[0], 0);
+    EXPECT_EQ(counters[1], 0);
+}
+
+TEST(CounterTable, generator)
+{
+    auto cg = std::make_shared<CounterGenerator>(0);
+
+    cg->setRate(SAI_OBJECT_TYPE_PORT, SAI_PORT_STAT_IF_IN_OCTETS, 1000000000);
+
+    CounterTable ct(cg);
+
+    sai_stat_id_t ids[] = { SAI_PORT_STAT_IF_IN_OCTETS, SAI_PORT_STAT_IF_OUT_OCTETS };
+
+    std::vector<size_t> indexes;
+
+    ct.getCounterIndexes(SAI_OBJECT_TYPE_PORT, 2, ids, indexes);
+
+    uint64_t counters[2];
+
+    ct.readCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, false, counters);
+
+    uint64_t first = counters[0];
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    ct.readCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, true, counters);
+
+    // monotonic growth, at least 10 ms at 1 per ns
+
+    EXPECT_GE(counters[0], first + 10000000);
+    EXPECT_EQ(counters[1], 0);
+
+    uint64_t beforeClear = counters[0];
+
+    ct.readCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, false, counters);
+
+    // after read and clear only traffic since clear is counted
+
+    EXPECT_LT(counters[0], beforeClear);
+}
+
+TEST(CounterTable, generatorObjectRate)
+{
+    auto cg = std::make_shared<CounterGenerator>(0);
+
+    cg->setRate(SAI_OBJECT_TYPE_QUEUE, SAI_QUEUE_STAT_PACKETS, 1000000000);
+
+    // second queue is idle
+
+    cg->setObjectRate(0x2, SAI_QUEUE_STAT_PACKETS, 0);
+
+    CounterTable ct(cg);
+
+    sai_stat_id_t ids[] = { SAI_QUEUE_STAT_PACKETS };
+
+    std::vector<size_t> indexes;
+
+    ct.getCounterIndexes(SAI_OBJECT_TYPE_QUEUE, 1, ids, indexes);
+
+    uint64_t busy;
+    uint64_t idle;
+
+    ct.readCounters(SAI_OBJECT_TYPE_QUEUE, 0x1, indexes, false, &busy);
+    ct.readCounters(SAI_OBJECT_TYPE_QUEUE, 0x2, indexes, false, &idle);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    ct.readCounters(SAI_OBJECT_TYPE_QUEUE, 0x1, indexes, false, &busy);
+    ct.readCounters(SAI_OBJECT_TYPE_QUEUE, 0x2, indexes, false, &idle);
+
+    EXPECT_GE(busy, 10000000);
+    EXPECT_EQ(idle, 0);
+
+    EXPECT_TRUE(ct.hasObject(0x1));
+    EXPECT_FALSE(ct.hasObject(0x3));
+
+    ct.removeObject(0x1);
+
+    EXPECT_FALSE(ct.hasObject(0x1));
+}
+
+TEST(CounterTable, generatorNewCounter)
+{
+    auto cg = std::make_shared<CounterGenerator>(0);
+
+    cg->setRate(SAI_OBJECT_TYPE_PORT, SAI_PORT_STAT_IF_IN_OCTETS, 1000000000);
+    cg->setRate(SAI_OBJECT_TYPE_PORT, SAI_PORT_STAT_IF_OUT_OCTETS, 1000000000);
+
+    CounterTable ct(cg);
+
+    sai_stat_id_t ids[] = { SAI_PORT_STAT_IF_IN_OCTETS, SAI_PORT_STAT_IF_OUT_OCTETS };
+
+    std::vector<size_t> indexes;
+
+    ct.getCounterIndexes(SAI_OBJECT_TYPE_PORT, 1, ids, indexes);
+
+    uint64_t counters[2];
+
+    ct.readCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, false, counters);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    ct.getCounterIndexes(SAI_OBJECT_TYPE_PORT, 2, ids, indexes);
+
+    ct.readCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, false, counters);
+
+    // counter read for the first time starts from zero, time before its
+    // first read is not counted
+
+    EXPECT_GE(counters[0], 20000000);
+    EXPECT_LT(counters[1], 10000000);
+}
+
+TEST(CounterTable, generatorSetRate)
+{
+    auto cg = std::make_shared<CounterGenerator>(0);
+
+    cg->setRate(SAI_OBJECT_TYPE_PORT, SAI_PORT_STAT_IF_IN_OCTETS, 1000000000);
+
+    CounterTable ct(cg);
+
+    sai_stat_id_t ids[] = { SAI_PORT_STAT_IF_IN_OCTETS };
+
+    std::vector<size_t> indexes;
+
+    ct.getCounterIndexes(SAI_OBJECT_TYPE_PORT, 1, ids, indexes);
+
+    uint64_t before;
+    uint64_t stopped;
+    uint64_t after;
+
+    ct.readCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, false, &before);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // stopped counter keeps value generated so far
+
+    cg->setRate(SAI_OBJECT_TYPE_PORT, SAI_PORT_STAT_IF_IN_OCTETS, 0);
+
+    ct.readCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, false, &stopped);
+
+    EXPECT_GE(stopped, before + 10000000);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    ct.readCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, false, &after);
+
+    EXPECT_EQ(after, stopped);
+
+    // restarted counter grows from its current value, time while it was
+    // stopped is not counted
+
+    cg->setRate(SAI_OBJECT_TYPE_PORT, SAI_PORT_STAT_IF_IN_OCTETS, 1000000000);
+
+    ct.readCounters(SAI_OBJECT_TYPE_PORT, 0x1, indexes, false, &after);
+
+    EXPECT_GE(after, stopped);
+    EXPECT_LT(after, stopped + 10000000);
+}
@@ -76,3 +76,55 @@ TEST(SwitchStateBase, initialize_voq_switch)
     EXPECT_EQ(SAI_STATUS_SUCCESS,
               ss.initialize_voq_switch_objects((uint32_t)attrs.size(), attrs.data()));
 }
+
+TEST(SwitchStateBase, bulkGetStats)
+{
+    auto sc = std::make_shared<SwitchConfig>(0, "");
+    auto scc = std::make_shared<SwitchConfigContainer>();
+
+    SwitchStateBase ss(
+            0x2100000000,
+            std::make_shared<RealObjectIdManager>(0, scc),
+            sc);
+
+    sai_stat_id_t id = SAI_SWITCH_STAT_IN_CONFIGURED_DROP_REASONS_0_DROPPED_PKTS;
+
+    ss.debugSetStats(0x2100000000, {{ id, 7 }});
+
+    sai_object_key_t keys[2];
+
+    keys[0].key.object_id = 0x2100000000;
+    keys[1].key.object_id = 0x21000000000123; // not existing
+
+    sai_status_t statuses[2];
+
+    uint64_t counters[2] = { 0, 0 };
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER,
+              ss.bulkGetStats(SAI_OBJECT_TYPE_SWITCH, 2, keys, 1, &id, SAI_STATS_MODE_BULK_CLEAR, statuses, counters));
+
+    EXPECT_EQ(SAI_STATUS_FAILURE,
+              ss.bulkGetStats(SAI_OBJECT_TYPE_SWITCH, 2, keys, 1, &id, SAI_STATS_MODE_BULK_READ, statuses, counters));
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS, statuses[0]);
+    EXPECT_EQ(SAI_STATUS_INVALID_OBJECT_ID, statuses[1]);
+    EXPECT_EQ(7, counters[0]);
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS,
+              ss.bulkGetStats(SAI_OBJECT_TYPE_SWITCH, 1, keys, 1, &id, SAI_STATS_MODE_BULK_READ_AND_CLEAR, statuses, counters));
+
+    EXPECT_EQ(7, counters[0]);
+
+    ss.debugSetStats(0x2100000000, {{ id, 9 }});
+
+    EXPECT_EQ(SAI_STATUS_INVALID_PARAMETER,
+              ss.bulkClearStats(SAI_OBJECT_TYPE_SWITCH, 1, keys, 1, &id, SAI_STATS_MODE_BULK_READ, statuses));
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS,
+              ss.bulkClearStats(SAI_OBJECT_TYPE_SWITCH, 1, keys, 1, &id, SAI_STATS_MODE_BULK_CLEAR, statuses));
+
+    EXPECT_EQ(SAI_STATUS_SUCCESS,
+              ss.bulkGetStats(SAI_OBJECT_TYPE_SWITCH, 1, keys, 1, &id, SAI_STATS_MODE_BULK_READ, statuses, counters));
+
+    EXPECT_EQ(0, counters[0]);
+}
@@ -0,0 +1,132 @@
+#include "WarmBootSnapshot.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+using namespace saivs;
+
+static std::shared_ptr<WarmBootState> create_state()
+{
+    auto state = std::make_shared<WarmBootState>();
+
+    state->m_switchId = 0x2100000000;
+
+    state->m_objectHash[SAI_OBJECT_TYPE_SWITCH]["oid:0x2100000000"] = {};
+
+    auto& port = state->m_objectHash[SAI_OBJECT_TYPE_PORT]["oid:0x1000000000001"];
+
+    port["SAI_PORT_ATTR_ADMIN_STATE"] = std::make_shared<SaiAttrWrap>("SAI_PORT_ATTR_ADMIN_STATE", "true");
+    port["SAI_PORT_ATTR_MTU"] = std::make_shared<SaiAttrWrap>("SAI_PORT_ATTR_MTU", "9100");
+
+    return state;
+}
+
+TEST(WarmBootSnapshot, parseFormat)
+{
+    sai_vs_warm_boot_format_t format;
+
+    EXPECT_TRUE(WarmBootSnapshot::parseFormat(nullptr, format));
+    EXPECT_EQ(format, SAI_VS_WARM_BOOT_FORMAT_BINARY);
+
+    EXPECT_TRUE(WarmBootSnapshot::parseFormat("text", format));
+    EXPECT_EQ(format, SAI_VS_WARM_BOOT_FORMAT_TEXT);
+
+    EXPECT_TRUE(WarmBootSnapshot::parseFormat("binary", format));
+    EXPECT_EQ(format, SAI_VS_WARM_BOOT_FORMAT_BINARY);
+
+    EXPECT_FALSE(WarmBootSnapshot::parseFormat("foo", format));
+}
+
+TEST(WarmBootSnapshot, crc32)
+{
+    EXPECT_EQ(WarmBootSnapshot::crc32(0, "123456789", 9), 0xCBF43926);
+
+    // incremental crc is the same as crc of whole buffer
+
+    EXPECT_EQ(WarmBootSnapshot::crc32(WarmBootSnapshot::crc32(0, "1234", 4), "56789", 5), 0xCBF43926);
+}
+
+TEST(WarmBootSnapshot, writeText)
+{
+    std::stringstream ss;
+
+    WarmBootSnapshot::writeText(ss, *create_state());
+
+    EXPECT_EQ(ss.str(),
+            "SAI_OBJECT_TYPE_PORT oid:0x1000000000001 SAI_PORT_ATTR_ADMIN_STATE true\n"
+            "SAI_OBJECT_TYPE_PORT oid:0x1000000000001 SAI_PORT_ATTR_MTU 9100\n"
+            "SAI_OBJECT_TYPE_SWITCH oid:0x2100000000 NULL NULL\n");
+
+    EXPECT_FALSE(WarmBootSnapshot::isBinary(ss));
+}
+
+TEST(WarmBootSnapshot, readBinary)
+{
+    std::map<sai_object_id_t, std::shared_ptr<WarmBootState>> states;
+
+    states[0x2100000000] = create_state();
+
+    std::stringstream ss;
+
+    WarmBootSnapshot::writeBinary(ss, states);
+
+    EXPECT_TRUE(WarmBootSnapshot::isBinary(ss));
+
+    std::map<sai_object_id_t, WarmBootState> loaded;
+
+    EXPECT_TRUE(WarmBootSnapshot::readBinary(ss, loaded));
+
+    ASSERT_EQ(loaded.size(), 1);
+
+    auto& state = loaded.at(0x2100000000);
+
+    EXPECT_EQ(state.m_switchId, 0x2100000000);
+
+    std::stringstream expected;
+    std::stringstream actual;
+
+    WarmBootSnapshot::writeText(expected, *states[0x2100000000]);
+    WarmBootSnapshot::writeText(actual, state);
+
+    EXPECT_EQ(expected.str(), actual.str());
+}
+
+TEST(WarmBootSnapshot, readBinary_corrupted)
+{
+    std::map<sai_object_id_t, std::shared_ptr<WarmBootState>> states;
+
+    states[0x2100000000] = create_state();
+
+    std::stringstream ss;
+
+    WarmBootSnapshot::writeBinary(ss, states);
+
+    std::string data = ss.str();
+
+    std::map<sai_object_id_t, WarmBootState> loaded;
+
+    // truncated file
+
+    std::stringstream truncated(data.substr(0, data.size() - 10));
+
+    EXPECT_FALSE(WarmBootSnapshot::readBinary(truncated, loaded));
+    EXPECT_EQ(loaded.size(), 0);
+
+    // changed attribute value "9100" to "9101" is detected by checksum
+
+    auto pos = data.find("9100");
+
+    ASSERT_NE(pos, std::string::npos);
+
+    data[pos + 3] = '1';
+
+    std::stringstream corrupted(data);
+
+    EXPECT_FALSE(WarmBootSnapshot::readBinary(corrupted, loaded));
+    EXPECT_EQ(loaded.size(), 0);
+
+    std::stringstream text("SAI_OBJECT_TYPE_SWITCH oid:0x2100000000 NULL NULL\n");
+
+    EXPECT_FALSE(WarmBootSnapshot::readBinary(text, loaded));
+}
@@ -0,0 +1,132 @@
+#include "CounterGenerator.h"
+
+#include "swss/logger.h"
+#include "meta/sai_serialize.h"
+
+#include <inttypes.h>
+
+#define NANOSECONDS_PER_SECOND (1000000000ULL)
+
+using namespace saivs;
+
+CounterGenerator::CounterGenerator(
+        _In_ uint32_t switchIndex):
+    m_switchIndex(switchIndex),
+    m_version(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+uint64_t CounterGenerator::getRate(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ sai_stat_id_t counterId) const
+{
+    SWSS_LOG_ENTER();
+
+    auto oit = m_objectRates.find(objectId);
+
+    if (oit != m_objectRates.end())
+    {
+        auto rit = oit->second.find(counterId);
+
+        if (rit != oit->second.end())
+        {
+            return rit->second;
+        }
+    }
+
+    auto it = m_rates.find(objectType);
+
+    if (it == m_rates.end())
+    {
+        return 0;
+    }
+
+    auto rit = it->second.find(counterId);
+
+    if (rit == it->second.end())
+    {
+        return 0;
+    }
+
+    return rit->second;
+}
+
+void CounterGenerator::setRate(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_stat_id_t counterId,
+        _In_ uint64_t rate)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_INFO("setting %s counter %d rate to %" PRIu64 " on switch index %u",
+            sai_serialize_object_type(objectType).c_str(),
+            counterId,
+            rate,
+            m_switchIndex);
+
+    m_rates[objectType][counterId] = rate;
+
+    m_version++;
+}
+
+void CounterGenerator::setObjectRate(
+        _In_ sai_object_id_t objectId,
+        _In_ sai_stat_id_t counterId,
+        _In_ uint64_t rate)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_INFO("setting %s counter %d rate to %" PRIu64 " on switch index %u",
+            sai_serialize_object_id(objectId).c_str(),
+            counterId,
+            rate,
+            m_switchIndex);
+
+    m_objectRates[objectId][counterId] = rate;
+
+    m_version++;
+}
+
+void CounterGenerator::clearRates()
+{
+    SWSS_LOG_ENTER();
+
+    m_rates.clear();
+    m_objectRates.clear();
+
+    m_version++;
+}
+
+uint64_t CounterGenerator::getVersion() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_version;
+}
+
+uint64_t CounterGenerator::getGeneratedValue(
+        _In_ uint64_t rate,
+        _In_ std::chrono::nanoseconds elapsed)
+{
+    SWSS_LOG_ENTER();
+
+    if (elapsed.count() <= 0)
+    {
+        return 0;
+    }
+
+    uint64_t ns = (uint64_t)elapsed.count();
+
+    uint64_t seconds = ns / NANOSECONDS_PER_SECOND;
+    uint64_t remainder = ns % NANOSECONDS_PER_SECOND;
+
+    // rate * ns / 10^9 split so partial products don't overflow 64 bits
+
+    return rate * seconds
+        + remainder * (rate / NANOSECONDS_PER_SECOND)
+        + remainder * (rate % NANOSECONDS_PER_SECOND) / NANOSECONDS_PER_SECOND;
+}
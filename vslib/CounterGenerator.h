@@ -0,0 +1,85 @@
+#pragma once
+
+extern "C" {
+#include "sai.h"
+}
+
+#include <map>
+#include <chrono>
+
+namespace saivs
+{
+    /**
+     * @brief Synthetic traffic model for virtual switch counters.
+     *
+     * Holds growth rate per second of counter for given object type, which
+     * applies to all objects of that type, like all ports or all queues on
+     * the switch, and for single objects, which takes precedence over object
+     * type rate. Counters without rate are not changed by the generator.
+     */
+    class CounterGenerator
+    {
+        public:
+
+            constexpr static uint32_t DEFAULT_SWITCH_INDEX = 0;
+
+        public:
+
+            CounterGenerator(
+                    _In_ uint32_t switchIndex);
+
+            virtual ~CounterGenerator() = default;
+
+        public:
+
+            /**
+             * @brief Get counter rate of object, object rate if set,
+             * otherwise object type rate.
+             */
+            uint64_t getRate(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t objectId,
+                    _In_ sai_stat_id_t counterId) const;
+
+            void setRate(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_stat_id_t counterId,
+                    _In_ uint64_t rate);
+
+            void setObjectRate(
+                    _In_ sai_object_id_t objectId,
+                    _In_ sai_stat_id_t counterId,
+                    _In_ uint64_t rate);
+
+            void clearRates();
+
+            /**
+             * @brief Get rates version, incremented on every rate change.
+             *
+             * Users caching resolved rates compare it to detect changes.
+             */
+            uint64_t getVersion() const;
+
+        public:
+
+            /**
+             * @brief Get value generated with rate per second in elapsed time.
+             *
+             * Value is monotonic in elapsed time and it don't overflow for
+             * any rate up to 2^64 / 10^9 per nanosecond.
+             */
+            static uint64_t getGeneratedValue(
+                    _In_ uint64_t rate,
+                    _In_ std::chrono::nanoseconds elapsed);
+
+        private:
+
+            uint32_t m_switchIndex;
+
+            uint64_t m_version;
+
+            std::map<sai_object_type_t, std::map<sai_stat_id_t, uint64_t>> m_rates;
+
+            std::map<sai_object_id_t, std::map<sai_stat_id_t, uint64_t>> m_objectRates;
+    };
+}
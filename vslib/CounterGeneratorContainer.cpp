@@ -0,0 +1,54 @@
+#include "CounterGeneratorContainer.h"
+
+#include "swss/logger.h"
+
+using namespace saivs;
+
+void CounterGeneratorContainer::insert(
+        _In_ uint32_t switchIndex,
+        _In_ std::shared_ptr<CounterGenerator> cg)
+{
+    SWSS_LOG_ENTER();
+
+    if (cg == nullptr)
+    {
+        SWSS_LOG_THROW("counter generator pointer can't be nullptr");
+    }
+
+    m_container[switchIndex] = cg;
+}
+
+void CounterGeneratorContainer::remove(
+        _In_ uint32_t switchIndex)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_container.find(switchIndex);
+
+    if (it != m_container.end())
+    {
+        m_container.erase(it);
+    }
+}
+
+std::shared_ptr<CounterGenerator> CounterGeneratorContainer::getCounterGenerator(
+        _In_ uint32_t switchIndex) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_container.find(switchIndex);
+
+    if (it != m_container.end())
+    {
+        return it->second;
+    }
+
+    return nullptr;
+}
+
+void CounterGeneratorContainer::clear()
+{
+    SWSS_LOG_ENTER();
+
+    m_container.clear();
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CounterGenerator.h"
+
+#include <memory>
+
+namespace saivs
+{
+    class CounterGeneratorContainer
+    {
+        public:
+
+            CounterGeneratorContainer() = default;
+
+            virtual ~CounterGeneratorContainer() = default;
+
+        public:
+
+            void insert(
+                    _In_ uint32_t switchIndex,
+                    _In_ std::shared_ptr<CounterGenerator> cg);
+
+            void remove(
+                    _In_ uint32_t switchIndex);
+
+            std::shared_ptr<CounterGenerator> getCounterGenerator(
+                    _In_ uint32_t switchIndex) const;
+
+            void clear();
+
+        private:
+
+            std::map<uint32_t, std::shared_ptr<CounterGenerator>> m_container;
+    };
+}
@@ -0,0 +1,178 @@
+#include "CounterGeneratorParser.h"
+
+#include "swss/logger.h"
+#include "swss/tokenize.h"
+
+#include "meta/sai_serialize.h"
+
+#include <fstream>
+#include <inttypes.h>
+
+using namespace saivs;
+
+std::shared_ptr<CounterGeneratorContainer> CounterGeneratorParser::parseFromFile(
+        _In_ const char* fileName)
+{
+    SWSS_LOG_ENTER();
+
+    if (fileName == nullptr)
+    {
+        SWSS_LOG_NOTICE("file name is NULL, returning empty counter generator");
+
+        return std::make_shared<CounterGeneratorContainer>();
+    }
+
+    std::string file(fileName);
+
+    std::ifstream ifs(file);
+
+    if (!ifs.is_open())
+    {
+        SWSS_LOG_WARN("failed to open counter generator file: %s", file.c_str());
+
+        return std::make_shared<CounterGeneratorContainer>();
+    }
+
+    SWSS_LOG_NOTICE("loading counter rates from: %s", file.c_str());
+
+    std::string line;
+
+    auto container = std::make_shared<CounterGeneratorContainer>();
+
+    while (getline(ifs, line))
+    {
+        /*
+         * line can be in 4 forms:
+         *
+         * SAI_OBJECT_TYPE_XXX:SAI_XXX_STAT_YYY=rate
+         * N:SAI_OBJECT_TYPE_XXX:SAI_XXX_STAT_YYY=rate
+         * SAI_OBJECT_TYPE_XXX:oid:0xZZ:SAI_XXX_STAT_YYY=rate
+         * N:SAI_OBJECT_TYPE_XXX:oid:0xZZ:SAI_XXX_STAT_YYY=rate
+         *
+         * where N is switchIndex (0..255) - SAI_VS_SWITCH_INDEX_MAX
+         * if N is not specified then zero (0) is assumed
+         */
+
+        if (line.size() == 0 || line[0] == '#' || line[0] == ';')
+        {
+            continue;
+        }
+
+        SWSS_LOG_INFO("line: %s", line.c_str());
+
+        auto toks = swss::tokenize(line, '=');
+
+        if (toks.size() != 2)
+        {
+            SWSS_LOG_ERROR("expected 2 tokens, got: %zu on line: %s", toks.size(), line.c_str());
+            continue;
+        }
+
+        auto tokens = swss::tokenize(toks.at(0), ':');
+
+        uint32_t switchIndex = CounterGenerator::DEFAULT_SWITCH_INDEX;
+
+        if (tokens.size() == 3 || tokens.size() == 5)
+        {
+            if (sscanf(tokens.at(0).c_str(), "%u", &switchIndex) != 1)
+            {
+                SWSS_LOG_ERROR("failed to parse switchIndex: %s", tokens.at(0).c_str());
+                continue;
+            }
+
+            tokens.erase(tokens.begin());
+        }
+
+        if (tokens.size() == 2)
+        {
+            parse(container, switchIndex, tokens.at(0), "", tokens.at(1), toks.at(1));
+        }
+        else if (tokens.size() == 4)
+        {
+            parse(container, switchIndex, tokens.at(0), tokens.at(1) + ":" + tokens.at(2), tokens.at(3), toks.at(1));
+        }
+        else
+        {
+            SWSS_LOG_ERROR("expected 2 to 5 tokens in line %s, got %zu", line.c_str(), tokens.size());
+        }
+    }
+
+    return container;
+}
+
+void CounterGeneratorParser::parse(
+        _In_ std::shared_ptr<CounterGeneratorContainer> container,
+        _In_ uint32_t switchIndex,
+        _In_ const std::string& strObjectType,
+        _In_ const std::string& strObjectId,
+        _In_ const std::string& strCounterId,
+        _In_ const std::string& strRate)
+{
+    SWSS_LOG_ENTER();
+
+    sai_object_type_t objectType;
+
+    sai_object_id_t objectId = SAI_NULL_OBJECT_ID;
+
+    int32_t counterId;
+
+    try
+    {
+        sai_deserialize_object_type(strObjectType, objectType);
+
+        if (strObjectId.size())
+        {
+            sai_deserialize_object_id(strObjectId, objectId);
+        }
+
+        auto info = sai_metadata_get_object_type_info(objectType);
+
+        if (info == nullptr || info->statenum == nullptr)
+        {
+            SWSS_LOG_ERROR("object type %s has no counters", strObjectType.c_str());
+            return;
+        }
+
+        sai_deserialize_enum(strCounterId, info->statenum, counterId);
+    }
+    catch(const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to deserialize '%s:%s': %s", strObjectType.c_str(), strCounterId.c_str(), e.what());
+        return;
+    }
+
+    uint64_t rate;
+
+    if (sscanf(strRate.c_str(), "%" SCNu64, &rate) != 1)
+    {
+        SWSS_LOG_ERROR("failed to parse '%s' as rate", strRate.c_str());
+        return;
+    }
+
+    auto generator = container->getCounterGenerator(switchIndex);
+
+    if (generator == nullptr)
+    {
+        generator = std::make_shared<CounterGenerator>(switchIndex);
+
+        container->insert(switchIndex, generator);
+    }
+
+    auto name = strObjectId.size()
+        ? strObjectType + ":" + strObjectId + ":" + strCounterId
+        : strObjectType + ":" + strCounterId;
+
+    SWSS_LOG_NOTICE("adding counter rate on switch index %u, %s = %" PRIu64,
+            switchIndex,
+            name.c_str(),
+            rate);
+
+    if (objectId == SAI_NULL_OBJECT_ID)
+    {
+        generator->setRate(objectType, counterId, rate);
+    }
+    else
+    {
+        generator->setObjectRate(objectId, counterId, rate);
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CounterGeneratorContainer.h"
+
+#include <string>
+#include <vector>
+
+namespace saivs
+{
+    class CounterGeneratorParser
+    {
+        public:
+
+            CounterGeneratorParser() = delete;
+
+            ~CounterGeneratorParser() = delete;
+
+        public:
+
+            static std::shared_ptr<CounterGeneratorContainer> parseFromFile(
+                    _In_ const char* fileName);
+
+        private:
+
+            static void parse(
+                    _In_ std::shared_ptr<CounterGeneratorContainer> container,
+                    _In_ uint32_t switchIndex,
+                    _In_ const std::string& strObjectType,
+                    _In_ const std::string& strObjectId,
+                    _In_ const std::string& strCounterId,
+                    _In_ const std::string& strRate);
+    };
+}
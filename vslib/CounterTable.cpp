@@ -0,0 +1,190 @@
+#include "CounterTable.h"
+
+#include "swss/logger.h"
+
+using namespace saivs;
+
+CounterTable::CounterTable(
+        _In_ std::shared_ptr<CounterGenerator> generator):
+    m_generator(generator)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void CounterTable::getCounterIndexes(
+        _In_ sai_object_type_t objectType,
+        _In_ uint32_t numberOfCounters,
+        _In_ const sai_stat_id_t* counterIds,
+        _Out_ std::vector<size_t>& indexes)
+{
+    SWSS_LOG_ENTER();
+
+    auto& otc = m_objectTypes[objectType];
+
+    indexes.resize(numberOfCounters);
+
+    for (uint32_t idx = 0; idx < numberOfCounters; idx++)
+    {
+        auto it = otc.m_indexes.find(counterIds[idx]);
+
+        if (it != otc.m_indexes.end())
+        {
+            indexes[idx] = it->second;
+            continue;
+        }
+
+        size_t index = otc.m_counterIds.size();
+
+        otc.m_indexes[counterIds[idx]] = index;
+
+        otc.m_counterIds.push_back(counterIds[idx]);
+
+        indexes[idx] = index;
+    }
+}
+
+CounterTable::ObjectCounters& CounterTable::getObjectCounters(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ std::chrono::steady_clock::time_point now)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_objects.find(objectId);
+
+    if (it == m_objects.end())
+    {
+        it = m_objects.emplace(objectId, ObjectCounters()).first;
+
+        it->second.m_start = now;
+        it->second.m_ratesVersion = m_generator ? m_generator->getVersion() : 0;
+    }
+
+    auto& oc = it->second;
+
+    auto elapsed = now - oc.m_start;
+
+    auto& counterIds = m_objectTypes[objectType].m_counterIds;
+
+    size_t first = oc.m_rates.size();
+
+    if (m_generator && oc.m_ratesVersion != m_generator->getVersion())
+    {
+        // value generated with old rate is kept, new rate applies from now
+
+        for (size_t index = 0; index < first; index++)
+        {
+            updateGenerated(oc, index, elapsed);
+
+            oc.m_rates[index] = m_generator->getRate(objectType, objectId, counterIds[index]);
+
+            oc.m_generated[index] = CounterGenerator::getGeneratedValue(oc.m_rates[index], elapsed);
+        }
+
+        oc.m_ratesVersion = m_generator->getVersion();
+    }
+
+    size_t size = counterIds.size();
+
+    if (first < size)
+    {
+        // counter ids used for the first time start from zero, so value
+        // generated since object start is skipped
+
+        oc.m_values.resize(size, 0);
+        oc.m_generated.resize(size, 0);
+        oc.m_rates.resize(size, 0);
+
+        for (size_t index = first; m_generator && index < size; index++)
+        {
+            oc.m_rates[index] = m_generator->getRate(objectType, objectId, counterIds[index]);
+
+            oc.m_generated[index] = CounterGenerator::getGeneratedValue(oc.m_rates[index], elapsed);
+        }
+    }
+
+    return oc;
+}
+
+void CounterTable::updateGenerated(
+        _Inout_ ObjectCounters& oc,
+        _In_ size_t index,
+        _In_ std::chrono::nanoseconds elapsed)
+{
+    SWSS_LOG_ENTER();
+
+    if (oc.m_rates[index] == 0)
+    {
+        return;
+    }
+
+    uint64_t generated = CounterGenerator::getGeneratedValue(oc.m_rates[index], elapsed);
+
+    oc.m_values[index] += generated - oc.m_generated[index];
+
+    oc.m_generated[index] = generated;
+}
+
+void CounterTable::readCounters(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ const std::vector<size_t>& indexes,
+        _In_ bool clear,
+        _Out_ uint64_t* counters)
+{
+    SWSS_LOG_ENTER();
+
+    auto now = std::chrono::steady_clock::now();
+
+    auto& oc = getObjectCounters(objectType, objectId, now);
+
+    auto elapsed = now - oc.m_start;
+
+    for (size_t idx = 0; idx < indexes.size(); idx++)
+    {
+        size_t index = indexes[idx];
+
+        updateGenerated(oc, index, elapsed);
+
+        counters[idx] = oc.m_values[index];
+
+        if (clear)
+        {
+            oc.m_values[index] = 0;
+        }
+    }
+}
+
+void CounterTable::writeCounters(
+        _In_ sai_object_type_t objectType,
+        _In_ sai_object_id_t objectId,
+        _In_ const std::vector<size_t>& indexes,
+        _In_ const uint64_t* counters)
+{
+    SWSS_LOG_ENTER();
+
+    auto& oc = getObjectCounters(objectType, objectId, std::chrono::steady_clock::now());
+
+    for (size_t idx = 0; idx < indexes.size(); idx++)
+    {
+        oc.m_values[indexes[idx]] = counters[idx];
+    }
+}
+
+void CounterTable::removeObject(
+        _In_ sai_object_id_t objectId)
+{
+    SWSS_LOG_ENTER();
+
+    m_objects.erase(objectId);
+}
+
+bool CounterTable::hasObject(
+        _In_ sai_object_id_t objectId) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_objects.find(objectId) != m_objects.end();
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "CounterGenerator.h"
+
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <chrono>
+
+namespace saivs
+{
+    /**
+     * @brief Counters of all objects on virtual switch.
+     *
+     * Each counter id of object type gets index in flat per object counter
+     * array when used for the first time, so after indexes are resolved once
+     * for the counter id list, counters of many objects are accessed without
+     * any lookup. This is used by bulk stats API.
+     *
+     * When counter generator is set, counters with configured rate grow with
+     * time since counter of object was accessed for the first time. Rates are
+     * resolved per object, since single objects can have own rates, and they
+     * are resolved again when generator rates change.
+     */
+    class CounterTable
+    {
+        public:
+
+            CounterTable(
+                    _In_ std::shared_ptr<CounterGenerator> generator);
+
+            virtual ~CounterTable() = default;
+
+        public:
+
+            /**
+             * @brief Resolve counter ids to indexes in object counter array.
+             */
+            void getCounterIndexes(
+                    _In_ sai_object_type_t objectType,
+                    _In_ uint32_t numberOfCounters,
+                    _In_ const sai_stat_id_t* counterIds,
+                    _Out_ std::vector<size_t>& indexes);
+
+            /**
+             * @brief Read counters, clear them after read if requested.
+             *
+             * Counters not set yet are read as zero.
+             */
+            void readCounters(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t objectId,
+                    _In_ const std::vector<size_t>& indexes,
+                    _In_ bool clear,
+                    _Out_ uint64_t* counters);
+
+            void writeCounters(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t objectId,
+                    _In_ const std::vector<size_t>& indexes,
+                    _In_ const uint64_t* counters);
+
+            void removeObject(
+                    _In_ sai_object_id_t objectId);
+
+            /**
+             * @brief Check whether object counters were already accessed.
+             *
+             * Counters are removed together with object, so object with
+             * counters exists on the switch.
+             */
+            bool hasObject(
+                    _In_ sai_object_id_t objectId) const;
+
+        private:
+
+            class ObjectTypeCounters
+            {
+                public:
+
+                    std::unordered_map<sai_stat_id_t, size_t> m_indexes;
+
+                    /**
+                     * @brief Counter id per counter index.
+                     */
+                    std::vector<sai_stat_id_t> m_counterIds;
+            };
+
+            class ObjectCounters
+            {
+                public:
+
+                    std::vector<uint64_t> m_values;
+
+                    /**
+                     * @brief Generator rate of this object per counter index.
+                     */
+                    std::vector<uint64_t> m_rates;
+
+                    /**
+                     * @brief Value already added by generator per counter index.
+                     */
+                    std::vector<uint64_t> m_generated;
+
+                    std::chrono::steady_clock::time_point m_start;
+
+                    /**
+                     * @brief Generator version of resolved rates.
+                     */
+                    uint64_t m_ratesVersion;
+            };
+
+            ObjectCounters& getObjectCounters(
+                    _In_ sai_object_type_t objectType,
+                    _In_ sai_object_id_t objectId,
+                    _In_ std::chrono::steady_clock::time_point now);
+
+            /**
+             * @brief Add value generated since last update to counter.
+             */
+            static void updateGenerated(
+                    _Inout_ ObjectCounters& oc,
+                    _In_ size_t index,
+                    _In_ std::chrono::nanoseconds elapsed);
+
+        private:
+
+            std::shared_ptr<CounterGenerator> m_generator;
+
+            std::unordered_map<sai_object_type_t, ObjectTypeCounters> m_objectTypes;
+
+            std::unordered_map<sai_object_id_t, ObjectCounters> m_objects;
+    };
+}
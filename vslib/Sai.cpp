@@ -7,6 +7,7 @@
 #include "HostInterfaceInfo.h"
 #include "SwitchConfigContainer.h"
 #include "ResourceLimiterParser.h"
+#include "CounterGeneratorParser.h"
 #include "CorePortIndexMapFileParser.h"
 #include "ContextConfigContainer.h"
 
@@ -130,10 +131,21 @@ sai_status_t Sai::initialize(
 
     m_resourceLimiterContainer = ResourceLimiterParser::parseFromFile(resourceLimiterFile);
 
+    auto *counterGeneratorFile = service_method_table->profile_get_value(0, SAI_KEY_VS_COUNTER_GENERATOR_FILE);
+
+    m_counterGeneratorContainer = CounterGeneratorParser::parseFromFile(counterGeneratorFile);
+
     auto boot_type          = service_method_table->profile_get_value(0, SAI_KEY_BOOT_TYPE);
     m_warm_boot_read_file   = service_method_table->profile_get_value(0, SAI_KEY_WARM_BOOT_READ_FILE);
     m_warm_boot_write_file  = service_method_table->profile_get_value(0, SAI_KEY_WARM_BOOT_WRITE_FILE);
 
+    auto warm_boot_format   = service_method_table->profile_get_value(0, SAI_KEY_VS_WARM_BOOT_FORMAT);
+
+    if (!WarmBootSnapshot::parseFormat(warm_boot_format, m_warm_boot_format))
+    {
+        return SAI_STATUS_FAILURE;
+    }
+
     sai_vs_boot_type_t bootType;
 
     if (!SwitchConfig::parseBootType(boot_type, bootType))
@@ -234,6 +246,7 @@ sai_status_t Sai::initialize(
 
         sc->m_eventQueue = m_eventQueue;
         sc->m_resourceLimiter = m_resourceLimiterContainer->getResourceLimiter(sc->m_switchIndex);
+        sc->m_counterGenerator = m_counterGeneratorContainer->getCounterGenerator(sc->m_switchIndex);
         sc->m_corePortIndexMap = m_corePortIndexMapContainer->getCorePortIndexMap(sc->m_switchIndex);
     }
 
@@ -300,7 +313,7 @@ sai_status_t Sai::uninitialize(void)
 
     // clear state after ending all threads
 
-    m_vsSai->writeWarmBootFile(m_warm_boot_write_file);
+    m_vsSai->writeWarmBootFile(m_warm_boot_write_file, m_warm_boot_format);
 
     m_vsSai = nullptr;
     m_meta = nullptr;
@@ -534,7 +547,16 @@ sai_status_t Sai::bulkGetStats(
     SWSS_LOG_ENTER();
     VS_CHECK_API_INITIALIZED();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return m_meta->bulkGetStats(
+            switchId,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses,
+            counters);
 }
 
 sai_status_t Sai::bulkClearStats(
@@ -551,7 +573,15 @@ sai_status_t Sai::bulkClearStats(
     SWSS_LOG_ENTER();
     VS_CHECK_API_INITIALIZED();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    return m_meta->bulkClearStats(
+            switchId,
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses);
 }
 
 // BULK QUAD OID
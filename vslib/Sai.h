@@ -5,6 +5,7 @@
 #include "EventQueue.h"
 #include "EventPayloadNotification.h"
 #include "ResourceLimiterContainer.h"
+#include "CounterGeneratorContainer.h"
 #include "CorePortIndexMapContainer.h"
 #include "Context.h"
 
@@ -298,12 +299,16 @@ namespace saivs
 
             const char *m_warm_boot_write_file;
 
+            sai_vs_warm_boot_format_t m_warm_boot_format;
+
             std::shared_ptr<LaneMapContainer> m_laneMapContainer;
 
             std::shared_ptr<LaneMapContainer> m_fabricLaneMapContainer;
 
             std::shared_ptr<ResourceLimiterContainer> m_resourceLimiterContainer;
 
+            std::shared_ptr<CounterGeneratorContainer> m_counterGeneratorContainer;
+
             std::shared_ptr<CorePortIndexMapContainer> m_corePortIndexMapContainer;
 
             uint32_t m_globalContext;
@@ -3,6 +3,7 @@
 #include "LaneMap.h"
 #include "EventQueue.h"
 #include "ResourceLimiter.h"
+#include "CounterGenerator.h"
 #include "CorePortIndexMap.h"
 
 #include <string>
@@ -88,5 +89,7 @@ namespace saivs
             std::shared_ptr<ResourceLimiter> m_resourceLimiter;
 
             std::shared_ptr<CorePortIndexMap> m_corePortIndexMap;
+
+            std::shared_ptr<CounterGenerator> m_counterGenerator;
     };
 }
@@ -61,6 +61,14 @@ SwitchState::SwitchState(
         SWSS_LOG_NOTICE("resource limiter is SET on switch %s",
                 sai_serialize_object_id(switch_id).c_str());
     }
+
+    if (m_switchConfig->m_counterGenerator)
+    {
+        SWSS_LOG_NOTICE("counter generator is SET on switch %s",
+                sai_serialize_object_id(switch_id).c_str());
+    }
+
+    m_counterTable = std::make_shared<CounterTable>(m_switchConfig->m_counterGenerator);
 }
 
 SwitchState::~SwitchState()
@@ -237,45 +245,118 @@ sai_status_t SwitchState::getStatsExt(
         perform_set = true;
     }
 
-    auto str_object_id = sai_serialize_object_id(object_id);
+    std::vector<size_t> indexes;
 
-    auto mapit = m_countersMap.find(str_object_id);
+    m_counterTable->getCounterIndexes(object_type, number_of_counters, counter_ids, indexes);
 
-    if (mapit == m_countersMap.end())
-        m_countersMap[str_object_id] = { };
+    if (perform_set)
+    {
+        m_counterTable->writeCounters(object_type, object_id, indexes, counters);
+    }
+    else
+    {
+        m_counterTable->readCounters(object_type, object_id, indexes, mode == SAI_STATS_MODE_READ_AND_CLEAR, counters);
+    }
 
-    auto& localcounters = m_countersMap[str_object_id];
+    return SAI_STATUS_SUCCESS;
+}
+
+sai_status_t SwitchState::bulkGetStats(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _Inout_ sai_status_t *object_statuses,
+        _Out_ uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
 
-    for (uint32_t i = 0; i < number_of_counters; ++i)
+    if (mode != SAI_STATS_MODE_BULK_READ && mode != SAI_STATS_MODE_BULK_READ_AND_CLEAR)
     {
-        int32_t id = counter_ids[i];
+        SWSS_LOG_ERROR("mode %d is not supported on bulk get stats", mode);
 
-        if (perform_set)
-        {
-            localcounters[ id ] = counters[i];
-        }
-        else
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::vector<size_t> indexes;
+
+    m_counterTable->getCounterIndexes(object_type, number_of_counters, counter_ids, indexes);
+
+    return bulkStats(object_type, object_count, object_key, indexes,
+            mode == SAI_STATS_MODE_BULK_READ_AND_CLEAR, object_statuses, counters);
+}
+
+sai_status_t SwitchState::bulkClearStats(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _In_ sai_stats_mode_t mode,
+        _Inout_ sai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (mode != SAI_STATS_MODE_BULK_CLEAR)
+    {
+        SWSS_LOG_ERROR("mode %d is not supported on bulk clear stats", mode);
+
+        return SAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::vector<size_t> indexes;
+
+    m_counterTable->getCounterIndexes(object_type, number_of_counters, counter_ids, indexes);
+
+    return bulkStats(object_type, object_count, object_key, indexes, true, object_statuses, nullptr);
+}
+
+sai_status_t SwitchState::bulkStats(
+        _In_ sai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const sai_object_key_t *object_key,
+        _In_ const std::vector<size_t>& indexes,
+        _In_ bool clear,
+        _Inout_ sai_status_t *object_statuses,
+        _Out_ uint64_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    // counters are not returned on bulk clear, read them to temporary buffer
+
+    std::vector<uint64_t> buffer(counters ? 0 : indexes.size());
+
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    auto& objectHash = m_objectHash.at(object_type);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        sai_object_id_t objectId = object_key[idx].key.object_id;
+
+        // object hash is indexed by serialized id, so it's only used for
+        // objects which counters were not accessed yet
+
+        if (!m_counterTable->hasObject(objectId) &&
+                objectHash.find(sai_serialize_object_id(objectId)) == objectHash.end())
         {
-            auto it = localcounters.find(id);
-
-            if (it == localcounters.end())
-            {
-                // if counter is not found on list, just return 0
-                counters[i] = 0;
-            }
-            else
-            {
-                counters[i] = it->second;
-            }
-
-            if (mode == SAI_STATS_MODE_READ_AND_CLEAR)
-            {
-                localcounters[ id ] = 0;
-            }
+            object_statuses[idx] = SAI_STATUS_INVALID_OBJECT_ID;
+
+            status = SAI_STATUS_FAILURE;
+
+            continue;
         }
+
+        uint64_t *objectCounters = counters ? counters + (size_t)idx * indexes.size() : buffer.data();
+
+        m_counterTable->readCounters(object_type, objectId, indexes, clear, objectCounters);
+
+        object_statuses[idx] = SAI_STATUS_SUCCESS;
     }
 
-    return SAI_STATUS_SUCCESS;
+    return status;
 }
 
 sai_status_t SwitchState::queryStatsCapability(
@@ -6,6 +6,7 @@ extern "C" {
 
 #include "SaiAttrWrap.h"
 #include "SwitchConfig.h"
+#include "CounterTable.h"
 
 #include "meta/Meta.h"
 
@@ -56,6 +57,25 @@ namespace saivs
                     _In_ sai_stats_mode_t mode,
                     _Out_ uint64_t *counters);
 
+            sai_status_t bulkGetStats(
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t *counter_ids,
+                    _In_ sai_stats_mode_t mode,
+                    _Inout_ sai_status_t *object_statuses,
+                    _Out_ uint64_t *counters);
+
+            sai_status_t bulkClearStats(
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const sai_stat_id_t *counter_ids,
+                    _In_ sai_stats_mode_t mode,
+                    _Inout_ sai_status_t *object_statuses);
+
             sai_status_t queryStatsCapability(
                     _In_ sai_object_id_t switchId,
                     _In_ sai_object_type_t objectType,
@@ -98,13 +118,29 @@ namespace saivs
 
             std::shared_ptr<saimeta::Meta> getMeta();
 
+        private:
+
+            /**
+             * @brief Read counters of objects, counter indexes are already resolved.
+             *
+             * Counters can be nullptr, then values are only cleared.
+             */
+            sai_status_t bulkStats(
+                    _In_ sai_object_type_t object_type,
+                    _In_ uint32_t object_count,
+                    _In_ const sai_object_key_t *object_key,
+                    _In_ const std::vector<size_t>& indexes,
+                    _In_ bool clear,
+                    _Inout_ sai_status_t *object_statuses,
+                    _Out_ uint64_t *counters);
+
         public: // TODO make private
 
             ObjectHash m_objectHash;
 
         protected:
 
-            std::map<std::string, std::map<int, uint64_t>> m_countersMap;
+            std::shared_ptr<CounterTable> m_counterTable;
 
             sai_object_id_t m_switch_id;
 
@@ -1,4 +1,5 @@
 #include "SwitchStateBase.h"
+#include "WarmBootSnapshot.h"
 
 #include "swss/logger.h"
 #include "meta/sai_serialize.h"
@@ -424,6 +425,17 @@ sai_status_t SwitchStateBase::remove_internal(
 
     objectHash.erase(it);
 
+    auto info = sai_metadata_get_object_type_info(object_type);
+
+    if (!info->isnonobjectid)
+    {
+        sai_object_id_t objectId;
+
+        sai_deserialize_object_id(serializedObjectId, objectId);
+
+        m_counterTable->removeObject(objectId);
+    }
+
     return SAI_STATUS_SUCCESS;
 }
 
@@ -735,7 +747,9 @@ sai_status_t SwitchStateBase::bulkCreate(
 
     for (it = 0; it < object_count; it++)
     {
-        object_statuses[it] = create_internal(object_type, serialized_object_ids[it], switch_id, attr_count[it], attr_list[it]);
+        // same as single create, so port dependencies are created as well
+
+        object_statuses[it] = create(object_type, serialized_object_ids[it], switch_id, attr_count[it], attr_list[it]);
 
         if (object_statuses[it] != SAI_STATUS_SUCCESS)
         {
@@ -779,7 +793,7 @@ sai_status_t SwitchStateBase::bulkRemove(
 
     for (it = 0; it < object_count; it++)
     {
-        object_statuses[it] = remove_internal(object_type, serialized_object_ids[it]);
+        object_statuses[it] = remove(object_type, serialized_object_ids[it]);
 
         if (object_statuses[it] != SAI_STATUS_SUCCESS)
         {
@@ -2921,44 +2935,24 @@ bool SwitchStateBase::check_object_list_default_state(
             [&](sai_object_id_t oid) { return check_object_default_state(oid); });
 }
 
-std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
+std::shared_ptr<WarmBootState> SwitchStateBase::getWarmBootState() const
 {
     SWSS_LOG_ENTER();
 
-    std::stringstream ss;
+    auto state = std::make_shared<WarmBootState>();
+
+    state->m_switchId = m_switch_id;
 
-    const auto& objectHash = m_objectHash;
+    // attributes are held by shared pointers, so only maps are copied here,
+    // attribute values are serialized later directly to warm boot file
 
-    // dump all objects and attributes to file
+    state->m_objectHash = m_objectHash;
 
     size_t count = 0;
 
-    for (auto kvp: objectHash)
+    for (const auto& kvp: m_objectHash)
     {
-        auto singleTypeObjectMap = kvp.second;
-
-        count += singleTypeObjectMap.size();
-
-        for (auto o: singleTypeObjectMap)
-        {
-            // if object don't have attributes, size can be zero
-            if (o.second.size() == 0)
-            {
-                ss << sai_serialize_object_type(kvp.first) << " " << o.first << " NULL NULL" << std::endl;
-                continue;
-            }
-
-            for (auto a: o.second)
-            {
-                ss << sai_serialize_object_type(kvp.first) << " ";
-                ss << o.first.c_str();
-                ss << " ";
-                ss << a.first.c_str();
-                ss << " ";
-                ss << a.second->getAttrStrValue();
-                ss << std::endl;
-            }
-        }
+        count += kvp.second.size();
     }
 
     if (m_switchConfig->m_useTapDevice)
@@ -2968,10 +2962,7 @@ std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
          * data and restore it on warm start.
          */
 
-        for (auto fi: m_fdb_info_set)
-        {
-            ss << SAI_VS_FDB_INFO << " " << fi.serialize() << std::endl;
-        }
+        state->m_fdbInfoSet = m_fdb_info_set;
 
         SWSS_LOG_NOTICE("dumped %zu fdb infos for switch %s",
                 m_fdb_info_set.size(),
@@ -2982,6 +2973,17 @@ std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
             count,
             sai_serialize_object_id(m_switch_id).c_str());
 
+    return state;
+}
+
+std::string SwitchStateBase::dump_switch_database_for_warm_restart() const
+{
+    SWSS_LOG_ENTER();
+
+    std::stringstream ss;
+
+    WarmBootSnapshot::writeText(ss, *getWarmBootState());
+
     return ss.str();
 }
 
@@ -3007,11 +3009,15 @@ void SwitchStateBase::debugSetStats(
 {
     SWSS_LOG_ENTER();
 
-    auto key = sai_serialize_object_id(oid);
+    auto objectType = objectTypeQuery(oid);
 
     for (auto& kvp: stats)
     {
-        m_countersMap[key][kvp.first] = kvp.second;
+        std::vector<size_t> indexes;
+
+        m_counterTable->getCounterIndexes(objectType, 1, &kvp.first, indexes);
+
+        m_counterTable->writeCounters(objectType, oid, indexes, &kvp.second);
     }
 }
 
@@ -504,6 +504,11 @@ namespace saivs
                     _In_ sai_object_id_t port_id,
                     _In_ sai_port_oper_status_t port_oper_status);
 
+            /**
+             * @brief Get snapshot of switch database for warm restart.
+             */
+            std::shared_ptr<WarmBootState> getWarmBootState() const;
+
             std::string dump_switch_database_for_warm_restart() const;
 
             void syncOnLinkMsg(
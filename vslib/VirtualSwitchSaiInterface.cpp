@@ -16,6 +16,10 @@
 #include "SwitchMLNX2700.h"
 
 #include <inttypes.h>
+#include <sys/resource.h>
+
+#include <chrono>
+#include <fstream>
 
 /*
  * Max number of counters used in 1 api call
@@ -652,7 +656,7 @@ sai_status_t VirtualSwitchSaiInterface::remove(
 
             if (attr.value.booldata)
             {
-                m_warmBootData[switchId] = ss->dump_switch_database_for_warm_restart();
+                m_warmBootData[switchId] = ss->getWarmBootState();
             }
         }
         else
@@ -974,7 +978,24 @@ sai_status_t VirtualSwitchSaiInterface::bulkGetStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    auto it = m_switchStateMap.find(switchId);
+
+    if (it == m_switchStateMap.end())
+    {
+        SWSS_LOG_ERROR("failed to find switch %s in switch state map", sai_serialize_object_id(switchId).c_str());
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    return it->second->bulkGetStats(
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses,
+            counters);
 }
 
 sai_status_t VirtualSwitchSaiInterface::bulkClearStats(
@@ -989,7 +1010,23 @@ sai_status_t VirtualSwitchSaiInterface::bulkClearStats(
 {
     SWSS_LOG_ENTER();
 
-    return SAI_STATUS_NOT_IMPLEMENTED;
+    auto it = m_switchStateMap.find(switchId);
+
+    if (it == m_switchStateMap.end())
+    {
+        SWSS_LOG_ERROR("failed to find switch %s in switch state map", sai_serialize_object_id(switchId).c_str());
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    return it->second->bulkClearStats(
+            object_type,
+            object_count,
+            object_key,
+            number_of_counters,
+            counter_ids,
+            mode,
+            object_statuses);
 }
 
 sai_status_t VirtualSwitchSaiInterface::bulkRemove(
@@ -1300,9 +1337,12 @@ sai_status_t VirtualSwitchSaiInterface::bulkCreate(
 
     std::vector<std::string> serialized_object_ids;
 
-    // on create vid is put in db by syncd
     for (uint32_t idx = 0; idx < object_count; idx++)
     {
+        // create new real object ID, same as on single create
+
+        object_id[idx] = m_realObjectIdManager->allocateNewObjectId(object_type, switch_id);
+
         std::string str_object_id = sai_serialize_object_id(object_id[idx]);
         serialized_object_ids.push_back(str_object_id);
     }
@@ -1532,16 +1572,40 @@ sai_status_t VirtualSwitchSaiInterface::logSet(
     return SAI_STATUS_SUCCESS;
 }
 
+/*
+ * Process lifetime high water mark of resident memory, it is never decreased,
+ * so increase during operation shows how much operation raised the peak, and
+ * zero means operation fit into memory already used before.
+ */
+static long getPeakRssKb()
+{
+    SWSS_LOG_ENTER();
+
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return -1;
+    }
+
+    return usage.ru_maxrss;
+}
+
 bool VirtualSwitchSaiInterface::writeWarmBootFile(
-        _In_ const char* warmBootFile) const
+        _In_ const char* warmBootFile,
+        _In_ sai_vs_warm_boot_format_t format) const
 {
     SWSS_LOG_ENTER();
 
     if (warmBootFile)
     {
+        auto start = std::chrono::steady_clock::now();
+
+        long peakRss = getPeakRssKb();
+
         std::ofstream ofs;
 
-        ofs.open(warmBootFile);
+        ofs.open(warmBootFile, std::ofstream::binary);
 
         if (!ofs.is_open())
         {
@@ -1554,13 +1618,40 @@ bool VirtualSwitchSaiInterface::writeWarmBootFile(
             SWSS_LOG_WARN("warm boot data is empty, is that what you want?");
         }
 
-        for (auto& kvp: m_warmBootData)
+        if (format == SAI_VS_WARM_BOOT_FORMAT_TEXT)
+        {
+            for (auto& kvp: m_warmBootData)
+            {
+                WarmBootSnapshot::writeText(ofs, *kvp.second);
+            }
+        }
+        else
         {
-            ofs << kvp.second;
+            WarmBootSnapshot::writeBinary(ofs, m_warmBootData);
         }
 
+        size_t size = (size_t)ofs.tellp();
+
         ofs.close();
 
+        if (ofs.fail())
+        {
+            SWSS_LOG_ERROR("failed to write: %s", warmBootFile);
+            return false;
+        }
+
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        long endPeakRss = getPeakRssKb();
+
+        SWSS_LOG_NOTICE("warm boot file %s written in %.3f ms, %zu bytes, %s format, process peak RSS %ld kB (raised by %ld kB)",
+                warmBootFile,
+                (double)duration.count() / 1000.0,
+                size,
+                format == SAI_VS_WARM_BOOT_FORMAT_TEXT ? "text" : "binary",
+                endPeakRss,
+                endPeakRss - peakRss);
+
         return true;
     }
 
@@ -1572,34 +1663,11 @@ bool VirtualSwitchSaiInterface::writeWarmBootFile(
     return false;
 }
 
-bool VirtualSwitchSaiInterface::readWarmBootFile(
-        _In_ const char* warmBootFile)
+bool VirtualSwitchSaiInterface::readTextWarmBootFile(
+        _In_ std::istream& ifs)
 {
     SWSS_LOG_ENTER();
 
-    if (warmBootFile == NULL)
-    {
-        SWSS_LOG_ERROR("warm boot read file is NULL");
-
-        return false;
-    }
-
-    {
-        std::ifstream in(warmBootFile, std::ifstream::ate | std::ifstream::binary);
-        SWSS_LOG_NOTICE("%s file size: %zu", warmBootFile, (size_t)in.tellg());
-    }
-
-    std::ifstream ifs;
-
-    ifs.open(warmBootFile);
-
-    if (!ifs.is_open())
-    {
-        SWSS_LOG_ERROR("failed to open: %s", warmBootFile);
-
-        return false;
-    }
-
     std::string line;
 
     while (std::getline(ifs, line))
@@ -1690,10 +1758,100 @@ bool VirtualSwitchSaiInterface::readWarmBootFile(
             std::make_shared<SaiAttrWrap>(strAttrId, strAttrValue);
     }
 
+    return true;
+}
+
+bool VirtualSwitchSaiInterface::readBinaryWarmBootFile(
+        _In_ std::istream& ifs)
+{
+    SWSS_LOG_ENTER();
+
+    if (!WarmBootSnapshot::readBinary(ifs, m_warmBootState))
+    {
+        return false;
+    }
+
+    // same as in text format, find biggest index of loaded OID objects
+
+    for (auto& kvp: m_warmBootState)
+    {
+        for (auto& ot: kvp.second.m_objectHash)
+        {
+            auto info = sai_metadata_get_object_type_info(ot.first);
+
+            if (info->isnonobjectid)
+            {
+                continue;
+            }
+
+            for (auto& o: ot.second)
+            {
+                sai_object_id_t objectId;
+                sai_deserialize_object_id(o.first, objectId);
+
+                m_realObjectIdManager->updateWarmBootObjectIndex(objectId);
+            }
+        }
+    }
+
+    return true;
+}
+
+bool VirtualSwitchSaiInterface::readWarmBootFile(
+        _In_ const char* warmBootFile)
+{
+    SWSS_LOG_ENTER();
+
+    if (warmBootFile == NULL)
+    {
+        SWSS_LOG_ERROR("warm boot read file is NULL");
+
+        return false;
+    }
+
+    {
+        std::ifstream in(warmBootFile, std::ifstream::ate | std::ifstream::binary);
+        SWSS_LOG_NOTICE("%s file size: %zu", warmBootFile, (size_t)in.tellg());
+    }
+
+    std::ifstream ifs;
+
+    ifs.open(warmBootFile, std::ifstream::binary);
+
+    if (!ifs.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open: %s", warmBootFile);
+
+        return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    long peakRss = getPeakRssKb();
+
+    bool success = WarmBootSnapshot::isBinary(ifs)
+        ? readBinaryWarmBootFile(ifs)
+        : readTextWarmBootFile(ifs);
+
     // NOTE notification pointers should be restored by attr_list when creating switch
 
     ifs.close();
 
+    if (!success)
+    {
+        return false;
+    }
+
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    long endPeakRss = getPeakRssKb();
+
+    SWSS_LOG_NOTICE("warm boot file %s loaded in %.3f ms, process peak RSS %ld kB (raised by %ld kB)",
+            warmBootFile,
+            (double)duration.count() / 1000.0,
+            endPeakRss,
+            endPeakRss - peakRss);
+
     SWSS_LOG_NOTICE("warm boot file %s stats, loaded switches: %zu", warmBootFile, m_warmBootState.size());
 
     for (auto& kvp: m_warmBootState)
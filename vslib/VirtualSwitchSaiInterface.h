@@ -2,6 +2,7 @@
 
 #include "SwitchStateBase.h"
 #include "WarmBootState.h"
+#include "WarmBootSnapshot.h"
 #include "RealObjectIdManager.h"
 #include "SwitchStateBase.h"
 #include "EventQueue.h"
@@ -284,7 +285,8 @@ namespace saivs
                     _In_ std::weak_ptr<saimeta::Meta> meta);
 
             bool writeWarmBootFile(
-                    _In_ const char* warmBootFile) const;
+                    _In_ const char* warmBootFile,
+                    _In_ sai_vs_warm_boot_format_t format) const;
 
             bool readWarmBootFile(
                     _In_ const char* warmBootFile);
@@ -301,11 +303,19 @@ namespace saivs
             void syncProcessEventNetLinkMsg(
                     _In_ std::shared_ptr<EventPayloadNetLinkMsg> payload);
 
+        private:
+
+            bool readTextWarmBootFile(
+                    _In_ std::istream& ifs);
+
+            bool readBinaryWarmBootFile(
+                    _In_ std::istream& ifs);
+
         private:
 
             std::weak_ptr<saimeta::Meta> m_meta;
 
-            std::map<sai_object_id_t, std::string> m_warmBootData;
+            std::map<sai_object_id_t, std::shared_ptr<WarmBootState>> m_warmBootData;
 
             std::map<sai_object_id_t, WarmBootState> m_warmBootState;
 
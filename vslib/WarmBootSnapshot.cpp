@@ -0,0 +1,466 @@
+#include "WarmBootSnapshot.h"
+#include "SwitchStateBase.h"
+
+#include "swss/logger.h"
+#include "meta/sai_serialize.h"
+
+#include <cstring>
+#include <array>
+#include <inttypes.h>
+
+#define WARM_BOOT_BINARY_MAGIC "SAIVSWB"
+
+#define WARM_BOOT_BINARY_VERSION (1)
+
+#define WARM_BOOT_RECORD_SWITCH ('S')
+#define WARM_BOOT_RECORD_OBJECT ('O')
+#define WARM_BOOT_RECORD_FDB_INFO ('F')
+#define WARM_BOOT_RECORD_END ('E')
+
+#define WARM_BOOT_MAX_STRING_SIZE (64 * 1024 * 1024)
+
+using namespace saivs;
+
+namespace
+{
+    class BinaryWriter
+    {
+        public:
+
+            BinaryWriter(
+                    _In_ std::ostream& os):
+                m_os(os),
+                m_crc(0)
+            {
+                SWSS_LOG_ENTER();
+
+                // empty
+            }
+
+            void write(
+                    _In_ const void* data,
+                    _In_ size_t size)
+            {
+                SWSS_LOG_ENTER();
+
+                m_crc = WarmBootSnapshot::crc32(m_crc, data, size);
+
+                m_os.write((const char*)data, (std::streamsize)size);
+            }
+
+            template <typename T>
+            void writeNumber(
+                    _In_ T value)
+            {
+                SWSS_LOG_ENTER();
+
+                write(&value, sizeof(value));
+            }
+
+            void writeString(
+                    _In_ const std::string& s)
+            {
+                SWSS_LOG_ENTER();
+
+                writeNumber((uint32_t)s.size());
+
+                write(s.data(), s.size());
+            }
+
+            uint32_t getCrc() const
+            {
+                SWSS_LOG_ENTER();
+
+                return m_crc;
+            }
+
+        private:
+
+            std::ostream& m_os;
+
+            uint32_t m_crc;
+    };
+
+    class BinaryReader
+    {
+        public:
+
+            BinaryReader(
+                    _In_ std::istream& is):
+                m_is(is),
+                m_crc(0)
+            {
+                SWSS_LOG_ENTER();
+
+                // empty
+            }
+
+            void read(
+                    _Out_ void* data,
+                    _In_ size_t size)
+            {
+                SWSS_LOG_ENTER();
+
+                if (!m_is.read((char*)data, (std::streamsize)size))
+                {
+                    SWSS_LOG_THROW("unexpected end of warm boot file");
+                }
+
+                m_crc = WarmBootSnapshot::crc32(m_crc, data, size);
+            }
+
+            template <typename T>
+            T readNumber()
+            {
+                SWSS_LOG_ENTER();
+
+                T value;
+
+                read(&value, sizeof(value));
+
+                return value;
+            }
+
+            void readString(
+                    _Out_ std::string& s)
+            {
+                SWSS_LOG_ENTER();
+
+                uint32_t size = readNumber<uint32_t>();
+
+                if (size > WARM_BOOT_MAX_STRING_SIZE)
+                {
+                    SWSS_LOG_THROW("string size %u exceeds limit", size);
+                }
+
+                s.resize(size);
+
+                read(&s[0], size);
+            }
+
+            uint32_t getCrc() const
+            {
+                SWSS_LOG_ENTER();
+
+                return m_crc;
+            }
+
+        private:
+
+            std::istream& m_is;
+
+            uint32_t m_crc;
+    };
+}
+
+bool WarmBootSnapshot::parseFormat(
+        _In_ const char* formatStr,
+        _Out_ sai_vs_warm_boot_format_t& format)
+{
+    SWSS_LOG_ENTER();
+
+    std::string str = (formatStr == NULL) ? "binary" : formatStr;
+
+    if (str == "binary")
+    {
+        format = SAI_VS_WARM_BOOT_FORMAT_BINARY;
+    }
+    else if (str == "text")
+    {
+        format = SAI_VS_WARM_BOOT_FORMAT_TEXT;
+    }
+    else
+    {
+        SWSS_LOG_ERROR("unknown warm boot format: %s, expected binary|text", str.c_str());
+
+        return false;
+    }
+
+    return true;
+}
+
+void WarmBootSnapshot::writeText(
+        _In_ std::ostream& os,
+        _In_ const WarmBootState& state)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto& kvp: state.m_objectHash)
+    {
+        auto strObjectType = sai_serialize_object_type(kvp.first);
+
+        for (const auto& o: kvp.second)
+        {
+            // if object don't have attributes, size can be zero
+            if (o.second.size() == 0)
+            {
+                os << strObjectType << " " << o.first << " NULL NULL\n";
+                continue;
+            }
+
+            for (const auto& a: o.second)
+            {
+                os << strObjectType << " " << o.first << " " << a.first << " " << a.second->getAttrStrValue() << "\n";
+            }
+        }
+    }
+
+    for (const auto& fi: state.m_fdbInfoSet)
+    {
+        os << SAI_VS_FDB_INFO << " " << fi.serialize() << "\n";
+    }
+}
+
+void WarmBootSnapshot::writeBinary(
+        _In_ std::ostream& os,
+        _In_ const std::map<sai_object_id_t, std::shared_ptr<WarmBootState>>& states)
+{
+    SWSS_LOG_ENTER();
+
+    BinaryWriter writer(os);
+
+    writer.write(WARM_BOOT_BINARY_MAGIC, sizeof(WARM_BOOT_BINARY_MAGIC));
+
+    writer.writeNumber((uint32_t)WARM_BOOT_BINARY_VERSION);
+
+    uint64_t records = 0;
+
+    for (const auto& kvp: states)
+    {
+        const auto& state = *kvp.second;
+
+        writer.writeNumber((uint8_t)WARM_BOOT_RECORD_SWITCH);
+        writer.writeNumber((uint64_t)state.m_switchId);
+
+        records++;
+
+        for (const auto& ot: state.m_objectHash)
+        {
+            for (const auto& o: ot.second)
+            {
+                writer.writeNumber((uint8_t)WARM_BOOT_RECORD_OBJECT);
+                writer.writeNumber((uint32_t)ot.first);
+                writer.writeString(o.first);
+                writer.writeNumber((uint32_t)o.second.size());
+
+                for (const auto& a: o.second)
+                {
+                    writer.writeString(a.first);
+                    writer.writeString(a.second->getAttrStrValue());
+                }
+
+                records++;
+            }
+        }
+
+        for (const auto& fi: state.m_fdbInfoSet)
+        {
+            writer.writeNumber((uint8_t)WARM_BOOT_RECORD_FDB_INFO);
+            writer.writeString(fi.serialize());
+
+            records++;
+        }
+    }
+
+    writer.writeNumber((uint8_t)WARM_BOOT_RECORD_END);
+    writer.writeNumber(records);
+
+    uint32_t crc = writer.getCrc();
+
+    os.write((const char*)&crc, sizeof(crc));
+}
+
+bool WarmBootSnapshot::isBinary(
+        _In_ std::istream& is)
+{
+    SWSS_LOG_ENTER();
+
+    char magic[sizeof(WARM_BOOT_BINARY_MAGIC)];
+
+    auto pos = is.tellg();
+
+    bool binary = is.read(magic, sizeof(magic)) && memcmp(magic, WARM_BOOT_BINARY_MAGIC, sizeof(magic)) == 0;
+
+    is.clear();
+    is.seekg(pos);
+
+    return binary;
+}
+
+bool WarmBootSnapshot::readBinary(
+        _In_ std::istream& is,
+        _Out_ std::map<sai_object_id_t, WarmBootState>& states)
+{
+    SWSS_LOG_ENTER();
+
+    states.clear();
+
+    BinaryReader reader(is);
+
+    try
+    {
+        char magic[sizeof(WARM_BOOT_BINARY_MAGIC)];
+
+        reader.read(magic, sizeof(magic));
+
+        if (memcmp(magic, WARM_BOOT_BINARY_MAGIC, sizeof(magic)) != 0)
+        {
+            SWSS_LOG_THROW("invalid warm boot file magic");
+        }
+
+        uint32_t version = reader.readNumber<uint32_t>();
+
+        if (version != WARM_BOOT_BINARY_VERSION)
+        {
+            SWSS_LOG_THROW("unsupported warm boot file version %u", version);
+        }
+
+        WarmBootState* state = nullptr;
+
+        uint64_t records = 0;
+
+        std::string objectId;
+        std::string attrId;
+        std::string attrValue;
+
+        while (true)
+        {
+            uint8_t type = reader.readNumber<uint8_t>();
+
+            if (type == WARM_BOOT_RECORD_END)
+            {
+                break;
+            }
+
+            records++;
+
+            if (type == WARM_BOOT_RECORD_SWITCH)
+            {
+                sai_object_id_t switchId = reader.readNumber<uint64_t>();
+
+                state = &states[switchId];
+
+                state->m_switchId = switchId;
+
+                continue;
+            }
+
+            if (state == nullptr)
+            {
+                SWSS_LOG_THROW("record %c before switch record", type);
+            }
+
+            if (type == WARM_BOOT_RECORD_FDB_INFO)
+            {
+                std::string fdbInfo;
+
+                reader.readString(fdbInfo);
+
+                state->m_fdbInfoSet.insert(FdbInfo::deserialize(fdbInfo));
+
+                continue;
+            }
+
+            if (type != WARM_BOOT_RECORD_OBJECT)
+            {
+                SWSS_LOG_THROW("unknown record type 0x%x", type);
+            }
+
+            sai_object_type_t objectType = (sai_object_type_t)reader.readNumber<uint32_t>();
+
+            if (!sai_metadata_is_object_type_valid(objectType))
+            {
+                SWSS_LOG_THROW("invalid object type %d", objectType);
+            }
+
+            reader.readString(objectId);
+
+            uint32_t attrCount = reader.readNumber<uint32_t>();
+
+            auto& objectHash = state->m_objectHash[objectType];
+
+            // records are written in map order, so hint at the end is exact
+
+            auto it = objectHash.emplace_hint(objectHash.end(), objectId, SwitchState::AttrHash());
+
+            auto& attrHash = it->second;
+
+            for (uint32_t idx = 0; idx < attrCount; idx++)
+            {
+                reader.readString(attrId);
+                reader.readString(attrValue);
+
+                attrHash.emplace_hint(attrHash.end(), attrId, std::make_shared<SaiAttrWrap>(attrId, attrValue));
+            }
+        }
+
+        uint64_t expectedRecords = reader.readNumber<uint64_t>();
+
+        uint32_t crc = reader.getCrc();
+
+        uint32_t expectedCrc;
+
+        if (!is.read((char*)&expectedCrc, sizeof(expectedCrc)))
+        {
+            SWSS_LOG_THROW("unexpected end of warm boot file");
+        }
+
+        if (expectedRecords != records)
+        {
+            SWSS_LOG_THROW("expected %" PRIu64 " records, but read %" PRIu64, expectedRecords, records);
+        }
+
+        if (expectedCrc != crc)
+        {
+            SWSS_LOG_THROW("checksum mismatch 0x%08x, expected 0x%08x", crc, expectedCrc);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to load binary warm boot snapshot: %s", e.what());
+
+        states.clear();
+
+        return false;
+    }
+
+    return true;
+}
+
+uint32_t WarmBootSnapshot::crc32(
+        _In_ uint32_t crc,
+        _In_ const void* data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    static const std::array<uint32_t, 256> table = []() {
+
+        std::array<uint32_t, 256> t;
+
+        for (uint32_t idx = 0; idx < 256; idx++)
+        {
+            uint32_t c = idx;
+
+            for (int bit = 0; bit < 8; bit++)
+            {
+                c = (c & 1) ? (0xEDB88320U ^ (c >> 1)) : (c >> 1);
+            }
+
+            t[idx] = c;
+        }
+
+        return t;
+    }();
+
+    auto ptr = (const uint8_t*)data;
+
+    crc = ~crc;
+
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        crc = table[(crc ^ ptr[idx]) & 0xFF] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
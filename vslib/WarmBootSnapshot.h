@@ -0,0 +1,83 @@
+#pragma once
+
+#include "WarmBootState.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <ostream>
+#include <istream>
+
+namespace saivs
+{
+    typedef enum _sai_vs_warm_boot_format_t
+    {
+        SAI_VS_WARM_BOOT_FORMAT_BINARY,
+
+        SAI_VS_WARM_BOOT_FORMAT_TEXT,
+
+    } sai_vs_warm_boot_format_t;
+
+    /**
+     * @brief Warm boot snapshot of virtual switch database.
+     *
+     * Text format has one line per attribute:
+     * OBJECT_TYPE OBJECT_ID ATTR_ID ATTR_VALUE
+     *
+     * Binary format starts with magic and version, followed by records:
+     * switch, object with all its attributes and FDB info. Strings are
+     * length prefixed and numbers are in host byte order. Last record
+     * contains number of records and CRC32 of all preceding bytes, so
+     * truncated or corrupted file is detected on load. Objects are written
+     * in object hash order, so on load they are inserted at the end of
+     * maps without searching.
+     *
+     * Both formats are written record by record to the stream, so whole
+     * database is never formatted in memory.
+     */
+    class WarmBootSnapshot
+    {
+        public:
+
+            WarmBootSnapshot() = delete;
+
+            ~WarmBootSnapshot() = delete;
+
+        public:
+
+            static bool parseFormat(
+                    _In_ const char* formatStr,
+                    _Out_ sai_vs_warm_boot_format_t& format);
+
+            static void writeText(
+                    _In_ std::ostream& os,
+                    _In_ const WarmBootState& state);
+
+            static void writeBinary(
+                    _In_ std::ostream& os,
+                    _In_ const std::map<sai_object_id_t, std::shared_ptr<WarmBootState>>& states);
+
+            /**
+             * @brief Check if stream starts with binary snapshot magic.
+             *
+             * Stream position is restored.
+             */
+            static bool isBinary(
+                    _In_ std::istream& is);
+
+            /**
+             * @brief Load binary snapshot.
+             *
+             * On any error, like checksum mismatch, false is returned and
+             * states are cleared.
+             */
+            static bool readBinary(
+                    _In_ std::istream& is,
+                    _Out_ std::map<sai_object_id_t, WarmBootState>& states);
+
+            static uint32_t crc32(
+                    _In_ uint32_t crc,
+                    _In_ const void* data,
+                    _In_ size_t size);
+    };
+}
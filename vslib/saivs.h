@@ -33,6 +33,21 @@ extern "C" {
  */
 #define SAI_KEY_VS_RESOURCE_LIMITER_FILE    "SAI_VS_RESOURCE_LIMITER_FILE"
 
+/**
+ * @def SAI_KEY_VS_COUNTER_GENERATOR_FILE
+ *
+ * File with synthetic counter rates per second. Counters with rate grow
+ * monotonically with time, read and clear resets them to zero. Rate is set
+ * for all objects of given object type, or for single object when object id
+ * is given, object rate takes precedence. Switch index prefix is optional.
+ *
+ * Example:
+ * SAI_OBJECT_TYPE_PORT:SAI_PORT_STAT_IF_IN_OCTETS=1250000000
+ * SAI_OBJECT_TYPE_PORT:oid:0x1000000000002:SAI_PORT_STAT_IF_IN_OCTETS=0
+ * 1:SAI_OBJECT_TYPE_QUEUE:SAI_QUEUE_STAT_PACKETS=1000
+ */
+#define SAI_KEY_VS_COUNTER_GENERATOR_FILE   "SAI_VS_COUNTER_GENERATOR_FILE"
+
 /**
  * @def SAI_KEY_VS_INTERFACE_FABRIC_LANE_MAP_FILE
  *
@@ -86,6 +101,17 @@ extern "C" {
  */
 #define SAI_KEY_VS_GLOBAL_CONTEXT             "SAI_VS_GLOBAL_CONTEXT"
 
+/**
+ * @def SAI_KEY_VS_WARM_BOOT_FORMAT
+ *
+ * Format of file written to SAI_KEY_WARM_BOOT_WRITE_FILE, "binary" or
+ * "text". Binary format is streamed and has checksum, text format is one
+ * line per attribute. On warm boot both formats are detected and loaded.
+ *
+ * By default binary format is used.
+ */
+#define SAI_KEY_VS_WARM_BOOT_FORMAT           "SAI_VS_WARM_BOOT_FORMAT"
+
 #define SAI_VALUE_VS_SWITCH_TYPE_BCM56850     "SAI_VS_SWITCH_TYPE_BCM56850"
 #define SAI_VALUE_VS_SWITCH_TYPE_BCM56971B0   "SAI_VS_SWITCH_TYPE_BCM56971B0"
 #define SAI_VALUE_VS_SWITCH_TYPE_BCM81724     "SAI_VS_SWITCH_TYPE_BCM81724"